@@ -0,0 +1,351 @@
+/*
+  ==============================================================================
+
+    SubdominantCore.cpp
+    Created: 19 Oct 2026 11:18:40pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "../../Source/Engine.h"
+#include "../../Source/NoiseGate.h"
+#include "SubdominantCore.h"
+
+/*
+ * one voice of the plugin's processBlock(): the same grid, the same order of engine, dry sum and gate,
+ * and the same arithmetic, so with the same parameters and flags a render matches the plugin's at full
+ * rate with no cab loaded
+ */
+struct sd_engine
+{
+public:
+    typedef SubdominantEngine::DSPState_t DSPState_t;
+
+    static constexpr int blockChunk = SubdominantEngine::blockChunk;
+
+    void prepare(const double newSampleRate, const int newFlags)
+    {
+        sampleRate = newSampleRate;
+        flags = newFlags;
+
+        engine.prepare(sampleRate, 0, (flags & SD_DETERMINISTIC) != 0);
+
+        /* the plugin's 5ms lookahead, rounded the way it rounds it */
+        const int maxLookahead = (int) std::nearbyint(sampleRate * 0.005);
+
+        gate.prepare(sampleRate, maxLookahead);
+        gate.setLookahead((flags & SD_GATE_LOOKAHEAD) != 0 ? maxLookahead : 0);
+
+        for (int i = 0; i < Params::numParams; i++)
+            params[i] = Params::ranges[i].def;
+
+        reset();
+    }
+
+    void reset()
+    {
+        gate.reset();
+
+        engine.resetState(&state);
+        state.upsampler.prepare(0);
+
+        applyParams(true);
+
+        gridPos = 0;
+        wasPlaying = false;
+    }
+
+    int getLatency() const
+    {
+        return (flags & SD_GATE_LOOKAHEAD) != 0 ? (int) std::nearbyint(sampleRate * 0.005) : 0;
+    }
+
+    void process(const float* const* in, float* const* out, const int numChannels, const int numSamples)
+    {
+        const bool portable = (flags & SD_DETERMINISTIC) != 0;
+
+        /* deterministic mode only locks the phase when the transport starts, same as the plugin */
+        const bool lockPhase = playing && !(portable && wasPlaying);
+        wasPlaying = playing;
+
+        if (lockPhase) engine.lockLfoPhase(&state, bpm, ppq);
+
+        for (int pos = 0; pos < numSamples;)
+        {
+            const int chunk = std::min(blockChunk - gridPos, numSamples - pos);
+
+            /* parameters and the LFO speed only move on grid lines, wherever the calls are cut */
+            if (gridPos == 0)
+            {
+                if (std::memcmp(params, applied, sizeof(params)) != 0) applyParams(Params::gateChanged(params, applied));
+
+                engine.updateLfo(&state, bpm);
+            }
+
+            /* copied first, in and out can be the same buffers */
+            std::copy(in[0] + pos, in[0] + pos + chunk, buf.in[0]);
+            SubdominantEngine::sanitizeInput(buf.in[0], chunk);
+
+            const float* inL = buf.in[0];
+            const float* inR = inL;
+
+            if (numChannels > 1)
+            {
+                std::copy(in[1] + pos, in[1] + pos + chunk, buf.in[1]);
+                SubdominantEngine::sanitizeInput(buf.in[1], chunk);
+
+                inR = buf.in[1];
+            }
+
+            engine.renderChunk(&state, inL, inR, chunk, inL, inR, buf.out[0], buf.out[1], buf.dryOut[0], buf.dryOut[1], chunk);
+
+            for (int i = 0; i < chunk; i++)
+            {
+                buf.out[0][i] += buf.dryOut[0][i];
+                buf.out[1][i] += buf.dryOut[1][i];
+            }
+
+            gate.processBlock(inL, inR, buf.out[0], buf.out[1], chunk);
+
+            if (numChannels > 1)
+            {
+                std::copy(buf.out[0], buf.out[0] + chunk, out[0] + pos);
+                std::copy(buf.out[1], buf.out[1] + chunk, out[1] + pos);
+            }
+            else
+            {
+                for (int i = 0; i < chunk; i++)
+                    out[0][pos + i] = (buf.out[0][i] + buf.out[1][i]) * 0.5f;
+            }
+
+            gridPos = (gridPos + chunk) % blockChunk;
+            pos += chunk;
+
+            if (gridPos == 0)
+            {
+                engine.flushDenormals(&state);
+                gate.flushDenormals();
+            }
+        }
+
+        /* a host moves the playhead on by itself, here it moves with the samples until it's set again */
+        if (playing && bpm > 0.0) ppq += numSamples * bpm / (60.0 * sampleRate);
+    }
+
+    float params[Params::numParams];
+    double bpm = 0.0, ppq = 0.0;
+    bool playing = false;
+
+private:
+    void applyParams(const bool setupGate)
+    {
+        engine.applyParams(&state, params);
+
+        if (setupGate)
+            gate.setup(params[Params::gateThreshold], params[Params::gateHysteresis],
+                       params[Params::gateAttack], params[Params::gateRelease], (flags & SD_DETERMINISTIC) != 0);
+
+        std::copy(params, params + Params::numParams, applied);
+    }
+
+    typedef struct BlockBuffers_t
+    {
+    public:
+
+        float in[2][blockChunk], out[2][blockChunk], dryOut[2][blockChunk];
+
+    } BlockBuffers_t;
+
+    DSPState_t state;
+    SubdominantEngine engine;
+    NoiseGate gate;
+
+    alignas(SubdominantEngine::cacheLine) BlockBuffers_t buf;
+
+    float applied[Params::numParams];
+
+    double sampleRate = 0.0;
+    int flags = 0;
+    int gridPos = 0;
+    bool wasPlaying = false;
+};
+
+static bool isValidParam(const int index)
+{
+    return index >= 0 && index < Params::numParams;
+}
+
+static bool isValidStream(const sd_engine* engine, const float* const* in, float* const* out, const int numChannels,
+                          const int numSamples)
+{
+    if (engine == nullptr || in == nullptr || out == nullptr || numSamples < 0) return false;
+    if (numChannels != 1 && numChannels != 2) return false;
+
+    for (int ch = 0; ch < numChannels; ch++)
+        if (in[ch] == nullptr || out[ch] == nullptr) return false;
+
+    return true;
+}
+
+int sd_version(void)
+{
+    return SD_VERSION;
+}
+
+sd_engine* sd_create(const double sampleRate, const int flags)
+{
+    if (!(sampleRate > 0.0)) return nullptr;
+
+    /* nothing can be allowed to throw across the C boundary, running out of memory is a NULL here */
+    try
+    {
+        sd_engine* engine = new sd_engine();
+
+        engine->prepare(sampleRate, flags);
+
+        return engine;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void sd_destroy(sd_engine* engine)
+{
+    delete engine;
+}
+
+void sd_reset(sd_engine* engine)
+{
+    if (engine != nullptr) engine->reset();
+}
+
+int sd_get_latency(const sd_engine* engine)
+{
+    return engine != nullptr ? engine->getLatency() : 0;
+}
+
+int sd_num_params(void)
+{
+    return Params::numParams;
+}
+
+const char* sd_param_id(const int index)
+{
+    return isValidParam(index) ? Params::ids[index] : nullptr;
+}
+
+int sd_param_index(const char* id)
+{
+    if (id == nullptr) return -1;
+
+    for (int i = 0; i < Params::numParams; i++)
+        if (std::strcmp(Params::ids[i], id) == 0) return i;
+
+    return -1;
+}
+
+float sd_param_min(const int index)
+{
+    return isValidParam(index) ? Params::ranges[index].min : 0.f;
+}
+
+float sd_param_max(const int index)
+{
+    return isValidParam(index) ? Params::ranges[index].max : 0.f;
+}
+
+float sd_param_default(const int index)
+{
+    return isValidParam(index) ? Params::ranges[index].def : 0.f;
+}
+
+int sd_set_param(sd_engine* engine, const int index, const float value)
+{
+    if (engine == nullptr || !isValidParam(index)) return 0;
+
+    /* a NaN fails both comparisons in clamp and would go straight through, it gets the default instead */
+    engine->params[index] = value == value ? std::clamp(value, Params::ranges[index].min, Params::ranges[index].max)
+                                           : Params::ranges[index].def;
+
+    return 1;
+}
+
+float sd_get_param(const sd_engine* engine, const int index)
+{
+    return engine != nullptr && isValidParam(index) ? engine->params[index] : 0.f;
+}
+
+void sd_set_transport(sd_engine* engine, const double bpm, const double ppqPosition, const int isPlaying)
+{
+    if (engine == nullptr) return;
+
+    engine->bpm = bpm;
+    engine->ppq = ppqPosition;
+    engine->playing = isPlaying != 0;
+}
+
+int sd_process(sd_engine* engine, const float* const* in, float* const* out, const int numChannels, const int numSamples)
+{
+    if (!isValidStream(engine, in, out, numChannels, numSamples)) return 0;
+
+    engine->process(in, out, numChannels, numSamples);
+
+    return 1;
+}
+
+int sd_process_batch(const sd_stream* streams, const int numStreams, const int numThreads)
+{
+    if (streams == nullptr || numStreams <= 0) return 0;
+
+    std::atomic<int> next { 0 }, done { 0 };
+
+    /* streams are handed out one at a time, a long file doesn't hold up a thread's whole share */
+    auto worker = [&]()
+    {
+        for (int i = next.fetch_add(1); i < numStreams; i = next.fetch_add(1))
+        {
+            const sd_stream& s = streams[i];
+
+            if (sd_process(s.engine, s.in, s.out, s.numChannels, s.numSamples) != 0)
+                done.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    const int threadCount = std::min(numThreads, numStreams);
+
+    if (threadCount <= 1)
+    {
+        worker();
+
+        return done.load();
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve((size_t) threadCount - 1);
+
+    /* the calling thread is one of the workers, if the system won't start any more it just does a bigger share */
+    try
+    {
+        for (int t = 1; t < threadCount; t++)
+            threads.emplace_back(worker);
+    }
+    catch (const std::system_error&)
+    {
+    }
+
+    worker();
+
+    for (std::thread& t : threads)
+        t.join();
+
+    return done.load();
+}
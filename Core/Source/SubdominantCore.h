@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+
+    SubdominantCore.h
+    Created: 19 Oct 2026 11:18:40pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+/*
+ * plain C interface to the SubDominant engine, no JUCE anywhere: the same render path as the plugin
+ * (Source/Engine.h) and the noise gate after it, without the cab, the program bank or decimated mode.
+ * parameters are plain values as the plugin shows them, by index (sd_param_index() finds one by
+ * the plugin's ID), and changes land on the same 32 sample grid the plugin uses, counted from
+ * sd_create()/sd_reset(). with the same calls at the same sample positions a render comes out the
+ * same whatever buffer sizes it's cut into. the one exception is a synced LFO with the transport
+ * playing and no SD_DETERMINISTIC: that locks to the beat position on every sd_process() call, as
+ * the plugin does on every host block.
+ *
+ * one sd_engine is one stereo stream. nothing is shared between them but read-only coefficient
+ * tables, so different engines can run on different threads at the same time, a single engine is
+ * only ever to be used from one thread at a time. sd_process() doesn't allocate or lock
+ */
+
+#include <stddef.h>
+
+/* Core.jucer builds the shared library, Static/CoreStatic.jucer the static one, define SD_STATIC when linking that */
+#if defined(SD_STATIC)
+ #define SD_API
+#elif defined(_WIN32)
+ #if defined(SD_BUILDING)
+  #define SD_API __declspec(dllexport)
+ #else
+  #define SD_API __declspec(dllimport)
+ #endif
+#else
+ #define SD_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SD_VERSION 1
+
+/* sd_create() flags */
+#define SD_DETERMINISTIC    1   /* PortableMath coefficients and LFO locking, see the plugin's Deterministic Render */
+#define SD_GATE_LOOKAHEAD   2   /* 5ms gate lookahead, delays the output by sd_get_latency() samples */
+
+typedef struct sd_engine sd_engine;
+
+/* one stream of a batch, in and out are planar, numChannels 1 or 2 */
+typedef struct sd_stream
+{
+    sd_engine* engine;
+    const float* const* in;
+    float* const* out;
+    int numChannels;
+    int numSamples;
+
+} sd_stream;
+
+SD_API int sd_version(void);
+
+/* NULL on a sample rate <= 0 or out of memory. all parameters start at their defaults */
+SD_API sd_engine* sd_create(double sampleRate, int flags);
+SD_API void sd_destroy(sd_engine* engine);
+
+/* back to the state right after sd_create(), the parameters are kept */
+SD_API void sd_reset(sd_engine* engine);
+
+SD_API int sd_get_latency(const sd_engine* engine);
+
+SD_API int sd_num_params(void);
+SD_API const char* sd_param_id(int index);
+SD_API int sd_param_index(const char* id);          /* -1 if there's no such parameter */
+SD_API float sd_param_min(int index);
+SD_API float sd_param_max(int index);
+SD_API float sd_param_default(int index);
+
+/* clamped to the parameter's range, returns 0 on a bad index */
+SD_API int sd_set_param(sd_engine* engine, int index, float value);
+SD_API float sd_get_param(const sd_engine* engine, int index);
+
+/*
+ * transport for the tempo synced LFO, bpm <= 0 runs it free at LFO RATE. while playing, the position
+ * moves on with every sd_process() call, it only needs setting again on a jump
+ */
+SD_API void sd_set_transport(sd_engine* engine, double bpm, double ppqPosition, int isPlaying);
+
+/*
+ * planar buffers of any length, numChannels 1 or 2 (mono goes through as a stereo pair and is
+ * summed back). in and out may be the same buffers. returns 0 on bad arguments
+ */
+SD_API int sd_process(sd_engine* engine, const float* const* in, float* const* out, int numChannels, int numSamples);
+
+/*
+ * many independent streams in one call, each engine at most once per batch. numThreads <= 1 runs
+ * them one after the other on the calling thread, more spreads them over that many threads started
+ * for the call, which is for offline pipelines, not for an audio callback. returns the number of
+ * streams processed
+ */
+SD_API int sd_process_batch(const sd_stream* streams, int numStreams, int numThreads);
+
+#ifdef __cplusplus
+}
+#endif
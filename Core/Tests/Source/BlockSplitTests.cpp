@@ -0,0 +1,163 @@
+/*
+  ==============================================================================
+
+    BlockSplitTests.cpp
+    Created: 20 Oct 2026 10:31:47am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Tests.h"
+
+/*
+ * the same input and the same automation at the same sample positions has to come out bit identical
+ * however the calls are cut: one call, host sized blocks, the 32 sample grid, single samples and a
+ * random mix of sizes with empty calls thrown in
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 48000 * 2;
+
+    std::vector<std::vector<float>> makeStereo()
+    {
+        return { Tests::makeInput(sampleRate, numSamples, 1.f), Tests::makeInput(sampleRate, numSamples, 1.003f) };
+    }
+
+    /* a bit of everything, moves landing on and off the grid */
+    std::vector<Tests::Event_t> makeAutomation()
+    {
+        return { { 0, Params::lfoFilterDepth, 0.7f }, { 0, Params::lfoGlitchDepth, -0.4f },
+                 { 0, Params::sub3Volume, 0.6f }, { 0, Params::gateThreshold, -60.f },
+                 { 5003, Params::gainAmount, 0.9f }, { 9600, Params::bandMode, 2.f },
+                 { 16384, Params::lfoRate, 15.f }, { 20011, Params::filterAmount, 0.3f },
+                 { 31999, Params::envGlitchDepth, 0.8f }, { 40000, Params::lfoRate, 0.2f },
+                 { 52800, Params::gateRelease, 400.f }, { 61441, Params::fuzzLow, 1.f },
+                 { 70000, Params::lfoRate, 7.5f }, { 88001, Params::masterVolume, 0.8f } };
+    }
+
+    /* the tempo synced LFO, the transport starts a second in */
+    std::vector<Tests::Event_t> makeSyncedAutomation()
+    {
+        return { { 0, Params::lfoFilterDepth, 1.f }, { 0, Params::lfoSync, 5.f },
+                 { 48000, Tests::transportPlay, 128.f }, { 70000, Params::lfoSync, 3.f } };
+    }
+
+    std::function<int()> fixed(const int size)
+    {
+        return [size]() { return size; };
+    }
+
+    std::function<int()> randomSizes(const uint32_t seed)
+    {
+        auto random = std::make_shared<Tests::Random_t>();
+        random->state = seed;
+
+        return [random]()
+        {
+            const int pick = random->nextInt(8);
+
+            /* mostly small and odd, empty and single sample calls included */
+            return pick == 0 ? 0 : pick == 1 ? 1 : random->nextInt(pick < 6 ? 100 : 3000);
+        };
+    }
+
+    void expectSameInAnySplit(const int flags, const std::vector<std::vector<float>>& in, const std::vector<Tests::Event_t>& events)
+    {
+        const std::vector<std::vector<float>> whole = Tests::render(sampleRate, flags, in, events, fixed(numSamples));
+
+        const std::function<int()> splits[] = { fixed(4096), fixed(511), fixed(32), fixed(1), randomSizes(1), randomSizes(77) };
+
+        for (const std::function<int()>& split : splits)
+        {
+            const std::vector<std::vector<float>> out = Tests::render(sampleRate, flags, in, events, split);
+
+            for (size_t ch = 0; ch < in.size(); ch++)
+            {
+                int first = -1;
+                const int differences = Tests::countDifferences(whole[ch], out[ch], &first);
+
+                if (differences != 0) std::printf("    flags %d channel %d: %d samples differ from %d on\n", flags, (int) ch, differences, first);
+
+                SD_EXPECT(differences == 0);
+            }
+        }
+    }
+}
+
+SD_TEST(blockSplitDefault)
+{
+    expectSameInAnySplit(0, makeStereo(), makeAutomation());
+}
+
+SD_TEST(blockSplitDeterministic)
+{
+    expectSameInAnySplit(SD_DETERMINISTIC, makeStereo(), makeAutomation());
+}
+
+SD_TEST(blockSplitLookahead)
+{
+    expectSameInAnySplit(SD_GATE_LOOKAHEAD, makeStereo(), makeAutomation());
+}
+
+SD_TEST(blockSplitMono)
+{
+    expectSameInAnySplit(SD_DETERMINISTIC | SD_GATE_LOOKAHEAD, { makeStereo()[0] }, makeAutomation());
+}
+
+/* without SD_DETERMINISTIC a synced LFO locks on every call, see SubdominantCore.h */
+SD_TEST(blockSplitSyncedDeterministic)
+{
+    expectSameInAnySplit(SD_DETERMINISTIC, makeStereo(), makeSyncedAutomation());
+}
+
+/* a batch has to render each stream exactly as sd_process() would on its own */
+SD_TEST(batchMatchesSequential)
+{
+    constexpr int numStreams = 5, blockSize = 256;
+
+    std::vector<std::vector<std::vector<float>>> in, expected, out;
+    std::vector<sd_engine*> engines;
+
+    for (int i = 0; i < numStreams; i++)
+    {
+        in.push_back({ Tests::makeInput(sampleRate, numSamples, 1.f + 0.01f * i), Tests::makeInput(sampleRate, numSamples, 0.99f) });
+
+        std::vector<Tests::Event_t> events = { { 0, Params::gainAmount, 0.2f * i } };
+        expected.push_back(Tests::render(sampleRate, 0, in.back(), events, fixed(blockSize)));
+
+        out.push_back(in.back());
+        engines.push_back(sd_create(sampleRate, 0));
+        sd_set_param(engines.back(), Params::gainAmount, 0.2f * i);
+    }
+
+    for (int pos = 0; pos < numSamples; pos += blockSize)
+    {
+        const int n = std::min(blockSize, numSamples - pos);
+
+        const float* inPtrs[numStreams][2];
+        float* outPtrs[numStreams][2];
+        sd_stream streams[numStreams];
+
+        for (int i = 0; i < numStreams; i++)
+        {
+            inPtrs[i][0] = in[(size_t) i][0].data() + pos;
+            inPtrs[i][1] = in[(size_t) i][1].data() + pos;
+            outPtrs[i][0] = out[(size_t) i][0].data() + pos;
+            outPtrs[i][1] = out[(size_t) i][1].data() + pos;
+
+            streams[i] = { engines[(size_t) i], inPtrs[i], outPtrs[i], 2, n };
+        }
+
+        SD_EXPECT(sd_process_batch(streams, numStreams, 3) == numStreams);
+    }
+
+    for (int i = 0; i < numStreams; i++)
+    {
+        SD_EXPECT(Tests::countDifferences(expected[(size_t) i][0], out[(size_t) i][0]) == 0);
+        SD_EXPECT(Tests::countDifferences(expected[(size_t) i][1], out[(size_t) i][1]) == 0);
+
+        sd_destroy(engines[(size_t) i]);
+    }
+}
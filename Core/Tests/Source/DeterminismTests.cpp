@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    DeterminismTests.cpp
+    Created: 20 Oct 2026 12:58:09pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <random>
+#include "Tests.h"
+#include "../../../Source/PortableMath.h"
+
+/*
+ * the deterministic render mode from both ends: PortableMath against the platform's libm, the
+ * libm and PortableMath renders against each other, and a checksum of a deterministic render that
+ * has to come out the same on every CPU, compiler and optimisation level
+ */
+namespace
+{
+    /* distance in representable doubles, both sides of zero included */
+    int64_t ulpDistance(const double a, const double b)
+    {
+        int64_t x, y;
+        std::memcpy(&x, &a, sizeof(x));
+        std::memcpy(&y, &b, sizeof(y));
+
+        x = x < 0 ? INT64_MIN - x : x;
+        y = y < 0 ? INT64_MIN - y : y;
+
+        return x > y ? x - y : y - x;
+    }
+
+    /* largest distance over a million arguments in [low, high], std::mt19937_64 is the same everywhere */
+    template <typename Portable, typename Libm>
+    int64_t maxUlps(const char* name, Portable portable, Libm libm, const double low, const double high)
+    {
+        std::mt19937_64 random(1);
+        int64_t worst = 0;
+
+        for (int i = 0; i < 1000000; i++)
+        {
+            const double x = low + (high - low) * ((double) (random() >> 11) / 9007199254740992.0);
+
+            worst = std::max(worst, ulpDistance(portable(x), libm(x)));
+        }
+
+        std::printf("    %s: %lld ulp\n", name, (long long) worst);
+
+        return worst;
+    }
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numSamples = 48000 * 3;
+
+    /* everything that goes through CoeffMath at least once: both filters swept, all band modes, the gate */
+    std::vector<Tests::Event_t> makeAutomation()
+    {
+        return { { 0, Params::envFilterDepth, 0.6f }, { 0, Params::lfoGlitchDepth, 0.5f }, { 0, Params::lfoRate, 3.3f },
+                 { 0, Params::sub2Volume, 0.8f }, { 0, Params::sub4Volume, 0.4f }, { 0, Params::gateThreshold, -70.f },
+                 { 24000, Params::bandMode, 1.f }, { 48000, Params::bandMode, 2.f }, { 48000, Params::lowCrossover, 180.f },
+                 { 72000, Params::gateAttack, 3.f }, { 96000, Params::filterAmount, 0.4f }, { 120000, Params::glitchAmount, 0.7f } };
+    }
+
+    std::vector<std::vector<float>> renderAutomation(const int flags)
+    {
+        const std::vector<std::vector<float>> in = { Tests::makeInput(sampleRate, numSamples, 1.f),
+                                                     Tests::makeInput(sampleRate, numSamples, 0.997f) };
+
+        return Tests::render(sampleRate, flags, in, makeAutomation(), []() { return 300; });
+    }
+}
+
+SD_TEST(portableMathMatchesLibm)
+{
+    namespace pm = PortableMath;
+
+    SD_EXPECT(maxUlps("exp", [](double x) { return pm::exp(x); }, [](double x) { return std::exp(x); }, -700.0, 700.0) <= 2);
+    SD_EXPECT(maxUlps("log", [](double x) { return pm::log(std::exp(x)); }, [](double x) { return std::log(std::exp(x)); }, -40.0, 40.0) <= 2);
+    SD_EXPECT(maxUlps("sin", [](double x) { return pm::sin(x); }, [](double x) { return std::sin(x); }, -400.0, 400.0) <= 2);
+    SD_EXPECT(maxUlps("cos", [](double x) { return pm::cos(x); }, [](double x) { return std::cos(x); }, -400.0, 400.0) <= 2);
+    SD_EXPECT(maxUlps("tan", [](double x) { return pm::tan(x); }, [](double x) { return std::tan(x); }, -400.0, 400.0) <= 4);
+
+    /* the two ways the engine uses pow: cutoff sweeps and dB to gain for the gate */
+    SD_EXPECT(maxUlps("pow cutoff", [](double x) { return pm::pow(20000. / 159., x); }, [](double x) { return std::pow(20000. / 159., x); },
+                      0.0, 1.0) <= 8);
+    SD_EXPECT(maxUlps("pow gate", [](double x) { return pm::pow(10.0, x); }, [](double x) { return std::pow(10.0, x); }, -5.5, 0.0) <= 24);
+}
+
+/*
+ * the two paths only differ in the last bits of the coefficients, so the renders may only differ
+ * by a rounding error's worth of level. the counters can still flip a sample early or late where
+ * the filtered input grazes zero, those show up as isolated full scale steps and are counted apart
+ */
+SD_TEST(libmAndPortableRendersAgree)
+{
+    const std::vector<std::vector<float>> fast = renderAutomation(0);
+    const std::vector<std::vector<float>> portable = renderAutomation(SD_DETERMINISTIC);
+
+    for (size_t ch = 0; ch < fast.size(); ch++)
+    {
+        int steps = 0;
+        float worst = 0.f;
+
+        for (size_t i = 0; i < fast[ch].size(); i++)
+        {
+            const float difference = std::abs(fast[ch][i] - portable[ch][i]);
+
+            if (difference > 1e-3f)
+                steps++;
+            else
+                worst = std::max(worst, difference);
+        }
+
+        std::printf("    channel %d: %d edge moves, otherwise within %g\n", (int) ch, steps, worst);
+
+        SD_EXPECT(steps < numSamples / 1000);
+        SD_EXPECT(worst < 1e-4f);
+    }
+}
+
+/*
+ * the render farm case: this is the sum the stems of this exact render come out with on any machine,
+ * at any optimisation level and vector width. a build that lets the compiler fuse multiply-adds
+ * (no -ffp-contract=off with FMA enabled) gets a different one. it has to be updated, on purpose,
+ * whenever the sound of the engine is changed on purpose
+ */
+SD_TEST(deterministicRenderChecksum)
+{
+    constexpr uint64_t expected = 0xed9d9a909edabbc2ull;
+
+    const uint64_t sum = Tests::checksum(renderAutomation(SD_DETERMINISTIC));
+    const uint64_t lookahead = Tests::checksum(renderAutomation(SD_DETERMINISTIC | SD_GATE_LOOKAHEAD));
+
+    std::printf("    checksum %016llx\n", (unsigned long long) sum);
+
+    SD_EXPECT(sum == expected);
+    SD_EXPECT(lookahead != sum);
+}
@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    LanesTests.cpp
+    Created: 22 Oct 2026 3:06:41pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Tests.h"
+#include "../../../Source/Crossover.h"
+#include "../../../Source/Halfband.h"
+
+/*
+ * the two kernels that run on FloatLanes, straight through without the engine around them. the
+ * lanes promise the same bits from SSE2, NEON and the plain loops, so the checksum is pinned
+ * and has to come out the same from a normal build and one made with SD_NO_SIMD (the Tests
+ * project's ScalarLanes configurations)
+ */
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int hostBlock = 256;
+    constexpr int numSamples = hostBlock * 192;
+
+    const char* lanesName()
+    {
+       #if SD_FLOAT_LANES_SSE2
+        return "SSE2";
+       #elif SD_FLOAT_LANES_NEON
+        return "NEON";
+       #else
+        return "plain loops";
+       #endif
+    }
+
+    /* all three bands, the middle one to the engine side so neither output is a plain copy */
+    std::vector<std::vector<float>> runCrossover(const std::vector<std::vector<float>>& in)
+    {
+        std::vector<std::vector<float>> out(4, std::vector<float>((size_t) numSamples, 0.f));
+        LinkwitzRileySplit split;
+
+        split.reset();
+        split.setup(sampleRate, 180.f, 2200.f, true);
+        split.process(in[0].data(), in[1].data(), out[0].data(), out[1].data(), out[2].data(), out[3].data(),
+                      numSamples, 3, LinkwitzRileySplit::midBand);
+
+        return out;
+    }
+
+    /* down through every stage and back up, a host block at a time like the engine does */
+    std::vector<std::vector<float>> runHalfbands(const std::vector<std::vector<float>>& in)
+    {
+        std::vector<std::vector<float>> out(2, std::vector<float>((size_t) numSamples, 0.f));
+        auto decimator = std::make_unique<HalfbandDecimatorChain>();
+        auto interpolator = std::make_unique<HalfbandInterpolatorChain<hostBlock>>();
+
+        decimator->prepare(Halfband::maxStages);
+        interpolator->prepare(Halfband::maxStages);
+
+        for (int pos = 0; pos < numSamples; pos += hostBlock)
+        {
+            float low[2][hostBlock];
+
+            const int numLow = decimator->process(in[0].data() + pos, in[1].data() + pos, low[0], low[1], hostBlock);
+            interpolator->process(low[0], low[1], numLow, out[0].data() + pos, out[1].data() + pos, hostBlock);
+        }
+
+        return out;
+    }
+}
+
+SD_TEST(floatLanesChecksum)
+{
+    constexpr uint64_t expectedCrossover = 0x852681c310d6c8a5ull;
+    constexpr uint64_t expectedHalfbands = 0xbdb454192ce350afull;
+
+    const std::vector<std::vector<float>> in = { Tests::makeInput(sampleRate, numSamples, 1.f),
+                                                 Tests::makeInput(sampleRate, numSamples, 0.997f) };
+
+    const uint64_t crossover = Tests::checksum(runCrossover(in));
+    const uint64_t halfbands = Tests::checksum(runHalfbands(in));
+
+    std::printf("    %s: crossover %016llx, halfbands %016llx\n", lanesName(),
+                (unsigned long long) crossover, (unsigned long long) halfbands);
+
+    SD_EXPECT(crossover == expectedCrossover);
+    SD_EXPECT(halfbands == expectedHalfbands);
+}
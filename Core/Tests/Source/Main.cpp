@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 10:12:05am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <cstdio>
+#include <cstring>
+#include "Tests.h"
+
+/*
+ *   Tests [name ...]
+ *
+ * runs every registered test, or only the ones named, and exits with the number of failed ones
+ */
+namespace
+{
+    typedef struct Test_t
+    {
+    public:
+
+        const char* name;
+        void (*run)();
+
+    } Test_t;
+
+    /* filled by static initialisers, so it has to exist before the first of them runs */
+    std::vector<Test_t>& getTests()
+    {
+        static std::vector<Test_t> tests;
+        return tests;
+    }
+
+    int failures = 0;
+}
+
+int Tests::add(const char* name, void (*run)())
+{
+    getTests().push_back({ name, run });
+    return (int) getTests().size();
+}
+
+void Tests::fail(const char* file, const int line, const char* what)
+{
+    std::printf("    %s:%d: expected %s\n", file, line, what);
+    failures++;
+}
+
+int main(int argc, char* argv[])
+{
+    int numRun = 0, numFailed = 0;
+
+    for (const Test_t& test : getTests())
+    {
+        bool selected = argc < 2;
+
+        for (int i = 1; i < argc; i++)
+            selected = selected || std::strcmp(argv[i], test.name) == 0;
+
+        if (!selected) continue;
+
+        const int failuresBefore = failures;
+
+        std::printf("%s\n", test.name);
+        test.run();
+
+        numRun++;
+
+        if (failures != failuresBefore) numFailed++;
+    }
+
+    std::printf("%d tests, %d failed\n", numRun, numFailed);
+
+    return numFailed;
+}
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    PortableFFTTests.cpp
+    Created: 20 Oct 2026 4:21:47pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Tests.h"
+#include "../../../Source/PortableFFT.h"
+
+/*
+ * the cab's deterministic FFT at the size the cab uses: right against a plain DFT in doubles, back
+ * to where it started through the inverse, and the same bits everywhere
+ */
+namespace
+{
+    constexpr int order = 8;
+    constexpr int size = 1 << order;
+
+    std::vector<float> makeBlock(const uint32_t seed)
+    {
+        Tests::Random_t random;
+        std::vector<float> data((size_t) size * 2, 0.f);
+
+        random.state = seed;
+
+        for (int i = 0; i < size; i++)
+            data[(size_t) i] = random.nextFloat() * 2.f - 1.f;
+
+        return data;
+    }
+}
+
+SD_TEST(portableFFTMatchesDFT)
+{
+    PortableFFT<order> fft;
+    std::vector<float> data = makeBlock(3);
+    const std::vector<float> input = data;
+
+    fft.performRealOnlyForwardTransform(data.data());
+
+    double worst = 0.0;
+
+    for (int k = 0; k <= size / 2; k++)
+    {
+        double re = 0.0, im = 0.0;
+
+        for (int n = 0; n < size; n++)
+        {
+            const double phase = 2.0 * 3.141592653589793 * k * n / size;
+
+            re += input[(size_t) n] * std::cos(phase);
+            im -= input[(size_t) n] * std::sin(phase);
+        }
+
+        worst = std::max(worst, std::max(std::abs(re - data[(size_t) (2 * k)]), std::abs(im - data[(size_t) (2 * k + 1)])));
+    }
+
+    std::printf("    worst bin error %g\n", worst);
+
+    /* float butterflies over 8 stages, bins of the order of sqrt(size) */
+    SD_EXPECT(worst < 1e-5);
+}
+
+SD_TEST(portableFFTRoundTrip)
+{
+    PortableFFT<order> fft;
+    std::vector<float> data = makeBlock(5);
+    const std::vector<float> input = data;
+
+    fft.performRealOnlyForwardTransform(data.data());
+    fft.performRealOnlyInverseTransform(data.data());
+
+    float worst = 0.f;
+
+    for (int i = 0; i < size; i++)
+        worst = std::max(worst, std::abs(data[(size_t) i] - input[(size_t) i]));
+
+    std::printf("    worst sample error %g\n", worst);
+
+    SD_EXPECT(worst < 1e-6f);
+}
+
+/* like the render checksum: the same at every optimisation level, only fused multiply-adds change it */
+SD_TEST(portableFFTChecksum)
+{
+    constexpr uint64_t expected = 0x94969a969e88d20eull;
+
+    PortableFFT<order> fft;
+    uint64_t hash = 14695981039346656037ull;
+
+    for (uint32_t seed = 1; seed <= 64; seed++)
+    {
+        std::vector<float> data = makeBlock(seed);
+
+        fft.performRealOnlyForwardTransform(data.data());
+        fft.performRealOnlyInverseTransform(data.data());
+
+        for (int i = 0; i < size; i++)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &data[(size_t) i], sizeof(bits));
+
+            hash = (hash ^ bits) * 1099511628211ull;
+        }
+    }
+
+    std::printf("    checksum %016llx\n", (unsigned long long) hash);
+
+    SD_EXPECT(hash == expected);
+}
@@ -0,0 +1,170 @@
+/*
+  ==============================================================================
+
+    PulseGenTests.cpp
+    Created: 20 Oct 2026 11:46:22am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Tests.h"
+#include "../../../Source/PulseGen.h"
+
+/*
+ * the divider chain against what it replaced: two single-stage dividers in a row, the second one
+ * clocked off the first one's output. taps 1 and 2 have to match the old SUB1/SUB2 sample for sample
+ */
+namespace
+{
+    /* the old single-stage PulseGen, as it was before the multi-tap one */
+    typedef struct CascadeStage_t
+    {
+    public:
+
+        void incPulseCounter(const float* samp)
+        {
+            if ((*samp >= 0) == (lastSamp >= 0) || (lastSamp == 0.f && *samp == 0.f))
+            {
+                lastSamp = *samp;
+                return;
+            }
+
+            counter ^= 1;
+
+            if (counter) state ^= 1;
+
+            lastSamp = *samp;
+        }
+
+        float generatePulseWave() const
+        {
+            return lastSamp != 0.f ? state ? 1.f : -1.f : 0.f;
+        }
+
+        int counter = 0;
+        int state = 1;
+
+        float lastSamp = 0.f;
+
+    } CascadeStage_t;
+
+    constexpr int numSamples = 200000;
+
+    /* a wobbling tone on a coarse grid, so it sits on exact zero a lot, sometimes for long runs */
+    std::vector<float> makeQuantisedInput()
+    {
+        Tests::Random_t random;
+        std::vector<float> input(numSamples);
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            const float tone = (float) std::sin(i * 0.013) * (float) std::sin(i * 0.0007);
+            input[(size_t) i] = std::round((tone + (random.nextFloat() - 0.5f) * 0.2f) * 4.f) * 0.25f;
+        }
+
+        return input;
+    }
+
+    std::vector<float> makeNonZeroInput()
+    {
+        std::vector<float> input = makeQuantisedInput();
+
+        for (float& x : input)
+            x = x != 0.f ? x : 0.125f;
+
+        return input;
+    }
+}
+
+SD_TEST(pulseGenMatchesCascade)
+{
+    const std::vector<float> input = makeQuantisedInput();
+
+    PulseGen divider;
+    CascadeStage_t sub1, sub2;
+
+    int zeros = 0, mismatches = 0;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        sub1.incPulseCounter(&input[(size_t) i]);
+
+        const float sub1Out = sub1.generatePulseWave();
+        sub2.incPulseCounter(&sub1Out);
+
+        divider.incPulseCounter(&input[(size_t) i]);
+
+        zeros += input[(size_t) i] == 0.f;
+        mismatches += divider.generatePulseWave(1) != sub1Out || divider.generatePulseWave(2) != sub2.generatePulseWave();
+    }
+
+    if (mismatches != 0) std::printf("    %d of %d samples differ\n", mismatches, numSamples);
+
+    SD_EXPECT(zeros > numSamples / 10);
+    SD_EXPECT(mismatches == 0);
+}
+
+/* the block path, cut into uneven pieces, against the per-sample one, and its taps where every piece ends */
+SD_TEST(pulseGenBlockMatchesPerSample)
+{
+    const std::vector<float> input = makeQuantisedInput();
+    const float tapGains[PulseGen::numStages] = { 1.f, 0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f };
+
+    PulseGen perSample, block;
+    Tests::Random_t random;
+
+    std::vector<float> out(numSamples);
+    int mismatches = 0;
+
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int n = std::min(random.nextInt(700), numSamples - pos);
+
+        block.processBlock(input.data() + pos, out.data() + pos, tapGains, PulseGen::numStages, n);
+
+        for (int i = pos; i < pos + n; i++)
+        {
+            perSample.incPulseCounter(&input[(size_t) i]);
+
+            float expected = 0.f;
+
+            for (int tap = 1; tap <= PulseGen::numStages; tap++)
+                expected += perSample.generatePulseWave(tap) * tapGains[tap - 1];
+
+            mismatches += out[(size_t) i] != expected;
+        }
+
+        /* what the plugin's scope reads after every sub-block */
+        for (int tap = 1; tap <= PulseGen::numStages && n > 0; tap++)
+            mismatches += block.generatePulseWave(tap) != perSample.generatePulseWave(tap);
+
+        pos += n;
+    }
+
+    SD_EXPECT(mismatches == 0);
+}
+
+/* with nothing sitting on zero the chain is a plain ripple counter, one count per zero crossing */
+SD_TEST(pulseGenIsRippleCounter)
+{
+    const std::vector<float> input = makeNonZeroInput();
+
+    PulseGen divider;
+    uint32_t counter = ~0u;
+    float last = 0.f;
+    int mismatches = 0;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        if ((input[(size_t) i] >= 0.f) != (last >= 0.f)) counter++;
+
+        last = input[(size_t) i];
+        divider.incPulseCounter(&input[(size_t) i]);
+
+        for (int tap = 1; tap <= PulseGen::numStages; tap++)
+            mismatches += divider.generatePulseWave(tap) != ((counter >> tap) & 1u ? 1.f : -1.f);
+    }
+
+    SD_EXPECT(mismatches == 0);
+}
@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    Tests.h
+    Created: 20 Oct 2026 10:12:05am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../../Source/SubdominantCore.h"
+#include "../../../Source/Params.h"
+
+/*
+ * the engine's tests, no JUCE and no framework: every file registers its tests with SD_TEST, Main.cpp
+ * runs them (or the ones named on the command line) and exits non-zero if any expectation failed
+ */
+namespace Tests
+{
+    int add(const char* name, void (*run)());
+    void fail(const char* file, const int line, const char* what);
+
+    /* same numbers on every platform, std::rand() isn't */
+    typedef struct Random_t
+    {
+    public:
+
+        uint32_t state = 1;
+
+        uint32_t next() { state = state * 1664525u + 1013904223u; return state; }
+        float nextFloat() { return (float) (next() >> 8) / 16777216.f; }
+        int nextInt(const int range) { return (int) (next() >> 8) % range; }
+
+    } Random_t;
+
+    /* a plucked note every half second with silence in between, exact zeros included */
+    inline std::vector<float> makeInput(const double sampleRate, const int numSamples, const float detune)
+    {
+        std::vector<float> input((size_t) numSamples, 0.f);
+        const int period = (int) (sampleRate * 0.5);
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            const int t = i % period;
+
+            if (t < period * 3 / 4)
+                input[(size_t) i] = (float) (0.6 * std::exp(-t / (sampleRate * 0.12)) * std::sin(t * detune * 2.0 * 3.141592653589793 * 110.0 / sampleRate));
+        }
+
+        return input;
+    }
+
+    /* a parameter change, or with param < 0 a transport change, at a sample position */
+    typedef struct Event_t
+    {
+    public:
+
+        int position;
+        int param;
+        float value;
+
+    } Event_t;
+
+    constexpr int transportPlay = -1;
+
+    /*
+     * renders in[0..numChannels) through a fresh engine, cutting the calls wherever nextBlock() says
+     * and also at every event, the way a host with sample accurate automation does
+     */
+    inline std::vector<std::vector<float>> render(const double sampleRate, const int flags, const std::vector<std::vector<float>>& in,
+                                                  const std::vector<Event_t>& events, const std::function<int()>& nextBlock)
+    {
+        const int numChannels = (int) in.size();
+        const int numSamples = (int) in[0].size();
+
+        std::vector<std::vector<float>> out((size_t) numChannels, std::vector<float>((size_t) numSamples, 0.f));
+        sd_engine* engine = sd_create(sampleRate, flags);
+
+        size_t nextEvent = 0;
+
+        for (int pos = 0; pos < numSamples;)
+        {
+            for (; nextEvent < events.size() && events[nextEvent].position <= pos; nextEvent++)
+            {
+                const Event_t& e = events[nextEvent];
+
+                if (e.param == transportPlay)
+                    sd_set_transport(engine, e.value, 0.0, 1);
+                else
+                    sd_set_param(engine, e.param, e.value);
+            }
+
+            int n = std::min(nextBlock(), numSamples - pos);
+
+            if (nextEvent < events.size()) n = std::min(n, events[nextEvent].position - pos);
+
+            const float* inPtrs[2] = { in[0].data() + pos, in[(size_t) numChannels - 1].data() + pos };
+            float* outPtrs[2] = { out[0].data() + pos, out[(size_t) numChannels - 1].data() + pos };
+
+            sd_process(engine, inPtrs, outPtrs, numChannels, n);
+
+            pos += n;
+        }
+
+        sd_destroy(engine);
+
+        return out;
+    }
+
+    /* number of samples that differ in any way, -0 against 0 included */
+    inline int countDifferences(const std::vector<float>& a, const std::vector<float>& b, int* firstDifference = nullptr)
+    {
+        int count = 0;
+
+        for (size_t i = 0; i < a.size() && i < b.size(); i++)
+        {
+            uint32_t x, y;
+            std::memcpy(&x, &a[i], sizeof(x));
+            std::memcpy(&y, &b[i], sizeof(y));
+
+            if (x != y && count++ == 0 && firstDifference != nullptr) *firstDifference = (int) i;
+        }
+
+        return count;
+    }
+
+    /* FNV-1a over the bits of every channel, for results that have to come out the same everywhere */
+    inline uint64_t checksum(const std::vector<std::vector<float>>& out)
+    {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (const std::vector<float>& channel : out)
+        {
+            for (const float x : channel)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &x, sizeof(bits));
+
+                for (int i = 0; i < 4; i++)
+                    hash = (hash ^ ((bits >> (8 * i)) & 0xffu)) * 1099511628211ull;
+            }
+        }
+
+        return hash;
+    }
+}
+
+#define SD_TEST(name) \
+    static void name(); \
+    static const int name##Registered = Tests::add(#name, name); \
+    static void name()
+
+#define SD_EXPECT(condition) \
+    do { if (!(condition)) Tests::fail(__FILE__, __LINE__, #condition); } while (false)
@@ -1,821 +1,821 @@
-/* ==================================== JUCER_BINARY_RESOURCE ====================================
-
-   This is an auto-generated file: Any edits you make may be overwritten!
-
-*/
-
-#include <cstring>
-
-namespace BinaryData
-{
-
-//================== typo-round.bold.otf ==================
-static const unsigned char temp_binary_data_0[] =
-{ 0,1,0,0,0,15,0,128,0,3,0,112,68,83,73,71,0,0,0,1,0,0,255,96,0,0,0,8,71,68,69,70,0,1,0,0,0,0,255,104,0,0,0,12,71,80,79,83,0,25,0,12,0,0,255,116,0,0,0,18,71,83,85,66,56,111,73,83,0,0,255,136,0,0,1,144,79,83,47,50,26,20,95,71,0,0,1,120,0,0,0,96,99,109,97,
-112,167,129,119,250,0,0,9,228,0,0,3,236,103,97,115,112,255,255,0,3,0,0,255,88,0,0,0,8,103,108,121,102,26,132,209,6,0,0,17,216,0,0,219,160,104,101,97,100,13,64,66,30,0,0,0,252,0,0,0,54,104,104,101,97,16,245,7,66,0,0,1,52,0,0,0,36,104,109,116,120,240,0,
-166,32,0,0,1,216,0,0,8,12,108,111,99,97,219,79,16,46,0,0,13,208,0,0,4,8,109,97,120,112,2,137,10,2,0,0,1,88,0,0,0,32,110,97,109,101,160,33,64,255,0,0,237,120,0,0,5,55,112,111,115,116,90,94,8,57,0,0,242,176,0,0,12,168,0,1,0,0,0,1,0,0,45,142,111,102,95,
-15,60,245,0,9,8,0,0,0,0,0,210,176,31,192,0,0,0,0,210,181,215,167,255,46,253,163,9,143,8,25,0,1,0,6,0,1,0,0,0,0,0,0,0,1,0,0,8,16,254,5,0,37,9,169,255,46,253,144,9,143,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,1,0,0,2,3,5,0,0,65,5,0,0,65,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,3,0,2,0,3,4,240,2,188,0,5,0,2,5,191,5,33,0,0,1,215,5,191,5,33,0,0,2,49,0,102,2,18,0,0,2,0,5,0,0,0,0,0,0,0,128,0,0,167,80,0,164,79,0,0,0,0,0,0,0,0,83,84,80,79,0,32,0,0,251,2,6,26,254,101,0,205,8,16,1,251,32,0,0,147,0,0,0,0,4,128,6,26,0,0,0,
-32,0,3,6,11,0,100,1,4,0,0,1,4,0,0,2,99,0,0,1,224,0,100,2,149,0,50,5,132,0,15,4,17,0,60,5,231,0,100,5,61,0,100,1,189,0,100,2,195,0,100,2,195,0,34,3,209,0,106,4,128,0,50,1,185,0,23,3,104,0,50,6,11,0,100,2,183,0,0,4,251,0,100,2,177,0,10,4,200,0,100,4,11,
-0,70,4,229,0,70,4,150,0,120,4,234,0,100,3,192,0,10,4,252,0,100,4,234,0,100,1,224,0,100,1,224,0,23,4,166,0,50,4,128,0,50,4,166,0,50,4,86,0,82,8,157,0,100,4,231,0,110,4,140,0,110,4,178,0,75,5,104,0,110,3,240,0,110,3,165,0,110,6,187,0,80,4,240,0,110,2,13,
-0,140,3,33,0,10,4,134,0,110,3,140,0,120,7,107,0,110,4,231,0,110,6,187,0,80,4,218,0,110,6,187,0,80,4,166,0,110,4,72,0,70,4,30,0,40,4,231,0,110,4,192,0,20,7,107,0,110,4,211,0,100,4,211,0,100,4,69,0,40,2,199,0,100,2,183,0,0,2,199,0,100,5,89,0,247,3,239,
-255,246,2,169,0,11,5,72,0,100,5,42,0,100,3,207,0,70,5,42,0,70,4,253,0,70,2,247,0,100,5,42,0,70,4,143,0,100,2,8,0,120,2,17,255,46,4,49,0,100,2,13,0,140,2,155,0,140,7,87,0,100,4,143,0,100,5,12,0,70,5,42,0,100,5,42,0,70,2,217,0,100,3,83,0,60,2,144,0,100,
-4,143,0,100,4,123,0,21,7,87,0,100,4,113,0,85,4,143,0,100,4,58,0,65,2,225,0,50,2,133,0,200,2,225,0,50,4,31,0,37,1,224,0,40,4,108,0,48,4,197,0,100,4,211,0,38,4,191,255,247,2,31,0,150,4,112,0,70,3,75,0,100,7,45,0,110,3,213,0,100,4,108,0,30,4,83,0,130,7,
-19,0,100,3,184,0,50,3,134,0,100,4,128,0,50,2,169,0,182,4,163,0,110,4,104,0,100,2,99,0,100,2,188,0,108,4,118,255,236,6,244,0,40,6,156,0,40,7,206,0,40,4,86,0,14,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,7,27,0,110,4,178,0,
-75,3,240,0,110,3,240,0,110,3,240,0,110,3,240,0,110,2,13,0,140,2,13,0,140,2,13,0,140,2,13,0,140,5,134,0,10,4,231,0,110,6,187,0,80,6,187,0,80,6,187,0,80,6,187,0,80,6,187,0,80,3,149,0,51,6,187,0,80,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,211,0,
-100,5,0,0,140,4,160,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,8,197,0,100,3,207,0,70,4,253,0,70,4,253,0,70,4,253,0,70,4,253,0,70,2,8,0,137,2,8,0,137,2,8,0,137,2,8,0,137,5,72,0,100,4,143,0,100,5,12,0,70,5,12,0,70,5,12,0,70,
-5,12,0,70,5,12,0,70,3,184,0,50,5,12,0,70,4,143,0,100,4,143,0,100,4,143,0,100,4,143,0,100,4,143,0,100,5,42,0,100,4,143,0,100,2,8,0,137,3,173,0,105,3,174,0,106,2,140,0,50,3,166,0,107,1,224,0,100,2,196,0,100,2,71,0,65,3,200,0,102,4,60,0,108,4,173,0,100,
-6,61,0,100,1,199,0,100,1,199,0,100,1,199,0,100,2,216,0,100,2,216,0,100,2,216,0,100,4,116,0,10,4,116,0,10,3,125,0,100,8,60,0,100,2,226,0,30,2,226,255,236,1,240,255,207,4,6,0,10,4,197,0,100,9,169,0,160,5,156,0,100,8,241,0,160,5,38,0,20,4,41,0,123,5,48,
-0,105,5,125,0,100,5,149,0,110,3,184,0,50,4,198,0,106,4,251,0,100,2,157,0,7,4,234,0,102,4,138,0,100,4,138,0,100,4,195,0,100,5,41,0,100,3,84,0,40,1,241,0,40,3,51,0,40,2,203,0,40,3,139,0,40,3,25,0,40,3,73,0,40,2,239,0,40,3,84,0,40,3,73,0,40,3,69,0,40,2,
-195,0,40,3,69,0,40,1,79,0,40,2,13,0,40,2,13,0,40,3,14,0,40,3,84,0,40,1,241,0,40,3,51,0,40,2,203,0,40,3,139,0,40,3,25,0,40,3,73,0,40,2,239,0,40,3,84,0,40,3,73,0,40,3,69,0,40,2,195,0,40,3,69,0,40,2,13,0,40,2,13,0,40,3,203,0,70,3,165,0,70,3,227,0,70,4,82,
-0,70,3,59,0,70,3,22,0,70,5,87,0,70,3,210,0,70,1,123,0,70,2,186,0,70,3,153,0,70,3,10,0,70,5,174,0,70,3,203,0,70,5,87,0,70,3,224,0,70,5,87,0,70,3,192,0,70,3,144,0,70,3,158,0,70,3,203,0,70,4,70,0,78,5,174,0,70,3,203,0,70,3,203,0,70,3,187,0,70,8,13,0,100,
-7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,
-70,7,209,0,70,7,209,0,70,7,209,0,70,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,
-0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,
-13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,
-8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,4,231,0,110,5,72,0,100,4,231,0,110,5,72,0,100,4,231,0,110,5,72,0,100,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,5,104,0,110,6,38,0,70,5,134,0,10,5,66,
-0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,4,240,0,110,4,143,0,100,5,61,0,10,4,183,0,10,2,
-13,0,140,2,8,0,137,2,13,0,140,2,8,0,137,2,13,0,140,2,8,0,137,2,13,0,140,2,8,0,120,2,13,0,140,4,242,0,140,3,221,0,120,2,244,255,96,2,231,255,148,4,134,0,110,4,49,0,100,4,49,0,100,3,140,0,120,2,110,0,144,3,140,0,120,2,110,0,140,3,140,0,120,3,1,0,140,3,
-140,0,120,3,41,0,140,3,240,0,1,2,217,0,1,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,184,0,10,4,231,0,110,4,143,0,100,6,187,0,80,5,12,0,70,6,187,0,80,5,12,0,70,6,187,0,80,5,12,0,70,8,229,0,80,8,108,0,70,4,166,0,110,2,217,
-0,100,4,166,0,110,2,217,0,100,4,166,0,110,2,217,0,106,4,72,0,70,3,83,0,60,4,72,0,70,3,82,0,65,4,72,0,70,3,83,0,60,4,72,0,70,3,83,0,65,4,30,0,40,2,144,0,102,4,30,0,40,2,218,0,100,3,236,0,15,2,144,0,110,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,
-231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,7,107,0,110,7,87,0,100,4,211,0,100,4,143,0,100,4,211,0,100,4,69,0,40,4,58,0,65,4,69,0,40,4,58,0,65,4,69,0,40,4,58,0,65,2,221,0,100,0,0,0,3,0,0,0,3,0,0,0,28,
-0,1,0,0,0,0,1,226,0,3,0,1,0,0,0,28,0,4,1,198,0,0,0,100,0,64,0,5,0,36,0,0,0,29,0,108,0,126,0,160,0,172,0,185,0,255,1,48,1,49,1,127,2,199,2,201,2,221,3,126,32,20,32,26,32,30,32,34,32,38,32,58,32,68,32,113,32,124,32,142,32,164,32,167,32,172,32,221,33,22,
-33,34,34,2,34,6,34,15,34,18,34,21,34,26,34,30,34,43,34,72,34,101,36,115,36,244,36,255,37,203,37,207,39,127,240,2,251,2,255,255,0,0,0,0,0,29,0,32,0,109,0,160,0,161,0,173,0,187,1,0,1,49,1,50,2,198,2,201,2,216,3,126,32,19,32,24,32,28,32,32,32,38,32,57,32,
-68,32,112,32,116,32,125,32,163,32,167,32,172,32,221,33,22,33,34,34,2,34,6,34,15,34,17,34,21,34,25,34,30,34,43,34,72,34,100,36,96,36,182,36,255,37,203,37,207,39,118,240,1,251,1,255,255,0,1,255,228,255,227,255,228,0,0,255,194,0,0,255,189,0,132,0,0,0,131,
-253,248,253,247,253,233,252,160,224,180,224,177,224,176,224,175,224,172,224,154,224,145,0,0,224,121,224,122,224,51,224,49,224,45,224,70,223,196,223,185,222,218,222,215,222,207,222,206,222,192,0,0,222,196,222,184,222,156,222,129,221,6,220,110,220,100,
-219,153,219,150,218,4,16,230,5,230,0,1,0,0,0,0,0,0,0,0,0,92,0,0,0,90,0,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
-16,0,111,0,112,0,113,0,114,0,235,0,236,0,115,0,116,0,117,0,118,0,119,0,234,0,189,0,233,0,246,0,118,0,225,0,6,2,10,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-0,0,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,
-0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,98,0,0,0,129,0,130,0,132,0,134,0,
-142,0,147,0,153,0,158,0,157,0,159,0,161,0,160,0,162,0,164,0,166,0,165,0,167,0,168,0,170,0,169,0,171,0,172,0,174,0,176,0,175,0,177,0,179,0,178,0,183,0,182,0,184,0,185,0,207,0,113,0,100,0,101,0,105,0,209,0,117,0,156,0,111,0,107,0,219,0,115,0,106,0,0,0,
-131,0,149,0,226,0,114,0,229,0,230,0,103,0,116,0,220,0,223,0,222,0,0,0,227,0,108,0,0,0,0,0,163,0,181,0,124,0,99,0,110,0,225,0,0,0,228,0,221,0,109,0,120,0,210,0,3,0,125,0,128,0,146,1,213,1,214,0,199,0,200,0,204,0,205,0,201,0,202,0,180,0,0,0,188,1,251,0,
-213,0,217,0,211,0,212,0,231,0,232,0,208,0,118,0,203,0,206,0,0,0,127,0,135,0,126,0,136,0,133,0,138,0,139,0,140,0,137,0,144,0,145,0,0,0,143,0,151,0,152,0,150,0,189,0,190,0,197,0,112,0,193,0,194,0,195,0,119,0,198,0,196,0,191,0,0,6,116,6,116,6,116,6,116,
-6,166,6,214,7,114,7,236,8,92,8,200,8,228,9,34,9,96,9,200,10,8,10,42,10,76,16,192,16,208,17,8,17,48,17,122,17,208,18,16,18,88,18,162,18,204,19,38,19,112,19,162,19,218,20,8,20,68,20,112,20,208,21,86,21,148,21,226,22,34,22,94,22,170,22,232,23,62,23,126,
-23,160,23,206,24,34,24,80,24,166,24,222,25,20,25,78,25,160,25,246,26,68,26,116,26,172,26,216,27,46,27,140,27,212,28,14,28,34,28,50,28,70,28,114,28,126,28,160,28,220,29,28,29,88,29,152,29,226,30,30,30,112,30,178,30,234,31,48,31,132,31,166,31,212,32,42,
-32,98,32,148,32,212,33,20,33,68,33,146,33,206,34,6,34,56,34,142,34,234,35,72,35,134,35,242,36,0,36,108,36,196,36,206,37,22,37,114,37,176,37,218,37,238,38,154,38,204,39,56,39,116,39,160,39,176,40,22,40,32,40,86,40,178,40,212,41,32,41,64,41,74,41,134,41,
-178,41,194,41,210,41,226,41,236,41,248,42,4,42,16,42,28,42,40,42,52,42,170,42,182,42,194,42,206,42,218,42,230,42,242,42,254,43,10,43,22,43,90,43,102,43,114,43,126,43,138,43,150,43,162,43,232,44,54,44,66,44,78,44,90,44,102,44,114,44,178,45,18,45,30,45,
-42,45,54,45,66,45,78,45,90,45,216,45,228,45,240,45,252,46,8,46,20,46,32,46,44,46,56,46,68,46,180,46,192,46,204,46,216,46,228,46,240,46,252,47,74,47,148,47,160,47,172,47,184,47,196,47,208,48,24,48,36,48,70,48,112,48,160,48,194,48,242,49,14,49,68,49,108,
-49,164,49,176,49,190,49,204,49,244,50,26,50,36,50,48,50,60,50,70,50,94,50,130,50,154,50,224,50,250,51,20,51,36,51,130,51,138,52,14,52,136,52,214,52,250,53,94,53,136,53,184,53,248,54,26,54,94,54,168,55,16,55,118,55,196,56,20,56,32,56,44,56,100,56,140,
-56,214,57,42,57,104,57,176,57,248,58,34,58,124,58,196,59,2,59,36,59,96,59,152,59,214,60,20,60,76,60,132,60,172,60,246,61,74,61,136,61,206,62,22,62,64,62,154,62,226,63,30,63,64,63,124,63,186,63,248,64,54,64,126,64,190,64,244,65,62,65,124,65,208,66,16,
-66,50,66,96,66,178,66,224,67,54,67,110,67,164,67,222,68,46,68,132,68,210,69,2,69,58,69,102,69,188,70,22,70,94,70,152,70,206,71,58,71,178,72,32,72,132,72,254,73,106,73,236,74,92,74,172,75,8,75,138,75,230,76,106,76,208,77,52,77,156,78,22,78,154,79,22,79,
-116,79,218,80,52,80,184,81,64,81,182,82,30,82,44,82,58,82,72,82,86,82,100,82,114,82,128,82,142,82,156,82,170,82,184,82,198,82,212,82,226,82,240,82,254,83,12,83,26,83,40,83,54,83,68,83,82,83,96,83,110,83,124,83,138,83,150,83,248,84,124,85,8,85,128,86,
-2,86,132,86,232,87,124,87,254,88,146,88,226,89,24,89,54,89,66,89,78,89,90,89,102,89,114,89,126,89,138,89,150,89,162,89,178,89,194,89,210,89,226,89,242,90,2,90,18,90,34,90,50,90,66,90,234,91,42,91,140,91,248,92,80,92,176,93,16,93,82,93,194,94,34,94,148,
-94,160,94,172,94,184,94,196,94,208,94,220,94,232,94,244,95,0,95,12,95,24,95,36,95,48,95,60,95,72,95,84,95,92,95,162,95,174,95,186,95,198,95,210,95,222,95,234,95,246,96,104,96,116,96,128,96,140,96,152,96,164,96,176,96,188,96,200,96,212,96,224,96,236,96,
-248,97,64,97,138,97,150,97,162,97,174,97,186,97,198,97,210,97,222,97,234,97,246,98,2,98,14,98,96,98,180,99,40,99,156,99,240,99,252,100,68,100,146,100,224,101,46,101,124,101,194,101,250,102,48,102,102,102,114,102,126,102,214,103,46,103,58,103,70,103,158,
-103,170,103,182,103,194,103,206,103,218,103,230,103,242,103,254,104,126,104,244,105,0,105,12,105,130,105,210,105,222,105,234,105,246,106,2,106,14,106,26,106,38,106,50,106,62,106,74,106,168,107,24,107,36,107,128,107,188,107,252,108,8,108,20,108,32,108,
-44,108,56,108,68,108,80,108,92,108,104,108,116,108,200,109,28,109,40,109,52,109,64,109,76,109,88,109,100,109,112,109,124,109,136,109,148,109,160,109,208,0,65,0,100,254,230,5,155,5,148,0,3,0,7,0,18,0,30,0,64,0,82,0,106,0,122,0,135,0,157,0,172,0,196,0,
-216,0,251,1,30,1,78,1,99,1,131,1,154,1,167,1,175,1,184,1,193,1,227,2,5,2,14,2,25,2,46,2,69,2,91,2,137,2,152,2,172,2,200,2,234,3,7,3,19,3,26,3,36,3,62,3,87,3,110,3,120,3,136,3,156,3,172,3,188,3,223,4,7,4,57,4,87,4,97,4,127,4,140,4,153,4,163,4,175,4,188,
-4,197,4,204,4,211,4,221,4,230,4,243,4,255,0,0,19,17,33,17,37,33,17,33,1,51,23,21,22,21,7,35,38,61,1,37,51,23,6,21,20,23,7,35,38,39,54,37,51,20,23,6,29,1,20,23,51,50,55,51,22,51,6,21,20,51,22,21,35,34,39,35,6,43,1,34,39,38,61,1,52,37,51,50,23,22,29,1,
-20,7,6,43,1,34,39,53,52,55,54,5,51,22,21,20,7,6,7,21,35,34,39,53,35,39,52,55,51,49,52,35,38,53,54,5,21,20,23,50,55,54,61,1,52,39,34,53,34,7,6,37,22,21,50,21,54,55,54,53,52,39,35,6,23,50,23,34,7,38,35,6,7,22,21,6,35,38,53,54,51,21,20,23,51,54,23,50,23,
-22,29,1,20,7,6,35,38,53,52,55,54,55,50,23,50,21,6,35,38,39,6,7,34,7,35,34,39,38,53,54,51,22,21,51,54,33,50,23,6,35,38,39,6,7,6,43,1,34,39,54,51,22,21,51,54,5,22,29,1,20,7,35,38,35,34,7,20,23,22,21,20,15,1,35,34,39,53,54,55,51,22,51,54,53,38,35,34,61,
-1,52,33,50,23,21,6,35,52,39,34,7,21,20,23,22,21,20,7,35,34,39,53,54,59,1,22,51,54,53,52,39,34,39,38,53,52,5,49,22,51,6,29,1,22,59,1,54,53,49,51,21,22,21,20,7,34,43,1,34,39,38,53,49,52,59,1,22,51,7,20,23,51,50,53,52,39,35,6,43,1,34,39,53,52,37,22,29,1,
-20,7,35,20,23,50,55,51,22,21,6,43,1,34,39,52,55,37,51,22,21,6,21,48,23,6,43,1,39,6,43,1,38,61,1,52,55,22,23,53,38,35,34,7,35,38,39,53,54,33,22,21,20,7,35,21,22,51,50,55,51,50,23,20,7,6,43,1,34,39,52,55,5,22,59,1,54,55,53,38,43,1,34,7,6,39,50,55,53,38,
-35,34,7,5,51,50,55,38,43,1,34,7,5,21,20,23,50,55,38,35,6,7,50,23,21,7,35,38,35,34,7,22,21,20,23,54,59,1,21,7,22,21,35,38,53,35,6,35,53,50,55,38,53,54,59,1,50,23,7,35,53,52,39,6,21,20,23,48,21,54,59,1,23,21,34,7,23,20,23,35,52,39,6,35,53,55,38,53,52,7,
-59,1,21,20,23,35,38,53,55,59,1,21,20,23,35,38,61,1,52,7,22,51,6,21,51,55,21,34,7,23,7,35,38,39,35,53,55,51,53,52,33,50,23,6,29,1,51,55,21,35,7,23,7,35,38,53,35,55,53,55,51,53,52,55,50,23,6,29,1,51,55,29,1,34,7,21,20,23,7,35,39,35,53,55,51,37,51,50,23,
-6,21,35,38,35,34,7,6,29,1,20,23,22,51,54,61,1,38,43,1,53,50,23,22,21,6,21,20,23,34,7,35,34,39,6,7,35,34,39,53,52,55,5,50,23,21,20,15,1,34,39,38,61,1,52,55,54,51,50,23,35,6,35,38,39,6,15,1,35,34,39,55,51,22,21,51,54,5,22,21,50,21,20,7,6,35,21,20,23,51,
-50,55,51,20,23,21,6,43,1,34,39,53,52,55,54,33,51,50,23,22,23,6,7,22,21,7,35,39,6,43,1,38,61,1,54,51,50,23,53,52,39,35,34,7,35,34,39,53,54,5,50,23,20,51,54,55,54,53,51,50,23,6,29,1,20,23,6,21,35,38,39,35,6,7,35,34,61,1,23,22,59,1,50,55,54,53,38,43,1,34,
-5,50,55,38,43,1,34,5,22,59,1,50,55,38,43,1,6,5,50,23,6,7,20,23,6,43,1,34,39,35,20,7,34,39,38,53,52,55,51,50,23,53,52,39,23,6,29,1,54,51,22,21,35,6,35,22,23,6,35,53,38,53,39,35,53,51,53,52,33,51,23,6,29,1,54,51,23,21,6,21,20,23,6,35,53,38,53,35,53,51,
-52,39,50,23,21,20,7,35,38,53,54,23,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,59,1,50,29,1,54,51,50,23,20,23,6,15,1,35,23,20,23,35,38,55,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,51,50,23,51,54,59,1,50,23,
-35,6,43,1,38,35,6,7,6,35,34,39,38,35,6,21,6,35,53,39,54,51,22,23,51,54,5,22,29,1,6,7,35,52,39,35,34,7,21,20,51,22,29,1,20,7,6,43,1,34,39,52,55,51,22,51,50,53,52,39,34,39,38,61,1,52,5,22,51,6,29,1,20,23,51,54,61,1,51,21,22,29,1,20,7,6,35,34,39,38,61,1,
-52,51,23,7,21,20,23,51,50,55,54,61,1,39,35,6,43,1,34,39,38,61,1,52,5,51,50,23,22,21,6,35,49,38,43,1,6,15,1,20,23,51,50,55,51,22,21,6,35,34,39,52,55,54,5,51,23,20,7,22,23,35,39,38,39,22,29,1,20,59,1,54,55,54,55,51,22,21,6,29,1,20,23,20,7,49,38,53,35,6,
-43,1,34,53,23,20,23,51,50,55,53,52,47,1,35,34,7,23,20,23,51,50,55,54,61,1,38,43,1,34,23,20,31,1,50,55,38,43,1,34,23,21,20,23,51,50,55,54,53,38,35,34,23,20,59,1,50,55,54,61,1,38,43,1,34,7,50,23,21,6,35,34,39,54,3,21,33,34,7,53,18,33,51,50,23,22,21,33,
-5,33,21,38,43,1,34,61,1,54,41,1,23,21,20,7,35,38,53,37,51,20,23,51,50,29,1,20,43,1,38,53,1,51,22,51,21,6,43,1,34,39,53,50,100,5,55,250,236,4,240,251,16,2,78,3,11,2,7,6,3,1,243,1,14,1,3,11,4,2,1,1,254,78,4,7,4,15,1,21,14,2,12,1,6,12,2,8,13,7,1,11,16,5,
-20,7,1,1,56,6,12,16,12,40,7,7,7,30,5,40,8,252,181,9,28,33,12,15,1,5,9,5,5,5,5,6,6,18,3,74,25,22,15,5,26,3,17,18,3,252,189,1,1,29,8,8,15,6,26,180,19,9,1,14,6,7,17,3,1,10,5,13,12,3,3,1,10,151,20,13,2,35,5,4,27,25,2,86,19,17,1,8,4,15,8,9,9,1,4,7,7,2,2,7,
-7,3,1,7,2,73,16,19,9,4,15,9,6,13,3,1,6,7,3,6,9,1,1,7,253,72,18,10,1,4,9,13,3,29,20,20,8,5,24,10,1,8,1,12,16,14,4,17,28,1,221,13,7,11,3,11,12,5,29,19,24,8,23,12,8,2,1,12,15,14,16,25,5,2,1,118,13,1,1,2,11,1,18,15,7,30,2,3,5,18,5,1,3,1,9,3,1,9,2,23,1,1,
-8,18,1,19,6,252,108,23,39,10,17,11,10,4,8,17,13,7,26,4,32,1,105,11,27,1,2,9,4,1,2,12,11,7,22,32,11,9,4,13,9,9,3,2,6,12,1,57,24,42,7,7,9,10,13,1,1,8,21,4,5,7,24,5,30,254,57,2,10,3,24,2,6,14,2,13,5,1,211,19,14,7,2,16,8,2,141,3,17,14,6,3,3,16,6,254,221,
-10,17,8,8,11,16,49,13,2,6,2,3,5,6,2,1,2,5,4,3,11,5,11,4,1,5,5,6,4,3,3,14,200,12,4,8,2,7,8,3,5,5,1,1,1,11,2,4,11,4,9,3,11,3,88,4,6,3,11,2,26,1,8,3,11,3,204,8,2,2,2,12,1,13,4,2,8,3,2,13,11,2,1,212,3,9,3,3,12,3,12,5,5,6,3,15,1,11,1,148,3,9,2,2,12,1,13,4,
-2,9,4,13,11,1,253,34,10,14,9,6,3,9,12,17,18,9,24,2,6,31,4,8,10,28,5,2,2,4,1,7,1,4,2,6,23,2,38,5,45,1,213,23,11,34,7,16,8,2,19,8,83,15,19,1,5,4,15,9,7,16,2,4,6,3,8,2,3,1,9,254,71,20,1,35,5,10,17,1,10,13,3,6,14,15,6,19,8,26,5,2,94,11,16,8,2,1,1,2,2,6,3,
-3,10,15,4,21,3,27,12,9,18,3,6,11,1,1,5,10,254,72,2,9,14,19,9,1,1,3,7,3,5,5,2,7,1,2,4,15,9,20,207,2,13,1,16,11,3,6,16,4,15,254,121,23,16,2,9,3,19,2,93,3,8,6,14,8,9,8,2,20,253,207,1,16,4,1,10,11,1,1,3,3,2,21,33,14,3,34,4,14,15,188,15,2,13,2,2,2,9,6,3,2,
-12,5,5,2,14,15,1,107,1,15,2,14,2,1,16,5,13,4,5,18,17,125,9,2,8,7,8,2,71,25,16,2,39,4,9,27,5,30,10,194,5,11,9,10,25,8,1,3,28,8,10,1,1,17,5,115,23,16,4,38,8,6,22,9,2,30,11,203,24,15,4,39,4,9,28,4,30,10,95,17,10,1,8,19,1,24,16,2,11,2,1,19,6,10,7,3,7,8,3,
-13,6,16,10,7,12,13,4,2,2,2,9,252,86,24,1,11,3,13,1,13,7,31,27,22,5,5,9,23,16,11,3,8,22,18,21,27,5,4,1,241,12,3,1,12,5,22,17,8,28,10,6,22,7,2,4,14,1,11,4,20,5,1,1,1,10,19,2,23,7,1,1,67,8,6,9,11,11,1,11,7,2,12,6,4,14,3,11,23,1,6,25,22,23,5,19,12,254,22,
-12,6,1,1,3,18,1,2,187,17,12,5,17,7,5,1,2,15,3,5,10,12,1,11,17,3,29,104,30,3,12,3,21,6,2,17,2,129,15,4,15,14,2,7,17,2,21,230,3,7,22,4,3,14,1,10,66,15,2,16,14,4,6,22,19,198,17,3,14,15,2,8,17,1,20,120,9,3,3,9,9,2,1,250,254,251,54,49,147,1,44,10,132,147,
-56,254,167,254,140,1,33,35,40,214,19,3,1,132,1,127,9,131,167,94,254,37,9,140,177,66,103,158,131,1,173,9,61,126,108,79,9,80,107,132,254,230,6,174,249,82,40,6,104,252,97,1,18,70,56,2,71,67,3,6,1,9,4,55,76,2,58,71,12,1,2,10,18,12,18,44,14,117,4,58,28,31,
-16,4,32,28,61,4,18,11,25,19,28,22,22,9,37,21,3,43,9,50,38,2,4,5,35,34,15,5,2,37,3,34,1,11,8,41,7,4,24,86,8,21,3,27,8,10,3,27,26,2,50,11,49,35,12,2,6,11,10,8,18,3,3,1,49,4,33,9,66,14,1,2,69,18,2,1,4,15,43,6,32,9,8,3,36,17,1,4,34,50,15,1,2,89,7,7,62,18,
-13,57,10,57,14,9,2,17,3,41,96,7,66,14,12,62,6,80,2,19,3,43,2,5,12,1,2,6,7,11,5,1,11,23,25,9,2,23,1,3,8,15,4,12,15,22,3,30,18,1,7,6,1,10,1,5,1,9,27,26,8,23,1,11,15,4,12,12,3,11,11,3,30,1,2,18,8,9,35,13,54,3,78,10,46,10,19,5,5,15,6,9,8,1,42,5,16,24,47,
-17,10,18,4,18,6,20,16,11,5,18,12,3,22,45,40,13,1,9,36,21,14,16,8,11,8,3,18,8,30,5,1,5,1,25,10,1,10,2,14,4,19,29,12,2,14,18,12,9,13,3,44,40,14,62,18,7,28,3,26,32,7,13,18,2,2,19,3,19,3,21,32,3,3,3,17,7,3,112,34,3,1,21,19,2,2,10,29,3,15,3,57,12,54,11,2,
-17,2,21,31,29,37,1,1,15,5,5,10,8,38,1,3,8,7,3,3,12,54,6,59,2,17,1,46,6,30,17,9,61,71,65,37,39,30,32,79,66,70,3,2,3,2,29,13,2,17,2,74,2,29,46,16,1,18,27,2,13,16,13,2,17,2,74,2,62,13,8,8,1,1,21,23,2,18,16,8,2,8,9,2,6,15,53,2,75,16,1,42,23,6,3,15,26,19,
-15,5,29,6,1,3,17,10,3,17,9,7,2,25,4,11,15,5,22,8,4,51,4,58,21,30,38,14,34,16,1,20,11,6,4,41,16,5,94,4,67,12,7,72,1,76,2,16,17,54,4,4,16,2,23,13,3,1,11,6,16,2,7,1,22,32,15,33,13,2,28,16,2,6,20,4,19,4,12,11,3,17,8,32,8,3,25,4,8,7,2,13,2,3,74,12,54,5,6,
-3,24,21,12,9,10,7,4,4,22,15,14,75,10,48,23,25,8,3,31,31,22,6,56,8,18,8,3,92,4,38,54,34,35,10,13,8,8,42,12,16,48,10,16,1,8,51,5,23,13,14,3,20,4,1,63,28,2,1,61,27,2,24,9,46,5,28,17,5,3,14,10,1,1,23,67,2,1,75,15,24,34,18,14,1,11,5,5,12,14,41,38,11,6,9,40,
-20,2,41,14,51,18,2,3,2,5,44,11,3,52,12,1,8,6,34,132,39,35,13,11,43,22,2,27,12,11,54,20,2,35,8,11,8,43,19,2,41,14,51,18,2,58,58,118,5,98,22,60,10,15,76,58,35,4,1,104,6,8,23,43,1,5,16,1,2,7,7,1,10,4,6,12,26,5,28,10,3,25,5,11,18,20,15,3,12,8,4,8,34,1,4,
-23,11,6,33,11,18,54,10,1,89,14,10,44,16,4,20,4,5,9,15,7,8,4,8,2,33,4,8,20,13,30,50,8,12,9,33,1,9,12,6,13,15,5,23,21,22,2,16,20,2,18,46,34,30,12,2,1,3,5,67,42,8,68,41,5,1,20,67,19,36,10,28,2,4,42,17,10,10,10,6,12,12,13,29,93,32,34,6,26,3,36,12,1,35,18,
-22,3,29,4,5,9,31,8,3,64,1,42,34,53,5,17,3,26,8,10,34,53,25,30,6,4,7,31,67,14,5,13,15,17,5,184,242,38,10,1,14,149,68,25,84,94,19,19,37,19,94,18,185,113,12,81,242,72,12,65,103,83,120,159,254,205,56,10,37,37,10,0,2,0,100,0,0,1,124,6,26,0,13,0,29,0,0,1,3,
-35,3,17,52,55,54,59,1,50,23,22,21,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,106,35,175,35,36,36,49,3,49,36,36,122,58,41,41,41,41,58,57,41,42,42,41,3,80,254,58,1,198,2,81,50,36,35,35,36,50,250,95,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,0,50,3,
-218,2,99,6,27,0,13,0,27,0,0,1,3,35,3,53,52,55,54,59,1,50,23,22,21,5,3,35,3,53,52,55,54,59,1,50,23,22,21,1,39,36,173,36,36,36,49,3,49,36,36,1,60,36,173,36,36,36,49,3,49,36,36,5,38,254,180,1,76,124,50,36,35,35,36,50,124,254,180,1,76,124,50,36,35,35,36,
-50,0,0,0,0,2,0,15,0,83,5,117,5,171,0,107,0,111,0,0,1,55,35,34,39,38,61,1,52,55,54,59,1,55,54,55,54,51,50,31,1,22,23,22,21,20,15,1,51,55,54,55,54,51,50,31,1,22,23,22,21,20,15,1,51,50,23,22,29,1,20,7,6,43,1,7,51,50,23,22,29,1,20,7,6,43,1,3,6,7,6,35,34,
-47,1,38,39,38,53,52,63,1,35,3,6,7,6,35,34,47,1,38,39,38,53,52,63,1,35,34,39,38,61,1,52,55,54,51,37,7,51,55,1,77,47,175,45,33,32,32,33,45,220,50,9,39,28,33,12,13,2,40,27,18,2,40,226,50,9,39,28,32,12,12,3,42,26,18,2,40,178,46,31,33,33,31,46,223,47,190,
-47,31,33,33,31,47,235,54,8,39,28,32,12,12,3,42,26,19,3,43,226,54,8,39,28,34,12,13,2,40,26,19,3,43,162,46,33,32,32,33,46,1,227,47,226,47,2,148,233,33,33,45,2,45,33,33,246,45,25,18,2,1,8,37,29,32,12,12,201,246,45,25,18,2,1,8,37,29,32,12,12,201,33,33,45,
-2,45,33,33,233,33,33,45,3,44,33,33,254,247,45,25,18,2,1,8,38,28,32,12,12,220,254,247,45,25,18,2,1,8,38,28,32,12,12,220,33,33,44,3,45,33,33,233,233,233,0,0,4,0,60,255,104,3,213,6,180,0,6,0,13,0,48,0,83,0,0,1,54,55,54,53,52,39,1,6,7,6,21,20,23,19,54,51,
-50,29,1,22,23,22,23,22,21,20,7,6,43,1,34,39,38,39,17,22,23,22,21,20,7,6,7,21,20,35,34,47,1,6,35,34,61,1,38,39,38,39,38,53,52,55,54,59,1,50,23,22,23,17,38,39,38,53,52,55,54,55,53,52,51,50,23,2,137,16,35,36,87,254,253,15,35,35,85,169,11,15,64,98,91,91,
-34,5,23,34,56,21,83,25,29,48,142,77,113,102,99,131,64,15,11,77,12,16,64,98,90,91,33,5,23,34,56,21,83,25,28,47,142,76,112,101,98,131,64,16,12,1,9,7,53,54,65,136,35,2,171,7,53,53,65,135,35,2,250,4,82,71,23,86,87,120,17,15,35,31,45,79,95,21,254,85,37,73,
-107,211,162,126,124,31,71,82,4,1,5,82,72,24,85,87,119,17,17,34,30,45,79,93,22,1,172,36,73,107,210,161,127,123,32,71,82,5,0,0,5,0,100,0,0,5,131,6,26,0,3,0,21,0,39,0,57,0,75,0,0,9,1,35,1,19,34,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,39,50,23,22,29,
-1,20,7,6,35,34,39,38,61,1,52,55,54,1,34,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,39,50,23,22,29,1,20,7,6,35,34,39,38,61,1,52,55,54,4,137,253,170,213,2,86,167,47,34,33,33,34,47,47,34,34,34,34,47,122,87,87,87,87,122,121,88,87,87,88,253,170,48,33,34,
-34,34,47,47,34,33,33,34,47,122,87,87,87,87,122,122,87,87,87,87,6,26,249,230,6,26,251,154,34,33,48,20,48,33,34,34,34,47,20,47,34,34,186,87,87,122,30,122,87,87,87,87,122,30,122,87,87,2,242,33,34,47,21,47,34,34,34,33,48,21,47,34,33,186,87,87,121,31,122,
-87,87,87,87,122,31,121,87,87,0,0,0,2,0,100,0,0,5,36,6,26,0,15,0,78,0,0,1,33,34,7,6,21,20,23,22,59,1,50,55,54,53,51,1,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,6,43,1,34,39,38,53,52,55,38,53,52,55,54,59,1,50,23,7,38,43,
-1,34,7,6,21,20,23,22,51,33,53,55,17,3,99,254,208,90,64,64,64,64,90,85,90,64,64,1,1,82,47,31,33,33,32,46,113,20,21,29,43,46,33,32,32,33,46,23,164,73,110,187,85,191,136,136,152,129,129,129,182,150,150,142,143,79,70,150,80,58,57,57,57,81,1,48,225,2,170,
-64,64,91,91,64,63,63,64,121,1,164,33,33,45,3,45,33,32,254,117,29,20,20,33,33,45,3,45,33,33,106,106,136,136,191,229,116,108,206,182,129,129,109,201,66,58,57,91,92,57,56,235,89,254,194,0,1,0,100,3,218,1,89,6,27,0,13,0,0,1,3,35,3,53,52,55,54,59,1,50,23,
-22,21,1,89,36,173,36,36,36,49,3,49,36,36,5,38,254,180,1,76,124,50,36,35,35,36,50,0,0,0,0,1,0,100,254,101,2,161,6,26,0,39,0,0,0,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,1,84,118,122,122,
-118,183,16,15,40,33,46,27,26,43,103,68,70,70,68,103,43,26,27,46,34,40,15,15,254,145,147,149,192,3,140,192,149,147,41,4,28,35,60,8,44,33,33,9,23,80,83,103,252,128,103,83,80,23,9,33,33,44,9,58,37,26,3,0,0,0,1,0,34,254,100,2,95,6,26,0,39,0,0,19,6,35,34,
-39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,38,39,38,39,38,61,1,52,55,54,51,50,23,22,23,22,21,17,20,7,6,183,16,15,39,33,46,27,26,43,103,68,70,70,68,103,43,26,27,46,33,40,14,16,183,119,122,122,119,254,104,4,27,37,58,9,44,33,33,9,23,80,83,103,3,128,103,
-83,80,23,9,33,33,44,8,60,35,28,4,41,147,149,192,252,116,192,149,147,0,0,0,0,1,0,106,2,145,3,102,5,114,0,70,0,0,1,50,23,22,29,1,55,54,51,50,23,22,31,1,22,21,20,7,6,15,1,23,22,21,20,7,6,15,1,6,35,34,39,38,47,1,7,6,7,6,35,34,47,1,38,39,38,53,52,63,1,39,
-38,39,38,53,52,63,1,54,55,54,51,50,31,1,53,52,55,54,51,1,233,47,32,32,124,18,19,24,24,41,13,1,6,12,20,44,124,77,20,1,7,35,2,32,36,8,8,47,26,77,76,27,45,8,7,38,36,1,32,7,1,21,76,124,43,21,13,6,1,13,42,25,25,17,17,124,33,33,45,5,114,33,33,45,130,39,6,11,
-22,42,2,18,18,25,24,41,15,41,105,29,34,9,9,47,25,2,22,1,7,38,105,105,38,7,1,25,2,22,47,9,9,35,29,104,41,15,40,25,26,17,18,2,42,22,12,5,41,130,45,33,33,0,0,1,0,50,1,0,4,78,5,28,0,43,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,33,
-34,39,38,61,1,52,55,54,51,33,17,52,55,54,59,1,50,23,22,21,2,187,1,25,50,36,36,36,36,50,254,231,36,36,50,2,51,34,36,254,229,51,34,36,36,34,51,1,27,36,34,51,2,50,36,36,3,136,36,36,50,2,51,34,36,254,231,50,36,36,36,36,50,1,25,36,34,51,2,50,36,36,1,27,51,
-34,36,36,34,51,0,1,0,23,255,72,1,100,0,241,0,19,0,0,37,50,23,22,21,20,7,3,6,43,1,34,39,38,53,52,55,19,54,51,1,32,36,21,11,7,129,18,44,66,34,21,14,3,78,12,53,241,32,17,18,15,15,254,225,41,27,19,21,9,10,1,31,52,0,1,0,50,2,147,3,54,3,136,0,19,0,0,1,20,7,
-6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,54,36,36,50,253,239,51,34,36,36,34,51,2,17,50,36,36,3,12,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,65,0,100,254,230,5,155,5,148,0,3,0,7,0,18,0,30,0,64,0,82,0,106,0,122,0,135,0,157,0,172,0,196,0,216,0,
-251,1,30,1,78,1,99,1,131,1,154,1,167,1,175,1,184,1,193,1,227,2,5,2,14,2,25,2,46,2,69,2,91,2,137,2,152,2,172,2,200,2,234,3,7,3,19,3,26,3,36,3,62,3,87,3,110,3,120,3,136,3,156,3,172,3,188,3,223,4,7,4,57,4,87,4,97,4,127,4,140,4,153,4,163,4,175,4,188,4,197,
-4,204,4,211,4,221,4,230,4,243,4,255,0,0,19,17,33,17,37,33,17,33,1,51,23,21,22,21,7,35,38,61,1,37,51,23,6,21,20,23,7,35,38,39,54,37,51,20,23,6,29,1,20,23,51,50,55,51,22,51,6,21,20,51,22,21,35,34,39,35,6,43,1,34,39,38,61,1,52,37,51,50,23,22,29,1,20,7,6,
-43,1,34,39,53,52,55,54,5,51,22,21,20,7,6,7,21,35,34,39,53,35,39,52,55,51,49,52,35,38,53,54,5,21,20,23,50,55,54,61,1,52,39,34,53,34,7,6,37,22,21,50,21,54,55,54,53,52,39,35,6,23,50,23,34,7,38,35,6,7,22,21,6,35,38,53,54,51,21,20,23,51,54,23,50,23,22,29,
-1,20,7,6,35,38,53,52,55,54,55,50,23,50,21,6,35,38,39,6,7,34,7,35,34,39,38,53,54,51,22,21,51,54,33,50,23,6,35,38,39,6,7,6,43,1,34,39,54,51,22,21,51,54,5,22,29,1,20,7,35,38,35,34,7,20,23,22,21,20,15,1,35,34,39,53,54,55,51,22,51,54,53,38,35,34,61,1,52,33,
-50,23,21,6,35,52,39,34,7,21,20,23,22,21,20,7,35,34,39,53,54,59,1,22,51,54,53,52,39,34,39,38,53,52,5,49,22,51,6,29,1,22,59,1,54,53,49,51,21,22,21,20,7,34,43,1,34,39,38,53,49,52,59,1,22,51,7,20,23,51,50,53,52,39,35,6,43,1,34,39,53,52,37,22,29,1,20,7,35,
-20,23,50,55,51,22,21,6,43,1,34,39,52,55,37,51,22,21,6,21,48,23,6,43,1,39,6,43,1,38,61,1,52,55,22,23,53,38,35,34,7,35,38,39,53,54,33,22,21,20,7,35,21,22,51,50,55,51,50,23,20,7,6,43,1,34,39,52,55,5,22,59,1,54,55,53,38,43,1,34,7,6,39,50,55,53,38,35,34,7,
-5,51,50,55,38,43,1,34,7,5,21,20,23,50,55,38,35,6,7,50,23,21,7,35,38,35,34,7,22,21,20,23,54,59,1,21,7,22,21,35,38,53,35,6,35,53,50,55,38,53,54,59,1,50,23,7,35,53,52,39,6,21,20,23,48,21,54,59,1,23,21,34,7,23,20,23,35,52,39,6,35,53,55,38,53,52,7,59,1,21,
-20,23,35,38,53,55,59,1,21,20,23,35,38,61,1,52,7,22,51,6,21,51,55,21,34,7,23,7,35,38,39,35,53,55,51,53,52,33,50,23,6,29,1,51,55,21,35,7,23,7,35,38,53,35,55,53,55,51,53,52,55,50,23,6,29,1,51,55,29,1,34,7,21,20,23,7,35,39,35,53,55,51,37,51,50,23,6,21,35,
-38,35,34,7,6,29,1,20,23,22,51,54,61,1,38,43,1,53,50,23,22,21,6,21,20,23,34,7,35,34,39,6,7,35,34,39,53,52,55,5,50,23,21,20,15,1,34,39,38,61,1,52,55,54,51,50,23,35,6,35,38,39,6,15,1,35,34,39,55,51,22,21,51,54,5,22,21,50,21,20,7,6,35,21,20,23,51,50,55,51,
-20,23,21,6,43,1,34,39,53,52,55,54,33,51,50,23,22,23,6,7,22,21,7,35,39,6,43,1,38,61,1,54,51,50,23,53,52,39,35,34,7,35,34,39,53,54,5,50,23,20,51,54,55,54,53,51,50,23,6,29,1,20,23,6,21,35,38,39,35,6,7,35,34,61,1,23,22,59,1,50,55,54,53,38,43,1,34,5,50,55,
-38,43,1,34,5,22,59,1,50,55,38,43,1,6,5,50,23,6,7,20,23,6,43,1,34,39,35,20,7,34,39,38,53,52,55,51,50,23,53,52,39,23,6,29,1,54,51,22,21,35,6,35,22,23,6,35,53,38,53,39,35,53,51,53,52,33,51,23,6,29,1,54,51,23,21,6,21,20,23,6,35,53,38,53,35,53,51,52,39,50,
-23,21,20,7,35,38,53,54,23,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,59,1,50,29,1,54,51,50,23,20,23,6,15,1,35,23,20,23,35,38,55,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,51,50,23,51,54,59,1,50,23,35,6,43,1,
-38,35,6,7,6,35,34,39,38,35,6,21,6,35,53,39,54,51,22,23,51,54,5,22,29,1,6,7,35,52,39,35,34,7,21,20,51,22,29,1,20,7,6,43,1,34,39,52,55,51,22,51,50,53,52,39,34,39,38,61,1,52,5,22,51,6,29,1,20,23,51,54,61,1,51,21,22,29,1,20,7,6,35,34,39,38,61,1,52,51,23,
-7,21,20,23,51,50,55,54,61,1,39,35,6,43,1,34,39,38,61,1,52,5,51,50,23,22,21,6,35,49,38,43,1,6,15,1,20,23,51,50,55,51,22,21,6,35,34,39,52,55,54,5,51,23,20,7,22,23,35,39,38,39,22,29,1,20,59,1,54,55,54,55,51,22,21,6,29,1,20,23,20,7,49,38,53,35,6,43,1,34,
-53,23,20,23,51,50,55,53,52,47,1,35,34,7,23,20,23,51,50,55,54,61,1,38,43,1,34,23,20,31,1,50,55,38,43,1,34,23,21,20,23,51,50,55,54,53,38,35,34,23,20,59,1,50,55,54,61,1,38,43,1,34,7,50,23,21,6,35,34,39,54,3,21,33,34,7,53,18,33,51,50,23,22,21,33,5,33,21,
-38,43,1,34,61,1,54,41,1,23,21,20,7,35,38,53,37,51,20,23,51,50,29,1,20,43,1,38,53,1,51,22,51,21,6,43,1,34,39,53,50,100,5,55,250,236,4,240,251,16,2,78,3,11,2,7,6,3,1,243,1,14,1,3,11,4,2,1,1,254,78,4,7,4,15,1,21,14,2,12,1,6,12,2,8,13,7,1,11,16,5,20,7,1,
-1,56,6,12,16,12,40,7,7,7,30,5,40,8,252,181,9,28,33,12,15,1,5,9,5,5,5,5,6,6,18,3,74,25,22,15,5,26,3,17,18,3,252,189,1,1,29,8,8,15,6,26,180,19,9,1,14,6,7,17,3,1,10,5,13,12,3,3,1,10,151,20,13,2,35,5,4,27,25,2,86,19,17,1,8,4,15,8,9,9,1,4,7,7,2,2,7,7,3,1,
-7,2,73,16,19,9,4,15,9,6,13,3,1,6,7,3,6,9,1,1,7,253,72,18,10,1,4,9,13,3,29,20,20,8,5,24,10,1,8,1,12,16,14,4,17,28,1,221,13,7,11,3,11,12,5,29,19,24,8,23,12,8,2,1,12,15,14,16,25,5,2,1,118,13,1,1,2,11,1,18,15,7,30,2,3,5,18,5,1,3,1,9,3,1,9,2,23,1,1,8,18,1,
-19,6,252,108,23,39,10,17,11,10,4,8,17,13,7,26,4,32,1,105,11,27,1,2,9,4,1,2,12,11,7,22,32,11,9,4,13,9,9,3,2,6,12,1,57,24,42,7,7,9,10,13,1,1,8,21,4,5,7,24,5,30,254,57,2,10,3,24,2,6,14,2,13,5,1,211,19,14,7,2,16,8,2,141,3,17,14,6,3,3,16,6,254,221,10,17,8,
-8,11,16,49,13,2,6,2,3,5,6,2,1,2,5,4,3,11,5,11,4,1,5,5,6,4,3,3,14,200,12,4,8,2,7,8,3,5,5,1,1,1,11,2,4,11,4,9,3,11,3,88,4,6,3,11,2,26,1,8,3,11,3,204,8,2,2,2,12,1,13,4,2,8,3,2,13,11,2,1,212,3,9,3,3,12,3,12,5,5,6,3,15,1,11,1,148,3,9,2,2,12,1,13,4,2,9,4,13,
-11,1,253,34,10,14,9,6,3,9,12,17,18,9,24,2,6,31,4,8,10,28,5,2,2,4,1,7,1,4,2,6,23,2,38,5,45,1,213,23,11,34,7,16,8,2,19,8,83,15,19,1,5,4,15,9,7,16,2,4,6,3,8,2,3,1,9,254,71,20,1,35,5,10,17,1,10,13,3,6,14,15,6,19,8,26,5,2,94,11,16,8,2,1,1,2,2,6,3,3,10,15,
-4,21,3,27,12,9,18,3,6,11,1,1,5,10,254,72,2,9,14,19,9,1,1,3,7,3,5,5,2,7,1,2,4,15,9,20,207,2,13,1,16,11,3,6,16,4,15,254,121,23,16,2,9,3,19,2,93,3,8,6,14,8,9,8,2,20,253,207,1,16,4,1,10,11,1,1,3,3,2,21,33,14,3,34,4,14,15,188,15,2,13,2,2,2,9,6,3,2,12,5,5,
-2,14,15,1,107,1,15,2,14,2,1,16,5,13,4,5,18,17,125,9,2,8,7,8,2,71,25,16,2,39,4,9,27,5,30,10,194,5,11,9,10,25,8,1,3,28,8,10,1,1,17,5,115,23,16,4,38,8,6,22,9,2,30,11,203,24,15,4,39,4,9,28,4,30,10,95,17,10,1,8,19,1,24,16,2,11,2,1,19,6,10,7,3,7,8,3,13,6,16,
-10,7,12,13,4,2,2,2,9,252,86,24,1,11,3,13,1,13,7,31,27,22,5,5,9,23,16,11,3,8,22,18,21,27,5,4,1,241,12,3,1,12,5,22,17,8,28,10,6,22,7,2,4,14,1,11,4,20,5,1,1,1,10,19,2,23,7,1,1,67,8,6,9,11,11,1,11,7,2,12,6,4,14,3,11,23,1,6,25,22,23,5,19,12,254,22,12,6,1,
-1,3,18,1,2,187,17,12,5,17,7,5,1,2,15,3,5,10,12,1,11,17,3,29,104,30,3,12,3,21,6,2,17,2,129,15,4,15,14,2,7,17,2,21,230,3,7,22,4,3,14,1,10,66,15,2,16,14,4,6,22,19,198,17,3,14,15,2,8,17,1,20,120,9,3,3,9,9,2,1,250,254,251,54,49,147,1,44,10,132,147,56,254,
-167,254,140,1,33,35,40,214,19,3,1,132,1,127,9,131,167,94,254,37,9,140,177,66,103,158,131,1,173,9,61,126,108,79,9,80,107,132,254,230,6,174,249,82,40,6,104,252,97,1,18,70,56,2,71,67,3,6,1,9,4,55,76,2,58,71,12,1,2,10,18,12,18,44,14,117,4,58,28,31,16,4,32,
-28,61,4,18,11,25,19,28,22,22,9,37,21,3,43,9,50,38,2,4,5,35,34,15,5,2,37,3,34,1,11,8,41,7,4,24,86,8,21,3,27,8,10,3,27,26,2,50,11,49,35,12,2,6,11,10,8,18,3,3,1,49,4,33,9,66,14,1,2,69,18,2,1,4,15,43,6,32,9,8,3,36,17,1,4,34,50,15,1,2,89,7,7,62,18,13,57,10,
-57,14,9,2,17,3,41,96,7,66,14,12,62,6,80,2,19,3,43,2,5,12,1,2,6,7,11,5,1,11,23,25,9,2,23,1,3,8,15,4,12,15,22,3,30,18,1,7,6,1,10,1,5,1,9,27,26,8,23,1,11,15,4,12,12,3,11,11,3,30,1,2,18,8,9,35,13,54,3,78,10,46,10,19,5,5,15,6,9,8,1,42,5,16,24,47,17,10,18,
-4,18,6,20,16,11,5,18,12,3,22,45,40,13,1,9,36,21,14,16,8,11,8,3,18,8,30,5,1,5,1,25,10,1,10,2,14,4,19,29,12,2,14,18,12,9,13,3,44,40,14,62,18,7,28,3,26,32,7,13,18,2,2,19,3,19,3,21,32,3,3,3,17,7,3,112,34,3,1,21,19,2,2,10,29,3,15,3,57,12,54,11,2,17,2,21,31,
-29,37,1,1,15,5,5,10,8,38,1,3,8,7,3,3,12,54,6,59,2,17,1,46,6,30,17,9,61,71,65,37,39,30,32,79,66,70,3,2,3,2,29,13,2,17,2,74,2,29,46,16,1,18,27,2,13,16,13,2,17,2,74,2,62,13,8,8,1,1,21,23,2,18,16,8,2,8,9,2,6,15,53,2,75,16,1,42,23,6,3,15,26,19,15,5,29,6,1,
-3,17,10,3,17,9,7,2,25,4,11,15,5,22,8,4,51,4,58,21,30,38,14,34,16,1,20,11,6,4,41,16,5,94,4,67,12,7,72,1,76,2,16,17,54,4,4,16,2,23,13,3,1,11,6,16,2,7,1,22,32,15,33,13,2,28,16,2,6,20,4,19,4,12,11,3,17,8,32,8,3,25,4,8,7,2,13,2,3,74,12,54,5,6,3,24,21,12,9,
-10,7,4,4,22,15,14,75,10,48,23,25,8,3,31,31,22,6,56,8,18,8,3,92,4,38,54,34,35,10,13,8,8,42,12,16,48,10,16,1,8,51,5,23,13,14,3,20,4,1,63,28,2,1,61,27,2,24,9,46,5,28,17,5,3,14,10,1,1,23,67,2,1,75,15,24,34,18,14,1,11,5,5,12,14,41,38,11,6,9,40,20,2,41,14,
-51,18,2,3,2,5,44,11,3,52,12,1,8,6,34,132,39,35,13,11,43,22,2,27,12,11,54,20,2,35,8,11,8,43,19,2,41,14,51,18,2,58,58,118,5,98,22,60,10,15,76,58,35,4,1,104,6,8,23,43,1,5,16,1,2,7,7,1,10,4,6,12,26,5,28,10,3,25,5,11,18,20,15,3,12,8,4,8,34,1,4,23,11,6,33,
-11,18,54,10,1,89,14,10,44,16,4,20,4,5,9,15,7,8,4,8,2,33,4,8,20,13,30,50,8,12,9,33,1,9,12,6,13,15,5,23,21,22,2,16,20,2,18,46,34,30,12,2,1,3,5,67,42,8,68,41,5,1,20,67,19,36,10,28,2,4,42,17,10,10,10,6,12,12,13,29,93,32,34,6,26,3,36,12,1,35,18,22,3,29,4,
-5,9,31,8,3,64,1,42,34,53,5,17,3,26,8,10,34,53,25,30,6,4,7,31,67,14,5,13,15,17,5,184,242,38,10,1,14,149,68,25,84,94,19,19,37,19,94,18,185,113,12,81,242,72,12,65,103,83,120,159,254,205,56,10,37,37,10,0,1,0,0,0,0,2,183,6,26,0,3,0,0,9,1,35,1,2,183,254,51,
-234,1,207,6,26,249,230,6,26,0,0,2,0,100,0,0,4,151,6,27,0,17,0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,3,91,158,158,158,158,222,221,158,158,158,158,221,121,86,85,85,86,121,121,86,86,
-86,86,121,6,27,158,158,221,254,24,222,158,158,158,158,222,1,232,221,158,158,250,86,86,121,254,36,121,86,86,86,86,121,1,220,121,86,86,0,1,0,10,0,0,2,27,6,26,0,25,0,0,37,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,27,35,36,
-50,2,50,36,35,164,49,36,36,36,36,49,1,31,50,36,35,121,50,35,36,36,35,50,4,173,35,36,50,2,50,36,35,35,36,50,0,1,0,100,0,0,4,100,6,26,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,
-35,33,34,39,38,61,1,52,55,54,51,2,161,183,129,129,128,75,192,189,68,110,2,139,51,34,36,36,34,51,252,242,49,36,36,127,87,184,223,39,109,57,58,81,254,110,50,36,36,36,36,50,6,26,129,129,182,160,130,78,118,119,65,109,98,36,36,50,2,51,34,36,36,34,51,94,184,
-149,102,117,144,31,91,89,81,57,58,35,36,50,2,50,36,35,0,1,0,70,0,0,3,167,6,26,0,60,0,0,1,50,23,22,21,20,7,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,35,33,34,39,38,61,1,
-52,55,54,51,1,215,182,130,129,129,152,136,136,192,254,232,49,36,36,36,36,49,1,24,91,64,63,63,64,91,236,50,36,35,35,36,50,236,81,57,57,57,58,80,254,232,49,36,36,36,36,49,6,26,129,129,182,206,108,116,229,191,136,136,36,34,51,2,50,36,36,63,64,91,91,64,64,
-36,35,50,2,50,36,35,1,56,57,82,81,57,58,35,36,50,2,50,36,35,0,0,0,0,2,0,70,0,0,4,206,6,26,0,38,0,41,0,0,1,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,5,17,1,2,105,34,72,150,49,36,36,115,50,36,
-35,35,36,50,115,36,36,49,3,49,36,36,253,210,49,36,36,15,2,152,254,125,5,220,62,35,36,50,252,118,36,36,50,2,50,35,36,169,51,34,36,36,34,51,169,36,34,51,70,32,26,4,2,187,253,69,0,0,0,0,1,0,120,0,0,4,80,6,26,0,49,0,0,19,34,39,38,53,17,52,55,54,51,33,50,
-23,22,29,1,20,7,6,35,33,17,33,50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,241,49,36,36,36,36,49,2,98,49,36,36,36,36,49,254,26,1,19,192,136,136,136,136,192,254,113,49,36,36,36,36,49,1,143,91,64,63,63,64,91,2,170,36,34,
-51,2,126,50,36,35,35,36,50,2,50,36,35,254,120,135,136,192,191,136,136,36,34,51,2,50,36,36,63,64,91,91,64,64,0,0,2,0,100,0,0,4,134,6,26,0,14,0,49,0,0,1,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,
-34,7,6,29,1,33,50,23,22,21,20,7,6,35,1,89,64,64,90,131,91,64,63,63,64,91,131,191,136,136,136,136,191,1,49,50,36,36,36,36,50,254,207,90,64,64,1,93,192,136,136,136,136,192,2,170,219,91,64,63,63,64,91,91,64,64,253,86,136,136,191,2,124,192,135,136,35,36,
-50,2,50,36,35,64,64,91,173,135,136,192,191,136,136,0,0,0,0,1,0,10,0,0,3,162,6,26,0,25,0,0,37,20,7,6,43,1,34,39,38,53,1,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,18,35,36,50,2,51,34,36,1,104,253,253,49,36,36,36,36,49,2,166,50,36,35,117,46,35,36,36,
-34,55,4,169,35,36,50,2,50,36,35,35,36,54,0,0,3,0,100,0,0,4,152,6,26,0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,
-20,23,22,51,2,201,182,129,130,129,151,136,135,192,150,191,136,136,152,129,129,129,182,150,91,63,64,64,64,90,150,90,64,64,64,64,90,150,81,57,57,57,58,80,150,80,58,57,57,57,81,6,26,129,129,182,206,108,116,229,191,136,136,136,136,191,229,116,108,206,182,
-129,129,250,219,63,64,91,91,64,64,64,64,91,91,64,63,2,170,56,57,82,81,57,58,58,57,81,82,57,56,0,0,0,0,2,0,100,0,0,4,134,6,26,0,14,0,49,0,0,1,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,
-55,33,34,39,38,53,52,55,54,51,3,145,64,64,91,131,90,64,64,64,64,90,131,192,136,136,136,136,192,254,120,50,36,35,35,36,50,1,136,91,64,63,1,254,162,191,136,136,136,136,191,3,112,219,91,64,64,64,64,91,91,64,64,2,170,136,135,192,253,132,191,136,136,36,35,
-50,2,50,36,36,63,64,91,173,136,136,191,192,135,136,0,0,0,2,0,100,0,0,1,124,4,128,0,15,0,31,0,0,51,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,57,58,41,41,41,41,58,57,41,
-42,42,41,41,41,58,57,41,41,41,40,58,59,40,41,3,105,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,0,23,255,72,1,124,4,128,0,19,0,35,0,0,37,50,23,22,21,20,7,3,6,43,1,34,39,38,53,52,55,19,54,51,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,32,36,21,11,7,
-129,18,44,66,34,21,14,3,78,12,53,71,58,41,41,41,41,58,57,41,42,42,41,241,32,17,18,15,15,254,225,41,27,19,21,9,10,1,31,52,2,120,41,41,58,57,41,41,41,40,58,59,40,41,0,1,0,50,0,236,4,116,5,25,0,26,0,0,19,38,61,1,52,55,1,54,51,50,23,22,29,1,20,7,9,1,22,29,
-1,20,7,6,35,34,39,103,53,53,3,154,17,16,24,21,37,53,252,250,3,6,53,37,21,24,16,17,2,90,20,58,181,57,22,1,102,7,15,25,45,67,56,22,254,208,254,207,20,58,67,45,25,15,7,0,0,0,0,2,0,50,1,178,4,78,4,90,0,19,0,39,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,
-33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,4,78,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,2,43,51,34,36,36,34,51,2,50,36,36,36,36,50,1,177,51,34,36,36,34,51,2,50,36,
-36,36,36,50,0,1,0,50,0,236,4,116,5,25,0,26,0,0,55,6,35,34,39,38,61,1,52,55,9,1,38,61,1,52,55,54,51,50,23,1,22,29,1,20,7,165,17,16,24,21,37,53,3,7,252,249,53,37,21,24,16,17,3,154,53,53,243,7,15,25,45,67,58,20,1,49,1,48,22,56,67,45,25,15,7,254,154,22,57,
-181,58,20,0,2,0,82,255,255,3,252,6,10,0,50,0,66,0,0,0,23,22,21,20,7,6,7,21,20,7,6,43,1,34,39,38,61,1,52,55,54,55,51,50,55,54,53,52,39,38,35,34,7,6,7,6,7,6,43,1,34,39,38,53,52,55,54,55,54,51,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,2,229,140,139,106,
-103,149,35,35,49,3,49,35,35,35,34,49,5,98,68,69,69,68,98,79,62,61,23,11,32,31,40,3,60,36,24,6,45,125,127,159,3,58,41,41,41,41,58,57,41,42,42,41,6,10,139,140,197,169,130,129,34,130,47,36,35,35,36,49,235,49,35,35,1,68,69,98,98,69,68,47,46,73,38,23,23,48,
-32,37,18,19,148,94,95,249,245,41,41,58,57,41,41,41,40,58,59,40,41,0,0,1,0,100,254,104,8,57,6,48,0,86,0,0,0,43,1,32,1,0,17,16,1,0,33,32,1,0,17,20,7,6,7,35,34,39,38,61,1,55,52,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,23,6,7,6,35,34,39,38,39,38,
-53,16,55,54,51,50,23,22,17,7,21,20,23,54,55,54,53,16,39,38,33,32,7,6,17,16,23,22,33,51,50,55,23,5,58,235,2,254,96,254,220,254,219,1,37,1,37,1,161,1,160,1,37,1,37,131,130,165,17,100,67,91,2,99,60,90,36,34,53,54,206,170,69,79,9,10,86,103,98,134,130,21,
-21,137,128,140,78,80,174,160,227,226,160,175,1,18,48,64,80,225,221,254,201,254,200,224,222,225,222,1,53,2,180,199,95,254,104,1,38,1,33,1,157,1,156,1,33,1,39,254,217,254,223,254,100,251,190,189,8,65,86,236,20,223,154,87,53,16,7,17,63,237,196,87,36,2,6,
-69,221,78,10,1,64,72,128,130,158,1,1,152,142,141,153,254,255,225,24,133,15,3,106,132,164,1,61,225,221,224,222,254,195,254,194,225,220,103,217,0,0,0,0,2,0,110,0,0,4,121,6,26,0,30,0,41,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,
-52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,4,121,36,36,49,3,49,36,36,253,223,36,36,49,3,49,36,36,152,152,213,214,152,152,245,79,80,114,113,80,79,121,51,34,36,36,34,51,1,190,254,66,51,34,36,36,34,51,3,156,214,152,151,151,152,214,234,234,113,
-80,80,80,80,113,234,0,0,3,0,110,0,0,4,70,6,26,0,14,0,37,0,52,0,0,1,37,50,55,54,53,52,39,38,43,1,34,7,6,21,35,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,5,50,55,54,53,52,39,38,35,33,17,20,23,22,51,1,99,1,19,82,57,57,57,58,81,238,16,11,
-10,245,83,83,116,238,183,129,129,129,152,136,136,192,238,116,83,83,2,8,91,64,63,63,64,91,254,237,10,11,16,3,158,1,56,57,82,81,57,58,11,11,16,117,83,82,129,129,182,206,108,116,229,191,136,136,83,83,116,37,63,64,91,91,64,64,254,112,16,11,10,0,0,1,0,75,
-0,0,4,118,6,26,0,41,0,0,0,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,3,187,95,92,48,32,38,16,17,67,68,222,157,157,157,157,222,68,67,17,16,38,32,48,92,95,99,254,189,229,229,229,229,
-1,67,6,26,24,24,93,3,59,37,25,4,17,157,157,223,223,157,156,16,4,25,36,60,2,94,24,24,229,229,1,67,1,67,229,229,0,0,0,0,2,0,110,0,0,5,44,6,26,0,18,0,37,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,21,19,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,
-55,54,51,1,99,10,11,16,151,223,157,157,157,157,223,151,16,11,10,188,1,67,229,229,229,229,254,189,151,116,83,83,83,83,116,1,26,16,11,10,156,157,223,223,157,157,11,11,16,1,26,229,229,254,189,254,189,229,229,83,83,116,3,230,117,83,82,0,0,0,1,0,110,0,0,3,
-185,6,26,0,51,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,99,1,221,49,36,36,36,36,49,254,35,35,35,50,1,101,49,36,36,36,36,49,254,155,151,107,107,
-107,107,151,1,101,49,36,36,36,36,49,254,155,50,35,35,3,135,35,36,50,2,50,36,35,254,218,50,35,35,36,36,50,2,51,34,36,107,107,151,3,64,151,107,107,36,34,51,2,50,36,36,35,35,50,0,0,0,0,1,0,110,0,0,3,135,6,26,0,41,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,
-7,6,43,1,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,99,1,161,49,36,36,36,36,49,254,95,36,36,49,3,49,36,36,107,107,151,1,51,49,36,36,36,36,49,254,205,50,35,35,3,135,35,36,50,2,51,34,36,253,230,51,34,36,36,34,51,4,52,151,107,107,
-35,36,50,2,50,36,35,35,35,51,0,0,1,0,80,0,0,6,107,6,26,0,56,0,0,0,23,22,21,20,7,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,7,6,33,32,39,38,17,16,55,54,33,4,180,232,33,1,7,42,2,33,
-37,7,7,45,32,159,236,222,157,157,157,157,222,199,150,149,26,254,13,50,36,35,35,36,50,2,123,50,36,35,1,229,230,254,189,254,189,229,229,229,229,1,67,6,26,252,36,46,7,6,55,29,2,24,1,4,35,173,157,157,223,223,157,156,129,128,157,36,35,50,2,50,36,35,35,36,
-50,1,254,189,229,229,229,229,1,67,1,67,229,229,0,0,0,1,0,110,0,0,4,130,6,26,0,43,0,0,19,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,234,49,36,36,2,42,36,36,49,3,49,36,36,36,
-36,49,3,49,36,36,253,214,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,253,230,2,26,50,36,35,35,36,50,250,216,51,34,36,36,34,51,2,26,253,230,51,34,36,36,34,51,5,40,50,36,35,0,1,0,140,0,0,1,129,6,26,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,
-55,54,51,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,250,216,51,34,36,36,34,51,5,40,50,36,35,0,0,1,0,10,0,0,2,169,6,26,0,29,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,1,181,35,36,50,2,50,36,35,107,
-107,151,185,49,36,36,36,36,49,185,51,35,35,5,161,50,36,35,35,36,50,251,204,151,107,107,36,34,51,2,50,36,36,35,35,50,0,0,0,1,0,110,0,0,4,54,6,26,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,16,7,22,23,22,21,17,20,7,6,43,1,34,
-39,38,53,17,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,234,49,36,36,104,137,96,97,1,36,35,50,3,49,36,36,196,89,74,76,35,36,50,2,50,36,35,1,97,97,137,147,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,254,24,96,97,136,159,50,36,35,35,36,50,159,
-254,223,146,54,129,133,154,255,0,50,35,36,36,35,50,1,0,136,97,96,253,183,51,34,36,36,34,51,5,40,50,36,35,0,0,0,1,0,120,0,0,3,130,6,26,0,29,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,109,35,35,50,1,35,50,
-36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,0,1,0,110,0,0,6,253,6,26,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,
-17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,99,36,36,49,3,49,36,36,141,141,199,238,121,120,238,199,141,141,35,36,50,2,51,34,36,69,69,99,98,69,69,36,34,51,2,50,36,36,69,69,98,98,69,69,121,51,34,36,36,34,51,3,192,199,
-141,141,158,158,141,141,199,252,64,50,35,36,36,34,51,3,192,99,69,69,69,69,99,252,64,51,34,36,36,34,51,3,192,99,69,69,69,69,99,0,0,0,0,1,0,110,0,0,4,121,6,26,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,
-55,54,51,50,23,22,21,4,121,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,152,152,213,214,152,152,121,51,34,36,36,34,51,3,156,113,80,80,80,80,113,252,100,51,34,36,36,34,51,3,156,214,152,151,151,152,214,0,0,2,0,80,0,0,6,107,6,26,0,15,0,31,
-0,0,0,23,22,17,16,7,6,33,32,39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,4,160,230,229,229,230,254,189,254,189,229,229,229,229,1,67,222,157,157,157,157,222,223,157,157,157,157,223,6,26,229,229,254,189,254,189,229,229,229,229,1,67,
-1,67,229,229,244,157,157,223,223,157,156,156,157,223,223,157,157,0,0,2,0,110,0,0,4,148,6,26,0,13,0,37,0,0,1,33,50,55,54,53,52,39,38,35,34,7,6,21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,1,99,1,30,119,84,83,83,84,119,119,84,83,
-36,36,49,3,49,36,36,156,156,219,220,155,156,156,155,220,2,233,84,83,119,119,84,84,84,84,119,253,237,254,133,51,34,36,36,34,51,3,142,220,156,155,155,156,220,219,156,156,0,0,2,0,80,254,243,6,107,6,26,0,26,0,53,0,0,0,23,22,17,16,7,6,5,21,20,7,6,43,1,34,
-39,38,61,1,36,39,38,17,16,55,54,33,19,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,4,160,230,229,199,195,254,247,36,36,50,2,50,35,36,254,247,196,198,229,229,1,67,1,50,36,36,157,128,129,157,157,223,222,157,157,129,128,157,
-36,34,51,6,26,229,229,254,189,254,215,222,220,33,157,50,36,35,35,36,50,157,33,220,222,1,41,1,67,229,229,252,53,36,36,49,213,26,149,151,198,223,157,157,157,157,223,199,149,150,26,213,49,36,36,0,2,0,110,0,0,4,106,6,26,0,16,0,58,0,0,1,50,55,54,53,52,39,
-38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,2,118,106,75,75,75,75,106,115,75,42,33,9,2,2,20,75,68,94,254,217,35,36,50,2,51,34,36,114,115,161,130,207,146,
-147,147,23,24,146,36,36,49,2,49,36,36,3,38,74,75,106,107,75,74,41,33,45,11,24,254,155,254,12,106,75,69,5,254,72,50,35,36,36,34,51,4,27,161,114,115,147,147,207,206,147,24,25,146,207,185,51,34,36,36,34,51,0,0,1,0,70,0,0,4,2,6,32,0,53,0,0,1,34,7,6,21,20,
-23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,39,38,53,52,55,54,51,33,50,23,22,29,1,20,7,6,35,2,18,86,60,60,93,41,200,171,79,118,134,133,187,254,131,49,36,36,36,36,49,1,135,85,61,60,93,44,198,171,78,118,133,
-133,188,1,13,50,36,35,35,36,50,5,40,60,60,86,102,53,23,58,51,72,107,194,188,133,133,36,36,49,6,49,36,36,60,60,86,100,56,26,62,56,71,106,183,188,133,133,36,35,50,6,49,36,36,0,1,0,40,0,0,3,246,6,26,0,31,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,
-34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,246,36,35,50,244,35,36,50,2,50,36,35,244,49,36,36,36,36,49,2,220,50,35,36,5,159,50,36,35,251,83,50,35,36,36,35,50,4,173,35,36,50,2,50,36,35,35,36,50,0,1,0,110,0,0,4,121,6,26,0,37,0,0,1,20,7,6,35,34,39,38,53,
-17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,4,121,152,152,214,213,152,152,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,2,5,214,151,152,152,151,214,3,156,50,36,35,35,36,50,252,100,113,80,79,79,80,
-113,3,156,50,36,35,35,36,50,0,1,0,20,0,0,4,173,6,26,0,25,0,0,9,1,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,2,97,1,88,28,86,7,63,36,24,8,254,102,46,125,124,47,254,103,8,23,37,62,7,87,28,1,97,4,103,82,50,33,36,20,22,250,252,117,
-117,5,4,22,21,36,32,50,82,0,1,0,110,0,0,6,253,6,26,0,60,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,99,69,69,98,
-98,69,69,36,36,50,2,50,35,36,69,69,98,99,69,69,36,35,50,2,50,36,35,141,141,199,238,120,121,238,199,141,141,36,36,49,3,49,36,36,1,225,98,69,69,69,69,98,3,192,50,36,35,35,36,50,252,64,98,69,69,69,69,98,3,192,50,36,35,35,36,50,252,64,199,141,141,158,158,
-141,141,199,3,192,50,36,35,35,36,50,0,0,0,1,0,100,0,0,4,111,6,26,0,67,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,16,55,38,17,53,52,55,54,59,1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,
-1,16,7,22,17,4,111,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,181,181,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,181,181,121,51,34,36,36,34,51,1,47,113,80,80,80,80,113,254,209,51,34,36,36,34,51,1,47,1,8,131,131,1,8,227,
-50,36,35,35,36,50,227,113,80,80,80,80,113,227,50,36,35,35,36,50,227,254,248,131,131,254,248,0,0,1,0,100,0,0,4,111,6,26,0,48,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,
-1,50,23,22,21,4,111,120,119,156,36,36,49,3,49,36,36,156,119,120,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,3,229,188,144,141,31,254,140,51,34,36,36,34,51,1,116,31,141,144,188,1,188,50,36,35,35,36,50,254,68,114,80,79,79,80,114,1,188,50,
-36,35,35,36,50,0,0,0,1,0,40,0,0,4,29,6,26,0,35,0,0,19,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,39,38,53,52,55,1,33,34,39,38,53,84,35,36,50,2,107,88,61,62,35,253,81,2,107,51,34,36,36,34,51,253,71,83,56,56,27,2,185,253,209,50,
-36,35,5,161,50,36,35,1,63,63,87,65,54,252,40,36,36,50,2,51,34,36,8,62,61,84,55,50,3,230,35,36,50,0,0,0,1,0,100,254,101,2,99,6,26,0,7,0,0,19,33,21,33,17,33,21,33,100,1,255,254,246,1,10,254,1,6,26,191,249,202,192,0,0,0,0,1,0,0,0,0,2,183,6,26,0,3,0,0,19,
-1,35,1,233,1,206,233,254,50,6,26,249,230,6,26,0,0,0,1,0,100,254,101,2,99,6,26,0,7,0,0,1,33,53,33,17,33,53,33,2,99,254,1,1,10,254,246,1,255,254,101,192,6,54,191,0,0,0,1,0,247,3,50,4,97,6,26,0,26,0,0,1,54,59,1,50,23,1,22,21,20,7,6,43,1,34,39,11,1,6,43,
-1,34,39,38,53,52,55,2,13,21,61,154,60,22,1,14,8,17,25,47,72,60,22,194,195,21,60,72,48,25,16,7,5,227,55,55,253,201,18,17,25,23,39,55,1,169,254,87,55,39,23,26,16,18,0,1,255,246,255,10,3,249,255,255,0,3,0,0,7,53,33,21,10,4,3,246,245,245,0,1,0,11,4,222,1,
-224,6,97,0,19,0,0,19,38,53,52,55,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,29,18,9,19,42,155,36,18,175,15,8,19,42,76,27,25,5,240,18,22,16,18,39,28,250,20,21,15,16,37,23,0,0,0,0,2,0,100,0,0,4,228,4,128,0,23,0,39,0,0,0,23,22,21,17,20,7,6,43,1,34,39,38,53,
-6,35,34,39,38,53,52,55,54,51,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,3,146,169,169,36,36,49,3,49,36,36,114,217,238,169,169,169,169,238,138,97,96,96,97,138,138,96,97,97,97,137,4,128,169,169,238,254,57,51,34,36,36,34,51,121,169,169,238,238,169,169,
-245,97,97,137,138,97,96,96,97,138,137,97,97,0,2,0,100,0,0,4,228,6,26,0,15,0,40,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,1,50,23,22,21,17,54,51,50,23,22,21,20,7,6,35,34,39,38,39,17,52,55,54,51,2,164,138,97,96,96,97,138,137,97,97,97,97,253,179,
-49,36,36,113,218,238,169,169,169,169,238,238,168,169,1,36,36,49,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,254,123,100,169,169,238,238,169,169,168,167,238,3,100,50,36,35,0,0,0,1,0,70,0,0,3,137,4,128,0,40,0,0,0,23,22,29,1,20,7,6,35,34,
-39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,2,224,84,85,49,34,36,19,20,49,52,138,97,96,96,97,138,52,49,19,19,37,34,49,85,84,90,238,169,169,169,169,238,4,128,27,27,89,5,61,36,24,6,16,97,97,138,137,97,97,16,
-6,24,36,62,88,28,26,169,169,238,238,169,169,0,0,2,0,70,0,0,4,198,6,26,0,15,0,40,0,0,0,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,1,50,23,22,21,17,6,7,6,35,34,39,38,53,52,55,54,51,50,23,17,52,55,54,51,1,252,97,96,96,97,138,137,97,97,97,97,137,1,199,49,
-36,36,1,169,169,237,238,169,169,169,169,238,217,114,36,36,49,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,252,156,238,167,168,169,169,238,238,169,169,100,1,133,50,36,35,0,0,0,2,0,70,0,0,4,173,4,128,0,7,0,47,0,0,1,34,7,6,29,1,37,38,5,22,
-21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,2,134,138,97,96,2,47,74,1,113,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,238,169,169,169,169,238,172,142,141,
-3,137,97,97,138,7,251,88,89,25,26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,169,238,238,169,169,94,92,0,1,0,100,0,0,2,207,6,26,0,40,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,51,50,23,22,29,1,20,7,6,43,1,17,20,7,6,43,1,34,
-39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,253,50,36,35,35,36,50,253,36,36,49,3,49,36,36,2,127,129,183,6,26,35,36,50,2,50,36,35,57,57,53,36,35,50,2,50,36,36,252,239,51,34,36,36,34,51,3,233,183,128,129,0,0,2,0,70,254,101,4,198,4,128,
-0,37,0,54,0,0,4,51,50,55,54,53,6,35,34,39,38,53,52,55,54,51,50,23,22,23,17,20,7,6,35,32,3,38,53,52,55,54,63,1,54,51,50,23,1,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,53,1,190,200,125,101,105,114,217,238,169,169,169,169,238,237,169,169,1,181,175,220,
-254,175,168,20,7,18,56,3,25,23,56,38,2,118,2,97,96,136,138,97,96,96,97,138,138,96,97,166,98,100,133,165,169,169,238,238,169,169,168,167,239,254,99,234,174,168,1,6,31,33,20,20,56,20,1,9,56,2,85,135,95,95,97,97,137,138,97,96,96,97,138,0,0,1,0,100,0,0,4,
-43,6,26,0,45,0,0,19,50,23,22,21,17,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,79,160,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,36,36,49,3,49,36,36,36,36,49,6,26,
-35,36,50,254,164,59,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,253,221,51,34,36,36,34,51,5,40,50,36,35,0,2,0,120,0,0,1,144,6,25,0,19,0,35,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,55,34,39,38,53,52,55,54,51,50,23,22,
-21,20,7,6,1,5,51,34,36,36,34,51,2,50,36,36,36,36,50,1,58,41,41,41,41,58,57,41,42,42,41,4,128,36,36,50,252,115,51,34,36,36,34,51,3,141,50,36,36,130,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,255,46,254,101,1,170,6,27,0,29,0,45,0,0,3,34,39,38,61,1,52,
-55,54,59,1,50,55,54,55,17,52,55,54,59,1,50,23,22,21,17,6,7,6,35,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,89,49,36,36,36,36,49,58,81,57,57,1,35,36,50,2,50,36,35,2,127,127,184,1,61,58,41,41,41,41,58,57,41,42,42,41,254,101,36,36,49,3,49,36,36,57,57,
-82,3,232,50,36,36,36,36,50,252,24,184,128,129,6,159,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,0,1,0,100,0,0,3,235,6,26,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,
-17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,253,75,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,
-51,51,34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,51,5,40,50,36,35,0,0,0,1,0,140,0,0,1,129,6,26,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,250,216,51,34,36,36,34,51,
-5,40,50,36,35,0,0,1,0,140,0,0,2,144,6,26,0,29,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,8,49,36,36,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,6,26,35,36,50,251,153,29,20,20,36,36,50,2,51,34,36,
-92,93,129,4,103,50,36,35,0,0,1,0,100,0,0,6,243,4,128,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,89,36,36,49,3,49,
-36,36,141,141,199,238,121,120,238,199,141,141,35,36,50,2,51,34,36,69,69,99,98,69,69,36,34,51,2,50,36,36,69,69,98,98,69,69,121,51,34,36,36,34,51,2,38,198,142,141,158,158,141,142,198,253,218,50,35,36,36,34,51,2,38,98,69,69,69,69,98,253,218,51,34,36,36,
-34,51,2,38,98,69,69,69,69,98,0,0,0,0,1,0,100,0,0,4,43,4,128,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,89,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,36,69,70,
-99,100,70,69,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,0,0,2,0,70,0,0,4,198,4,128,0,15,0,31,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,39,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,2,134,
-138,97,96,96,97,138,137,97,97,97,97,137,238,169,169,169,169,238,238,169,169,169,169,3,137,97,97,138,137,97,97,97,97,137,138,97,97,247,169,169,238,238,169,169,169,169,238,238,169,169,0,2,0,100,254,101,4,228,4,128,0,15,0,40,0,0,36,55,54,53,52,39,38,35,
-34,7,6,21,20,23,22,51,1,34,39,38,53,17,54,55,54,51,50,23,22,21,20,7,6,35,34,39,17,20,7,6,35,3,45,97,97,97,96,138,138,97,96,96,97,138,254,57,49,36,36,1,169,168,238,238,169,169,169,169,238,218,113,36,36,49,247,97,97,137,138,97,96,96,97,138,137,97,97,253,
-110,36,36,49,3,100,239,167,168,169,169,238,238,169,169,100,254,122,49,36,36,0,0,0,0,2,0,70,254,101,4,198,4,128,0,15,0,40,0,0,37,50,55,54,53,52,39,38,35,34,7,6,21,20,23,22,1,34,39,38,53,17,6,35,34,39,38,53,52,55,54,51,50,23,22,23,17,20,7,6,35,2,134,137,
-97,97,97,96,138,138,97,96,96,97,2,78,49,36,36,114,217,238,169,169,169,169,238,237,169,169,1,36,36,49,247,97,97,137,138,97,96,96,97,138,137,97,97,253,110,36,36,49,1,134,100,169,169,238,238,169,169,168,169,237,252,156,49,36,36,0,0,0,0,1,0,100,0,0,2,207,
-4,128,0,29,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,4,128,36,36,50,2,50,35,36,57,57,82,253,178,51,34,36,36,34,51,2,78,183,129,129,0,0,0,0,
-1,0,60,0,0,3,23,4,128,0,53,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,1,154,44,30,30,58,20,147,119,58,83,102,103,144,254,251,49,36,36,36,
-36,49,1,15,44,30,30,57,15,153,119,58,83,102,103,144,184,50,36,36,36,36,50,3,139,30,31,43,60,30,11,39,34,55,79,146,144,103,102,36,34,51,2,50,36,36,30,30,44,55,28,7,43,35,57,81,148,144,102,103,36,36,50,2,51,34,36,0,0,1,0,100,0,0,2,104,6,26,0,41,0,0,19,
-50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,150,49,36,36,36,36,49,150,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,6,26,35,36,50,254,223,36,36,50,2,51,34,36,253,
-175,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,0,0,1,0,100,0,0,4,43,4,128,0,37,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,70,100,99,70,69,36,36,50,2,51,34,36,142,
-142,199,200,142,142,36,36,49,3,49,36,36,1,227,99,70,69,69,70,99,2,35,50,36,36,36,36,50,253,221,199,142,142,142,142,199,2,35,50,36,36,36,36,50,0,1,0,21,0,0,4,102,4,128,0,28,0,0,9,1,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,18,23,
-20,2,61,1,61,32,80,2,65,36,21,11,254,141,46,124,126,45,254,140,10,21,36,65,3,80,31,239,37,1,83,2,227,74,55,31,34,24,25,252,157,116,116,3,99,25,23,34,32,55,74,253,209,85,4,0,0,0,0,1,0,100,0,0,6,243,4,128,0,60,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,
-59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,69,98,98,69,69,36,36,50,2,51,34,36,69,69,98,99,69,69,36,34,51,2,50,36,35,141,141,199,238,120,121,238,199,
-141,141,36,36,49,3,49,36,36,1,225,98,69,69,69,69,98,2,37,50,36,36,36,36,50,253,219,98,69,69,69,69,98,2,37,50,36,36,36,36,50,253,219,199,141,141,158,158,141,141,199,2,37,50,36,36,36,36,50,0,0,0,1,0,85,0,0,4,28,4,128,0,67,0,0,1,20,23,22,51,50,55,54,61,
-1,52,55,54,59,1,50,23,22,29,1,20,7,22,29,1,20,7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,1,50,23,22,21,1,74,69,70,100,99,70,69,36,36,50,2,51,34,36,160,160,36,34,51,2,50,36,36,69,70,99,100,70,69,
-36,36,49,3,49,36,36,160,160,36,36,49,3,49,36,36,3,174,99,70,70,70,70,99,88,50,36,36,36,36,49,89,240,121,122,239,99,51,34,36,36,34,51,99,99,70,69,69,70,99,99,51,34,36,36,34,51,99,239,122,121,240,88,50,36,36,36,36,50,0,0,0,0,1,0,100,254,101,4,43,4,128,
-0,65,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,38,39,38,53,52,55,54,63,1,54,51,50,23,22,23,22,23,22,51,50,55,54,61,1,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,70,100,98,70,70,36,36,50,2,51,34,36,149,145,
-189,150,123,120,62,14,10,20,50,4,22,21,22,21,41,21,32,64,65,76,95,71,72,79,159,200,142,142,36,36,49,3,49,36,36,1,249,99,70,70,70,70,99,2,13,50,36,36,36,36,50,252,67,198,144,142,74,72,121,27,27,23,23,52,17,2,7,8,17,40,60,37,38,70,72,97,8,59,142,141,200,
-2,13,50,36,36,36,36,50,0,0,0,1,0,65,0,3,3,254,4,131,0,39,0,0,37,5,50,23,22,29,1,20,7,6,35,33,34,39,38,53,52,55,54,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,20,7,0,1,139,1,250,50,35,36,36,35,50,253,115,118,47,18,57,98,200,175,93,254,50,51,35,
-35,35,35,51,2,92,121,48,18,57,254,188,248,1,35,36,50,2,50,36,35,111,41,38,67,57,102,210,184,97,36,36,49,3,49,36,36,111,41,38,68,56,254,172,0,0,0,1,0,50,254,94,2,175,6,26,0,71,0,0,18,55,54,55,54,53,52,55,54,55,54,55,54,55,54,55,50,23,22,29,1,20,7,6,7,
-6,7,6,7,6,7,6,7,22,19,22,21,20,23,22,23,22,23,22,23,22,29,1,20,7,6,35,38,39,38,39,38,39,38,61,1,52,39,38,39,38,39,38,61,1,52,55,166,21,41,14,17,4,10,26,27,41,42,61,39,78,41,30,29,26,27,39,63,20,25,3,5,4,37,85,94,31,9,2,6,23,19,57,38,28,27,30,29,41,92,
-46,72,46,47,15,12,17,14,40,22,28,86,86,2,189,17,34,58,76,143,187,46,90,55,57,34,35,18,10,1,29,30,41,20,39,28,29,3,4,22,29,182,247,25,220,41,39,254,248,80,127,149,20,56,19,15,4,1,29,29,40,19,43,28,29,1,17,26,57,57,87,77,185,17,153,73,59,34,18,8,27,89,
-9,90,26,0,0,0,1,0,200,254,96,1,185,6,26,0,3,0,0,19,51,17,35,200,241,241,6,26,248,70,0,0,0,0,1,0,50,254,94,2,175,6,26,0,70,0,0,1,22,29,1,20,7,6,7,6,7,6,21,20,7,6,7,6,7,6,7,34,39,38,61,1,52,55,54,55,54,55,54,55,54,53,52,55,18,55,38,39,38,39,38,39,38,39,
-38,39,38,61,1,52,55,54,51,22,23,22,23,22,23,22,23,22,21,20,23,22,23,22,2,89,86,85,29,22,40,13,18,12,14,47,47,72,46,92,41,29,30,27,28,38,57,19,23,7,1,9,31,95,86,37,4,4,4,26,18,63,40,26,27,30,29,41,78,39,63,40,41,27,26,10,4,18,13,41,22,2,180,26,90,9,89,
-27,8,18,33,60,77,166,185,77,87,57,57,26,17,1,29,28,43,19,40,29,29,1,4,15,19,56,20,149,127,80,1,8,39,41,220,25,247,182,29,22,4,3,29,28,39,20,41,30,29,1,10,18,35,34,57,55,90,46,187,142,77,58,34,17,0,0,0,0,1,0,37,2,33,3,250,3,105,0,58,0,0,18,55,54,51,50,
-23,22,23,22,23,22,59,1,54,55,54,51,50,23,22,23,22,23,22,21,20,7,6,7,6,7,6,7,6,35,34,39,38,39,38,43,1,6,7,6,7,35,34,39,38,39,38,39,38,53,52,55,54,55,157,151,12,12,51,57,43,73,76,27,45,35,13,57,63,24,27,20,22,24,13,11,4,1,4,8,18,52,57,59,73,12,12,58,60,
-43,88,94,63,12,64,58,19,26,4,22,20,24,14,13,2,2,3,6,17,3,96,8,1,14,10,26,27,8,12,3,45,16,9,13,26,20,29,9,8,18,15,28,17,49,24,25,4,1,16,11,35,36,3,42,15,3,9,11,25,20,26,11,11,13,13,28,17,255,255,0,40,254,42,1,64,4,68,0,11,0,4,1,164,4,68,192,0,0,2,0,48,
-254,104,4,80,5,255,0,8,0,42,0,0,1,19,6,7,6,21,20,23,22,1,3,51,50,55,23,6,7,6,35,34,39,3,35,19,38,39,38,53,52,55,54,51,50,23,19,51,3,22,23,22,23,7,38,1,153,161,104,78,86,94,9,1,96,166,10,163,107,233,70,117,140,191,42,13,98,207,116,57,69,168,157,156,225,
-37,9,91,206,105,28,47,122,69,247,41,1,50,2,122,6,99,117,140,134,122,11,2,41,253,120,200,52,190,96,104,2,254,128,1,196,33,75,182,244,249,177,178,1,1,98,254,103,13,34,99,192,44,75,0,0,1,0,100,0,0,4,97,6,26,0,65,0,0,0,39,38,35,34,7,6,21,17,33,50,23,22,29,
-1,20,7,6,35,33,17,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,51,34,39,38,61,1,52,55,54,51,35,17,52,55,54,51,50,23,22,23,22,21,20,7,6,43,1,34,39,3,73,57,59,74,91,64,64,1,32,50,36,35,35,36,50,254,224,2,55,50,36,36,36,36,50,253,77,49,36,36,1,36,26,26,
-26,26,36,1,136,136,192,157,125,123,41,5,25,36,61,3,92,25,4,203,45,46,64,64,91,254,244,36,36,49,3,49,36,36,254,171,36,36,50,2,51,34,36,36,34,51,1,209,26,26,37,67,37,26,26,1,12,192,135,136,96,94,150,18,16,38,33,48,89,0,2,0,38,0,212,4,173,5,89,0,11,0,39,
-0,0,1,34,6,21,20,22,51,50,54,53,52,38,5,39,55,23,54,51,50,23,55,23,7,22,21,20,7,23,7,39,6,35,34,39,7,39,55,38,53,52,2,105,110,157,157,110,111,156,156,253,237,159,167,159,99,155,155,100,158,166,159,69,69,159,167,158,100,154,155,99,158,167,159,70,4,34,
-156,111,112,156,156,112,111,156,15,159,167,158,69,69,158,165,159,100,154,155,100,159,165,158,69,69,158,165,159,101,154,153,0,1,255,247,0,0,4,201,6,89,0,22,0,0,37,21,35,53,33,53,33,53,33,53,33,1,51,9,1,51,1,33,21,33,21,33,21,2,205,237,254,228,1,28,254,
-228,1,0,254,51,253,1,99,1,125,245,254,33,1,17,254,210,1,46,226,226,226,183,113,193,3,142,253,32,2,224,252,114,193,113,183,0,0,0,0,2,0,150,254,49,1,137,6,87,0,3,0,7,0,0,19,51,17,35,17,51,17,35,150,243,243,243,243,6,87,252,120,254,234,252,120,0,0,0,0,2,
-0,70,254,13,4,65,6,115,0,89,0,117,0,0,37,22,23,22,23,22,29,1,6,7,6,7,6,43,1,36,3,55,22,23,22,23,22,51,50,55,54,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,54,53,52,35,34,7,38,39,38,53,52,55,54,55,54,59,1,22,23,22,23,7,38,39,38,35,34,7,6,7,21,20,23,22,
-23,30,1,23,4,23,22,23,22,29,1,6,7,6,37,51,50,55,54,55,54,53,52,39,38,39,38,39,38,35,34,7,6,7,21,20,23,22,23,22,23,22,3,140,64,56,33,15,13,4,91,81,132,90,90,16,254,84,87,227,42,129,45,67,13,12,114,77,40,13,8,22,33,86,73,89,233,88,113,156,18,1,1,7,12,40,
-113,156,87,122,49,51,23,193,113,118,38,233,33,107,45,63,90,67,70,3,13,11,26,42,115,115,1,1,90,33,15,13,4,91,57,254,167,17,110,77,40,13,8,22,33,86,38,39,22,28,90,67,70,3,13,11,26,42,54,36,250,31,78,46,56,49,56,21,135,106,94,45,32,12,1,180,39,189,63,21,
-5,1,74,38,50,28,25,43,34,52,38,30,25,68,78,102,176,214,115,13,1,1,4,6,35,102,176,214,115,64,22,7,6,92,95,219,35,164,52,22,49,52,84,6,43,35,33,25,43,38,31,77,126,46,56,49,56,21,135,106,66,104,73,38,50,28,25,43,34,52,38,16,13,4,49,52,84,6,43,35,33,25,43,
-17,12,0,0,2,0,100,4,159,2,231,5,182,0,15,0,31,0,0,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,1,50,58,41,41,41,41,58,57,41,42,42,41,4,159,41,41,58,57,41,41,41,40,58,
-59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,0,0,3,0,110,255,208,6,185,6,27,0,35,0,51,0,67,0,0,1,38,39,38,35,34,7,6,29,1,20,23,22,51,50,55,54,55,23,6,7,6,35,34,39,38,61,1,52,55,54,51,50,23,22,23,1,50,4,18,21,20,2,4,35,34,36,2,53,52,18,36,23,34,4,2,21,
-20,18,4,51,50,36,18,53,52,2,36,4,161,19,56,72,107,119,82,83,83,82,119,104,72,71,14,139,23,111,112,154,180,126,123,123,126,180,154,113,93,30,254,107,203,1,130,216,212,254,128,209,209,254,129,214,217,1,130,203,170,254,191,182,179,1,64,174,174,1,64,178,
-181,254,190,3,171,90,54,70,86,84,122,178,121,84,87,68,66,114,14,166,102,105,129,128,180,166,181,128,129,106,85,136,2,85,208,254,124,210,208,254,127,212,212,1,129,208,210,1,132,208,133,174,254,188,175,174,254,193,179,179,1,63,174,175,1,68,174,0,0,0,2,
-0,100,3,79,3,113,6,26,0,23,0,39,0,0,0,23,22,21,17,20,7,6,43,1,34,39,38,53,6,35,34,39,38,53,52,55,54,51,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,2,140,113,116,28,27,35,2,36,27,27,63,146,161,113,116,116,113,161,87,62,59,59,62,87,87,62,60,60,62,87,6,
-26,104,105,149,254,239,35,25,24,24,25,35,84,104,105,148,149,105,104,171,56,54,77,77,54,55,55,54,77,77,54,56,0,2,0,30,1,93,4,128,4,127,0,9,0,19,0,0,1,33,9,1,33,1,38,53,52,55,1,33,9,1,33,1,38,53,52,55,1,184,1,62,254,53,1,203,254,194,254,130,28,28,3,8,1,
-62,254,53,1,203,254,194,254,130,28,28,4,127,254,111,254,111,1,82,25,38,39,25,1,81,254,111,254,111,1,82,25,38,39,25,0,1,0,130,1,94,3,209,3,108,0,5,0,0,19,33,17,35,17,33,130,3,79,192,253,113,3,108,253,242,1,89,0,4,0,100,255,208,6,175,6,27,0,15,0,31,0,48,
-0,59,0,0,1,50,4,18,21,20,2,4,35,34,36,2,53,52,18,36,23,34,4,2,21,20,18,4,51,50,36,18,53,52,2,36,13,1,22,23,22,21,20,7,6,35,51,1,35,1,35,17,35,1,54,55,54,53,52,39,38,39,33,17,3,138,203,1,130,216,212,254,128,209,209,254,129,214,217,1,130,203,170,254,191,
-182,179,1,64,174,174,1,64,178,181,254,190,254,52,1,127,113,79,79,98,64,138,2,1,52,136,254,204,93,127,1,127,63,45,44,44,45,63,255,0,6,27,208,254,124,210,208,254,127,212,212,1,129,208,210,1,132,208,133,174,254,188,175,174,254,193,179,179,1,63,174,175,1,
-68,174,193,1,1,80,80,112,128,83,64,254,35,1,221,254,35,2,84,1,46,45,64,63,45,45,2,254,201,0,255,255,0,50,5,20,3,54,6,9,2,3,0,16,0,0,2,129,0,0,0,2,0,100,3,140,3,34,6,38,0,17,0,35,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,7,52,55,54,59,1,50,
-23,22,21,20,7,6,43,1,34,39,38,1,53,39,39,52,22,54,39,39,39,38,55,22,53,38,39,209,98,98,138,34,137,99,98,98,99,137,34,138,98,98,4,218,54,39,39,39,39,54,53,39,38,38,39,53,136,98,98,98,98,136,138,98,98,98,98,0,2,0,50,0,90,4,78,5,208,0,43,0,63,0,0,1,33,50,
-23,22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,17,52,55,54,59,1,50,23,22,21,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,187,1,25,50,36,36,36,36,50,254,231,36,36,50,2,51,34,36,254,229,51,34,36,36,34,
-51,1,27,36,34,51,2,50,36,36,1,147,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,4,60,36,36,50,2,51,34,36,254,231,50,36,36,36,36,50,1,25,36,34,51,2,50,36,36,1,27,51,34,36,36,34,51,251,124,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,1,0,182,4,222,2,140,
-6,97,0,19,0,0,1,6,43,1,34,39,38,53,52,63,1,54,59,1,50,23,22,21,20,7,1,124,25,27,77,43,18,8,14,176,19,36,154,43,18,10,19,4,245,23,38,15,15,21,19,251,28,39,18,15,22,19,0,0,0,1,0,110,254,101,4,53,4,127,0,53,0,0,37,17,20,7,6,43,1,34,39,38,53,17,52,55,54,
-59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,6,35,34,1,99,36,36,49,3,49,36,36,36,36,49,3,49,36,36,69,70,100,99,70,69,36,36,49,3,49,36,36,36,36,49,3,49,36,36,37,201,202,56,254,166,51,34,36,36,34,
-51,5,40,50,36,35,36,36,50,253,221,99,70,69,69,70,99,2,36,50,36,35,35,36,50,252,4,51,34,36,36,34,51,46,57,0,0,0,1,0,100,0,0,4,48,6,87,0,17,0,0,1,35,17,35,17,35,17,35,17,38,39,38,53,52,55,54,55,33,4,48,87,209,62,219,171,112,112,112,119,193,2,36,5,134,250,
-122,5,134,250,122,2,195,26,129,129,170,168,129,149,16,255,255,0,100,1,167,4,211,7,84,0,11,0,17,0,15,2,150,54,102,0,1,0,108,254,5,2,112,0,10,0,39,0,0,37,51,7,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,
-38,53,52,55,1,10,206,22,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,17,5,7,22,13,22,41,22,19,1,10,114,7,53,51,66,93,68,65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,2,255,236,1,93,4,88,4,127,0,9,0,19,0,0,1,22,21,20,7,1,
-33,9,1,33,1,22,21,20,7,1,33,9,1,33,2,168,28,28,254,130,254,194,1,203,254,53,1,62,3,18,28,28,254,130,254,194,1,203,254,53,1,62,3,46,25,39,38,25,254,174,1,145,1,145,254,175,25,39,38,25,254,174,1,145,1,145,255,255,0,40,255,132,6,204,6,96,0,34,0,234,0,0,
-0,35,0,213,1,181,0,0,0,3,0,237,3,105,253,207,255,255,0,40,255,132,6,116,6,96,0,34,0,234,0,0,0,35,0,213,1,181,0,0,0,3,0,235,3,105,253,207,255,255,0,40,255,132,7,166,6,96,0,34,0,236,0,0,0,35,0,213,2,143,0,0,0,3,0,237,4,67,253,207,255,255,0,14,254,57,3,
-184,4,68,0,11,0,34,4,10,4,67,192,0,255,255,0,110,0,0,4,121,7,251,2,34,0,36,0,0,0,3,0,67,1,58,1,154,255,255,0,110,0,0,4,121,7,251,2,34,0,36,0,0,0,3,0,115,1,23,1,154,255,255,0,110,0,0,4,121,7,226,2,34,0,36,0,0,0,3,0,190,0,157,1,154,255,255,0,110,0,0,4,
-121,7,131,2,34,0,36,0,0,0,3,0,197,0,144,1,154,255,255,0,110,0,0,4,121,7,80,2,34,0,36,0,0,0,3,0,106,0,206,1,154,255,255,0,110,0,0,4,121,8,16,2,34,0,36,0,0,0,3,0,195,1,18,1,154,0,2,0,110,0,0,6,208,6,26,0,10,0,83,0,0,1,53,52,39,38,35,34,7,6,29,1,1,38,61,
-1,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,17,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,3,132,79,80,114,113,80,79,2,34,1,253,223,36,36,49,3,49,
-36,36,152,152,213,214,138,29,107,151,1,100,50,36,36,36,36,50,254,156,51,35,35,1,221,50,36,36,36,36,50,254,35,35,35,51,1,100,50,36,36,36,36,50,254,156,151,107,107,3,43,234,113,80,80,80,80,113,234,254,156,7,9,96,254,66,51,34,36,36,34,51,3,156,214,152,151,
-137,1,29,107,36,36,49,3,49,36,36,35,35,50,254,218,36,36,49,3,49,36,36,254,219,51,35,35,35,36,50,2,50,36,35,107,107,151,0,0,0,255,255,0,75,254,30,4,118,6,26,2,34,0,38,0,0,0,3,0,119,2,3,0,25,255,255,0,110,0,0,3,185,7,251,2,34,0,40,0,0,0,3,0,67,0,218,1,
-154,255,255,0,110,0,0,3,185,7,251,2,34,0,40,0,0,0,3,0,115,0,183,1,154,255,255,0,110,0,0,3,185,7,226,2,34,0,40,0,0,0,3,0,190,0,111,1,154,255,255,0,110,0,0,3,185,7,80,2,34,0,40,0,0,0,3,0,106,0,150,1,154,255,255,255,206,0,0,1,163,7,251,2,34,0,44,0,0,0,3,
-0,67,255,195,1,154,255,255,0,106,0,0,2,64,7,251,2,34,0,44,0,0,0,3,0,115,255,180,1,154,255,255,255,153,0,0,2,116,7,226,2,34,0,44,0,0,0,3,0,190,255,48,1,154,255,255,255,197,0,0,2,72,7,80,2,34,0,44,0,0,0,3,0,106,255,97,1,154,0,2,0,10,0,0,5,64,6,26,0,22,
-0,45,0,0,19,17,52,55,54,59,1,32,23,22,17,16,7,6,33,35,34,39,38,53,17,35,53,41,1,21,33,17,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,21,130,83,83,116,151,1,67,229,229,229,229,254,189,151,116,83,83,120,1,109,1,49,254,207,10,11,16,151,223,157,157,157,
-157,223,151,16,11,10,3,136,1,120,117,83,82,229,229,254,189,254,189,229,229,83,83,116,1,121,245,245,254,135,16,11,10,156,157,223,223,157,157,11,11,16,255,255,0,110,0,0,4,121,7,131,2,34,0,49,0,0,0,3,0,197,0,144,1,154,255,255,0,80,0,0,6,107,7,251,2,34,0,
-50,0,0,0,3,0,67,2,36,1,154,255,255,0,80,0,0,6,107,7,251,2,34,0,50,0,0,0,3,0,115,2,1,1,154,255,255,0,80,0,0,6,107,7,226,2,34,0,50,0,0,0,3,0,190,1,135,1,154,255,255,0,80,0,0,6,107,7,131,2,34,0,50,0,0,0,3,0,197,1,122,1,154,255,255,0,80,0,0,6,107,7,80,2,
-34,0,50,0,0,0,3,0,106,1,184,1,154,0,1,0,51,1,118,3,99,4,166,0,47,0,0,1,55,54,51,50,31,1,22,21,20,15,1,23,22,21,20,15,1,6,35,34,47,1,7,6,43,1,34,47,1,38,61,1,52,63,1,39,38,61,1,52,63,1,54,59,1,50,23,1,203,199,36,50,51,39,1,32,35,199,199,35,39,2,32,50,
-50,36,199,199,36,48,6,47,35,1,36,35,200,200,35,35,1,36,50,3,48,36,3,187,199,36,39,2,33,49,50,36,199,199,36,50,50,40,1,32,36,199,200,35,35,1,36,50,3,48,35,200,200,35,48,6,47,35,1,36,35,0,3,0,80,255,39,6,107,6,156,0,10,0,21,0,47,0,0,1,38,35,34,7,6,21,20,
-23,22,31,1,22,51,50,55,54,53,52,39,38,39,55,22,23,22,17,16,7,6,33,34,39,7,35,19,38,39,38,17,16,55,54,33,50,23,55,51,3,211,38,80,222,157,157,157,47,22,198,35,77,223,157,157,157,45,21,101,62,76,229,229,230,254,189,127,85,108,237,147,65,77,229,229,229,1,
-67,130,88,70,236,5,27,11,157,157,223,223,157,46,14,86,10,156,157,223,223,157,44,14,226,37,75,229,254,189,254,189,229,229,27,244,1,75,38,77,229,1,67,1,67,229,229,28,158,0,0,0,255,255,0,110,0,0,4,121,7,251,2,34,0,56,0,0,0,3,0,67,1,58,1,154,255,255,0,110,
-0,0,4,121,7,251,2,34,0,56,0,0,0,3,0,115,1,23,1,154,255,255,0,110,0,0,4,121,7,226,2,34,0,56,0,0,0,3,0,190,0,157,1,154,255,255,0,110,0,0,4,121,7,80,2,34,0,56,0,0,0,3,0,106,0,206,1,154,255,255,0,100,0,0,4,111,7,251,2,34,0,60,0,0,0,3,0,115,1,13,1,154,0,2,
-0,140,0,0,4,181,6,26,0,30,0,41,0,0,1,21,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,33,50,23,22,21,20,7,6,35,1,17,33,50,55,54,53,52,39,38,35,1,129,36,36,49,3,49,36,36,36,36,49,3,49,36,36,1,80,200,142,142,142,142,200,254,176,1,80,99,70,70,70,
-70,99,1,42,177,51,34,36,36,34,51,5,40,50,36,35,35,36,50,176,142,142,199,200,142,142,2,210,254,35,69,70,100,99,70,69,0,0,0,1,0,100,0,0,4,60,6,26,0,70,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,
-54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,7,6,21,1,89,36,36,49,3,49,36,36,83,83,116,238,183,129,129,129,152,136,136,192,61,50,36,35,35,36,50,61,91,64,63,63,64,91,57,50,36,35,35,36,50,57,82,57,57,57,58,
-81,238,16,11,10,121,51,34,36,36,34,51,4,135,117,83,82,129,129,182,206,108,116,229,191,136,136,36,35,50,2,50,36,36,63,64,91,91,64,64,36,35,50,2,50,36,35,1,56,57,82,81,57,58,11,11,16,0,0,255,255,0,100,0,0,4,228,6,97,2,34,0,68,0,0,0,3,0,67,1,106,0,0,255,
-255,0,100,0,0,4,228,6,97,2,34,0,68,0,0,0,3,0,115,1,71,0,0,255,255,0,100,0,0,4,228,6,72,2,34,0,68,0,0,0,3,0,190,0,205,0,0,255,255,0,100,0,0,4,228,5,233,2,34,0,68,0,0,0,3,0,197,0,192,0,0,255,255,0,100,0,0,4,228,5,182,2,34,0,68,0,0,0,3,0,106,0,254,0,0,255,
-255,0,100,0,0,4,228,6,118,2,34,0,68,0,0,0,3,0,195,1,66,0,0,0,3,0,100,0,0,8,87,4,128,0,7,0,23,0,86,0,0,1,37,38,35,34,7,6,21,37,6,21,20,23,22,51,50,55,54,53,52,39,38,35,34,1,53,20,7,6,43,1,34,39,38,53,21,6,35,34,39,38,53,52,55,54,51,50,23,22,23,54,55,54,
-51,50,23,22,23,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,4,229,2,47,74,154,138,97,96,252,212,96,96,97,138,138,96,97,97,97,137,138,2,202,36,36,49,3,49,36,36,114,217,238,169,169,169,169,238,238,169,41,6,6,41,169,238,172,
-142,141,68,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,220,2,53,252,88,97,97,138,237,97,137,138,97,96,96,97,138,137,97,97,252,217,21,51,34,36,36,34,51,21,100,169,169,238,238,169,169,169,41,8,8,41,169,94,92,150,25,
-26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,0,0,255,255,0,70,254,14,3,151,4,128,2,34,0,70,0,0,0,3,0,119,1,39,0,9,255,255,0,70,0,0,4,173,6,97,2,34,0,72,0,0,0,3,0,67,1,64,0,0,255,255,0,70,0,0,4,173,6,97,2,34,0,72,0,0,0,3,0,115,
-1,29,0,0,255,255,0,70,0,0,4,173,6,72,2,34,0,72,0,0,0,3,0,190,0,162,0,0,255,255,0,70,0,0,4,173,5,182,2,34,0,72,0,0,0,3,0,106,0,212,0,0,255,255,255,203,0,0,1,160,6,97,2,34,0,189,0,0,0,2,0,67,192,0,0,0,255,255,0,103,0,0,2,61,6,97,2,34,0,189,0,0,0,2,0,115,
-177,0,0,0,255,255,255,150,0,0,2,113,6,72,2,34,0,189,0,0,0,3,0,190,255,45,0,0,255,255,255,194,0,0,2,69,5,182,2,34,0,189,0,0,0,3,0,106,255,94,0,0,0,2,0,100,0,0,4,228,6,91,0,15,0,76,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,3,23,22,21,20,15,1,4,19,
-22,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,53,52,39,38,39,7,6,35,34,47,1,38,53,52,63,1,38,39,38,39,38,53,52,63,1,54,51,50,23,22,23,55,54,51,50,2,164,138,97,96,96,97,138,137,97,97,97,97,45,8,31,18,49,1,54,129,65,5,3,169,169,238,238,169,169,169,169,
-238,69,4,13,123,65,22,28,21,24,8,31,18,56,5,35,29,7,3,11,43,21,31,15,17,49,23,61,23,29,21,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,192,5,23,28,21,23,66,211,254,195,158,120,31,30,238,169,169,169,169,238,238,169,169,4,1,1,16,90,87,32,18,5,23,28,
-21,24,75,2,17,14,30,10,9,18,18,64,34,7,22,12,81,32,0,255,255,0,100,0,0,4,43,5,233,2,34,0,82,0,0,0,2,0,197,100,0,0,0,255,255,0,70,0,0,4,198,6,97,2,34,0,83,0,0,0,3,0,67,1,76,0,0,255,255,0,70,0,0,4,198,6,97,2,34,0,83,0,0,0,3,0,115,1,41,0,0,255,255,0,70,
-0,0,4,198,6,72,2,34,0,83,0,0,0,3,0,190,0,175,0,0,255,255,0,70,0,0,4,198,5,233,2,34,0,83,0,0,0,3,0,197,0,162,0,0,255,255,0,70,0,0,4,198,5,182,2,34,0,83,0,0,0,3,0,106,0,224,0,0,0,3,0,50,1,50,3,134,4,234,0,19,0,35,0,51,0,0,1,20,7,6,35,33,34,39,38,61,1,52,
-55,54,51,33,50,23,22,21,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,134,36,36,50,253,159,51,34,36,36,34,51,2,97,50,36,36,254,86,58,41,41,41,41,58,57,41,42,42,41,57,58,41,41,41,41,58,57,41,42,42,41,3,12,
-51,34,36,36,34,51,2,50,36,36,36,36,50,254,36,41,41,58,57,41,41,41,40,58,59,40,41,2,161,41,41,58,57,41,41,41,40,58,59,40,41,0,3,0,70,255,46,4,198,5,72,0,9,0,20,0,46,0,0,9,1,35,34,7,6,21,20,23,22,23,54,51,50,55,54,53,52,39,38,39,1,38,39,38,53,52,55,54,
-51,50,23,55,51,3,22,23,22,21,20,7,6,35,34,39,7,35,1,163,1,7,36,138,97,96,96,5,199,4,27,137,97,97,98,2,1,253,207,30,46,169,169,169,238,87,54,99,236,140,27,44,169,169,169,238,84,50,103,237,1,76,2,61,97,97,138,137,97,5,93,1,97,97,137,138,97,2,2,253,59,20,
-46,169,238,238,169,169,16,216,254,206,19,44,169,238,238,169,169,14,224,255,255,0,100,0,0,4,43,6,97,2,34,0,89,0,0,0,3,0,67,1,14,0,0,255,255,0,100,0,0,4,43,6,97,2,34,0,89,0,0,0,3,0,115,0,235,0,0,255,255,0,100,0,0,4,43,6,72,2,34,0,89,0,0,0,2,0,190,113,0,
-0,0,255,255,0,100,0,0,4,43,5,182,2,34,0,89,0,0,0,3,0,106,0,162,0,0,255,255,0,100,254,101,4,43,6,97,2,34,0,93,0,0,0,3,0,115,0,235,0,0,0,2,0,100,254,101,4,228,6,26,0,32,0,48,0,0,1,54,51,50,23,22,21,20,7,6,35,34,39,17,20,7,6,43,1,34,39,38,53,17,52,55,54,
-59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,52,39,38,35,34,7,6,1,89,111,220,238,169,169,169,169,238,218,113,36,36,49,3,49,36,36,36,36,49,3,49,36,36,96,97,138,137,97,97,97,96,138,138,97,96,4,29,99,169,169,238,238,169,169,100,254,122,49,36,36,36,36,49,
-6,195,50,36,35,35,36,50,252,161,137,97,97,97,97,137,138,97,96,96,97,0,0,255,255,0,100,254,101,4,43,5,182,2,34,0,93,0,0,0,3,0,106,0,162,0,0,0,1,0,137,0,0,1,126,4,128,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,5,51,34,36,36,34,51,
-2,50,36,36,36,36,50,4,128,36,36,50,252,115,51,34,36,36,34,51,3,141,50,36,36,0,0,1,0,105,4,197,3,68,6,72,0,26,0,0,1,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,215,168,24,27,77,43,18,9,16,197,21,33,197,34,19,198,16,8,18,43,77,
-28,24,5,130,165,24,38,17,15,21,19,251,26,27,250,19,22,15,16,38,24,0,1,0,106,4,207,3,68,6,81,0,29,0,0,1,54,55,54,55,54,59,1,50,23,22,21,20,15,1,6,43,1,34,47,1,38,53,52,55,54,59,1,50,23,1,215,10,63,63,31,25,27,77,43,18,8,16,197,20,34,197,32,21,197,16,7,
-20,42,77,28,23,5,148,10,62,62,32,23,38,16,15,22,19,251,25,25,251,19,22,15,16,38,24,0,0,0,0,1,0,50,4,229,2,90,5,218,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,90,36,36,50,254,203,51,34,36,36,34,51,1,53,50,36,36,5,94,51,34,36,36,
-34,51,2,50,36,36,36,36,50,0,0,1,0,107,4,197,3,60,6,54,0,30,0,0,1,50,23,22,21,20,7,6,7,6,35,34,39,38,39,38,53,52,55,54,59,1,50,23,22,59,1,50,55,54,51,2,224,46,28,18,5,41,102,95,118,118,94,103,40,5,17,28,47,21,61,24,43,119,2,119,42,23,62,6,54,37,26,28,
-15,15,118,68,62,62,68,118,16,15,28,25,37,57,106,105,58,0,0,1,0,100,4,229,1,124,5,252,0,15,0,0,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,4,229,41,41,58,57,41,41,41,40,58,59,40,41,0,2,0,100,4,147,2,96,6,118,0,17,
-0,35,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,7,52,55,54,59,1,50,23,22,21,20,7,6,43,1,34,39,38,1,28,19,19,25,13,26,19,19,19,18,27,13,26,18,19,184,71,71,100,24,99,72,71,71,72,99,24,100,71,71,5,133,26,19,19,19,19,26,26,19,18,18,19,26,99,71,
-71,71,71,99,100,71,71,71,71,0,1,0,65,254,49,1,192,0,23,0,23,0,0,1,6,35,34,39,38,53,52,55,54,55,51,6,7,6,21,20,23,22,51,50,55,54,55,1,192,61,111,90,58,63,61,35,47,223,91,31,40,7,17,35,9,10,31,70,254,105,56,53,57,93,77,102,59,45,88,48,59,37,15,12,29,2,
-6,44,0,0,1,0,102,4,197,3,97,5,233,0,36,0,0,18,55,54,51,50,23,22,59,1,54,55,54,59,1,50,23,22,21,20,7,6,35,34,39,38,35,6,7,6,7,35,34,39,38,53,52,55,118,64,66,99,81,110,36,39,8,40,16,36,37,41,35,21,18,1,33,200,82,107,44,45,40,10,26,56,44,33,23,19,1,5,115,
-53,56,52,17,1,23,54,25,21,25,6,7,202,56,23,1,28,51,5,25,21,26,6,6,0,0,255,255,0,108,4,252,3,218,6,127,0,34,0,115,182,30,0,3,0,115,1,78,0,30,0,1,0,100,1,204,4,73,2,177,0,3,0,0,19,33,21,33,100,3,229,252,27,2,177,229,0,0,0,1,0,100,1,204,5,217,2,177,0,3,
-0,0,19,33,21,33,100,5,117,250,139,2,177,229,0,0,0,1,0,100,3,234,1,99,6,31,0,23,0,0,0,23,22,29,1,20,7,6,43,1,34,39,38,61,1,52,55,54,55,23,6,21,20,23,1,29,34,36,36,36,49,12,50,36,36,56,30,49,93,69,1,5,30,36,36,49,66,50,36,35,35,36,50,157,138,82,44,23,71,
-85,79,11,11,0,0,0,0,1,0,100,3,229,1,99,6,26,0,23,0,0,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,170,34,36,36,36,49,12,50,36,36,56,30,49,93,69,1,4,230,36,36,49,66,50,36,35,35,36,50,157,138,82,44,23,71,85,79,11,11,255,255,0,100,255,
-1,1,99,1,54,2,3,0,202,0,0,251,28,0,0,255,255,0,100,3,234,2,116,6,31,0,34,0,201,0,0,0,3,0,201,1,17,0,0,255,255,0,100,3,229,2,116,6,26,0,34,0,202,0,0,0,3,0,202,1,17,0,0,255,255,0,100,255,1,2,116,1,54,2,3,0,205,0,0,251,28,0,0,0,1,0,10,254,234,4,106,6,86,
-0,11,0,0,1,17,35,17,33,53,33,17,51,17,33,21,2,168,220,254,62,1,194,220,1,194,3,184,251,50,4,206,220,1,194,254,62,220,0,1,0,10,254,234,4,106,6,86,0,19,0,0,1,17,51,17,33,21,33,17,33,21,33,17,35,17,33,53,33,17,33,53,1,204,220,1,194,254,62,1,194,254,62,220,
-254,62,1,194,254,62,4,138,1,204,254,52,220,253,228,220,254,52,1,204,220,2,28,220,0,0,0,1,0,100,1,131,3,25,4,56,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,78,203,203,144,143,203,203,143,4,56,203,143,144,203,203,144,143,203,0,0,0,0,3,0,100,0,0,6,210,
-1,23,0,15,0,31,0,47,0,0,51,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,2,114,58,41,41,41,41,58,57,41,42,42,41,2,114,58,41,
-41,41,41,58,57,41,42,42,41,41,41,58,57,41,41,41,40,58,59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,0,1,0,30,1,93,2,246,4,127,0,9,0,0,1,33,9,1,33,1,38,53,52,55,1,184,1,62,254,53,1,203,254,194,254,130,28,28,4,127,254,
-111,254,111,1,82,25,38,39,25,0,0,0,1,255,236,1,93,2,196,4,127,0,9,0,0,1,22,21,20,7,1,33,9,1,33,2,168,28,28,254,130,254,194,1,203,254,53,1,62,3,46,25,39,38,25,254,174,1,145,1,145,0,0,0,1,255,207,255,132,2,142,6,96,0,3,0,0,9,1,35,1,2,142,253,249,184,2,
-9,6,96,249,36,6,220,0,0,1,0,10,0,0,3,212,6,26,0,67,0,0,1,22,23,22,29,1,20,7,6,35,21,35,21,20,7,6,43,1,34,39,38,61,1,35,53,34,39,38,61,1,52,55,54,55,51,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,21,2,2,46,35,
-36,36,35,16,112,36,36,49,3,49,36,36,90,18,33,36,36,33,48,60,107,107,151,1,51,49,36,36,36,36,49,254,205,50,35,35,1,161,49,36,36,36,36,49,254,95,2,16,1,34,36,50,2,50,36,34,2,162,51,34,36,36,34,51,162,2,34,36,50,2,50,36,34,1,2,157,151,107,107,35,36,50,2,
-50,36,35,35,35,51,254,218,35,36,50,2,51,34,36,131,0,0,0,255,255,0,100,0,0,4,97,6,26,2,2,0,101,0,0,0,3,0,160,255,243,9,143,6,110,0,10,0,63,0,86,0,0,0,53,52,39,38,39,33,17,33,54,55,1,34,39,38,3,17,35,6,7,6,35,33,17,35,17,33,21,22,23,22,23,51,17,55,17,33,
-54,59,1,4,19,7,38,35,34,7,6,7,21,20,23,22,23,22,23,22,21,20,7,6,7,6,7,55,50,55,54,55,54,53,52,39,38,39,38,39,38,53,52,55,35,17,22,23,22,23,3,126,53,53,73,254,191,1,65,73,53,2,214,211,66,122,1,73,27,94,96,193,254,222,234,2,74,138,116,113,3,71,233,1,108,
-79,99,21,1,110,64,236,35,176,68,59,64,2,65,46,166,195,81,121,2,14,158,123,163,5,63,51,72,18,5,71,31,166,183,82,137,10,121,5,34,20,136,3,215,139,139,60,58,3,253,248,3,58,252,88,44,79,1,22,2,39,114,87,108,253,138,6,87,1,2,132,126,205,1,88,145,254,23,25,
-11,254,175,29,165,31,32,49,3,57,27,18,44,50,60,88,148,17,17,164,94,75,9,222,19,27,49,16,14,53,35,15,43,46,54,91,165,82,21,253,198,123,20,11,6,0,1,0,100,0,0,5,56,6,26,0,89,0,0,1,21,20,23,33,50,23,22,29,1,20,7,6,35,33,22,23,22,51,50,55,54,51,50,23,22,29,
-1,20,7,6,35,32,39,38,39,35,34,39,38,61,1,52,55,54,59,1,53,35,34,39,38,61,1,52,55,54,59,1,54,55,54,33,50,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,7,33,50,23,22,29,1,20,7,6,35,2,2,1,1,148,36,27,26,26,27,36,254,160,44,134,137,169,68,66,16,16,38,34,47,91,
-95,99,254,247,209,207,65,117,36,27,25,26,26,36,82,82,36,27,25,26,26,36,111,58,209,214,1,15,99,95,91,47,34,38,16,17,65,68,174,141,139,40,1,172,36,26,26,25,26,37,3,26,13,31,6,25,27,36,23,36,26,27,111,93,95,16,4,25,36,60,2,94,24,24,160,158,226,26,27,36,
-23,36,26,26,50,26,27,36,23,36,26,26,235,166,167,24,24,93,3,58,38,25,4,17,102,101,121,26,26,36,23,36,26,27,0,0,4,0,160,0,0,8,196,6,87,0,11,0,15,0,31,0,47,0,0,1,0,23,17,51,17,35,0,39,17,35,17,1,53,33,21,1,52,55,54,51,50,23,22,21,20,7,6,35,34,39,38,55,20,
-23,22,51,50,55,54,53,52,39,38,35,34,7,6,1,144,2,35,123,253,240,253,222,124,253,4,242,3,18,252,231,129,115,169,167,117,128,128,117,167,169,115,129,242,55,47,68,68,47,55,55,47,68,68,47,55,6,87,252,104,235,4,131,249,169,3,154,241,251,117,6,87,249,170,235,
-235,3,39,217,129,117,117,129,217,216,128,117,117,128,217,105,60,51,51,60,105,104,61,51,51,61,0,0,1,0,20,3,170,4,194,6,87,0,18,0,0,1,35,17,35,17,35,53,33,27,1,51,17,35,17,3,35,3,17,35,2,64,204,147,205,2,220,145,145,176,141,126,108,126,141,5,212,253,214,
-2,42,131,254,98,1,158,253,83,1,140,254,154,1,102,254,116,0,0,0,0,2,0,123,0,95,3,197,5,187,0,15,0,65,0,0,1,6,7,6,7,6,21,20,23,22,51,50,55,54,55,54,55,6,7,6,7,6,7,6,35,34,39,38,53,52,55,54,55,54,55,53,52,39,38,35,34,7,6,7,6,7,6,35,34,39,38,39,38,53,52,
-55,54,55,54,51,50,23,22,17,20,7,3,3,164,124,152,18,3,50,23,28,51,68,131,58,38,207,2,2,14,52,81,188,113,101,74,67,147,4,28,215,174,235,24,30,63,45,54,47,28,17,36,16,16,20,20,34,13,6,9,30,53,118,142,92,70,141,1,3,33,10,70,86,164,29,24,95,28,12,40,78,158,
-105,226,38,33,184,140,220,112,68,37,80,206,35,38,249,131,107,11,52,96,63,81,54,47,60,35,13,6,9,16,37,17,16,19,19,65,63,140,52,106,254,244,97,43,0,0,0,0,2,0,105,0,180,4,199,5,130,0,18,0,21,0,0,1,54,51,50,23,1,22,21,20,7,6,35,33,34,39,38,53,52,55,37,9,
-1,2,86,19,47,47,19,1,230,7,12,21,39,252,51,39,22,12,6,3,95,254,202,254,201,5,87,43,43,251,195,16,15,20,18,33,33,19,20,14,15,88,2,182,253,74,0,0,1,0,100,255,70,5,25,6,28,0,29,0,0,1,33,17,20,7,6,35,34,39,38,53,17,52,55,54,51,33,50,23,22,21,17,20,7,6,35,
-34,39,38,53,4,94,252,193,28,28,38,39,26,28,28,26,39,3,250,40,26,28,28,26,40,39,26,28,5,97,250,66,39,26,28,28,26,39,6,27,38,28,28,28,28,38,249,229,39,26,28,28,26,39,0,0,0,1,0,110,255,126,5,49,6,26,0,39,0,0,9,1,22,21,20,7,1,33,50,23,22,21,20,7,6,35,33,
-34,39,38,53,52,55,9,1,38,53,52,55,54,51,33,50,23,22,21,20,7,6,35,1,141,1,219,23,23,254,37,3,71,39,28,26,27,27,39,251,248,57,27,10,22,2,36,253,220,22,10,27,57,4,8,39,28,26,27,27,39,5,95,253,167,29,29,29,29,253,167,28,28,38,38,27,28,53,21,20,30,28,2,182,
-2,182,27,30,21,21,53,28,28,38,38,27,28,0,1,0,50,2,147,3,134,3,136,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,134,36,36,50,253,159,51,34,36,36,34,51,2,97,50,36,36,3,12,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,1,0,106,0,1,4,94,
-6,148,0,41,0,0,1,54,55,54,51,50,23,22,23,22,21,20,7,3,6,7,6,35,34,39,1,7,6,35,34,39,38,39,38,53,52,55,54,63,1,54,51,50,23,22,23,19,3,165,6,32,25,29,7,8,39,22,17,1,241,10,68,9,9,54,26,254,171,124,18,18,18,18,36,14,7,7,15,35,206,18,17,17,16,35,17,250,6,
-70,37,23,18,1,6,32,25,29,8,8,250,40,66,11,1,53,2,186,52,7,7,15,37,18,17,18,18,35,15,85,7,6,13,34,254,0,0,0,0,3,0,100,1,208,4,151,4,82,0,24,0,40,0,49,0,0,0,51,50,23,22,21,20,7,6,35,34,39,6,35,34,39,38,53,52,55,54,55,51,50,23,22,23,22,51,50,55,54,53,52,
-39,38,35,34,7,6,7,39,38,43,1,6,21,20,51,50,2,208,172,154,69,60,68,76,146,169,120,95,156,124,65,56,59,64,116,10,150,99,138,33,55,61,56,27,42,30,23,65,44,37,50,73,176,81,85,1,80,80,92,4,82,90,77,154,147,83,91,162,113,85,73,121,114,71,78,6,123,225,32,52,
-22,32,102,107,27,21,22,30,108,1,115,4,100,114,0,0,0,1,0,7,255,12,2,151,6,27,0,67,0,0,0,39,38,53,6,7,6,7,6,17,16,7,6,7,6,7,6,7,6,35,34,39,38,39,38,53,52,55,54,55,54,51,50,23,22,23,22,21,54,55,54,55,54,17,16,55,54,55,54,55,54,55,54,51,50,23,22,23,22,21,
-20,7,6,7,6,35,34,39,1,241,37,9,7,7,6,3,1,1,2,7,10,23,44,109,10,10,69,77,36,15,7,7,14,36,18,18,17,17,38,36,10,6,7,6,3,1,1,2,7,11,23,44,108,10,10,70,77,35,16,8,8,15,35,18,18,17,17,5,93,3,1,5,12,96,89,142,49,254,177,254,177,51,151,95,134,45,84,7,1,31,15,
-35,18,18,18,18,36,15,7,6,15,3,1,6,12,97,89,142,49,1,78,1,80,51,151,95,134,45,84,7,1,31,15,35,18,19,18,18,35,15,7,6,0,0,0,2,0,102,1,205,4,132,4,3,0,35,0,71,0,0,0,51,50,23,22,51,50,55,54,59,1,22,23,22,29,1,6,7,6,35,34,39,38,35,34,7,6,43,1,38,39,38,61,1,
-54,55,22,51,50,23,22,51,50,55,54,59,1,22,23,22,29,1,6,7,6,35,34,39,38,35,34,7,6,43,1,38,39,38,61,1,54,55,1,15,167,81,132,164,29,72,87,26,35,8,39,23,22,3,31,138,140,61,195,101,49,97,86,26,33,8,39,25,22,3,29,137,167,81,131,165,29,72,87,26,33,8,41,23,22,
-5,29,138,140,61,196,100,49,97,86,26,33,8,39,25,22,3,29,4,3,48,59,72,22,5,29,26,33,8,39,25,116,71,36,73,22,3,30,26,33,8,38,27,155,48,59,72,22,3,31,26,34,8,38,25,116,71,36,72,22,3,29,25,35,8,39,25,0,0,0,2,0,100,0,231,4,33,5,47,0,17,0,49,0,0,1,50,23,22,
-21,20,7,6,35,33,34,39,38,53,52,55,54,51,37,22,23,22,21,20,7,6,7,6,35,34,39,1,38,53,52,55,1,54,51,50,23,22,23,22,21,20,7,6,7,5,3,196,39,26,28,28,26,39,252,253,39,26,28,28,26,39,3,39,35,15,7,7,15,36,18,18,18,18,252,254,57,57,3,2,18,18,18,18,36,15,7,7,15,
-35,253,202,1,162,28,26,39,40,26,28,28,26,40,39,26,28,254,15,36,18,18,18,18,35,15,7,7,1,68,25,62,62,24,1,68,7,7,15,35,18,18,18,18,36,15,237,0,2,0,100,0,231,4,33,5,48,0,17,0,49,0,0,1,50,23,22,21,20,7,6,35,33,34,39,38,53,52,55,54,51,1,37,38,39,38,53,52,
-55,54,55,54,51,50,23,1,22,21,20,7,1,6,35,34,39,38,39,38,53,52,55,54,55,3,196,39,28,26,26,28,39,252,253,39,26,28,28,26,39,2,18,253,203,36,14,7,7,15,36,18,17,18,18,3,2,57,57,252,254,18,18,17,18,36,15,7,7,14,36,1,162,28,27,38,39,27,28,28,26,40,39,26,28,
-1,236,237,15,36,18,18,18,18,35,15,8,8,254,188,24,62,62,25,254,188,7,7,15,35,18,18,18,18,36,15,0,0,0,255,255,0,100,0,0,4,75,6,26,0,34,0,73,0,0,0,3,0,76,2,187,0,0,255,255,0,100,0,0,4,60,6,26,0,34,0,73,0,0,0,3,0,79,2,187,0,0,0,2,0,40,2,49,3,44,6,27,0,17,
-0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,2,74,111,115,115,111,160,160,111,115,115,111,160,63,46,45,45,46,63,62,48,44,44,48,62,6,27,103,106,145,254,219,146,106,103,103,106,146,1,37,
-145,106,103,214,42,42,60,254,227,60,43,41,43,41,60,1,29,60,40,44,0,1,0,40,2,49,1,201,6,26,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,59,1,50,23,22,21,1,201,35,33,47,2,48,31,36,70,46,35,34,34,35,46,187,47,35,33,2,153,42,33,29,29,33,
-42,2,175,29,32,43,1,43,31,31,31,31,43,0,1,0,40,2,49,3,11,6,26,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,35,33,34,39,38,61,1,52,55,54,51,1,193,135,92,96,92,53,128,120,41,61,1,
-130,49,34,33,34,33,49,254,4,48,33,34,91,60,124,144,23,58,27,27,37,254,251,48,34,34,34,33,49,6,26,85,89,122,109,87,49,74,68,37,56,14,32,31,42,2,44,29,31,31,29,44,57,122,98,65,73,85,17,45,39,36,25,25,30,31,43,1,43,31,31,0,1,0,40,2,49,2,163,6,26,0,60,0,
-0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,1,81,134,95,94,64,79,101,96,141,182,48,33,34,35,32,48,182,43,32,30,30,32,43,
-153,49,32,34,32,34,49,153,37,27,26,27,26,37,182,46,35,34,34,35,46,6,26,87,87,122,138,49,55,153,128,93,89,31,29,44,2,42,33,30,28,29,42,42,29,28,30,32,43,1,42,31,31,1,24,25,36,36,25,25,29,32,43,1,43,31,31,0,0,0,2,0,40,2,49,3,99,6,26,0,38,0,41,0,0,1,54,
-59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,37,17,3,1,143,33,69,97,47,35,34,38,48,35,32,35,33,47,38,34,35,47,1,47,35,34,254,186,48,33,34,13,1,172,154,5,227,55,31,31,43,254,1,32,31,42,2,42,33,29,
-70,44,30,30,30,30,44,70,31,29,44,42,27,23,15,1,1,254,255,0,1,0,40,2,49,2,241,6,26,0,49,0,0,19,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,21,51,50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,155,48,33,34,34,
-35,46,1,141,46,35,34,34,35,46,254,232,143,140,99,99,101,97,140,254,252,48,33,34,35,32,48,1,4,43,31,31,31,31,43,3,202,31,31,43,1,126,43,31,31,31,31,43,1,43,32,29,172,91,90,128,128,93,89,31,29,44,2,42,33,30,28,29,42,42,29,28,0,0,0,0,2,0,40,2,49,3,33,6,
-26,0,14,0,49,0,0,1,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,29,1,51,50,23,22,21,20,7,6,35,1,16,31,32,42,86,43,31,31,31,31,43,86,140,96,101,99,98,140,199,47,35,34,34,35,47,199,42,34,29,191,
-140,99,99,101,97,140,3,202,99,42,29,28,28,29,42,42,29,28,254,103,89,93,128,1,125,128,90,92,31,31,43,1,43,32,29,31,27,42,72,91,90,128,128,93,89,0,0,0,1,0,40,2,49,2,199,6,26,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,50,23,22,
-21,2,199,35,33,47,1,49,33,34,254,188,46,35,34,34,35,46,1,185,47,35,33,2,153,42,33,29,31,29,44,2,175,29,32,43,1,43,31,31,31,31,43,0,0,0,3,0,40,2,49,3,44,6,26,0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,
-50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,1,219,134,94,95,64,78,98,98,141,98,140,96,101,79,64,96,92,134,98,43,33,29,32,30,43,98,42,34,29,31,32,42,98,37,27,26,27,27,36,98,36,27,27,27,27,36,6,26,
-87,87,122,138,49,56,152,128,91,91,89,93,128,153,55,49,138,122,89,85,252,234,30,27,42,41,30,28,30,28,41,42,29,28,1,153,24,25,36,36,25,25,25,25,36,36,25,24,0,0,0,0,2,0,40,2,49,3,33,6,26,0,14,0,49,0,0,1,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,
-21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,61,1,35,34,39,38,53,52,55,54,51,2,56,30,32,43,86,42,34,29,29,34,42,86,140,99,99,101,97,140,255,49,32,34,32,34,49,255,43,31,31,191,140,96,101,99,98,140,4,129,99,42,27,31,31,27,42,42,27,30,1,153,92,
-90,128,254,131,128,93,89,29,33,42,2,42,31,32,28,29,42,71,90,93,127,128,90,92,0,0,0,1,0,40,2,101,3,29,5,28,0,43,0,0,1,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,35,34,39,38,61,1,52,55,54,59,1,53,52,55,54,59,1,50,23,22,21,2,23,146,49,32,
-35,34,33,49,146,36,31,49,1,49,34,32,148,49,32,34,33,33,49,148,32,34,49,1,49,33,34,4,42,30,33,43,1,44,29,31,137,43,33,29,31,31,43,137,31,29,44,1,43,31,32,137,43,30,32,31,31,43,0,0,0,0,1,0,40,2,181,2,155,3,136,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,
-54,51,33,50,23,22,21,2,155,34,33,49,254,116,49,33,33,33,33,49,1,140,49,31,36,3,30,43,31,31,32,29,44,1,44,29,32,30,31,44,0,0,2,0,40,2,80,3,29,4,140,0,19,0,39,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,
-55,54,51,33,50,23,22,21,3,29,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,2,185,43,31,31,32,29,44,1,44,29,32,30,31,44,1,104,43,31,31,32,29,44,1,44,29,32,30,31,44,0,2,0,40,1,214,1,39,6,25,0,19,0,35,
-0,0,19,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,55,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,168,49,34,32,32,34,49,1,49,33,34,35,32,49,1,53,36,39,39,35,54,53,36,38,38,36,4,202,32,31,43,253,223,43,30,32,32,29,44,2,33,43,33,30,104,32,36,48,
-47,35,33,34,34,47,48,34,34,0,0,0,0,1,0,40,1,61,1,229,6,28,0,39,0,0,18,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,212,86,86,86,86,132,15,14,38,31,43,26,24,40,54,37,38,38,37,54,40,24,26,43,
-31,38,14,15,1,91,97,99,125,2,33,125,99,97,27,3,23,31,51,5,36,32,26,8,11,40,41,51,253,231,51,41,40,11,8,26,31,37,5,50,32,23,3,0,0,0,0,1,0,40,1,61,1,229,6,28,0,39,0,0,19,6,35,34,39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,38,39,38,39,38,61,1,52,55,54,51,
-50,23,22,23,22,21,17,20,7,6,181,15,14,37,32,43,26,24,40,55,37,37,37,37,55,40,24,26,43,32,37,14,15,132,86,86,86,86,1,64,3,23,32,50,5,37,31,26,8,11,40,41,51,2,25,51,41,40,11,8,26,32,36,5,51,31,23,3,27,97,99,125,253,223,125,99,97,0,0,0,0,1,0,40,3,39,2,230,
-6,26,0,37,0,0,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,16,34,33,48,2,48,33,34,105,100,146,146,100,105,34,33,49,1,47,35,34,34,36,48,49,35,35,3,143,44,29,31,31,29,44,1,73,132,97,93,93,97,
-132,254,183,44,29,31,30,30,44,1,73,46,33,32,32,33,46,0,2,0,40,254,41,3,44,2,19,0,17,0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,2,74,111,115,115,111,160,160,111,115,115,111,160,63,46,
-45,45,46,63,62,48,44,44,48,62,2,19,103,106,145,254,219,146,106,103,103,106,146,1,37,145,106,103,214,42,42,60,254,227,60,43,41,43,41,60,1,29,60,40,44,0,1,0,40,254,41,1,201,2,19,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,59,1,50,23,
-22,21,1,201,35,32,48,2,48,31,36,70,46,35,34,34,35,46,187,47,35,33,254,146,43,32,30,30,31,44,2,174,31,31,43,1,43,31,31,31,31,43,0,1,0,40,254,41,3,11,2,19,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,
-54,55,54,53,52,39,38,35,33,34,39,38,61,1,52,55,54,51,1,193,135,92,96,92,53,128,120,41,61,1,130,49,33,34,34,33,49,254,4,48,33,34,91,60,124,143,24,58,27,27,37,254,251,49,33,34,34,33,49,2,19,86,88,122,109,87,49,74,69,37,55,15,31,31,43,1,44,29,32,32,29,44,
-56,122,98,66,72,86,17,45,39,35,25,25,31,31,43,1,43,31,31,0,1,0,40,254,41,2,163,2,19,0,60,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,39,38,61,
-1,52,55,54,51,1,81,134,95,94,64,79,101,96,141,182,48,33,34,36,31,48,182,43,32,30,31,31,43,153,49,31,35,32,34,49,153,38,26,26,27,26,37,182,46,35,34,34,35,46,2,19,88,86,122,139,49,55,153,127,93,90,32,29,44,1,43,33,29,28,29,42,42,29,29,29,32,43,1,43,31,
-31,1,23,25,37,35,25,25,31,31,43,1,43,31,31,0,0,0,2,0,40,254,41,3,99,2,19,0,38,0,41,0,0,1,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,37,17,3,1,143,33,69,97,47,35,34,38,47,35,33,35,32,48,38,34,
-34,48,1,48,34,34,254,186,48,33,34,13,1,172,154,1,219,56,31,31,43,254,0,31,31,43,1,43,32,30,69,44,29,32,32,29,44,69,32,29,44,42,26,23,15,1,2,254,254,0,1,0,40,254,41,2,241,2,19,0,49,0,0,23,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,21,51,
-50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,155,48,33,34,34,35,46,1,141,46,35,34,34,35,46,254,232,143,140,99,99,101,97,140,254,252,48,33,34,36,31,48,1,4,43,31,31,32,30,43,61,31,29,44,1,127,43,31,31,31,31,43,1,43,31,31,
-171,91,91,128,127,93,90,32,29,44,1,43,33,29,28,29,42,42,29,29,0,2,0,40,254,41,3,33,2,19,0,14,0,49,0,0,5,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,29,1,51,50,23,22,21,20,7,6,35,1,16,31,32,
-42,86,43,31,31,32,30,43,86,140,96,101,99,98,140,199,47,35,34,34,35,47,199,42,34,29,191,140,99,99,101,97,140,61,100,42,29,28,28,29,42,42,29,29,254,102,90,93,127,1,126,128,90,92,31,31,43,1,43,31,31,30,27,42,72,91,91,128,127,93,90,0,0,0,0,1,0,40,254,41,
-2,199,2,19,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,199,35,32,48,1,49,33,34,254,188,46,35,34,34,35,46,1,185,47,35,33,254,146,43,32,30,32,29,44,2,174,31,31,43,1,43,31,31,31,31,43,0,0,0,3,0,40,254,41,3,44,2,19,
-0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,1,219,134,94,95,64,78,98,98,141,98,140,96,101,79,64,96,92,
-134,98,43,33,29,32,30,43,98,42,34,29,31,32,42,98,38,26,26,27,27,36,98,36,27,27,27,26,37,2,19,88,86,122,139,49,56,152,127,91,92,90,93,127,153,55,49,139,122,88,86,252,233,30,27,42,42,29,29,31,27,42,42,29,28,1,154,23,25,37,35,25,25,25,25,35,37,25,23,0,0,
-0,0,2,0,40,254,41,3,33,2,19,0,14,0,49,0,0,37,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,61,1,35,34,39,38,53,52,55,54,51,2,56,29,33,43,86,42,34,29,29,34,42,86,140,99,99,101,97,140,255,49,32,
-34,32,34,49,255,43,31,31,191,140,96,101,99,98,140,121,100,42,27,30,30,27,42,42,27,31,1,154,92,90,128,254,130,127,93,90,30,32,43,1,43,31,31,28,29,42,72,90,92,128,128,90,92,0,0,0,0,1,0,40,254,194,3,29,1,122,0,43,0,0,37,51,50,23,22,29,1,20,7,6,43,1,21,20,
-7,6,43,1,34,39,38,61,1,35,34,39,38,61,1,52,55,54,59,1,53,52,55,54,59,1,50,23,22,21,2,23,146,49,31,36,34,33,49,146,35,32,49,1,49,34,32,148,49,33,33,33,33,49,148,32,34,49,1,49,33,34,135,29,33,43,1,44,29,32,136,43,33,30,32,31,43,136,32,29,44,1,43,31,31,
-138,43,30,32,32,29,44,0,1,0,40,255,181,2,155,0,136,0,19,0,0,37,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,155,34,33,49,254,116,49,32,34,33,33,49,1,140,49,32,35,29,44,29,31,31,29,44,1,43,31,32,30,33,43,0,0,0,2,0,40,255,50,3,29,1,10,0,19,0,
-39,0,0,5,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,29,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,101,43,31,31,32,29,44,1,44,
-29,32,30,31,44,1,4,43,31,31,32,29,44,1,44,29,32,30,31,44,0,0,1,0,40,254,99,1,229,3,66,0,39,0,0,18,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,212,85,87,86,86,132,15,14,37,32,43,26,24,40,54,
-37,38,38,37,54,40,24,26,43,31,38,14,15,254,129,97,98,126,2,33,125,99,97,27,3,24,31,50,5,37,31,26,8,12,39,42,50,253,230,50,41,40,11,8,26,32,36,6,49,32,23,3,0,0,0,0,1,0,40,254,99,1,229,3,66,0,39,0,0,19,6,35,34,39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,
-38,39,38,39,38,61,1,52,55,54,51,50,23,22,23,22,21,17,20,7,6,181,15,14,37,32,43,26,24,40,55,37,37,37,37,55,40,24,26,43,32,38,14,14,132,86,86,87,85,254,102,3,23,32,49,6,36,32,26,8,11,40,41,51,2,25,50,42,39,12,8,26,31,37,5,50,31,24,3,27,97,99,125,253,223,
-126,98,97,0,0,0,0,2,0,70,0,0,3,133,4,232,0,30,0,41,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,3,133,31,35,52,2,52,35,31,254,158,32,35,51,3,51,35,32,118,123,174,176,122,118,238,
-56,51,71,70,51,55,113,44,32,37,37,32,44,1,73,254,183,44,32,37,37,32,44,2,209,172,123,127,127,123,172,164,164,83,57,54,54,57,83,164,0,0,3,0,70,0,0,3,95,4,232,0,12,0,35,0,48,0,0,1,51,50,55,54,53,52,39,38,43,1,6,21,35,52,55,54,59,1,50,23,22,21,20,7,22,21,
-20,7,6,43,1,34,39,38,53,5,50,55,54,53,52,39,38,43,1,17,20,23,1,53,178,47,34,39,39,34,46,171,8,239,66,71,102,179,152,102,104,90,107,109,108,158,179,102,68,69,1,162,53,39,44,44,39,53,179,3,2,248,35,40,59,58,39,37,3,8,96,70,73,107,108,147,167,78,84,185,
-154,114,112,70,73,96,11,41,45,66,66,45,41,254,219,8,3,0,0,0,1,0,70,0,0,3,157,4,232,0,41,0,0,0,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,2,250,77,86,42,34,40,17,17,45,47,151,112,
-111,113,110,151,47,45,17,17,40,34,42,86,77,79,254,255,177,179,179,177,1,1,4,232,20,24,85,2,52,34,28,5,12,117,114,169,169,118,113,12,5,28,34,52,2,86,23,20,184,187,1,1,1,1,186,185,0,0,0,0,2,0,70,0,0,4,12,4,232,0,14,0,33,0,0,37,20,23,51,50,55,54,53,52,39,
-38,43,1,6,21,55,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,55,54,51,1,53,3,110,153,109,114,111,112,153,104,9,113,1,1,178,179,179,178,254,255,113,102,68,69,66,71,102,239,8,3,113,118,169,169,114,117,3,8,239,185,186,254,255,254,255,187,184,70,73,96,3,10,
-96,70,73,0,0,0,1,0,70,0,0,2,245,4,232,0,51,0,0,1,33,50,23,22,29,1,20,7,6,35,33,21,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,53,1,74,50,36,32,32,36,50,254,182,19,21,22,1,12,52,32,34,
-31,35,52,254,244,128,86,87,87,86,128,1,12,52,35,31,34,32,52,254,244,23,20,19,2,230,36,33,44,2,44,33,36,211,34,19,22,33,36,44,2,44,32,37,89,91,123,2,137,123,91,90,37,32,44,2,44,36,34,21,20,34,0,1,0,70,0,0,2,208,4,232,0,41,0,0,1,33,50,23,22,29,1,20,7,6,
-35,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,21,1,53,1,29,50,36,32,31,35,52,254,227,32,35,51,3,51,35,32,87,86,128,231,50,36,32,32,36,50,231,22,21,19,2,230,36,33,44,2,44,32,37,254,111,44,32,37,37,32,44,3,71,123,91,
-90,36,33,44,2,44,33,36,22,19,35,0,0,0,0,1,0,70,0,0,5,17,4,232,0,55,0,0,0,23,22,29,1,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,7,6,33,32,39,38,17,16,55,54,33,3,187,184,27,6,40,2,31,
-37,8,8,46,32,111,162,151,112,111,113,110,151,137,104,106,16,254,168,52,33,33,30,37,51,1,220,51,37,30,1,176,181,254,255,254,255,177,179,179,177,1,1,4,232,206,33,41,11,48,31,1,23,1,4,35,126,117,114,169,169,118,113,93,95,98,34,35,44,2,44,33,36,36,33,44,
-1,254,255,184,187,184,187,1,1,1,1,186,185,0,0,1,0,70,0,0,3,140,4,232,0,43,0,0,19,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,191,50,36,32,1,104,32,36,51,2,50,36,32,32,35,51,
-2,52,35,32,254,152,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,254,111,1,145,44,33,36,36,33,44,251,250,44,32,37,37,32,44,1,145,254,111,44,32,37,37,32,44,4,6,44,33,36,0,1,0,70,0,0,1,53,4,232,0,19,0,0,19,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,
-54,51,191,50,36,32,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,251,250,44,32,37,37,32,44,4,6,44,33,36,0,0,0,1,0,70,0,0,2,116,4,232,0,29,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,1,134,31,35,53,1,51,37,30,87,
-86,128,139,51,35,32,35,33,50,139,23,21,19,4,119,44,33,36,36,33,44,252,184,123,91,89,37,32,44,2,44,36,33,22,19,34,0,0,0,1,0,70,0,0,3,83,4,232,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,20,7,22,23,22,29,1,20,7,6,43,1,34,39,
-38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,191,50,36,32,50,88,64,68,1,34,32,52,3,50,36,32,138,54,57,59,33,33,52,2,52,33,33,1,66,67,87,83,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,254,150,66,70,102,124,44,36,33,36,33,44,124,233,
-105,34,105,106,123,200,44,35,34,34,35,44,200,101,67,70,254,74,44,32,37,37,32,44,4,6,44,33,36,0,0,1,0,70,0,0,2,197,4,232,0,29,0,0,1,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,19,21,22,219,51,33,35,33,34,52,219,
-128,86,87,32,36,50,3,50,36,32,1,47,34,19,22,33,36,44,2,45,31,37,89,91,123,3,72,44,33,36,36,33,44,0,0,0,1,0,70,0,0,5,104,4,232,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,
-21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,53,32,35,51,3,51,35,32,113,111,164,195,74,74,195,164,112,112,33,33,52,1,53,35,31,45,46,59,59,46,44,32,34,53,1,53,35,31,45,46,59,58,46,45,113,44,32,37,37,32,44,2,237,160,118,116,101,101,116,118,
-160,253,19,44,35,34,37,32,44,2,237,72,46,48,48,46,72,253,19,45,31,37,37,32,44,2,237,72,46,48,48,46,72,0,0,0,0,1,0,70,0,0,3,133,4,232,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,3,
-133,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,118,123,174,176,122,118,113,44,32,37,37,32,44,2,209,83,57,54,54,57,83,253,47,44,32,37,37,32,44,2,209,172,123,127,127,123,172,0,0,2,0,70,0,0,5,17,4,232,0,15,0,31,0,0,0,23,22,17,16,7,6,33,32,
-39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,3,172,181,176,176,181,254,255,254,255,177,179,179,177,1,1,151,112,111,113,110,151,153,109,114,111,112,153,4,232,188,183,254,255,254,255,184,187,184,187,1,1,1,1,186,185,228,117,114,169,
-169,118,113,113,118,169,169,114,117,0,0,2,0,70,0,0,3,154,4,232,0,13,0,37,0,0,1,51,50,55,54,53,52,39,38,35,34,7,6,21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,1,53,187,74,57,56,58,55,74,75,54,58,32,35,51,3,51,35,32,121,126,179,
-180,122,124,122,124,180,2,106,60,57,88,87,61,57,57,61,87,254,79,254,235,44,32,37,37,32,44,2,198,177,126,130,127,129,177,176,127,130,0,0,0,2,0,70,255,46,5,17,4,232,0,26,0,53,0,0,0,23,22,17,20,7,6,7,21,20,7,6,43,1,34,39,38,61,1,38,39,38,53,16,55,54,33,
-19,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,3,172,181,176,152,154,188,32,36,51,1,53,32,34,188,154,152,179,177,1,1,1,52,32,35,73,90,93,111,112,153,151,112,111,93,89,73,31,35,53,4,232,188,183,254,255,237,177,179,24,108,
-44,33,36,33,36,44,108,24,179,178,236,1,1,186,185,253,10,34,35,44,142,13,108,114,150,169,114,117,117,114,169,151,113,108,13,142,44,32,37,0,2,0,70,0,0,3,122,4,232,0,16,0,58,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,35,17,20,7,6,43,
-1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,1,232,64,48,52,52,48,64,87,42,23,21,5,2,1,88,52,44,55,193,33,33,52,2,52,35,31,92,92,136,98,170,118,114,118,8,9,117,32,35,51,2,51,35,32,2,154,49,54,77,78,54,49,23,22,
-30,9,17,254,252,254,103,78,53,47,3,254,187,44,35,34,37,32,44,3,52,130,97,96,124,119,167,166,122,5,7,122,167,144,44,32,37,37,32,44,0,0,0,1,0,70,0,0,3,74,4,236,0,53,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,
-54,53,52,39,38,39,38,39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,1,187,50,39,38,59,27,147,136,64,93,105,108,155,254,226,51,33,34,34,33,51,1,38,49,38,40,61,30,144,136,62,94,107,105,156,202,52,33,33,30,37,51,4,6,42,39,61,72,35,16,44,42,61,88,157,152,
-109,112,34,36,43,5,43,36,34,38,42,62,70,38,19,47,46,58,88,149,151,112,109,34,35,44,4,44,33,36,0,0,1,0,70,0,0,3,88,4,232,0,31,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,88,34,32,53,155,33,33,52,2,52,33,
-33,156,50,36,32,32,36,50,2,37,53,32,34,4,117,44,36,33,252,109,44,35,34,34,35,44,3,147,36,33,44,2,44,33,36,33,36,44,0,1,0,70,0,0,3,133,4,232,0,37,0,0,1,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,
-22,21,3,133,118,122,176,174,123,118,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,1,166,172,123,127,127,123,172,2,209,44,33,36,36,33,44,253,47,83,58,53,53,58,83,2,209,44,33,36,36,33,44,0,1,0,78,0,0,3,247,4,232,0,25,0,0,1,19,54,59,1,50,23,
-22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,2,35,232,25,87,5,64,35,20,6,254,205,41,114,114,41,254,205,7,20,36,63,5,87,27,1,135,3,17,80,51,29,31,18,18,252,21,106,106,3,235,18,18,31,29,51,80,0,0,1,0,70,0,0,5,104,4,232,0,60,0,0,1,20,23,22,51,50,
-55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,45,46,58,59,46,45,32,36,51,1,53,32,34,44,46,59,59,46,45,34,32,53,1,51,37,30,112,112,164,
-195,74,74,195,164,111,113,32,36,50,3,50,36,32,1,138,72,46,48,48,46,72,2,237,44,33,36,33,36,44,253,19,72,46,48,48,46,72,2,237,44,36,33,36,33,44,253,19,161,117,116,100,100,116,117,161,2,237,44,33,36,36,33,44,0,0,0,1,0,70,0,0,3,133,4,232,0,67,0,0,37,20,
-7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,1,20,7,22,21,3,133,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,127,127,
-32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,126,126,113,44,32,37,37,32,44,236,83,58,54,54,58,83,236,44,32,37,37,32,44,236,213,95,96,213,177,44,33,36,36,33,44,177,84,57,54,54,57,84,177,44,33,36,36,33,44,177,213,96,95,213,0,1,0,70,0,0,3,133,
-4,232,0,48,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,3,133,93,95,108,32,35,51,2,52,35,32,108,94,94,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,
-36,32,3,28,150,117,117,22,254,235,44,32,37,37,32,44,1,21,22,117,116,151,1,91,44,33,36,36,33,44,254,165,84,57,53,53,57,84,1,91,44,33,36,36,33,44,0,0,0,1,0,70,0,0,3,117,4,232,0,35,0,0,19,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,
-39,38,53,52,55,1,33,34,39,38,53,103,30,37,51,1,209,80,52,53,28,254,14,1,166,52,35,31,31,35,52,253,242,76,47,48,22,1,250,254,135,51,37,30,4,119,44,33,36,1,55,57,73,53,46,253,25,36,33,44,2,44,32,37,8,53,56,69,45,43,2,242,36,33,44,0,0,0,2,0,100,254,213,
-7,169,6,26,0,11,0,23,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,
-55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,4,0,70,254,207,7,139,6,20,0,30,0,41,0,53,0,65,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,8,1,17,16,0,33,32,0,17,16,0,
-33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,254,158,32,35,51,3,51,35,32,118,123,174,176,122,118,238,56,51,71,70,51,55,2,61,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,
-44,1,73,254,183,44,32,37,37,32,44,2,209,172,123,127,127,123,172,164,164,83,57,54,54,57,83,164,3,118,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,5,0,70,254,207,7,139,6,20,0,11,0,23,0,
-36,0,49,0,72,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,6,21,17,51,50,55,54,53,52,39,38,35,17,50,55,54,53,52,39,38,43,1,17,20,23,3,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,5,106,2,33,253,223,254,127,254,126,
-253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,63,2,178,47,34,39,39,34,46,53,39,44,44,39,53,179,3,242,66,71,102,179,152,102,104,90,107,109,108,158,179,102,68,69,6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,
-254,188,254,189,254,55,1,201,1,67,1,68,1,201,254,134,4,7,254,255,35,40,59,58,39,37,252,224,41,45,66,66,45,41,254,219,8,3,3,21,96,70,73,107,108,147,167,78,84,185,154,114,112,70,73,96,0,0,0,0,3,0,70,254,207,7,139,6,20,0,41,0,53,0,65,0,0,0,23,22,29,1,20,
-7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,102,77,86,42,34,40,17,17,45,47,151,112,111,113,110,151,47,45,17,17,40,34,42,86,77,79,
-254,255,177,179,179,177,1,1,1,83,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,222,20,24,85,2,52,34,28,5,12,117,114,169,169,118,113,12,5,28,34,52,2,86,23,20,184,187,1,1,1,1,186,185,1,54,253,223,254,126,
-254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,4,0,70,254,207,7,139,6,20,0,11,0,23,0,38,0,57,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,6,21,17,20,23,51,50,55,54,53,52,39,
-38,35,53,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,55,54,51,5,106,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,43,2,3,110,153,109,114,111,112,153,1,1,178,179,179,178,254,255,113,102,68,69,66,71,102,
-6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,254,134,4,7,252,246,8,3,113,118,169,169,114,117,228,185,186,254,255,254,255,187,184,70,73,96,3,10,96,70,73,0,3,0,70,254,207,7,139,6,20,
-0,51,0,63,0,75,0,0,1,33,50,23,22,29,1,20,7,6,35,33,21,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,95,1,74,50,36,32,32,36,
-50,254,182,19,21,22,1,12,52,32,34,31,35,52,254,244,128,86,87,87,86,128,1,12,52,35,31,34,32,52,254,244,23,20,19,2,11,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,230,36,33,44,2,44,33,36,211,34,19,22,33,
-36,44,2,44,32,37,89,91,123,2,137,123,91,90,37,32,44,2,44,36,34,21,20,34,2,92,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,3,0,70,254,207,7,139,6,20,0,41,0,53,0,65,0,0,1,33,50,23,
-22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,155,1,29,50,36,32,31,35,52,254,227,32,35,51,3,51,35,32,87,86,128,231,50,36,32,32,36,
-50,231,22,21,19,1,207,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,230,36,33,44,2,44,32,37,254,111,44,32,37,37,32,44,3,71,123,91,90,36,33,44,2,44,33,36,22,19,35,2,92,253,223,254,126,254,127,253,223,2,33,
-1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,55,0,67,0,79,0,0,0,23,22,29,1,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,
-7,6,33,32,39,38,17,16,55,54,33,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,255,184,27,6,40,2,31,37,8,8,46,32,111,162,151,112,111,113,110,151,137,104,106,16,254,168,52,33,33,30,37,51,1,220,51,37,30,1,176,181,254,255,254,255,177,179,
-179,177,1,1,1,123,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,222,206,33,41,11,48,31,1,23,1,4,35,126,117,114,169,169,118,113,93,95,98,34,35,44,2,44,33,36,36,33,44,1,254,255,184,187,184,187,1,1,1,1,186,
-185,1,54,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,43,0,55,0,67,0,0,1,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,
-20,7,6,43,1,34,39,38,53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,173,50,36,32,1,104,32,36,51,2,50,36,32,32,35,51,2,52,35,32,254,152,32,35,51,3,51,35,32,32,36,50,2,192,2,33,253,223,254,127,254,126,253,223,2,33,1,
-130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,254,111,1,145,44,33,36,36,33,44,251,250,44,32,37,37,32,44,1,145,254,111,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,
-254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,19,0,31,0,43,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,231,50,36,32,32,35,51,3,51,35,32,32,36,50,1,134,2,
-33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,251,250,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,
-68,1,201,0,3,0,70,254,207,7,139,6,20,0,29,0,41,0,53,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,248,31,35,53,1,51,37,30,87,86,128,139,51,35,32,
-35,33,50,139,23,21,19,1,114,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,119,44,33,36,36,33,44,252,184,123,91,89,37,32,44,2,44,36,33,22,19,34,4,229,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,
-150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,58,0,70,0,82,0,0,1,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,20,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,
-53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,232,50,36,32,50,88,64,68,1,34,32,52,3,50,36,32,138,54,57,59,33,33,52,2,52,33,33,1,66,67,87,83,32,35,51,3,51,35,32,32,36,50,2,133,2,33,253,223,254,127,254,126,253,223,2,
-33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,254,150,66,70,102,124,44,36,33,36,33,44,124,233,105,34,105,106,123,200,44,35,34,34,35,44,200,101,67,70,254,74,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,
-1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,3,0,70,254,207,7,139,6,20,0,29,0,41,0,53,0,0,1,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,
-16,0,33,32,0,17,16,0,3,173,19,21,22,219,51,33,35,33,34,52,219,128,86,87,32,36,50,3,50,36,32,1,189,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,47,34,19,22,33,36,44,2,45,31,37,89,91,123,3,72,44,33,36,36,
-33,44,1,157,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,60,0,72,0,84,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,
-1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,122,28,31,45,3,44,31,28,99,98,143,171,65,65,171,143,99,98,29,29,45,1,47,30,28,39,40,52,52,40,39,
-28,29,47,1,47,30,27,39,41,52,51,40,39,2,240,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,153,44,32,37,37,32,44,2,237,160,118,116,101,101,116,118,160,253,19,44,35,34,37,32,44,2,237,72,46,48,48,46,72,253,19,
-45,31,37,37,32,44,2,237,72,46,48,48,46,72,2,142,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,37,0,49,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,
-34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,118,123,174,176,122,118,19,2,33,253,223,254,127,254,126,253,
-223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,44,2,209,83,57,54,54,57,83,253,47,44,32,37,37,32,44,2,209,172,123,127,127,123,172,2,210,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,
-55,1,201,1,67,1,68,1,201,0,0,4,0,70,254,207,7,139,6,20,0,15,0,31,0,43,0,55,0,0,0,23,22,17,16,7,6,33,32,39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,230,181,176,176,
-181,254,255,254,255,177,179,179,177,1,1,151,112,111,113,110,151,153,109,114,111,112,153,1,133,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,188,183,254,255,254,255,184,187,184,187,1,1,1,1,186,185,228,
-117,114,169,169,118,113,113,118,169,169,114,117,2,16,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,4,0,70,254,207,7,139,6,20,0,13,0,37,0,49,0,61,0,0,1,51,50,55,54,53,52,39,38,35,34,7,6,
-21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,85,187,74,57,56,58,55,74,75,54,58,32,35,51,3,51,35,32,121,126,179,180,122,124,122,124,180,1,90,2,33,253,223,254,127,
-254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,106,60,57,88,87,61,57,57,61,87,254,79,254,235,44,32,37,37,32,44,2,198,177,126,130,127,129,177,176,127,130,4,142,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,
-254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,26,0,62,0,74,0,0,1,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,19,36,55,54,17,16,0,33,32,0,17,16,23,22,23,38,61,1,38,39,38,53,16,55,54,33,32,23,
-22,17,20,7,6,7,21,20,0,17,16,0,33,32,0,17,16,0,33,32,3,220,52,32,35,73,90,93,111,112,153,151,112,111,93,89,73,31,35,53,106,1,8,196,228,254,55,254,189,254,188,254,55,229,184,247,12,188,154,152,179,177,1,1,1,1,181,176,152,154,188,3,56,253,223,254,127,254,
-126,253,223,2,33,1,130,1,129,1,242,34,35,44,142,13,108,114,150,169,114,117,117,114,169,151,113,108,13,142,44,32,37,253,120,28,196,228,1,67,1,68,1,201,254,55,254,188,254,189,228,185,36,24,26,108,24,179,178,236,1,1,186,185,188,183,254,255,237,177,179,24,
-108,29,4,113,254,126,254,127,253,223,2,33,1,129,1,130,2,33,0,0,0,0,4,0,70,254,207,7,139,6,20,0,16,0,58,0,70,0,82,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,35,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,
-1,20,7,6,43,1,34,39,38,53,18,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,254,64,48,52,52,48,64,87,42,23,21,5,2,1,88,52,44,55,193,33,33,52,2,52,35,31,92,92,136,98,170,118,114,118,9,10,117,32,35,51,2,51,35,32,200,2,33,253,223,254,127,
-254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,154,49,54,77,78,54,49,23,22,30,9,17,254,252,254,103,78,53,47,3,254,187,44,35,34,37,32,44,3,52,130,97,96,124,119,167,166,122,5,7,122,167,144,44,32,37,37,32,44,5,163,253,223,254,126,
-254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,53,0,65,0,77,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,
-39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,18,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,229,50,39,38,59,27,147,136,64,93,105,108,155,254,226,51,33,34,34,33,51,1,38,49,38,40,61,30,144,136,62,94,107,105,156,202,52,33,33,30,37,51,
-180,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,6,42,39,61,72,35,16,44,42,61,88,157,152,109,112,34,36,43,5,43,36,34,38,42,62,70,38,19,47,46,58,88,149,151,112,109,34,35,44,4,44,33,36,2,14,253,223,254,126,
-254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,31,0,43,0,55,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,0,17,16,0,33,32,0,
-17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,110,34,32,53,155,33,33,52,2,52,33,33,156,50,36,32,32,36,50,2,37,53,32,34,4,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,87,44,36,33,252,109,44,35,34,34,35,44,
-3,147,36,33,44,2,44,33,36,33,36,44,1,187,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,37,0,49,0,61,0,0,1,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,
-17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,135,118,122,176,174,123,118,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,29,2,33,253,223,254,127,254,126,253,223,2,33,
-1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,166,172,123,127,127,123,172,2,209,44,33,36,36,33,44,253,47,83,58,53,53,58,83,2,209,44,33,36,36,33,44,1,157,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,
-1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,11,0,23,0,49,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,19,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,5,106,2,33,253,223,254,127,254,126,253,223,2,33,1,130,
-254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,199,231,26,87,5,64,35,20,6,254,204,40,114,115,40,254,204,6,19,37,63,5,87,27,6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,252,9,3,17,
-80,51,29,32,17,18,252,21,106,106,3,235,18,18,31,29,51,80,0,3,0,70,254,207,7,139,6,20,0,60,0,72,0,84,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,
-17,52,55,54,59,1,50,23,22,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,151,37,39,48,49,39,37,26,30,43,1,44,26,29,36,39,49,49,39,37,28,27,44,1,43,30,25,94,93,136,163,61,61,163,136,93,94,26,30,42,3,42,30,26,2,211,2,33,253,223,254,
-127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,68,72,46,48,48,46,72,2,237,44,33,36,33,36,44,253,19,72,46,48,48,46,72,2,237,44,36,33,36,33,44,253,19,161,117,116,100,100,116,117,161,2,237,44,33,36,36,33,44,1,227,253,223,254,
-126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,67,0,79,0,91,0,0,37,20,7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,
-1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,1,20,7,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,127,127,32,36,50,3,50,36,32,55,51,70,71,51,
-56,31,35,52,2,50,36,32,126,126,19,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,44,236,83,58,54,54,58,83,236,44,32,37,37,32,44,236,213,95,96,213,177,44,33,36,36,33,44,177,84,57,54,54,57,
-84,177,44,33,36,36,33,44,177,213,96,95,213,4,183,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,48,0,60,0,72,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,
-39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,93,95,108,32,35,51,2,52,35,32,108,94,94,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,
-2,50,36,32,19,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,3,28,150,117,117,22,254,235,44,32,37,37,32,44,1,21,22,117,116,151,1,91,44,33,36,36,33,44,254,165,84,57,53,53,57,84,1,91,44,33,36,36,33,44,1,157,
-253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,35,0,47,0,59,0,0,1,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,39,38,53,52,55,1,33,
-34,39,38,53,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,95,30,37,51,1,209,80,52,53,28,254,14,1,166,52,35,31,31,35,52,253,242,76,47,48,22,1,250,254,135,51,37,30,3,11,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,
-201,1,68,1,67,1,201,254,55,4,119,44,33,36,1,55,57,73,53,46,253,25,36,33,44,2,44,32,37,8,53,56,69,45,43,2,242,36,33,44,1,159,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,255,255,0,100,254,
-213,7,169,6,26,2,34,1,100,0,0,0,11,0,68,2,36,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,69,2,66,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,70,2,128,0,219,44,205,0,0,255,255,0,100,254,213,7,169,
-6,26,2,34,1,100,0,0,0,11,0,71,2,7,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,72,2,66,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,73,2,223,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,
-100,0,0,0,11,0,74,2,57,1,107,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,75,2,101,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,76,3,72,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,
-0,77,3,138,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,78,2,164,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,79,3,40,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,81,1,108,
-0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,82,2,101,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,83,2,57,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,84,2,76,1,47,44,205,
-0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,85,2,37,1,67,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,86,2,233,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,87,2,212,0,219,44,205,0,0,255,255,
-0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,88,3,53,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,89,2,101,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,90,2,108,0,219,44,205,0,0,255,255,0,100,254,
-213,7,169,6,26,2,34,1,100,0,0,0,11,0,91,1,108,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,92,2,112,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,93,2,101,1,73,44,205,0,0,255,255,0,100,254,213,7,169,
-6,26,2,34,1,100,0,0,0,11,0,94,2,129,0,217,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,233,2,93,254,81,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,
-23,22,59,1,50,55,54,53,1,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,80,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,151,13,17,25,187,24,17,14,14,17,24,130,16,
-15,24,2,25,15,15,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,24,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,0,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,88,0,0,8,1,
-17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,19,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,38,35,5,136,2,33,
-253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,178,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,25,254,66,81,45,126,122,47,74,76,76,111,6,26,253,223,254,126,254,
-127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,0,0,0,3,0,100,254,213,7,169,6,
-26,0,11,0,37,0,98,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,19,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,35,7,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,
-1,50,55,54,53,52,39,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,180,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,215,24,17,14,14,17,24,182,61,44,45,46,43,61,153,25,16,14,16,14,25,153,67,48,50,50,48,67,182,24,14,17,
-14,17,24,182,117,80,81,119,104,74,79,110,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,15,13,17,1,17,12,15,41,43,62,62,43,40,1,15,13,16,1,17,14,14,44,47,68,68,47,44,14,15,
-16,2,16,13,15,73,75,102,121,85,81,108,96,69,71,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,76,0,79,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,55,6,29,1,20,23,22,51,33,21,20,23,22,59,1,50,55,
-54,61,1,51,50,55,54,61,1,52,39,38,43,1,17,52,39,38,43,1,34,7,3,1,17,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,105,5,14,17,24,1,130,14,17,25,1,25,17,14,98,25,15,15,14,17,24,98,14,17,
-25,97,35,15,230,1,64,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,236,9,11,42,16,13,15,130,16,12,16,16,12,16,130,13,15,16,2,16,13,16,2,59,17,13,15,25,253,177,2,23,253,233,0,0,
-0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,50,23,22,21,20,7,6,35,33,34,7,6,29,1,20,23,22,51,33,50,55,54,53,52,39,38,43,1,17,33,50,55,54,61,1,
-52,39,38,35,33,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,219,67,47,51,51,47,67,254,252,24,14,17,14,17,24,1,4,116,81,81,79,83,116,203,1,84,24,17,14,14,17,
-24,254,115,24,17,14,14,17,24,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,109,44,47,68,68,47,44,14,15,16,2,16,13,15,73,75,102,102,72,75,1,36,15,12,17,1,17,13,15,15,13,17,254,
-130,17,13,15,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,52,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,50,23,22,21,20,7,6,43,1,34,39,38,61,1,19,50,55,54,53,52,39,38,43,1,53,52,55,
-54,59,1,50,55,54,61,1,52,39,38,43,1,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,240,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,2,11,67,47,51,51,47,67,86,66,48,51,251,116,81,81,79,83,116,251,49,50,66,199,
-25,17,14,14,17,25,199,116,82,79,81,80,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,109,44,47,68,68,47,44,44,47,68,159,254,103,73,75,102,102,72,75,132,68,45,47,15,12,17,
-1,17,13,15,76,72,102,254,131,102,75,73,0,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,52,39,38,35,33,34,7,6,29,1,20,23,22,51,33,17,20,23,22,
-59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,200,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,2,119,13,17,25,254,71,24,17,14,14,17,24,1,128,14,17,25,1,25,15,15,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,
-2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,24,17,13,15,15,13,17,1,17,12,15,253,21,16,13,15,13,15,16,0,0,0,0,5,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,81,0,99,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,52,39,38,43,1,34,7,6,29,1,20,
-23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,34,7,6,21,20,23,6,21,20,23,22,59,1,50,55,54,53,52,39,54,53,52,39,38,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,5,136,2,33,253,223,254,127,254,126,253,
-223,2,33,1,130,254,232,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,181,110,76,76,104,119,81,80,116,98,117,82,78,118,104,75,78,110,98,66,48,51,49,50,66,98,67,48,50,49,49,67,98,60,43,47,47,43,60,98,60,43,47,46,43,61,6,26,253,223,254,126,254,
-127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,69,71,96,108,81,85,121,102,75,73,75,73,102,122,84,81,108,96,69,71,252,234,44,47,68,67,46,46,44,48,67,68,45,46,1,153,40,43,62,62,43,41,41,43,62,62,43,
-40,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,52,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,34,39,38,53,52,55,54,59,1,50,23,22,29,1,3,34,7,6,21,20,23,22,59,1,21,20,7,6,43,1,34,
-7,6,29,1,20,23,22,59,1,50,55,54,53,17,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,242,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,181,66,50,49,49,50,66,86,67,50,48,251,116,82,79,81,80,116,251,51,47,67,255,25,16,
-14,16,14,25,255,116,81,81,79,83,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,172,46,45,68,68,45,47,47,45,68,159,1,153,76,72,102,101,75,74,131,68,47,44,16,13,16,2,16,15,
-13,73,75,102,1,125,102,72,76,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,62,0,80,0,98,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,
-38,35,33,34,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,253,197,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,
-25,254,66,81,45,126,122,47,74,76,76,111,2,184,136,95,95,95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,
-15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,29,0,47,0,0,8,1,17,16,0,33,32,0,17,16,0,33,17,34,7,
-6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,136,95,95,95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,
-253,223,2,33,1,129,1,130,2,33,254,22,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,0,0,2,0,100,254,213,7,169,6,26,0,11,0,23,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,
-0,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,1,0,100,254,213,7,169,6,26,
-0,11,0,0,8,1,17,16,0,33,32,0,17,16,0,33,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,234,2,240,254,82,255,255,0,100,254,213,7,169,
-6,26,2,34,1,100,0,0,0,3,0,235,2,109,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,236,2,191,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,237,2,45,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,238,2,162,254,
-82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,239,2,128,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,240,2,94,254,81,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,241,2,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,
-1,100,0,0,0,3,0,242,2,98,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,128,254,82,0,3,0,233,3,63,254,81,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,250,254,82,0,3,0,234,3,193,254,82,255,255,0,100,254,213,7,169,6,
-26,2,34,1,100,0,0,0,35,0,234,1,138,254,82,0,3,0,235,3,73,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,173,254,82,0,3,0,236,3,103,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,126,254,82,0,3,0,237,3,33,254,
-82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,148,254,82,0,3,0,238,3,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,118,254,82,0,3,0,239,3,63,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,
-1,148,254,82,0,3,0,240,3,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,98,254,82,0,3,0,241,3,43,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,98,254,82,0,3,0,242,3,43,254,82,0,5,0,100,254,213,7,169,6,26,
-0,11,0,23,0,74,0,92,0,110,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,32,23,22,29,1,20,
-7,6,35,34,39,38,61,1,52,55,54,51,6,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,253,149,117,80,82,79,46,110,104,35,53,1,77,43,29,29,30,29,42,254,73,41,
-29,29,79,51,107,125,20,50,24,23,32,225,42,29,29,29,29,42,3,249,97,99,99,97,138,138,96,99,99,96,138,54,39,40,40,39,54,54,41,39,39,41,54,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,
-254,192,73,77,106,94,75,43,63,60,31,49,12,27,27,36,2,38,25,27,27,25,38,49,105,86,55,63,74,15,38,34,31,22,22,25,27,37,1,38,26,27,89,91,126,253,126,92,89,89,92,126,253,126,91,89,185,36,37,51,247,51,38,35,37,36,51,247,51,35,38,0,0,0,2,0,100,254,213,7,169,
-6,26,0,11,0,37,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,78,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,6,26,253,223,254,
-126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,0,0,2,0,100,254,213,7,169,6,26,0,11,0,62,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,
-51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,222,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,25,254,66,81,45,126,122,47,74,76,76,111,
-6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,0,0,2,0,100,254,213,7,169,6,26,0,11,0,72,0,0,8,1,17,16,0,33,32,0,
-17,16,0,33,3,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,35,7,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,1,50,55,54,53,52,39,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,173,24,17,14,14,17,24,
-182,61,44,45,46,43,61,153,25,16,14,16,14,25,153,67,48,50,50,48,67,182,24,14,17,14,17,24,182,117,80,81,119,104,74,79,110,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,12,15,41,43,62,62,43,40,1,15,13,16,1,17,14,14,44,47,
-68,68,47,44,14,15,16,2,16,13,15,73,75,102,121,85,81,108,96,69,71,0,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,50,0,53,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,6,29,1,20,23,22,51,33,21,20,23,22,59,1,50,55,54,61,1,51,50,55,54,61,1,52,39,38,43,1,17,52,39,38,43,
-1,34,7,3,1,17,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,143,5,14,17,24,1,130,14,17,25,1,25,17,14,98,25,15,15,14,17,24,98,14,17,25,97,35,15,230,1,64,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,251,189,9,11,42,16,13,15,130,
-16,12,16,16,12,16,130,13,15,16,2,16,13,16,2,59,17,13,15,25,253,177,2,23,253,233,0,0,0,0,2,0,100,254,213,7,169,6,26,0,11,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,50,23,22,21,20,7,6,35,33,34,7,6,29,1,20,23,22,51,33,50,55,54,53,52,39,38,43,1,17,33,50,
-55,54,61,1,52,39,38,35,33,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,78,67,47,51,51,47,67,254,252,24,14,17,14,17,24,1,4,116,81,81,79,83,116,203,1,84,24,17,14,14,17,24,254,115,24,17,14,14,17,24,6,26,253,223,254,126,
-254,127,253,223,2,33,1,129,1,130,2,33,252,62,44,47,68,68,47,44,14,15,16,2,16,13,15,73,75,102,102,72,75,1,36,15,12,17,1,17,13,15,15,13,17,254,130,17,13,15,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,26,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,50,23,22,21,
-20,7,6,43,1,34,39,38,61,1,19,50,55,54,53,52,39,38,43,1,53,52,55,54,59,1,50,55,54,61,1,52,39,38,43,1,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,82,67,47,51,51,47,67,86,66,48,51,251,116,81,81,79,83,116,251,49,50,66,199,
-25,17,14,14,17,25,199,116,82,79,81,80,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,252,62,44,47,68,68,47,44,44,47,68,159,254,103,73,75,102,102,72,75,132,68,45,47,15,12,17,1,17,13,15,76,72,102,254,131,102,75,73,0,0,0,0,2,0,100,254,213,
-7,169,6,26,0,11,0,37,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,52,39,38,35,33,34,7,6,29,1,20,23,22,51,33,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,205,13,17,25,254,71,24,17,14,14,17,24,1,128,14,17,25,1,25,15,15,6,
-26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,13,15,13,15,16,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,55,0,73,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,7,6,21,20,23,6,21,20,23,22,59,1,50,55,
-54,53,52,39,54,53,52,39,38,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,39,110,76,76,104,119,81,80,116,98,117,82,78,118,104,75,78,110,98,66,
-48,51,49,50,66,98,67,48,50,49,49,67,98,60,43,47,47,43,60,98,60,43,47,46,43,61,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,69,71,96,108,81,85,121,102,75,73,75,73,102,122,84,81,108,96,69,71,252,234,44,47,68,67,46,46,44,48,67,68,45,
-46,1,153,40,43,62,62,43,41,41,43,62,62,43,40,0,3,0,100,254,213,7,169,6,26,0,11,0,26,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,39,38,53,52,55,54,59,1,50,23,22,29,1,3,34,7,6,21,20,23,22,59,1,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,1,50,55,54,53,17,52,
-39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,44,66,50,49,49,50,66,86,67,50,48,251,116,82,79,81,80,116,251,51,47,67,255,25,16,14,16,14,25,255,116,81,81,79,83,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,252,125,46,45,
-68,68,45,47,47,45,68,159,1,153,76,72,102,101,75,74,131,68,47,44,16,13,16,2,16,15,13,73,75,102,1,125,102,72,76,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,55,0,73,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,
-22,59,1,50,55,54,53,1,34,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,240,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,240,136,95,95,
-95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,
-86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,255,255,0,110,0,0,4,121,7,116,2,34,0,36,0,0,0,3,0,192,1,46,1,154,255,255,0,100,0,0,4,228,5,218,2,34,0,68,0,0,0,3,0,192,1,94,0,0,255,255,0,110,0,0,4,121,7,208,2,34,0,36,0,0,0,3,0,193,0,161,1,154,255,255,0,100,
-0,0,4,228,6,54,2,34,0,68,0,0,0,3,0,193,0,209,0,0,255,255,0,110,254,84,4,124,6,26,2,34,0,36,0,0,0,3,0,196,2,188,0,35,255,255,0,100,254,86,4,235,4,128,2,34,0,68,0,0,0,3,0,196,3,43,0,37,255,255,0,75,0,0,4,118,7,251,2,34,0,38,0,0,0,3,0,115,1,199,1,154,255,
-255,0,70,0,0,3,163,6,97,2,34,0,70,0,0,0,3,0,115,1,23,0,0,255,255,0,75,0,0,4,145,7,226,2,34,0,38,0,0,0,3,0,190,1,77,1,154,255,255,0,70,0,0,3,192,6,72,2,34,0,70,0,0,0,2,0,190,124,0,0,0,255,255,0,75,0,0,4,118,7,150,2,34,0,38,0,0,0,3,0,194,2,115,1,154,255,
-255,0,70,0,0,3,137,5,252,2,34,0,70,0,0,0,3,0,194,1,155,0,0,255,255,0,75,0,0,4,178,7,235,2,34,0,38,0,0,0,3,0,191,1,110,1,154,255,255,0,70,0,0,3,248,6,81,2,34,0,70,0,0,0,3,0,191,0,180,0,0,255,255,0,110,0,0,5,44,7,235,2,34,0,39,0,0,0,3,0,191,0,182,1,154,
-255,255,0,70,0,0,5,246,6,26,0,34,0,71,0,0,0,3,0,202,4,147,0,0,255,255,0,10,0,0,5,64,6,26,2,2,0,141,0,0,0,3,0,70,0,0,5,45,6,26,0,15,0,40,0,44,0,0,0,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,1,50,23,22,21,17,6,7,6,35,34,39,38,53,52,55,54,51,50,23,17,52,
-55,54,51,1,53,33,21,1,252,97,96,96,97,138,137,97,97,97,97,137,1,199,49,36,36,1,169,169,237,238,169,169,169,169,238,217,114,36,36,49,254,167,2,60,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,252,156,238,167,168,169,169,238,238,169,169,
-100,1,133,50,36,35,254,192,168,168,255,255,0,110,0,0,3,185,7,116,2,34,0,40,0,0,0,3,0,192,1,34,1,154,255,255,0,70,0,0,4,173,5,218,2,34,0,72,0,0,0,3,0,192,1,51,0,0,255,255,0,110,0,0,3,185,7,208,2,34,0,40,0,0,0,3,0,193,0,118,1,154,255,255,0,70,0,0,4,173,
-6,54,2,34,0,72,0,0,0,3,0,193,0,166,0,0,255,255,0,110,0,0,3,185,7,150,2,34,0,40,0,0,0,3,0,194,1,36,1,154,255,255,0,70,0,0,4,173,5,252,2,34,0,72,0,0,0,3,0,194,1,137,0,0,255,255,0,110,254,49,3,185,6,26,2,34,0,40,0,0,0,3,0,196,1,187,0,0,0,3,0,70,255,0,4,
-173,4,128,0,9,0,49,0,76,0,0,1,34,7,6,21,20,35,39,37,38,5,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,19,6,35,34,39,38,53,52,55,54,55,51,50,55,51,6,7,6,21,20,23,22,51,50,55,54,55,2,134,138,
-97,96,1,1,2,49,74,1,113,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,238,169,169,169,169,238,172,142,141,33,61,111,90,58,63,61,19,25,9,65,28,159,91,31,40,7,17,35,9,10,31,70,3,137,97,97,138,15,6,253,88,89,25,26,21,
-21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,169,238,238,169,169,94,92,251,114,56,53,57,93,77,102,30,32,42,88,48,59,37,15,12,29,2,6,44,0,0,255,255,0,110,0,0,3,185,7,235,2,34,0,40,0,0,0,3,0,191,0,112,1,154,255,255,0,70,0,0,4,173,
-6,81,2,34,0,72,0,0,0,3,0,191,0,163,0,0,255,255,0,80,0,0,6,107,7,226,2,34,0,42,0,0,0,3,0,190,1,135,1,154,255,255,0,70,254,101,4,198,6,72,2,34,0,74,0,0,0,3,0,190,0,175,0,0,255,255,0,80,0,0,6,107,7,208,2,34,0,42,0,0,0,3,0,193,1,139,1,154,255,255,0,70,254,
-101,4,198,6,54,2,34,0,74,0,0,0,3,0,193,0,179,0,0,255,255,0,80,0,0,6,107,7,150,2,34,0,42,0,0,0,3,0,194,2,110,1,154,255,255,0,70,254,101,4,198,5,252,2,34,0,74,0,0,0,3,0,194,1,150,0,0,255,255,0,80,253,163,6,107,6,26,2,34,0,42,0,0,0,3,0,202,2,168,249,190,
-255,255,0,70,254,101,4,198,6,238,2,34,0,74,0,0,0,3,0,201,1,166,0,207,255,255,0,110,0,0,4,130,7,226,2,34,0,43,0,0,0,3,0,190,0,161,1,154,255,255,0,100,0,0,4,43,7,192,2,34,0,75,0,0,0,3,0,190,0,125,1,120,0,2,0,10,0,0,5,51,6,26,0,43,0,47,0,0,1,50,23,22,21,
-17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,53,33,21,1,18,49,36,36,2,42,36,36,49,3,49,36,36,36,36,49,3,49,36,36,253,214,36,36,49,3,49,36,36,36,36,49,254,251,5,41,6,26,35,36,50,253,230,
-2,26,50,36,35,35,36,50,250,216,51,34,36,36,34,51,2,26,253,230,51,34,36,36,34,51,5,40,50,36,35,254,90,197,197,0,0,2,0,10,0,0,4,83,6,26,0,45,0,49,0,0,1,50,23,22,21,17,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,
-34,39,38,53,17,52,55,54,51,3,53,33,21,1,8,49,36,36,79,160,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,36,36,49,3,49,36,36,36,36,49,251,2,226,6,26,35,36,50,254,164,59,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,253,221,51,34,36,
-36,34,51,5,40,50,36,35,254,150,199,199,0,0,255,255,255,137,0,0,2,132,7,131,2,34,0,44,0,0,0,3,0,197,255,35,1,154,255,255,255,134,0,0,2,129,5,233,2,34,0,189,0,0,0,3,0,197,255,32,0,0,255,255,255,243,0,0,2,27,7,116,2,34,0,44,0,0,0,3,0,192,255,193,1,154,255,
-255,255,240,0,0,2,24,5,218,2,34,0,189,0,0,0,2,0,192,190,0,0,0,255,255,255,158,0,0,2,111,7,208,2,34,0,44,0,0,0,3,0,193,255,51,1,154,255,255,255,155,0,0,2,108,6,54,2,34,0,189,0,0,0,3,0,193,255,48,0,0,255,255,0,2,254,49,1,129,6,26,2,34,0,44,0,0,0,2,0,196,
-193,0,0,0,255,255,0,17,254,49,1,144,6,25,2,34,0,76,0,0,0,2,0,196,208,0,0,0,255,255,0,123,0,0,1,147,7,150,2,34,0,44,0,0,0,3,0,194,0,23,1,154,255,255,0,140,0,0,4,122,6,26,0,34,0,44,0,0,0,3,0,45,1,209,0,0,255,255,0,120,254,101,3,118,6,27,0,34,0,76,0,0,0,
-3,0,77,1,204,0,0,0,2,255,96,0,0,2,228,7,156,0,29,0,56,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,19,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,11,35,36,50,2,50,36,35,107,107,151,
-185,49,36,36,36,36,49,185,51,35,35,108,168,24,27,77,43,18,8,16,196,22,32,197,34,20,197,16,8,18,43,77,27,24,5,161,50,36,35,35,36,50,251,204,151,107,107,36,34,51,2,50,36,36,35,35,50,5,105,165,24,38,16,15,22,19,251,26,27,250,19,22,15,16,38,24,0,0,0,0,2,
-255,148,254,101,2,224,6,2,0,26,0,56,0,0,1,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,34,39,38,61,1,52,55,54,59,1,50,55,54,55,17,52,55,54,59,1,50,23,22,21,17,6,7,6,35,1,115,168,24,27,77,43,18,8,16,196,22,32,197,34,20,197,16,
-8,18,43,77,27,24,253,242,49,36,36,36,36,49,58,81,57,57,1,35,36,50,2,50,36,35,2,127,127,184,5,60,165,24,38,16,15,22,19,251,26,27,250,19,22,15,16,38,24,249,206,36,36,49,3,49,36,36,57,57,82,3,232,50,36,36,36,36,50,252,24,184,128,129,0,0,0,0,2,0,110,254,
-107,4,54,6,26,0,58,0,82,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,16,7,22,23,22,21,17,20,7,6,43,1,34,39,38,53,17,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,
-53,52,39,234,49,36,36,104,137,96,97,1,36,35,50,3,49,36,36,196,89,74,76,35,36,50,2,50,36,35,1,97,97,137,147,36,36,49,3,49,36,36,36,36,49,1,27,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,254,24,96,97,136,159,50,36,35,35,36,50,159,254,223,
-146,54,129,133,154,255,0,50,35,36,36,35,50,1,0,136,97,96,253,183,51,34,36,36,34,51,5,40,50,36,35,249,22,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,2,0,100,254,107,3,235,6,26,0,58,0,82,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,
-59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,
-74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,1,17,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,253,75,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,51,51,34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,
-51,5,40,50,36,35,249,22,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,1,0,100,0,0,3,235,4,128,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,
-6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,4,127,35,36,50,254,230,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,51,51,
-34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,51,3,141,50,36,35,0,0,255,255,0,120,0,0,3,130,7,251,2,34,0,47,0,0,0,3,0,115,0,160,1,154,0,2,0,144,0,0,2,145,7,244,0,29,0,49,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,
-52,55,54,51,55,6,43,1,34,39,38,53,52,63,1,54,59,1,50,23,22,21,20,7,1,12,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,120,25,27,77,43,18,8,14,176,19,36,154,43,18,10,19,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,
-50,36,35,110,23,38,15,15,21,19,251,28,39,18,15,22,19,0,0,2,0,120,254,6,3,130,6,26,0,29,0,53,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,109,
-35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,171,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,249,42,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,
-3,3,0,2,0,140,253,244,2,100,6,26,0,29,0,53,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,8,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,
-92,36,36,49,93,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,50,36,35,248,159,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,2,0,120,0,0,3,130,6,26,0,29,0,53,0,0,1,20,23,
-22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,4,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,109,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,61,34,36,36,36,49,12,50,36,36,
-56,30,49,93,71,1,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,157,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,140,0,0,2,223,6,26,0,29,0,53,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,
-38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,8,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,1,33,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,
-92,93,129,4,103,50,36,35,254,234,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,120,0,0,3,130,6,26,0,29,0,45,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,34,39,38,53,52,55,54,51,50,23,22,
-21,20,7,6,1,109,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,78,49,35,35,35,35,49,48,35,36,36,35,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,252,245,35,35,49,49,35,35,35,34,50,50,34,35,0,0,0,0,2,
-0,140,0,0,3,7,6,26,0,19,0,35,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,1,139,49,35,35,35,35,49,48,35,36,36,35,6,26,35,36,50,250,216,51,34,36,36,34,
-51,5,40,50,36,35,252,124,35,35,49,49,35,35,35,34,50,50,34,35,0,2,0,1,0,0,3,230,6,26,0,29,0,33,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,1,21,1,209,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,
-36,36,49,3,49,36,36,254,48,2,215,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,252,96,211,1,80,211,0,2,0,1,0,0,2,216,6,26,0,29,0,33,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,53,1,
-21,1,108,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,254,152,2,215,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,50,36,35,251,231,211,1,80,211,0,255,255,0,110,0,0,4,121,7,251,2,34,0,49,0,0,0,3,0,115,1,23,1,154,255,
-255,0,100,0,0,4,43,6,97,2,34,0,82,0,0,0,3,0,115,0,235,0,0,0,2,0,110,254,67,4,121,6,26,0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,
-7,6,7,39,54,53,52,39,4,121,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,152,152,213,214,152,152,253,207,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,3,156,113,80,80,80,80,113,252,100,51,34,36,36,34,51,3,156,214,152,
-151,151,152,214,250,243,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,100,254,67,4,43,4,128,0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,18,39,38,61,1,52,55,
-54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,89,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,199,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,
-36,34,51,2,35,99,70,70,70,70,99,252,108,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,255,255,0,110,0,0,4,121,7,235,2,34,0,49,0,0,0,3,0,191,0,157,1,154,255,255,0,100,0,0,4,43,6,81,2,34,0,82,0,0,0,2,0,191,113,0,0,0,0,2,0,10,0,0,4,84,5,96,
-0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,130,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,
-36,69,70,99,100,70,69,254,206,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,1,184,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,255,255,0,110,
-254,254,4,123,6,26,2,34,0,49,0,0,0,3,0,15,3,23,255,182,255,255,0,100,254,251,4,46,4,128,2,34,0,82,0,0,0,3,0,15,2,202,255,179,255,255,0,80,0,0,6,107,7,116,2,34,0,50,0,0,0,3,0,192,2,24,1,154,255,255,0,70,0,0,4,198,5,218,2,34,0,83,0,0,0,3,0,192,1,64,0,0,
-255,255,0,80,0,0,6,107,7,208,2,34,0,50,0,0,0,3,0,193,1,139,1,154,255,255,0,70,0,0,4,198,6,54,2,34,0,83,0,0,0,3,0,193,0,179,0,0,255,255,0,80,0,0,6,107,8,25,2,34,0,50,0,0,0,3,0,198,1,189,1,154,255,255,0,70,0,0,4,198,6,127,2,34,0,83,0,0,0,3,0,198,0,229,
-0,0,0,2,0,80,0,0,8,191,6,26,0,16,0,89,0,0,1,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,19,54,53,52,35,7,6,33,32,39,38,17,16,55,54,33,32,31,1,50,53,52,39,54,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,17,20,23,
-22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,5,116,15,140,157,223,222,157,157,157,157,222,223,157,140,15,20,10,1,11,230,254,189,254,189,229,229,229,229,1,67,1,67,230,11,1,10,8,79,107,151,1,101,49,36,36,36,36,49,254,155,50,35,35,1,221,49,36,36,36,36,49,
-254,35,35,35,50,1,101,49,36,36,36,36,49,254,155,151,107,79,3,63,190,140,157,157,157,223,223,157,156,156,140,190,254,8,11,1,1,11,229,229,229,1,67,1,67,229,229,229,11,1,1,11,42,78,107,36,34,51,2,50,36,36,35,35,50,254,218,35,36,50,2,50,36,35,254,218,50,
-35,35,36,36,50,2,51,34,36,107,78,0,3,0,70,0,0,8,57,4,128,0,15,0,23,0,79,0,0,0,35,34,7,6,21,20,23,22,51,50,55,54,53,52,39,36,35,34,7,6,29,1,37,1,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,23,54,55,54,51,50,23,22,23,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,
-55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,3,15,137,138,97,96,96,97,138,137,97,97,97,3,60,154,138,97,96,2,47,253,86,6,41,169,238,238,169,169,169,169,238,238,169,41,6,6,41,169,238,172,142,141,68,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,
-62,37,23,8,59,148,150,186,238,169,41,3,137,97,97,138,137,97,97,97,97,137,138,97,97,97,97,138,8,252,253,169,8,41,169,169,169,238,238,169,169,169,41,8,8,41,169,94,92,150,25,26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,41,0,
-255,255,0,110,0,0,4,106,7,251,2,34,0,53,0,0,0,3,0,115,1,15,1,154,255,255,0,100,0,0,2,207,6,97,2,34,0,86,0,0,0,2,0,115,61,0,0,0,0,3,0,110,254,67,4,106,6,26,0,16,0,58,0,82,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,33,17,20,7,6,43,1,
-34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,2,118,106,75,75,75,75,106,115,75,42,33,9,2,2,20,75,68,94,254,217,35,36,50,2,51,34,36,114,115,161,130,
-207,146,147,147,23,24,146,36,36,49,2,49,36,36,254,180,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,3,38,74,75,106,107,75,74,41,33,45,11,24,254,155,254,12,106,75,69,5,254,72,50,35,36,36,34,51,4,27,161,114,115,147,147,207,206,147,24,25,146,207,185,51,34,
-36,36,34,51,254,143,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,100,254,0,2,207,4,128,0,29,0,53,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,
-39,54,53,52,39,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,254,157,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,4,128,36,36,50,2,50,35,36,57,57,82,253,178,51,34,36,36,34,51,2,78,183,129,129,250,69,36,36,49,26,50,36,35,35,36,
-50,117,78,82,44,23,71,87,33,3,3,0,0,255,255,0,110,0,0,4,106,7,235,2,34,0,53,0,0,0,3,0,191,0,149,1,154,255,255,0,106,0,0,3,68,6,81,2,34,0,86,61,0,0,2,0,191,0,0,0,0,255,255,0,70,0,0,4,2,7,251,2,34,0,54,0,0,0,3,0,115,0,199,1,154,255,255,0,60,0,0,3,23,6,
-97,2,34,0,87,0,0,0,2,0,115,77,0,0,0,255,255,0,70,0,0,4,2,7,226,2,34,0,54,0,0,0,3,0,190,0,77,1,154,255,255,0,65,0,0,3,28,6,72,2,34,0,87,5,0,0,2,0,190,216,0,0,0,255,255,0,70,254,5,4,2,6,32,2,34,0,54,0,0,0,3,0,119,0,158,0,0,255,255,0,60,254,5,3,23,4,128,
-2,34,0,87,0,0,0,2,0,119,35,0,0,0,255,255,0,70,0,0,4,2,7,235,2,34,0,54,0,0,0,3,0,191,0,77,1,154,255,255,0,65,0,0,3,28,6,81,2,34,0,87,5,0,0,2,0,191,216,0,0,0,0,1,0,40,254,89,3,246,6,26,0,65,0,0,37,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,29,1,
-20,7,6,43,1,17,20,15,1,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,1,170,21,244,49,36,36,36,36,49,2,220,50,35,36,36,35,50,244,15,16,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,
-17,5,7,22,13,22,41,22,19,1,52,30,39,4,173,35,36,50,2,50,36,35,35,36,50,2,50,36,35,251,83,33,27,81,7,53,51,66,93,68,65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,0,0,0,1,0,102,254,43,2,134,6,26,0,80,0,0,37,38,39,38,53,17,52,55,54,59,
-1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,7,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,1,28,48,42,92,36,36,49,3,49,36,36,150,49,36,36,36,36,
-49,150,20,20,30,80,49,36,36,36,36,49,12,13,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,17,5,7,22,13,22,41,22,19,1,28,23,41,93,129,4,103,50,36,35,35,36,50,254,223,36,36,50,2,51,34,36,253,175,29,20,20,36,36,50,2,51,34,36,66,7,53,51,66,93,68,
-65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,0,255,255,0,40,0,0,3,246,7,235,2,34,0,55,0,0,0,3,0,191,0,56,1,154,0,2,0,100,0,0,2,190,6,73,0,41,0,65,0,0,19,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,
-7,6,43,1,34,39,38,53,17,52,55,54,51,4,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,224,49,36,36,150,49,36,36,36,36,49,150,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,1,40,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,
-50,254,223,36,36,50,2,51,34,36,253,175,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,221,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,1,0,15,0,0,3,221,6,26,0,39,0,0,1,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,29,1,20,7,6,43,
-1,17,33,21,33,17,20,7,6,43,1,34,39,38,53,17,33,53,1,124,244,49,36,36,36,36,49,2,220,50,35,36,36,35,50,244,1,36,254,220,35,36,50,2,50,36,35,254,221,3,136,1,158,35,36,50,2,50,36,35,35,36,50,2,50,36,35,254,98,195,253,180,50,35,36,36,35,50,2,76,195,0,0,0,
-0,1,0,110,0,0,2,114,6,26,0,45,0,0,1,21,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,33,21,1,99,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,3,49,36,36,150,49,36,36,36,36,49,
-150,1,0,2,48,246,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,35,36,50,254,223,36,36,50,2,51,34,36,152,195,255,255,0,110,0,0,4,121,7,131,2,34,0,56,0,0,0,3,0,197,0,144,1,154,255,255,0,100,0,0,4,43,5,233,2,34,0,89,0,0,0,2,0,197,100,0,0,0,255,255,
-0,110,0,0,4,121,7,116,2,34,0,56,0,0,0,3,0,192,1,46,1,154,255,255,0,100,0,0,4,43,5,218,2,34,0,89,0,0,0,3,0,192,1,2,0,0,255,255,0,110,0,0,4,121,7,208,2,34,0,56,0,0,0,3,0,193,0,161,1,154,255,255,0,100,0,0,4,43,6,54,2,34,0,89,0,0,0,2,0,193,117,0,0,0,255,
-255,0,110,0,0,4,121,8,16,2,34,0,56,0,0,0,3,0,195,1,18,1,154,255,255,0,100,0,0,4,43,6,118,2,34,0,89,0,0,0,3,0,195,0,230,0,0,255,255,0,110,0,0,4,173,8,25,2,34,0,56,0,0,0,3,0,198,0,211,1,154,255,255,0,100,0,0,4,129,6,127,2,34,0,89,0,0,0,3,0,198,0,167,0,
-0,0,1,0,110,254,213,4,121,6,26,0,59,0,0,37,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,51,6,7,6,21,20,23,22,51,50,55,54,55,21,6,35,34,39,38,53,52,2,172,28,29,213,152,152,36,36,49,3,49,
-36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,120,4,91,31,40,7,17,35,9,10,31,70,61,111,90,58,63,3,3,152,151,214,3,156,50,36,35,35,36,50,252,100,113,80,79,79,80,113,3,156,50,36,35,35,36,50,252,100,190,140,88,48,59,37,15,12,29,2,6,44,194,56,53,57,93,45,
-0,0,1,0,100,254,215,4,43,4,128,0,59,0,0,37,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,51,6,7,6,21,20,23,22,51,50,55,54,55,21,6,35,34,39,38,53,52,2,115,21,22,200,142,142,36,36,49,3,49,
-36,36,69,70,100,99,70,69,36,36,50,2,51,34,36,100,6,91,31,40,7,17,35,9,10,31,70,61,111,90,58,63,2,2,142,142,199,2,35,50,36,36,36,36,50,253,221,99,70,69,69,70,99,2,35,50,36,36,36,36,50,253,221,167,127,88,48,59,37,15,12,29,2,6,44,194,56,53,57,93,44,0,255,
-255,0,110,0,0,6,253,7,226,2,34,0,58,0,0,0,3,0,190,1,223,1,154,255,255,0,100,0,0,6,243,6,72,2,34,0,91,0,0,0,3,0,190,1,213,0,0,255,255,0,100,0,0,4,111,7,226,2,34,0,60,0,0,0,3,0,190,0,147,1,154,255,255,0,100,254,101,4,43,6,72,2,34,0,93,0,0,0,2,0,190,113,
-0,0,0,255,255,0,100,0,0,4,111,7,80,2,34,0,60,0,0,0,3,0,106,0,196,1,154,255,255,0,40,0,0,4,29,7,251,2,34,0,61,0,0,0,3,0,115,0,198,1,154,255,255,0,65,0,3,3,254,6,97,2,34,0,94,0,0,0,3,0,115,0,195,0,0,255,255,0,40,0,0,4,29,7,150,2,34,0,61,0,0,0,3,0,194,1,
-51,1,154,255,255,0,65,0,3,3,254,5,252,2,34,0,94,0,0,0,3,0,194,1,48,0,0,255,255,0,40,0,0,4,29,7,235,2,34,0,61,0,0,0,3,0,191,0,76,1,154,255,255,0,65,0,3,3,254,6,81,2,34,0,94,0,0,0,2,0,191,72,0,0,0,0,1,0,100,0,0,2,207,6,26,0,29,0,0,1,50,23,22,29,1,20,7,
-6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,6,26,35,36,50,2,50,36,35,57,57,82,252,23,51,34,36,36,34,51,3,233,183,128,129,0,0,0,0,0,0,24,1,38,0,1,0,0,0,0,0,0,0,48,0,0,
-0,1,0,0,0,0,0,1,0,20,0,55,0,1,0,0,0,0,0,2,0,7,0,48,0,1,0,0,0,0,0,3,0,33,0,55,0,1,0,0,0,0,0,4,0,20,0,55,0,1,0,0,0,0,0,5,0,45,0,88,0,1,0,0,0,0,0,6,0,17,0,133,0,1,0,0,0,0,0,7,0,37,0,150,0,1,0,0,0,0,0,8,0,10,0,11,0,1,0,0,0,0,0,10,0,160,0,187,0,1,0,0,0,0,
-0,12,0,25,1,55,0,1,0,0,0,0,0,14,0,25,1,55,0,3,0,1,4,9,0,0,0,96,1,91,0,3,0,1,4,9,0,1,0,40,1,201,0,3,0,1,4,9,0,2,0,14,1,187,0,3,0,1,4,9,0,3,0,66,1,201,0,3,0,1,4,9,0,4,0,40,1,201,0,3,0,1,4,9,0,5,0,90,2,11,0,3,0,1,4,9,0,6,0,34,2,101,0,3,0,1,4,9,0,7,0,74,
-2,135,0,3,0,1,4,9,0,8,0,20,1,113,0,3,0,1,4,9,0,10,1,64,2,209,0,3,0,1,4,9,0,12,0,50,3,201,0,3,0,1,4,9,0,14,0,50,3,201,84,121,112,101,102,97,99,101,32,169,32,83,116,117,100,105,111,84,121,112,111,46,32,50,48,49,54,46,32,65,108,108,32,82,105,103,104,116,
-115,32,82,101,115,101,114,118,101,100,82,101,103,117,108,97,114,84,121,112,111,32,82,111,117,110,100,32,66,111,108,100,32,68,101,109,111,58,86,101,114,115,105,111,110,32,49,46,48,48,86,101,114,115,105,111,110,32,49,46,48,48,32,74,97,110,117,97,114,121,
-32,56,44,32,50,48,49,54,44,32,105,110,105,116,105,97,108,32,114,101,108,101,97,115,101,84,121,112,111,82,111,117,110,100,66,111,108,100,68,101,109,111,84,121,112,111,32,82,111,117,110,100,32,168,32,84,114,97,100,101,109,97,114,107,32,111,102,32,83,116,
-117,100,105,111,84,121,112,111,46,84,104,105,115,32,105,115,32,108,105,109,105,116,101,100,32,99,104,97,114,97,99,116,101,114,32,100,101,109,111,32,118,101,114,115,105,111,110,46,13,10,105,102,32,121,111,117,32,119,111,117,108,100,32,108,105,107,101,
-32,116,111,32,99,111,110,115,105,100,101,114,32,117,115,105,110,103,32,105,116,32,102,111,114,32,99,111,109,109,101,114,99,105,97,108,32,112,114,111,106,101,99,116,115,46,32,13,10,112,108,101,97,115,101,32,118,105,115,105,116,32,13,10,13,10,104,116,116,
-112,58,47,47,119,119,119,46,115,116,117,100,105,111,116,121,112,111,46,99,111,109,47,13,10,13,10,84,104,97,110,107,115,0,84,0,121,0,112,0,101,0,102,0,97,0,99,0,101,0,32,0,169,0,32,0,83,0,116,0,117,0,100,0,105,0,111,0,84,0,121,0,112,0,111,0,46,0,32,0,
-50,0,48,0,49,0,54,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,84,0,121,0,112,0,111,0,32,0,82,0,111,0,117,0,110,0,100,0,32,0,66,0,111,
-0,108,0,100,0,32,0,68,0,101,0,109,0,111,0,58,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,32,0,74,0,97,0,110,0,117,0,97,0,114,0,121,0,32,0,56,0,44,0,32,0,50,0,48,
-0,49,0,54,0,44,0,32,0,105,0,110,0,105,0,116,0,105,0,97,0,108,0,32,0,114,0,101,0,108,0,101,0,97,0,115,0,101,0,84,0,121,0,112,0,111,0,82,0,111,0,117,0,110,0,100,0,66,0,111,0,108,0,100,0,68,0,101,0,109,0,111,0,84,0,121,0,112,0,111,0,32,0,82,0,111,0,117,
-0,110,0,100,0,32,0,174,0,32,0,84,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,83,0,116,0,117,0,100,0,105,0,111,0,84,0,121,0,112,0,111,0,46,0,84,0,104,0,105,0,115,0,32,0,105,0,115,0,32,0,108,0,105,0,109,0,105,0,116,0,101,0,100,
-0,32,0,99,0,104,0,97,0,114,0,97,0,99,0,116,0,101,0,114,0,32,0,100,0,101,0,109,0,111,0,32,0,118,0,101,0,114,0,115,0,105,0,111,0,110,0,46,0,13,0,10,0,105,0,102,0,32,0,121,0,111,0,117,0,32,0,119,0,111,0,117,0,108,0,100,0,32,0,108,0,105,0,107,0,101,0,32,
-0,116,0,111,0,32,0,99,0,111,0,110,0,115,0,105,0,100,0,101,0,114,0,32,0,117,0,115,0,105,0,110,0,103,0,32,0,105,0,116,0,32,0,102,0,111,0,114,0,32,0,99,0,111,0,109,0,109,0,101,0,114,0,99,0,105,0,97,0,108,0,32,0,112,0,114,0,111,0,106,0,101,0,99,0,116,0,115,
-0,46,0,32,0,13,0,10,0,112,0,108,0,101,0,97,0,115,0,101,0,32,0,118,0,105,0,115,0,105,0,116,0,32,0,13,0,10,0,13,0,10,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,115,0,116,0,117,0,100,0,105,0,111,0,116,0,121,0,112,0,111,0,46,0,99,0,111,
-0,109,0,47,0,13,0,10,0,13,0,10,0,84,0,104,0,97,0,110,0,107,0,115,0,0,2,0,0,0,0,0,0,255,39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,
-0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,
-0,74,0,75,0,76,0,77,0,78,0,79,1,2,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,138,0,218,0,131,0,147,0,141,0,151,0,136,0,195,0,222,
-0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,
-0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,0,215,0,216,0,225,1,3,0,219,0,220,0,221,0,224,0,217,0,223,0,178,0,179,0,182,0,183,0,196,
-0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,190,0,191,0,188,0,247,1,4,1,5,1,6,1,7,0,140,0,152,0,168,0,154,0,153,0,239,0,165,0,146,0,156,0,167,0,148,0,149,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
-1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,
-1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,
-123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,
-1,165,1,166,1,167,1,168,1,169,1,170,0,253,0,254,1,171,1,172,1,173,1,174,0,255,1,0,1,175,1,176,1,177,1,1,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,0,248,0,249,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,
-200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,0,226,0,227,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,0,176,0,177,1,237,
-1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,0,251,0,252,0,228,0,229,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,0,187,2,13,2,14,2,15,2,16,0,230,0,231,2,17,5,108,95,97,108,116,
-7,117,110,105,48,50,67,57,4,108,105,114,97,6,112,101,115,101,116,97,4,69,117,114,111,7,117,110,105,50,49,49,54,7,117,110,105,70,48,48,49,7,117,110,105,70,48,48,50,7,117,110,105,50,48,55,48,7,117,110,105,48,48,66,57,7,117,110,105,48,48,66,50,7,117,110,
-105,48,48,66,51,7,117,110,105,50,48,55,52,7,117,110,105,50,48,55,53,7,117,110,105,50,48,55,54,7,117,110,105,50,48,55,55,7,117,110,105,50,48,55,56,7,117,110,105,50,48,55,57,7,117,110,105,50,48,55,65,7,117,110,105,50,48,55,66,7,117,110,105,50,48,55,67,
-7,117,110,105,50,48,55,49,7,117,110,105,50,48,55,68,7,117,110,105,50,48,55,69,7,117,110,105,50,48,55,70,7,117,110,105,50,48,56,48,7,117,110,105,50,48,56,49,7,117,110,105,50,48,56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,7,117,110,105,50,
-48,56,53,7,117,110,105,50,48,56,54,7,117,110,105,50,48,56,55,7,117,110,105,50,48,56,56,7,117,110,105,50,48,56,57,7,117,110,105,50,48,56,65,7,117,110,105,50,48,56,66,7,117,110,105,50,48,56,67,7,117,110,105,50,48,56,68,7,117,110,105,50,48,56,69,6,65,46,
-115,109,99,112,6,66,46,115,109,99,112,6,67,46,115,109,99,112,6,68,46,115,109,99,112,6,69,46,115,109,99,112,6,70,46,115,109,99,112,6,71,46,115,109,99,112,6,72,46,115,109,99,112,6,73,46,115,109,99,112,6,74,46,115,109,99,112,6,75,46,115,109,99,112,6,76,
-46,115,109,99,112,6,77,46,115,109,99,112,6,78,46,115,109,99,112,6,79,46,115,109,99,112,6,80,46,115,109,99,112,6,81,46,115,109,99,112,6,82,46,115,109,99,112,6,83,46,115,109,99,112,6,84,46,115,109,99,112,6,85,46,115,109,99,112,6,86,46,115,109,99,112,6,
-87,46,115,109,99,112,6,88,46,115,109,99,112,6,89,46,115,109,99,112,6,90,46,115,109,99,112,7,117,110,105,50,48,68,68,7,117,110,105,50,52,66,54,7,117,110,105,50,52,66,55,7,117,110,105,50,52,66,56,7,117,110,105,50,52,66,57,7,117,110,105,50,52,66,65,7,117,
-110,105,50,52,66,66,7,117,110,105,50,52,66,67,7,117,110,105,50,52,66,68,7,117,110,105,50,52,66,69,7,117,110,105,50,52,66,70,7,117,110,105,50,52,67,48,7,117,110,105,50,52,67,49,7,117,110,105,50,52,67,50,7,117,110,105,50,52,67,51,7,117,110,105,50,52,67,
-52,7,117,110,105,50,52,67,53,7,117,110,105,50,52,67,54,7,117,110,105,50,52,67,55,7,117,110,105,50,52,67,56,7,117,110,105,50,52,67,57,7,117,110,105,50,52,67,65,7,117,110,105,50,52,67,66,7,117,110,105,50,52,67,67,7,117,110,105,50,52,67,68,7,117,110,105,
-50,52,67,69,7,117,110,105,50,52,67,70,7,117,110,105,50,52,68,48,7,117,110,105,50,52,68,49,7,117,110,105,50,52,68,50,7,117,110,105,50,52,68,51,7,117,110,105,50,52,68,52,7,117,110,105,50,52,68,53,7,117,110,105,50,52,68,54,7,117,110,105,50,52,68,55,7,117,
-110,105,50,52,68,56,7,117,110,105,50,52,68,57,7,117,110,105,50,52,68,65,7,117,110,105,50,52,68,66,7,117,110,105,50,52,68,67,7,117,110,105,50,52,68,68,7,117,110,105,50,52,68,69,7,117,110,105,50,52,68,70,7,117,110,105,50,52,69,48,7,117,110,105,50,52,69,
-49,7,117,110,105,50,52,69,50,7,117,110,105,50,52,69,51,7,117,110,105,50,52,69,52,7,117,110,105,50,52,69,53,7,117,110,105,50,52,69,54,7,117,110,105,50,52,69,55,7,117,110,105,50,52,69,56,7,117,110,105,50,52,69,57,7,117,110,105,50,52,69,65,7,117,110,105,
-50,52,69,66,7,117,110,105,50,52,69,67,7,117,110,105,50,52,69,68,7,117,110,105,50,52,69,69,7,117,110,105,50,52,69,70,7,117,110,105,50,52,70,48,7,117,110,105,50,52,70,49,7,117,110,105,50,52,70,50,7,117,110,105,50,52,70,51,7,117,110,105,50,52,70,52,7,117,
-110,105,50,52,70,70,6,99,105,114,99,108,101,6,72,49,56,53,51,51,7,117,110,105,50,52,54,48,7,117,110,105,50,52,54,49,7,117,110,105,50,52,54,50,7,117,110,105,50,52,54,51,7,117,110,105,50,52,54,52,7,117,110,105,50,52,54,53,7,117,110,105,50,52,54,54,7,117,
-110,105,50,52,54,55,7,117,110,105,50,52,54,56,7,117,110,105,50,52,54,57,7,117,110,105,50,52,54,65,7,117,110,105,50,52,54,66,7,117,110,105,50,52,54,67,7,117,110,105,50,52,54,68,7,117,110,105,50,52,54,69,7,117,110,105,50,52,54,70,7,117,110,105,50,52,55,
-48,7,117,110,105,50,52,55,49,7,117,110,105,50,52,55,50,7,117,110,105,50,52,55,51,7,117,110,105,50,55,55,54,7,117,110,105,50,55,55,55,7,117,110,105,50,55,55,56,7,117,110,105,50,55,55,57,7,117,110,105,50,55,55,65,7,117,110,105,50,55,55,66,7,117,110,105,
-50,55,55,67,7,117,110,105,50,55,55,68,7,117,110,105,50,55,55,69,7,117,110,105,50,55,55,70,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,110,6,65,98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,101,107,7,97,111,103,111,110,101,107,
-11,67,99,105,114,99,117,109,102,108,101,120,11,99,99,105,114,99,117,109,102,108,101,120,10,67,100,111,116,97,99,99,101,110,116,10,99,100,111,116,97,99,99,101,110,116,6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,97,116,7,69,109,97,99,
-114,111,110,7,101,109,97,99,114,111,110,6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,116,97,99,99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,103,111,110,101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,
-6,101,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,99,105,114,99,117,109,102,108,101,120,10,71,100,111,116,97,99,99,101,110,116,10,103,100,111,116,97,99,99,101,110,116,7,117,110,105,48,49,50,50,7,117,110,105,48,49,50,51,11,72,
-99,105,114,99,117,109,102,108,101,120,11,104,99,105,114,99,117,109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,108,100,101,6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,97,99,114,111,110,6,73,98,114,101,118,101,6,105,
-98,114,101,118,101,7,73,111,103,111,110,101,107,7,105,111,103,111,110,101,107,10,73,100,111,116,97,99,99,101,110,116,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,120,11,106,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,51,54,
-7,117,110,105,48,49,51,55,12,107,103,114,101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,99,117,116,101,7,117,110,105,48,49,51,66,7,117,110,105,48,49,51,67,6,76,99,97,114,111,110,6,108,99,97,114,111,110,4,76,100,111,116,4,108,100,111,
-116,6,78,97,99,117,116,101,6,110,97,99,117,116,101,7,117,110,105,48,49,52,53,7,117,110,105,48,49,52,54,6,78,99,97,114,111,110,6,110,99,97,114,111,110,11,110,97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,7,79,109,97,99,114,111,110,
-7,111,109,97,99,114,111,110,6,79,98,114,101,118,101,6,111,98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,117,116,13,111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,116,101,6,114,97,99,117,116,101,7,117,110,105,48,49,53,
-54,7,117,110,105,48,49,53,55,6,82,99,97,114,111,110,6,114,99,97,114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,83,99,105,114,99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,54,50,7,117,110,105,
-48,49,54,51,6,84,99,97,114,111,110,6,116,99,97,114,111,110,4,84,98,97,114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,100,101,7,85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,101,118,101,6,117,98,114,101,118,101,5,85,
-114,105,110,103,5,117,114,105,110,103,13,85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,103,97,114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,103,111,110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,
-99,105,114,99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,120,11,121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,122,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,116,97,99,99,101,110,116,
-5,108,111,110,103,115,0,0,0,1,255,255,0,2,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,12,0,14,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,36,0,88,0,1,108,97,116,110,0,8,0,4,0,0,0,0,255,255,0,4,0,3,0,0,0,2,0,1,0,4,102,114,97,99,0,26,104,105,115,116,
-0,34,110,97,108,116,0,40,115,105,110,102,0,46,0,0,0,2,0,1,0,2,0,0,0,1,0,4,0,0,0,1,0,3,0,0,0,1,0,0,0,5,0,12,0,90,0,112,0,172,1,34,0,1,0,0,0,1,0,8,0,2,0,36,0,15,1,7,1,8,1,4,0,250,0,251,0,252,0,253,0,254,0,255,1,0,1,1,1,2,1,3,1,6,1,5,0,1,0,15,0,11,0,12,
-0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,224,0,1,0,0,0,1,0,8,0,2,0,8,0,1,0,213,0,1,0,1,0,18,0,4,0,0,0,1,0,8,0,1,0,44,0,2,0,10,0,32,0,2,0,6,0,14,0,122,0,3,0,213,0,21,0,121,0,3,0,213,0,23,0,1,0,4,0,123,0,3,0,213,0,23,0,1,0,2,0,20,0,
-22,0,1,0,0,0,1,0,8,0,2,0,56,0,25,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,0,1,0,25,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,51,0,52,0,53,
-0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,1,0,0,0,1,0,8,0,2,0,8,0,1,2,2,0,1,0,1,0,87,0,0 };
-
-const char* typoround_bold_otf = (const char*) temp_binary_data_0;
-
-
-const char* getNamedResource (const char* resourceNameUTF8, int& numBytes);
-const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
-{
-    unsigned int hash = 0;
-
-    if (resourceNameUTF8 != nullptr)
-        while (*resourceNameUTF8 != 0)
-            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
-
-    switch (hash)
-    {
-        case 0x3a77363c:  numBytes = 65816; return typoround_bold_otf;
-        default: break;
-    }
-
-    numBytes = 0;
-    return nullptr;
-}
-
-const char* namedResourceList[] =
-{
-    "typoround_bold_otf"
-};
-
-const char* originalFilenames[] =
-{
-    "typo-round.bold.otf"
-};
-
-const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
-const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
-{
-    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
-        if (strcmp (namedResourceList[i], resourceNameUTF8) == 0)
-            return originalFilenames[i];
-
-    return nullptr;
-}
-
-}
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#include <cstring>
+
+namespace BinaryData
+{
+
+//================== typo-round.bold.otf ==================
+static const unsigned char temp_binary_data_0[] =
+{ 0,1,0,0,0,15,0,128,0,3,0,112,68,83,73,71,0,0,0,1,0,0,255,96,0,0,0,8,71,68,69,70,0,1,0,0,0,0,255,104,0,0,0,12,71,80,79,83,0,25,0,12,0,0,255,116,0,0,0,18,71,83,85,66,56,111,73,83,0,0,255,136,0,0,1,144,79,83,47,50,26,20,95,71,0,0,1,120,0,0,0,96,99,109,97,
+112,167,129,119,250,0,0,9,228,0,0,3,236,103,97,115,112,255,255,0,3,0,0,255,88,0,0,0,8,103,108,121,102,26,132,209,6,0,0,17,216,0,0,219,160,104,101,97,100,13,64,66,30,0,0,0,252,0,0,0,54,104,104,101,97,16,245,7,66,0,0,1,52,0,0,0,36,104,109,116,120,240,0,
+166,32,0,0,1,216,0,0,8,12,108,111,99,97,219,79,16,46,0,0,13,208,0,0,4,8,109,97,120,112,2,137,10,2,0,0,1,88,0,0,0,32,110,97,109,101,160,33,64,255,0,0,237,120,0,0,5,55,112,111,115,116,90,94,8,57,0,0,242,176,0,0,12,168,0,1,0,0,0,1,0,0,45,142,111,102,95,
+15,60,245,0,9,8,0,0,0,0,0,210,176,31,192,0,0,0,0,210,181,215,167,255,46,253,163,9,143,8,25,0,1,0,6,0,1,0,0,0,0,0,0,0,1,0,0,8,16,254,5,0,37,9,169,255,46,253,144,9,143,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,1,0,0,2,3,5,0,0,65,5,0,0,65,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,3,0,2,0,3,4,240,2,188,0,5,0,2,5,191,5,33,0,0,1,215,5,191,5,33,0,0,2,49,0,102,2,18,0,0,2,0,5,0,0,0,0,0,0,0,128,0,0,167,80,0,164,79,0,0,0,0,0,0,0,0,83,84,80,79,0,32,0,0,251,2,6,26,254,101,0,205,8,16,1,251,32,0,0,147,0,0,0,0,4,128,6,26,0,0,0,
+32,0,3,6,11,0,100,1,4,0,0,1,4,0,0,2,99,0,0,1,224,0,100,2,149,0,50,5,132,0,15,4,17,0,60,5,231,0,100,5,61,0,100,1,189,0,100,2,195,0,100,2,195,0,34,3,209,0,106,4,128,0,50,1,185,0,23,3,104,0,50,6,11,0,100,2,183,0,0,4,251,0,100,2,177,0,10,4,200,0,100,4,11,
+0,70,4,229,0,70,4,150,0,120,4,234,0,100,3,192,0,10,4,252,0,100,4,234,0,100,1,224,0,100,1,224,0,23,4,166,0,50,4,128,0,50,4,166,0,50,4,86,0,82,8,157,0,100,4,231,0,110,4,140,0,110,4,178,0,75,5,104,0,110,3,240,0,110,3,165,0,110,6,187,0,80,4,240,0,110,2,13,
+0,140,3,33,0,10,4,134,0,110,3,140,0,120,7,107,0,110,4,231,0,110,6,187,0,80,4,218,0,110,6,187,0,80,4,166,0,110,4,72,0,70,4,30,0,40,4,231,0,110,4,192,0,20,7,107,0,110,4,211,0,100,4,211,0,100,4,69,0,40,2,199,0,100,2,183,0,0,2,199,0,100,5,89,0,247,3,239,
+255,246,2,169,0,11,5,72,0,100,5,42,0,100,3,207,0,70,5,42,0,70,4,253,0,70,2,247,0,100,5,42,0,70,4,143,0,100,2,8,0,120,2,17,255,46,4,49,0,100,2,13,0,140,2,155,0,140,7,87,0,100,4,143,0,100,5,12,0,70,5,42,0,100,5,42,0,70,2,217,0,100,3,83,0,60,2,144,0,100,
+4,143,0,100,4,123,0,21,7,87,0,100,4,113,0,85,4,143,0,100,4,58,0,65,2,225,0,50,2,133,0,200,2,225,0,50,4,31,0,37,1,224,0,40,4,108,0,48,4,197,0,100,4,211,0,38,4,191,255,247,2,31,0,150,4,112,0,70,3,75,0,100,7,45,0,110,3,213,0,100,4,108,0,30,4,83,0,130,7,
+19,0,100,3,184,0,50,3,134,0,100,4,128,0,50,2,169,0,182,4,163,0,110,4,104,0,100,2,99,0,100,2,188,0,108,4,118,255,236,6,244,0,40,6,156,0,40,7,206,0,40,4,86,0,14,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,7,27,0,110,4,178,0,
+75,3,240,0,110,3,240,0,110,3,240,0,110,3,240,0,110,2,13,0,140,2,13,0,140,2,13,0,140,2,13,0,140,5,134,0,10,4,231,0,110,6,187,0,80,6,187,0,80,6,187,0,80,6,187,0,80,6,187,0,80,3,149,0,51,6,187,0,80,4,231,0,110,4,231,0,110,4,231,0,110,4,231,0,110,4,211,0,
+100,5,0,0,140,4,160,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,5,72,0,100,8,197,0,100,3,207,0,70,4,253,0,70,4,253,0,70,4,253,0,70,4,253,0,70,2,8,0,137,2,8,0,137,2,8,0,137,2,8,0,137,5,72,0,100,4,143,0,100,5,12,0,70,5,12,0,70,5,12,0,70,
+5,12,0,70,5,12,0,70,3,184,0,50,5,12,0,70,4,143,0,100,4,143,0,100,4,143,0,100,4,143,0,100,4,143,0,100,5,42,0,100,4,143,0,100,2,8,0,137,3,173,0,105,3,174,0,106,2,140,0,50,3,166,0,107,1,224,0,100,2,196,0,100,2,71,0,65,3,200,0,102,4,60,0,108,4,173,0,100,
+6,61,0,100,1,199,0,100,1,199,0,100,1,199,0,100,2,216,0,100,2,216,0,100,2,216,0,100,4,116,0,10,4,116,0,10,3,125,0,100,8,60,0,100,2,226,0,30,2,226,255,236,1,240,255,207,4,6,0,10,4,197,0,100,9,169,0,160,5,156,0,100,8,241,0,160,5,38,0,20,4,41,0,123,5,48,
+0,105,5,125,0,100,5,149,0,110,3,184,0,50,4,198,0,106,4,251,0,100,2,157,0,7,4,234,0,102,4,138,0,100,4,138,0,100,4,195,0,100,5,41,0,100,3,84,0,40,1,241,0,40,3,51,0,40,2,203,0,40,3,139,0,40,3,25,0,40,3,73,0,40,2,239,0,40,3,84,0,40,3,73,0,40,3,69,0,40,2,
+195,0,40,3,69,0,40,1,79,0,40,2,13,0,40,2,13,0,40,3,14,0,40,3,84,0,40,1,241,0,40,3,51,0,40,2,203,0,40,3,139,0,40,3,25,0,40,3,73,0,40,2,239,0,40,3,84,0,40,3,73,0,40,3,69,0,40,2,195,0,40,3,69,0,40,2,13,0,40,2,13,0,40,3,203,0,70,3,165,0,70,3,227,0,70,4,82,
+0,70,3,59,0,70,3,22,0,70,5,87,0,70,3,210,0,70,1,123,0,70,2,186,0,70,3,153,0,70,3,10,0,70,5,174,0,70,3,203,0,70,5,87,0,70,3,224,0,70,5,87,0,70,3,192,0,70,3,144,0,70,3,158,0,70,3,203,0,70,4,70,0,78,5,174,0,70,3,203,0,70,3,203,0,70,3,187,0,70,8,13,0,100,
+7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,70,7,209,0,
+70,7,209,0,70,7,209,0,70,7,209,0,70,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,
+0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,
+13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,
+8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,8,13,0,100,4,231,0,110,5,72,0,100,4,231,0,110,5,72,0,100,4,231,0,110,5,72,0,100,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,4,178,0,75,3,207,0,70,5,104,0,110,6,38,0,70,5,134,0,10,5,66,
+0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,3,240,0,110,4,253,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,6,187,0,80,5,42,0,70,4,240,0,110,4,143,0,100,5,61,0,10,4,183,0,10,2,
+13,0,140,2,8,0,137,2,13,0,140,2,8,0,137,2,13,0,140,2,8,0,137,2,13,0,140,2,8,0,120,2,13,0,140,4,242,0,140,3,221,0,120,2,244,255,96,2,231,255,148,4,134,0,110,4,49,0,100,4,49,0,100,3,140,0,120,2,110,0,144,3,140,0,120,2,110,0,140,3,140,0,120,3,1,0,140,3,
+140,0,120,3,41,0,140,3,240,0,1,2,217,0,1,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,184,0,10,4,231,0,110,4,143,0,100,6,187,0,80,5,12,0,70,6,187,0,80,5,12,0,70,6,187,0,80,5,12,0,70,8,229,0,80,8,108,0,70,4,166,0,110,2,217,
+0,100,4,166,0,110,2,217,0,100,4,166,0,110,2,217,0,106,4,72,0,70,3,83,0,60,4,72,0,70,3,82,0,65,4,72,0,70,3,83,0,60,4,72,0,70,3,83,0,65,4,30,0,40,2,144,0,102,4,30,0,40,2,218,0,100,3,236,0,15,2,144,0,110,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,
+231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,4,231,0,110,4,143,0,100,7,107,0,110,7,87,0,100,4,211,0,100,4,143,0,100,4,211,0,100,4,69,0,40,4,58,0,65,4,69,0,40,4,58,0,65,4,69,0,40,4,58,0,65,2,221,0,100,0,0,0,3,0,0,0,3,0,0,0,28,
+0,1,0,0,0,0,1,226,0,3,0,1,0,0,0,28,0,4,1,198,0,0,0,100,0,64,0,5,0,36,0,0,0,29,0,108,0,126,0,160,0,172,0,185,0,255,1,48,1,49,1,127,2,199,2,201,2,221,3,126,32,20,32,26,32,30,32,34,32,38,32,58,32,68,32,113,32,124,32,142,32,164,32,167,32,172,32,221,33,22,
+33,34,34,2,34,6,34,15,34,18,34,21,34,26,34,30,34,43,34,72,34,101,36,115,36,244,36,255,37,203,37,207,39,127,240,2,251,2,255,255,0,0,0,0,0,29,0,32,0,109,0,160,0,161,0,173,0,187,1,0,1,49,1,50,2,198,2,201,2,216,3,126,32,19,32,24,32,28,32,32,32,38,32,57,32,
+68,32,112,32,116,32,125,32,163,32,167,32,172,32,221,33,22,33,34,34,2,34,6,34,15,34,17,34,21,34,25,34,30,34,43,34,72,34,100,36,96,36,182,36,255,37,203,37,207,39,118,240,1,251,1,255,255,0,1,255,228,255,227,255,228,0,0,255,194,0,0,255,189,0,132,0,0,0,131,
+253,248,253,247,253,233,252,160,224,180,224,177,224,176,224,175,224,172,224,154,224,145,0,0,224,121,224,122,224,51,224,49,224,45,224,70,223,196,223,185,222,218,222,215,222,207,222,206,222,192,0,0,222,196,222,184,222,156,222,129,221,6,220,110,220,100,
+219,153,219,150,218,4,16,230,5,230,0,1,0,0,0,0,0,0,0,0,0,92,0,0,0,90,0,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+16,0,111,0,112,0,113,0,114,0,235,0,236,0,115,0,116,0,117,0,118,0,119,0,234,0,189,0,233,0,246,0,118,0,225,0,6,2,10,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+0,0,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,
+0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,98,0,0,0,129,0,130,0,132,0,134,0,
+142,0,147,0,153,0,158,0,157,0,159,0,161,0,160,0,162,0,164,0,166,0,165,0,167,0,168,0,170,0,169,0,171,0,172,0,174,0,176,0,175,0,177,0,179,0,178,0,183,0,182,0,184,0,185,0,207,0,113,0,100,0,101,0,105,0,209,0,117,0,156,0,111,0,107,0,219,0,115,0,106,0,0,0,
+131,0,149,0,226,0,114,0,229,0,230,0,103,0,116,0,220,0,223,0,222,0,0,0,227,0,108,0,0,0,0,0,163,0,181,0,124,0,99,0,110,0,225,0,0,0,228,0,221,0,109,0,120,0,210,0,3,0,125,0,128,0,146,1,213,1,214,0,199,0,200,0,204,0,205,0,201,0,202,0,180,0,0,0,188,1,251,0,
+213,0,217,0,211,0,212,0,231,0,232,0,208,0,118,0,203,0,206,0,0,0,127,0,135,0,126,0,136,0,133,0,138,0,139,0,140,0,137,0,144,0,145,0,0,0,143,0,151,0,152,0,150,0,189,0,190,0,197,0,112,0,193,0,194,0,195,0,119,0,198,0,196,0,191,0,0,6,116,6,116,6,116,6,116,
+6,166,6,214,7,114,7,236,8,92,8,200,8,228,9,34,9,96,9,200,10,8,10,42,10,76,16,192,16,208,17,8,17,48,17,122,17,208,18,16,18,88,18,162,18,204,19,38,19,112,19,162,19,218,20,8,20,68,20,112,20,208,21,86,21,148,21,226,22,34,22,94,22,170,22,232,23,62,23,126,
+23,160,23,206,24,34,24,80,24,166,24,222,25,20,25,78,25,160,25,246,26,68,26,116,26,172,26,216,27,46,27,140,27,212,28,14,28,34,28,50,28,70,28,114,28,126,28,160,28,220,29,28,29,88,29,152,29,226,30,30,30,112,30,178,30,234,31,48,31,132,31,166,31,212,32,42,
+32,98,32,148,32,212,33,20,33,68,33,146,33,206,34,6,34,56,34,142,34,234,35,72,35,134,35,242,36,0,36,108,36,196,36,206,37,22,37,114,37,176,37,218,37,238,38,154,38,204,39,56,39,116,39,160,39,176,40,22,40,32,40,86,40,178,40,212,41,32,41,64,41,74,41,134,41,
+178,41,194,41,210,41,226,41,236,41,248,42,4,42,16,42,28,42,40,42,52,42,170,42,182,42,194,42,206,42,218,42,230,42,242,42,254,43,10,43,22,43,90,43,102,43,114,43,126,43,138,43,150,43,162,43,232,44,54,44,66,44,78,44,90,44,102,44,114,44,178,45,18,45,30,45,
+42,45,54,45,66,45,78,45,90,45,216,45,228,45,240,45,252,46,8,46,20,46,32,46,44,46,56,46,68,46,180,46,192,46,204,46,216,46,228,46,240,46,252,47,74,47,148,47,160,47,172,47,184,47,196,47,208,48,24,48,36,48,70,48,112,48,160,48,194,48,242,49,14,49,68,49,108,
+49,164,49,176,49,190,49,204,49,244,50,26,50,36,50,48,50,60,50,70,50,94,50,130,50,154,50,224,50,250,51,20,51,36,51,130,51,138,52,14,52,136,52,214,52,250,53,94,53,136,53,184,53,248,54,26,54,94,54,168,55,16,55,118,55,196,56,20,56,32,56,44,56,100,56,140,
+56,214,57,42,57,104,57,176,57,248,58,34,58,124,58,196,59,2,59,36,59,96,59,152,59,214,60,20,60,76,60,132,60,172,60,246,61,74,61,136,61,206,62,22,62,64,62,154,62,226,63,30,63,64,63,124,63,186,63,248,64,54,64,126,64,190,64,244,65,62,65,124,65,208,66,16,
+66,50,66,96,66,178,66,224,67,54,67,110,67,164,67,222,68,46,68,132,68,210,69,2,69,58,69,102,69,188,70,22,70,94,70,152,70,206,71,58,71,178,72,32,72,132,72,254,73,106,73,236,74,92,74,172,75,8,75,138,75,230,76,106,76,208,77,52,77,156,78,22,78,154,79,22,79,
+116,79,218,80,52,80,184,81,64,81,182,82,30,82,44,82,58,82,72,82,86,82,100,82,114,82,128,82,142,82,156,82,170,82,184,82,198,82,212,82,226,82,240,82,254,83,12,83,26,83,40,83,54,83,68,83,82,83,96,83,110,83,124,83,138,83,150,83,248,84,124,85,8,85,128,86,
+2,86,132,86,232,87,124,87,254,88,146,88,226,89,24,89,54,89,66,89,78,89,90,89,102,89,114,89,126,89,138,89,150,89,162,89,178,89,194,89,210,89,226,89,242,90,2,90,18,90,34,90,50,90,66,90,234,91,42,91,140,91,248,92,80,92,176,93,16,93,82,93,194,94,34,94,148,
+94,160,94,172,94,184,94,196,94,208,94,220,94,232,94,244,95,0,95,12,95,24,95,36,95,48,95,60,95,72,95,84,95,92,95,162,95,174,95,186,95,198,95,210,95,222,95,234,95,246,96,104,96,116,96,128,96,140,96,152,96,164,96,176,96,188,96,200,96,212,96,224,96,236,96,
+248,97,64,97,138,97,150,97,162,97,174,97,186,97,198,97,210,97,222,97,234,97,246,98,2,98,14,98,96,98,180,99,40,99,156,99,240,99,252,100,68,100,146,100,224,101,46,101,124,101,194,101,250,102,48,102,102,102,114,102,126,102,214,103,46,103,58,103,70,103,158,
+103,170,103,182,103,194,103,206,103,218,103,230,103,242,103,254,104,126,104,244,105,0,105,12,105,130,105,210,105,222,105,234,105,246,106,2,106,14,106,26,106,38,106,50,106,62,106,74,106,168,107,24,107,36,107,128,107,188,107,252,108,8,108,20,108,32,108,
+44,108,56,108,68,108,80,108,92,108,104,108,116,108,200,109,28,109,40,109,52,109,64,109,76,109,88,109,100,109,112,109,124,109,136,109,148,109,160,109,208,0,65,0,100,254,230,5,155,5,148,0,3,0,7,0,18,0,30,0,64,0,82,0,106,0,122,0,135,0,157,0,172,0,196,0,
+216,0,251,1,30,1,78,1,99,1,131,1,154,1,167,1,175,1,184,1,193,1,227,2,5,2,14,2,25,2,46,2,69,2,91,2,137,2,152,2,172,2,200,2,234,3,7,3,19,3,26,3,36,3,62,3,87,3,110,3,120,3,136,3,156,3,172,3,188,3,223,4,7,4,57,4,87,4,97,4,127,4,140,4,153,4,163,4,175,4,188,
+4,197,4,204,4,211,4,221,4,230,4,243,4,255,0,0,19,17,33,17,37,33,17,33,1,51,23,21,22,21,7,35,38,61,1,37,51,23,6,21,20,23,7,35,38,39,54,37,51,20,23,6,29,1,20,23,51,50,55,51,22,51,6,21,20,51,22,21,35,34,39,35,6,43,1,34,39,38,61,1,52,37,51,50,23,22,29,1,
+20,7,6,43,1,34,39,53,52,55,54,5,51,22,21,20,7,6,7,21,35,34,39,53,35,39,52,55,51,49,52,35,38,53,54,5,21,20,23,50,55,54,61,1,52,39,34,53,34,7,6,37,22,21,50,21,54,55,54,53,52,39,35,6,23,50,23,34,7,38,35,6,7,22,21,6,35,38,53,54,51,21,20,23,51,54,23,50,23,
+22,29,1,20,7,6,35,38,53,52,55,54,55,50,23,50,21,6,35,38,39,6,7,34,7,35,34,39,38,53,54,51,22,21,51,54,33,50,23,6,35,38,39,6,7,6,43,1,34,39,54,51,22,21,51,54,5,22,29,1,20,7,35,38,35,34,7,20,23,22,21,20,15,1,35,34,39,53,54,55,51,22,51,54,53,38,35,34,61,
+1,52,33,50,23,21,6,35,52,39,34,7,21,20,23,22,21,20,7,35,34,39,53,54,59,1,22,51,54,53,52,39,34,39,38,53,52,5,49,22,51,6,29,1,22,59,1,54,53,49,51,21,22,21,20,7,34,43,1,34,39,38,53,49,52,59,1,22,51,7,20,23,51,50,53,52,39,35,6,43,1,34,39,53,52,37,22,29,1,
+20,7,35,20,23,50,55,51,22,21,6,43,1,34,39,52,55,37,51,22,21,6,21,48,23,6,43,1,39,6,43,1,38,61,1,52,55,22,23,53,38,35,34,7,35,38,39,53,54,33,22,21,20,7,35,21,22,51,50,55,51,50,23,20,7,6,43,1,34,39,52,55,5,22,59,1,54,55,53,38,43,1,34,7,6,39,50,55,53,38,
+35,34,7,5,51,50,55,38,43,1,34,7,5,21,20,23,50,55,38,35,6,7,50,23,21,7,35,38,35,34,7,22,21,20,23,54,59,1,21,7,22,21,35,38,53,35,6,35,53,50,55,38,53,54,59,1,50,23,7,35,53,52,39,6,21,20,23,48,21,54,59,1,23,21,34,7,23,20,23,35,52,39,6,35,53,55,38,53,52,7,
+59,1,21,20,23,35,38,53,55,59,1,21,20,23,35,38,61,1,52,7,22,51,6,21,51,55,21,34,7,23,7,35,38,39,35,53,55,51,53,52,33,50,23,6,29,1,51,55,21,35,7,23,7,35,38,53,35,55,53,55,51,53,52,55,50,23,6,29,1,51,55,29,1,34,7,21,20,23,7,35,39,35,53,55,51,37,51,50,23,
+6,21,35,38,35,34,7,6,29,1,20,23,22,51,54,61,1,38,43,1,53,50,23,22,21,6,21,20,23,34,7,35,34,39,6,7,35,34,39,53,52,55,5,50,23,21,20,15,1,34,39,38,61,1,52,55,54,51,50,23,35,6,35,38,39,6,15,1,35,34,39,55,51,22,21,51,54,5,22,21,50,21,20,7,6,35,21,20,23,51,
+50,55,51,20,23,21,6,43,1,34,39,53,52,55,54,33,51,50,23,22,23,6,7,22,21,7,35,39,6,43,1,38,61,1,54,51,50,23,53,52,39,35,34,7,35,34,39,53,54,5,50,23,20,51,54,55,54,53,51,50,23,6,29,1,20,23,6,21,35,38,39,35,6,7,35,34,61,1,23,22,59,1,50,55,54,53,38,43,1,34,
+5,50,55,38,43,1,34,5,22,59,1,50,55,38,43,1,6,5,50,23,6,7,20,23,6,43,1,34,39,35,20,7,34,39,38,53,52,55,51,50,23,53,52,39,23,6,29,1,54,51,22,21,35,6,35,22,23,6,35,53,38,53,39,35,53,51,53,52,33,51,23,6,29,1,54,51,23,21,6,21,20,23,6,35,53,38,53,35,53,51,
+52,39,50,23,21,20,7,35,38,53,54,23,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,59,1,50,29,1,54,51,50,23,20,23,6,15,1,35,23,20,23,35,38,55,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,51,50,23,51,54,59,1,50,23,
+35,6,43,1,38,35,6,7,6,35,34,39,38,35,6,21,6,35,53,39,54,51,22,23,51,54,5,22,29,1,6,7,35,52,39,35,34,7,21,20,51,22,29,1,20,7,6,43,1,34,39,52,55,51,22,51,50,53,52,39,34,39,38,61,1,52,5,22,51,6,29,1,20,23,51,54,61,1,51,21,22,29,1,20,7,6,35,34,39,38,61,1,
+52,51,23,7,21,20,23,51,50,55,54,61,1,39,35,6,43,1,34,39,38,61,1,52,5,51,50,23,22,21,6,35,49,38,43,1,6,15,1,20,23,51,50,55,51,22,21,6,35,34,39,52,55,54,5,51,23,20,7,22,23,35,39,38,39,22,29,1,20,59,1,54,55,54,55,51,22,21,6,29,1,20,23,20,7,49,38,53,35,6,
+43,1,34,53,23,20,23,51,50,55,53,52,47,1,35,34,7,23,20,23,51,50,55,54,61,1,38,43,1,34,23,20,31,1,50,55,38,43,1,34,23,21,20,23,51,50,55,54,53,38,35,34,23,20,59,1,50,55,54,61,1,38,43,1,34,7,50,23,21,6,35,34,39,54,3,21,33,34,7,53,18,33,51,50,23,22,21,33,
+5,33,21,38,43,1,34,61,1,54,41,1,23,21,20,7,35,38,53,37,51,20,23,51,50,29,1,20,43,1,38,53,1,51,22,51,21,6,43,1,34,39,53,50,100,5,55,250,236,4,240,251,16,2,78,3,11,2,7,6,3,1,243,1,14,1,3,11,4,2,1,1,254,78,4,7,4,15,1,21,14,2,12,1,6,12,2,8,13,7,1,11,16,5,
+20,7,1,1,56,6,12,16,12,40,7,7,7,30,5,40,8,252,181,9,28,33,12,15,1,5,9,5,5,5,5,6,6,18,3,74,25,22,15,5,26,3,17,18,3,252,189,1,1,29,8,8,15,6,26,180,19,9,1,14,6,7,17,3,1,10,5,13,12,3,3,1,10,151,20,13,2,35,5,4,27,25,2,86,19,17,1,8,4,15,8,9,9,1,4,7,7,2,2,7,
+7,3,1,7,2,73,16,19,9,4,15,9,6,13,3,1,6,7,3,6,9,1,1,7,253,72,18,10,1,4,9,13,3,29,20,20,8,5,24,10,1,8,1,12,16,14,4,17,28,1,221,13,7,11,3,11,12,5,29,19,24,8,23,12,8,2,1,12,15,14,16,25,5,2,1,118,13,1,1,2,11,1,18,15,7,30,2,3,5,18,5,1,3,1,9,3,1,9,2,23,1,1,
+8,18,1,19,6,252,108,23,39,10,17,11,10,4,8,17,13,7,26,4,32,1,105,11,27,1,2,9,4,1,2,12,11,7,22,32,11,9,4,13,9,9,3,2,6,12,1,57,24,42,7,7,9,10,13,1,1,8,21,4,5,7,24,5,30,254,57,2,10,3,24,2,6,14,2,13,5,1,211,19,14,7,2,16,8,2,141,3,17,14,6,3,3,16,6,254,221,
+10,17,8,8,11,16,49,13,2,6,2,3,5,6,2,1,2,5,4,3,11,5,11,4,1,5,5,6,4,3,3,14,200,12,4,8,2,7,8,3,5,5,1,1,1,11,2,4,11,4,9,3,11,3,88,4,6,3,11,2,26,1,8,3,11,3,204,8,2,2,2,12,1,13,4,2,8,3,2,13,11,2,1,212,3,9,3,3,12,3,12,5,5,6,3,15,1,11,1,148,3,9,2,2,12,1,13,4,
+2,9,4,13,11,1,253,34,10,14,9,6,3,9,12,17,18,9,24,2,6,31,4,8,10,28,5,2,2,4,1,7,1,4,2,6,23,2,38,5,45,1,213,23,11,34,7,16,8,2,19,8,83,15,19,1,5,4,15,9,7,16,2,4,6,3,8,2,3,1,9,254,71,20,1,35,5,10,17,1,10,13,3,6,14,15,6,19,8,26,5,2,94,11,16,8,2,1,1,2,2,6,3,
+3,10,15,4,21,3,27,12,9,18,3,6,11,1,1,5,10,254,72,2,9,14,19,9,1,1,3,7,3,5,5,2,7,1,2,4,15,9,20,207,2,13,1,16,11,3,6,16,4,15,254,121,23,16,2,9,3,19,2,93,3,8,6,14,8,9,8,2,20,253,207,1,16,4,1,10,11,1,1,3,3,2,21,33,14,3,34,4,14,15,188,15,2,13,2,2,2,9,6,3,2,
+12,5,5,2,14,15,1,107,1,15,2,14,2,1,16,5,13,4,5,18,17,125,9,2,8,7,8,2,71,25,16,2,39,4,9,27,5,30,10,194,5,11,9,10,25,8,1,3,28,8,10,1,1,17,5,115,23,16,4,38,8,6,22,9,2,30,11,203,24,15,4,39,4,9,28,4,30,10,95,17,10,1,8,19,1,24,16,2,11,2,1,19,6,10,7,3,7,8,3,
+13,6,16,10,7,12,13,4,2,2,2,9,252,86,24,1,11,3,13,1,13,7,31,27,22,5,5,9,23,16,11,3,8,22,18,21,27,5,4,1,241,12,3,1,12,5,22,17,8,28,10,6,22,7,2,4,14,1,11,4,20,5,1,1,1,10,19,2,23,7,1,1,67,8,6,9,11,11,1,11,7,2,12,6,4,14,3,11,23,1,6,25,22,23,5,19,12,254,22,
+12,6,1,1,3,18,1,2,187,17,12,5,17,7,5,1,2,15,3,5,10,12,1,11,17,3,29,104,30,3,12,3,21,6,2,17,2,129,15,4,15,14,2,7,17,2,21,230,3,7,22,4,3,14,1,10,66,15,2,16,14,4,6,22,19,198,17,3,14,15,2,8,17,1,20,120,9,3,3,9,9,2,1,250,254,251,54,49,147,1,44,10,132,147,
+56,254,167,254,140,1,33,35,40,214,19,3,1,132,1,127,9,131,167,94,254,37,9,140,177,66,103,158,131,1,173,9,61,126,108,79,9,80,107,132,254,230,6,174,249,82,40,6,104,252,97,1,18,70,56,2,71,67,3,6,1,9,4,55,76,2,58,71,12,1,2,10,18,12,18,44,14,117,4,58,28,31,
+16,4,32,28,61,4,18,11,25,19,28,22,22,9,37,21,3,43,9,50,38,2,4,5,35,34,15,5,2,37,3,34,1,11,8,41,7,4,24,86,8,21,3,27,8,10,3,27,26,2,50,11,49,35,12,2,6,11,10,8,18,3,3,1,49,4,33,9,66,14,1,2,69,18,2,1,4,15,43,6,32,9,8,3,36,17,1,4,34,50,15,1,2,89,7,7,62,18,
+13,57,10,57,14,9,2,17,3,41,96,7,66,14,12,62,6,80,2,19,3,43,2,5,12,1,2,6,7,11,5,1,11,23,25,9,2,23,1,3,8,15,4,12,15,22,3,30,18,1,7,6,1,10,1,5,1,9,27,26,8,23,1,11,15,4,12,12,3,11,11,3,30,1,2,18,8,9,35,13,54,3,78,10,46,10,19,5,5,15,6,9,8,1,42,5,16,24,47,
+17,10,18,4,18,6,20,16,11,5,18,12,3,22,45,40,13,1,9,36,21,14,16,8,11,8,3,18,8,30,5,1,5,1,25,10,1,10,2,14,4,19,29,12,2,14,18,12,9,13,3,44,40,14,62,18,7,28,3,26,32,7,13,18,2,2,19,3,19,3,21,32,3,3,3,17,7,3,112,34,3,1,21,19,2,2,10,29,3,15,3,57,12,54,11,2,
+17,2,21,31,29,37,1,1,15,5,5,10,8,38,1,3,8,7,3,3,12,54,6,59,2,17,1,46,6,30,17,9,61,71,65,37,39,30,32,79,66,70,3,2,3,2,29,13,2,17,2,74,2,29,46,16,1,18,27,2,13,16,13,2,17,2,74,2,62,13,8,8,1,1,21,23,2,18,16,8,2,8,9,2,6,15,53,2,75,16,1,42,23,6,3,15,26,19,
+15,5,29,6,1,3,17,10,3,17,9,7,2,25,4,11,15,5,22,8,4,51,4,58,21,30,38,14,34,16,1,20,11,6,4,41,16,5,94,4,67,12,7,72,1,76,2,16,17,54,4,4,16,2,23,13,3,1,11,6,16,2,7,1,22,32,15,33,13,2,28,16,2,6,20,4,19,4,12,11,3,17,8,32,8,3,25,4,8,7,2,13,2,3,74,12,54,5,6,
+3,24,21,12,9,10,7,4,4,22,15,14,75,10,48,23,25,8,3,31,31,22,6,56,8,18,8,3,92,4,38,54,34,35,10,13,8,8,42,12,16,48,10,16,1,8,51,5,23,13,14,3,20,4,1,63,28,2,1,61,27,2,24,9,46,5,28,17,5,3,14,10,1,1,23,67,2,1,75,15,24,34,18,14,1,11,5,5,12,14,41,38,11,6,9,40,
+20,2,41,14,51,18,2,3,2,5,44,11,3,52,12,1,8,6,34,132,39,35,13,11,43,22,2,27,12,11,54,20,2,35,8,11,8,43,19,2,41,14,51,18,2,58,58,118,5,98,22,60,10,15,76,58,35,4,1,104,6,8,23,43,1,5,16,1,2,7,7,1,10,4,6,12,26,5,28,10,3,25,5,11,18,20,15,3,12,8,4,8,34,1,4,
+23,11,6,33,11,18,54,10,1,89,14,10,44,16,4,20,4,5,9,15,7,8,4,8,2,33,4,8,20,13,30,50,8,12,9,33,1,9,12,6,13,15,5,23,21,22,2,16,20,2,18,46,34,30,12,2,1,3,5,67,42,8,68,41,5,1,20,67,19,36,10,28,2,4,42,17,10,10,10,6,12,12,13,29,93,32,34,6,26,3,36,12,1,35,18,
+22,3,29,4,5,9,31,8,3,64,1,42,34,53,5,17,3,26,8,10,34,53,25,30,6,4,7,31,67,14,5,13,15,17,5,184,242,38,10,1,14,149,68,25,84,94,19,19,37,19,94,18,185,113,12,81,242,72,12,65,103,83,120,159,254,205,56,10,37,37,10,0,2,0,100,0,0,1,124,6,26,0,13,0,29,0,0,1,3,
+35,3,17,52,55,54,59,1,50,23,22,21,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,106,35,175,35,36,36,49,3,49,36,36,122,58,41,41,41,41,58,57,41,42,42,41,3,80,254,58,1,198,2,81,50,36,35,35,36,50,250,95,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,0,50,3,
+218,2,99,6,27,0,13,0,27,0,0,1,3,35,3,53,52,55,54,59,1,50,23,22,21,5,3,35,3,53,52,55,54,59,1,50,23,22,21,1,39,36,173,36,36,36,49,3,49,36,36,1,60,36,173,36,36,36,49,3,49,36,36,5,38,254,180,1,76,124,50,36,35,35,36,50,124,254,180,1,76,124,50,36,35,35,36,
+50,0,0,0,0,2,0,15,0,83,5,117,5,171,0,107,0,111,0,0,1,55,35,34,39,38,61,1,52,55,54,59,1,55,54,55,54,51,50,31,1,22,23,22,21,20,15,1,51,55,54,55,54,51,50,31,1,22,23,22,21,20,15,1,51,50,23,22,29,1,20,7,6,43,1,7,51,50,23,22,29,1,20,7,6,43,1,3,6,7,6,35,34,
+47,1,38,39,38,53,52,63,1,35,3,6,7,6,35,34,47,1,38,39,38,53,52,63,1,35,34,39,38,61,1,52,55,54,51,37,7,51,55,1,77,47,175,45,33,32,32,33,45,220,50,9,39,28,33,12,13,2,40,27,18,2,40,226,50,9,39,28,32,12,12,3,42,26,18,2,40,178,46,31,33,33,31,46,223,47,190,
+47,31,33,33,31,47,235,54,8,39,28,32,12,12,3,42,26,19,3,43,226,54,8,39,28,34,12,13,2,40,26,19,3,43,162,46,33,32,32,33,46,1,227,47,226,47,2,148,233,33,33,45,2,45,33,33,246,45,25,18,2,1,8,37,29,32,12,12,201,246,45,25,18,2,1,8,37,29,32,12,12,201,33,33,45,
+2,45,33,33,233,33,33,45,3,44,33,33,254,247,45,25,18,2,1,8,38,28,32,12,12,220,254,247,45,25,18,2,1,8,38,28,32,12,12,220,33,33,44,3,45,33,33,233,233,233,0,0,4,0,60,255,104,3,213,6,180,0,6,0,13,0,48,0,83,0,0,1,54,55,54,53,52,39,1,6,7,6,21,20,23,19,54,51,
+50,29,1,22,23,22,23,22,21,20,7,6,43,1,34,39,38,39,17,22,23,22,21,20,7,6,7,21,20,35,34,47,1,6,35,34,61,1,38,39,38,39,38,53,52,55,54,59,1,50,23,22,23,17,38,39,38,53,52,55,54,55,53,52,51,50,23,2,137,16,35,36,87,254,253,15,35,35,85,169,11,15,64,98,91,91,
+34,5,23,34,56,21,83,25,29,48,142,77,113,102,99,131,64,15,11,77,12,16,64,98,90,91,33,5,23,34,56,21,83,25,28,47,142,76,112,101,98,131,64,16,12,1,9,7,53,54,65,136,35,2,171,7,53,53,65,135,35,2,250,4,82,71,23,86,87,120,17,15,35,31,45,79,95,21,254,85,37,73,
+107,211,162,126,124,31,71,82,4,1,5,82,72,24,85,87,119,17,17,34,30,45,79,93,22,1,172,36,73,107,210,161,127,123,32,71,82,5,0,0,5,0,100,0,0,5,131,6,26,0,3,0,21,0,39,0,57,0,75,0,0,9,1,35,1,19,34,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,39,50,23,22,29,
+1,20,7,6,35,34,39,38,61,1,52,55,54,1,34,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,39,50,23,22,29,1,20,7,6,35,34,39,38,61,1,52,55,54,4,137,253,170,213,2,86,167,47,34,33,33,34,47,47,34,34,34,34,47,122,87,87,87,87,122,121,88,87,87,88,253,170,48,33,34,
+34,34,47,47,34,33,33,34,47,122,87,87,87,87,122,122,87,87,87,87,6,26,249,230,6,26,251,154,34,33,48,20,48,33,34,34,34,47,20,47,34,34,186,87,87,122,30,122,87,87,87,87,122,30,122,87,87,2,242,33,34,47,21,47,34,34,34,33,48,21,47,34,33,186,87,87,121,31,122,
+87,87,87,87,122,31,121,87,87,0,0,0,2,0,100,0,0,5,36,6,26,0,15,0,78,0,0,1,33,34,7,6,21,20,23,22,59,1,50,55,54,53,51,1,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,6,43,1,34,39,38,53,52,55,38,53,52,55,54,59,1,50,23,7,38,43,
+1,34,7,6,21,20,23,22,51,33,53,55,17,3,99,254,208,90,64,64,64,64,90,85,90,64,64,1,1,82,47,31,33,33,32,46,113,20,21,29,43,46,33,32,32,33,46,23,164,73,110,187,85,191,136,136,152,129,129,129,182,150,150,142,143,79,70,150,80,58,57,57,57,81,1,48,225,2,170,
+64,64,91,91,64,63,63,64,121,1,164,33,33,45,3,45,33,32,254,117,29,20,20,33,33,45,3,45,33,33,106,106,136,136,191,229,116,108,206,182,129,129,109,201,66,58,57,91,92,57,56,235,89,254,194,0,1,0,100,3,218,1,89,6,27,0,13,0,0,1,3,35,3,53,52,55,54,59,1,50,23,
+22,21,1,89,36,173,36,36,36,49,3,49,36,36,5,38,254,180,1,76,124,50,36,35,35,36,50,0,0,0,0,1,0,100,254,101,2,161,6,26,0,39,0,0,0,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,1,84,118,122,122,
+118,183,16,15,40,33,46,27,26,43,103,68,70,70,68,103,43,26,27,46,34,40,15,15,254,145,147,149,192,3,140,192,149,147,41,4,28,35,60,8,44,33,33,9,23,80,83,103,252,128,103,83,80,23,9,33,33,44,9,58,37,26,3,0,0,0,1,0,34,254,100,2,95,6,26,0,39,0,0,19,6,35,34,
+39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,38,39,38,39,38,61,1,52,55,54,51,50,23,22,23,22,21,17,20,7,6,183,16,15,39,33,46,27,26,43,103,68,70,70,68,103,43,26,27,46,33,40,14,16,183,119,122,122,119,254,104,4,27,37,58,9,44,33,33,9,23,80,83,103,3,128,103,
+83,80,23,9,33,33,44,8,60,35,28,4,41,147,149,192,252,116,192,149,147,0,0,0,0,1,0,106,2,145,3,102,5,114,0,70,0,0,1,50,23,22,29,1,55,54,51,50,23,22,31,1,22,21,20,7,6,15,1,23,22,21,20,7,6,15,1,6,35,34,39,38,47,1,7,6,7,6,35,34,47,1,38,39,38,53,52,63,1,39,
+38,39,38,53,52,63,1,54,55,54,51,50,31,1,53,52,55,54,51,1,233,47,32,32,124,18,19,24,24,41,13,1,6,12,20,44,124,77,20,1,7,35,2,32,36,8,8,47,26,77,76,27,45,8,7,38,36,1,32,7,1,21,76,124,43,21,13,6,1,13,42,25,25,17,17,124,33,33,45,5,114,33,33,45,130,39,6,11,
+22,42,2,18,18,25,24,41,15,41,105,29,34,9,9,47,25,2,22,1,7,38,105,105,38,7,1,25,2,22,47,9,9,35,29,104,41,15,40,25,26,17,18,2,42,22,12,5,41,130,45,33,33,0,0,1,0,50,1,0,4,78,5,28,0,43,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,33,
+34,39,38,61,1,52,55,54,51,33,17,52,55,54,59,1,50,23,22,21,2,187,1,25,50,36,36,36,36,50,254,231,36,36,50,2,51,34,36,254,229,51,34,36,36,34,51,1,27,36,34,51,2,50,36,36,3,136,36,36,50,2,51,34,36,254,231,50,36,36,36,36,50,1,25,36,34,51,2,50,36,36,1,27,51,
+34,36,36,34,51,0,1,0,23,255,72,1,100,0,241,0,19,0,0,37,50,23,22,21,20,7,3,6,43,1,34,39,38,53,52,55,19,54,51,1,32,36,21,11,7,129,18,44,66,34,21,14,3,78,12,53,241,32,17,18,15,15,254,225,41,27,19,21,9,10,1,31,52,0,1,0,50,2,147,3,54,3,136,0,19,0,0,1,20,7,
+6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,54,36,36,50,253,239,51,34,36,36,34,51,2,17,50,36,36,3,12,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,65,0,100,254,230,5,155,5,148,0,3,0,7,0,18,0,30,0,64,0,82,0,106,0,122,0,135,0,157,0,172,0,196,0,216,0,
+251,1,30,1,78,1,99,1,131,1,154,1,167,1,175,1,184,1,193,1,227,2,5,2,14,2,25,2,46,2,69,2,91,2,137,2,152,2,172,2,200,2,234,3,7,3,19,3,26,3,36,3,62,3,87,3,110,3,120,3,136,3,156,3,172,3,188,3,223,4,7,4,57,4,87,4,97,4,127,4,140,4,153,4,163,4,175,4,188,4,197,
+4,204,4,211,4,221,4,230,4,243,4,255,0,0,19,17,33,17,37,33,17,33,1,51,23,21,22,21,7,35,38,61,1,37,51,23,6,21,20,23,7,35,38,39,54,37,51,20,23,6,29,1,20,23,51,50,55,51,22,51,6,21,20,51,22,21,35,34,39,35,6,43,1,34,39,38,61,1,52,37,51,50,23,22,29,1,20,7,6,
+43,1,34,39,53,52,55,54,5,51,22,21,20,7,6,7,21,35,34,39,53,35,39,52,55,51,49,52,35,38,53,54,5,21,20,23,50,55,54,61,1,52,39,34,53,34,7,6,37,22,21,50,21,54,55,54,53,52,39,35,6,23,50,23,34,7,38,35,6,7,22,21,6,35,38,53,54,51,21,20,23,51,54,23,50,23,22,29,
+1,20,7,6,35,38,53,52,55,54,55,50,23,50,21,6,35,38,39,6,7,34,7,35,34,39,38,53,54,51,22,21,51,54,33,50,23,6,35,38,39,6,7,6,43,1,34,39,54,51,22,21,51,54,5,22,29,1,20,7,35,38,35,34,7,20,23,22,21,20,15,1,35,34,39,53,54,55,51,22,51,54,53,38,35,34,61,1,52,33,
+50,23,21,6,35,52,39,34,7,21,20,23,22,21,20,7,35,34,39,53,54,59,1,22,51,54,53,52,39,34,39,38,53,52,5,49,22,51,6,29,1,22,59,1,54,53,49,51,21,22,21,20,7,34,43,1,34,39,38,53,49,52,59,1,22,51,7,20,23,51,50,53,52,39,35,6,43,1,34,39,53,52,37,22,29,1,20,7,35,
+20,23,50,55,51,22,21,6,43,1,34,39,52,55,37,51,22,21,6,21,48,23,6,43,1,39,6,43,1,38,61,1,52,55,22,23,53,38,35,34,7,35,38,39,53,54,33,22,21,20,7,35,21,22,51,50,55,51,50,23,20,7,6,43,1,34,39,52,55,5,22,59,1,54,55,53,38,43,1,34,7,6,39,50,55,53,38,35,34,7,
+5,51,50,55,38,43,1,34,7,5,21,20,23,50,55,38,35,6,7,50,23,21,7,35,38,35,34,7,22,21,20,23,54,59,1,21,7,22,21,35,38,53,35,6,35,53,50,55,38,53,54,59,1,50,23,7,35,53,52,39,6,21,20,23,48,21,54,59,1,23,21,34,7,23,20,23,35,52,39,6,35,53,55,38,53,52,7,59,1,21,
+20,23,35,38,53,55,59,1,21,20,23,35,38,61,1,52,7,22,51,6,21,51,55,21,34,7,23,7,35,38,39,35,53,55,51,53,52,33,50,23,6,29,1,51,55,21,35,7,23,7,35,38,53,35,55,53,55,51,53,52,55,50,23,6,29,1,51,55,29,1,34,7,21,20,23,7,35,39,35,53,55,51,37,51,50,23,6,21,35,
+38,35,34,7,6,29,1,20,23,22,51,54,61,1,38,43,1,53,50,23,22,21,6,21,20,23,34,7,35,34,39,6,7,35,34,39,53,52,55,5,50,23,21,20,15,1,34,39,38,61,1,52,55,54,51,50,23,35,6,35,38,39,6,15,1,35,34,39,55,51,22,21,51,54,5,22,21,50,21,20,7,6,35,21,20,23,51,50,55,51,
+20,23,21,6,43,1,34,39,53,52,55,54,33,51,50,23,22,23,6,7,22,21,7,35,39,6,43,1,38,61,1,54,51,50,23,53,52,39,35,34,7,35,34,39,53,54,5,50,23,20,51,54,55,54,53,51,50,23,6,29,1,20,23,6,21,35,38,39,35,6,7,35,34,61,1,23,22,59,1,50,55,54,53,38,43,1,34,5,50,55,
+38,43,1,34,5,22,59,1,50,55,38,43,1,6,5,50,23,6,7,20,23,6,43,1,34,39,35,20,7,34,39,38,53,52,55,51,50,23,53,52,39,23,6,29,1,54,51,22,21,35,6,35,22,23,6,35,53,38,53,39,35,53,51,53,52,33,51,23,6,29,1,54,51,23,21,6,21,20,23,6,35,53,38,53,35,53,51,52,39,50,
+23,21,20,7,35,38,53,54,23,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,59,1,50,29,1,54,51,50,23,20,23,6,15,1,35,23,20,23,35,38,55,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,23,22,29,1,20,7,6,35,34,39,53,52,55,54,51,50,23,51,54,59,1,50,23,35,6,43,1,
+38,35,6,7,6,35,34,39,38,35,6,21,6,35,53,39,54,51,22,23,51,54,5,22,29,1,6,7,35,52,39,35,34,7,21,20,51,22,29,1,20,7,6,43,1,34,39,52,55,51,22,51,50,53,52,39,34,39,38,61,1,52,5,22,51,6,29,1,20,23,51,54,61,1,51,21,22,29,1,20,7,6,35,34,39,38,61,1,52,51,23,
+7,21,20,23,51,50,55,54,61,1,39,35,6,43,1,34,39,38,61,1,52,5,51,50,23,22,21,6,35,49,38,43,1,6,15,1,20,23,51,50,55,51,22,21,6,35,34,39,52,55,54,5,51,23,20,7,22,23,35,39,38,39,22,29,1,20,59,1,54,55,54,55,51,22,21,6,29,1,20,23,20,7,49,38,53,35,6,43,1,34,
+53,23,20,23,51,50,55,53,52,47,1,35,34,7,23,20,23,51,50,55,54,61,1,38,43,1,34,23,20,31,1,50,55,38,43,1,34,23,21,20,23,51,50,55,54,53,38,35,34,23,20,59,1,50,55,54,61,1,38,43,1,34,7,50,23,21,6,35,34,39,54,3,21,33,34,7,53,18,33,51,50,23,22,21,33,5,33,21,
+38,43,1,34,61,1,54,41,1,23,21,20,7,35,38,53,37,51,20,23,51,50,29,1,20,43,1,38,53,1,51,22,51,21,6,43,1,34,39,53,50,100,5,55,250,236,4,240,251,16,2,78,3,11,2,7,6,3,1,243,1,14,1,3,11,4,2,1,1,254,78,4,7,4,15,1,21,14,2,12,1,6,12,2,8,13,7,1,11,16,5,20,7,1,
+1,56,6,12,16,12,40,7,7,7,30,5,40,8,252,181,9,28,33,12,15,1,5,9,5,5,5,5,6,6,18,3,74,25,22,15,5,26,3,17,18,3,252,189,1,1,29,8,8,15,6,26,180,19,9,1,14,6,7,17,3,1,10,5,13,12,3,3,1,10,151,20,13,2,35,5,4,27,25,2,86,19,17,1,8,4,15,8,9,9,1,4,7,7,2,2,7,7,3,1,
+7,2,73,16,19,9,4,15,9,6,13,3,1,6,7,3,6,9,1,1,7,253,72,18,10,1,4,9,13,3,29,20,20,8,5,24,10,1,8,1,12,16,14,4,17,28,1,221,13,7,11,3,11,12,5,29,19,24,8,23,12,8,2,1,12,15,14,16,25,5,2,1,118,13,1,1,2,11,1,18,15,7,30,2,3,5,18,5,1,3,1,9,3,1,9,2,23,1,1,8,18,1,
+19,6,252,108,23,39,10,17,11,10,4,8,17,13,7,26,4,32,1,105,11,27,1,2,9,4,1,2,12,11,7,22,32,11,9,4,13,9,9,3,2,6,12,1,57,24,42,7,7,9,10,13,1,1,8,21,4,5,7,24,5,30,254,57,2,10,3,24,2,6,14,2,13,5,1,211,19,14,7,2,16,8,2,141,3,17,14,6,3,3,16,6,254,221,10,17,8,
+8,11,16,49,13,2,6,2,3,5,6,2,1,2,5,4,3,11,5,11,4,1,5,5,6,4,3,3,14,200,12,4,8,2,7,8,3,5,5,1,1,1,11,2,4,11,4,9,3,11,3,88,4,6,3,11,2,26,1,8,3,11,3,204,8,2,2,2,12,1,13,4,2,8,3,2,13,11,2,1,212,3,9,3,3,12,3,12,5,5,6,3,15,1,11,1,148,3,9,2,2,12,1,13,4,2,9,4,13,
+11,1,253,34,10,14,9,6,3,9,12,17,18,9,24,2,6,31,4,8,10,28,5,2,2,4,1,7,1,4,2,6,23,2,38,5,45,1,213,23,11,34,7,16,8,2,19,8,83,15,19,1,5,4,15,9,7,16,2,4,6,3,8,2,3,1,9,254,71,20,1,35,5,10,17,1,10,13,3,6,14,15,6,19,8,26,5,2,94,11,16,8,2,1,1,2,2,6,3,3,10,15,
+4,21,3,27,12,9,18,3,6,11,1,1,5,10,254,72,2,9,14,19,9,1,1,3,7,3,5,5,2,7,1,2,4,15,9,20,207,2,13,1,16,11,3,6,16,4,15,254,121,23,16,2,9,3,19,2,93,3,8,6,14,8,9,8,2,20,253,207,1,16,4,1,10,11,1,1,3,3,2,21,33,14,3,34,4,14,15,188,15,2,13,2,2,2,9,6,3,2,12,5,5,
+2,14,15,1,107,1,15,2,14,2,1,16,5,13,4,5,18,17,125,9,2,8,7,8,2,71,25,16,2,39,4,9,27,5,30,10,194,5,11,9,10,25,8,1,3,28,8,10,1,1,17,5,115,23,16,4,38,8,6,22,9,2,30,11,203,24,15,4,39,4,9,28,4,30,10,95,17,10,1,8,19,1,24,16,2,11,2,1,19,6,10,7,3,7,8,3,13,6,16,
+10,7,12,13,4,2,2,2,9,252,86,24,1,11,3,13,1,13,7,31,27,22,5,5,9,23,16,11,3,8,22,18,21,27,5,4,1,241,12,3,1,12,5,22,17,8,28,10,6,22,7,2,4,14,1,11,4,20,5,1,1,1,10,19,2,23,7,1,1,67,8,6,9,11,11,1,11,7,2,12,6,4,14,3,11,23,1,6,25,22,23,5,19,12,254,22,12,6,1,
+1,3,18,1,2,187,17,12,5,17,7,5,1,2,15,3,5,10,12,1,11,17,3,29,104,30,3,12,3,21,6,2,17,2,129,15,4,15,14,2,7,17,2,21,230,3,7,22,4,3,14,1,10,66,15,2,16,14,4,6,22,19,198,17,3,14,15,2,8,17,1,20,120,9,3,3,9,9,2,1,250,254,251,54,49,147,1,44,10,132,147,56,254,
+167,254,140,1,33,35,40,214,19,3,1,132,1,127,9,131,167,94,254,37,9,140,177,66,103,158,131,1,173,9,61,126,108,79,9,80,107,132,254,230,6,174,249,82,40,6,104,252,97,1,18,70,56,2,71,67,3,6,1,9,4,55,76,2,58,71,12,1,2,10,18,12,18,44,14,117,4,58,28,31,16,4,32,
+28,61,4,18,11,25,19,28,22,22,9,37,21,3,43,9,50,38,2,4,5,35,34,15,5,2,37,3,34,1,11,8,41,7,4,24,86,8,21,3,27,8,10,3,27,26,2,50,11,49,35,12,2,6,11,10,8,18,3,3,1,49,4,33,9,66,14,1,2,69,18,2,1,4,15,43,6,32,9,8,3,36,17,1,4,34,50,15,1,2,89,7,7,62,18,13,57,10,
+57,14,9,2,17,3,41,96,7,66,14,12,62,6,80,2,19,3,43,2,5,12,1,2,6,7,11,5,1,11,23,25,9,2,23,1,3,8,15,4,12,15,22,3,30,18,1,7,6,1,10,1,5,1,9,27,26,8,23,1,11,15,4,12,12,3,11,11,3,30,1,2,18,8,9,35,13,54,3,78,10,46,10,19,5,5,15,6,9,8,1,42,5,16,24,47,17,10,18,
+4,18,6,20,16,11,5,18,12,3,22,45,40,13,1,9,36,21,14,16,8,11,8,3,18,8,30,5,1,5,1,25,10,1,10,2,14,4,19,29,12,2,14,18,12,9,13,3,44,40,14,62,18,7,28,3,26,32,7,13,18,2,2,19,3,19,3,21,32,3,3,3,17,7,3,112,34,3,1,21,19,2,2,10,29,3,15,3,57,12,54,11,2,17,2,21,31,
+29,37,1,1,15,5,5,10,8,38,1,3,8,7,3,3,12,54,6,59,2,17,1,46,6,30,17,9,61,71,65,37,39,30,32,79,66,70,3,2,3,2,29,13,2,17,2,74,2,29,46,16,1,18,27,2,13,16,13,2,17,2,74,2,62,13,8,8,1,1,21,23,2,18,16,8,2,8,9,2,6,15,53,2,75,16,1,42,23,6,3,15,26,19,15,5,29,6,1,
+3,17,10,3,17,9,7,2,25,4,11,15,5,22,8,4,51,4,58,21,30,38,14,34,16,1,20,11,6,4,41,16,5,94,4,67,12,7,72,1,76,2,16,17,54,4,4,16,2,23,13,3,1,11,6,16,2,7,1,22,32,15,33,13,2,28,16,2,6,20,4,19,4,12,11,3,17,8,32,8,3,25,4,8,7,2,13,2,3,74,12,54,5,6,3,24,21,12,9,
+10,7,4,4,22,15,14,75,10,48,23,25,8,3,31,31,22,6,56,8,18,8,3,92,4,38,54,34,35,10,13,8,8,42,12,16,48,10,16,1,8,51,5,23,13,14,3,20,4,1,63,28,2,1,61,27,2,24,9,46,5,28,17,5,3,14,10,1,1,23,67,2,1,75,15,24,34,18,14,1,11,5,5,12,14,41,38,11,6,9,40,20,2,41,14,
+51,18,2,3,2,5,44,11,3,52,12,1,8,6,34,132,39,35,13,11,43,22,2,27,12,11,54,20,2,35,8,11,8,43,19,2,41,14,51,18,2,58,58,118,5,98,22,60,10,15,76,58,35,4,1,104,6,8,23,43,1,5,16,1,2,7,7,1,10,4,6,12,26,5,28,10,3,25,5,11,18,20,15,3,12,8,4,8,34,1,4,23,11,6,33,
+11,18,54,10,1,89,14,10,44,16,4,20,4,5,9,15,7,8,4,8,2,33,4,8,20,13,30,50,8,12,9,33,1,9,12,6,13,15,5,23,21,22,2,16,20,2,18,46,34,30,12,2,1,3,5,67,42,8,68,41,5,1,20,67,19,36,10,28,2,4,42,17,10,10,10,6,12,12,13,29,93,32,34,6,26,3,36,12,1,35,18,22,3,29,4,
+5,9,31,8,3,64,1,42,34,53,5,17,3,26,8,10,34,53,25,30,6,4,7,31,67,14,5,13,15,17,5,184,242,38,10,1,14,149,68,25,84,94,19,19,37,19,94,18,185,113,12,81,242,72,12,65,103,83,120,159,254,205,56,10,37,37,10,0,1,0,0,0,0,2,183,6,26,0,3,0,0,9,1,35,1,2,183,254,51,
+234,1,207,6,26,249,230,6,26,0,0,2,0,100,0,0,4,151,6,27,0,17,0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,3,91,158,158,158,158,222,221,158,158,158,158,221,121,86,85,85,86,121,121,86,86,
+86,86,121,6,27,158,158,221,254,24,222,158,158,158,158,222,1,232,221,158,158,250,86,86,121,254,36,121,86,86,86,86,121,1,220,121,86,86,0,1,0,10,0,0,2,27,6,26,0,25,0,0,37,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,27,35,36,
+50,2,50,36,35,164,49,36,36,36,36,49,1,31,50,36,35,121,50,35,36,36,35,50,4,173,35,36,50,2,50,36,35,35,36,50,0,1,0,100,0,0,4,100,6,26,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,
+35,33,34,39,38,61,1,52,55,54,51,2,161,183,129,129,128,75,192,189,68,110,2,139,51,34,36,36,34,51,252,242,49,36,36,127,87,184,223,39,109,57,58,81,254,110,50,36,36,36,36,50,6,26,129,129,182,160,130,78,118,119,65,109,98,36,36,50,2,51,34,36,36,34,51,94,184,
+149,102,117,144,31,91,89,81,57,58,35,36,50,2,50,36,35,0,1,0,70,0,0,3,167,6,26,0,60,0,0,1,50,23,22,21,20,7,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,35,33,34,39,38,61,1,
+52,55,54,51,1,215,182,130,129,129,152,136,136,192,254,232,49,36,36,36,36,49,1,24,91,64,63,63,64,91,236,50,36,35,35,36,50,236,81,57,57,57,58,80,254,232,49,36,36,36,36,49,6,26,129,129,182,206,108,116,229,191,136,136,36,34,51,2,50,36,36,63,64,91,91,64,64,
+36,35,50,2,50,36,35,1,56,57,82,81,57,58,35,36,50,2,50,36,35,0,0,0,0,2,0,70,0,0,4,206,6,26,0,38,0,41,0,0,1,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,5,17,1,2,105,34,72,150,49,36,36,115,50,36,
+35,35,36,50,115,36,36,49,3,49,36,36,253,210,49,36,36,15,2,152,254,125,5,220,62,35,36,50,252,118,36,36,50,2,50,35,36,169,51,34,36,36,34,51,169,36,34,51,70,32,26,4,2,187,253,69,0,0,0,0,1,0,120,0,0,4,80,6,26,0,49,0,0,19,34,39,38,53,17,52,55,54,51,33,50,
+23,22,29,1,20,7,6,35,33,17,33,50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,241,49,36,36,36,36,49,2,98,49,36,36,36,36,49,254,26,1,19,192,136,136,136,136,192,254,113,49,36,36,36,36,49,1,143,91,64,63,63,64,91,2,170,36,34,
+51,2,126,50,36,35,35,36,50,2,50,36,35,254,120,135,136,192,191,136,136,36,34,51,2,50,36,36,63,64,91,91,64,64,0,0,2,0,100,0,0,4,134,6,26,0,14,0,49,0,0,1,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,
+34,7,6,29,1,33,50,23,22,21,20,7,6,35,1,89,64,64,90,131,91,64,63,63,64,91,131,191,136,136,136,136,191,1,49,50,36,36,36,36,50,254,207,90,64,64,1,93,192,136,136,136,136,192,2,170,219,91,64,63,63,64,91,91,64,64,253,86,136,136,191,2,124,192,135,136,35,36,
+50,2,50,36,35,64,64,91,173,135,136,192,191,136,136,0,0,0,0,1,0,10,0,0,3,162,6,26,0,25,0,0,37,20,7,6,43,1,34,39,38,53,1,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,18,35,36,50,2,51,34,36,1,104,253,253,49,36,36,36,36,49,2,166,50,36,35,117,46,35,36,36,
+34,55,4,169,35,36,50,2,50,36,35,35,36,54,0,0,3,0,100,0,0,4,152,6,26,0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,
+20,23,22,51,2,201,182,129,130,129,151,136,135,192,150,191,136,136,152,129,129,129,182,150,91,63,64,64,64,90,150,90,64,64,64,64,90,150,81,57,57,57,58,80,150,80,58,57,57,57,81,6,26,129,129,182,206,108,116,229,191,136,136,136,136,191,229,116,108,206,182,
+129,129,250,219,63,64,91,91,64,64,64,64,91,91,64,63,2,170,56,57,82,81,57,58,58,57,81,82,57,56,0,0,0,0,2,0,100,0,0,4,134,6,26,0,14,0,49,0,0,1,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,
+55,33,34,39,38,53,52,55,54,51,3,145,64,64,91,131,90,64,64,64,64,90,131,192,136,136,136,136,192,254,120,50,36,35,35,36,50,1,136,91,64,63,1,254,162,191,136,136,136,136,191,3,112,219,91,64,64,64,64,91,91,64,64,2,170,136,135,192,253,132,191,136,136,36,35,
+50,2,50,36,36,63,64,91,173,136,136,191,192,135,136,0,0,0,2,0,100,0,0,1,124,4,128,0,15,0,31,0,0,51,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,57,58,41,41,41,41,58,57,41,
+42,42,41,41,41,58,57,41,41,41,40,58,59,40,41,3,105,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,0,23,255,72,1,124,4,128,0,19,0,35,0,0,37,50,23,22,21,20,7,3,6,43,1,34,39,38,53,52,55,19,54,51,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,32,36,21,11,7,
+129,18,44,66,34,21,14,3,78,12,53,71,58,41,41,41,41,58,57,41,42,42,41,241,32,17,18,15,15,254,225,41,27,19,21,9,10,1,31,52,2,120,41,41,58,57,41,41,41,40,58,59,40,41,0,1,0,50,0,236,4,116,5,25,0,26,0,0,19,38,61,1,52,55,1,54,51,50,23,22,29,1,20,7,9,1,22,29,
+1,20,7,6,35,34,39,103,53,53,3,154,17,16,24,21,37,53,252,250,3,6,53,37,21,24,16,17,2,90,20,58,181,57,22,1,102,7,15,25,45,67,56,22,254,208,254,207,20,58,67,45,25,15,7,0,0,0,0,2,0,50,1,178,4,78,4,90,0,19,0,39,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,
+33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,4,78,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,2,43,51,34,36,36,34,51,2,50,36,36,36,36,50,1,177,51,34,36,36,34,51,2,50,36,
+36,36,36,50,0,1,0,50,0,236,4,116,5,25,0,26,0,0,55,6,35,34,39,38,61,1,52,55,9,1,38,61,1,52,55,54,51,50,23,1,22,29,1,20,7,165,17,16,24,21,37,53,3,7,252,249,53,37,21,24,16,17,3,154,53,53,243,7,15,25,45,67,58,20,1,49,1,48,22,56,67,45,25,15,7,254,154,22,57,
+181,58,20,0,2,0,82,255,255,3,252,6,10,0,50,0,66,0,0,0,23,22,21,20,7,6,7,21,20,7,6,43,1,34,39,38,61,1,52,55,54,55,51,50,55,54,53,52,39,38,35,34,7,6,7,6,7,6,43,1,34,39,38,53,52,55,54,55,54,51,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,2,229,140,139,106,
+103,149,35,35,49,3,49,35,35,35,34,49,5,98,68,69,69,68,98,79,62,61,23,11,32,31,40,3,60,36,24,6,45,125,127,159,3,58,41,41,41,41,58,57,41,42,42,41,6,10,139,140,197,169,130,129,34,130,47,36,35,35,36,49,235,49,35,35,1,68,69,98,98,69,68,47,46,73,38,23,23,48,
+32,37,18,19,148,94,95,249,245,41,41,58,57,41,41,41,40,58,59,40,41,0,0,1,0,100,254,104,8,57,6,48,0,86,0,0,0,43,1,32,1,0,17,16,1,0,33,32,1,0,17,20,7,6,7,35,34,39,38,61,1,55,52,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,23,6,7,6,35,34,39,38,39,38,
+53,16,55,54,51,50,23,22,17,7,21,20,23,54,55,54,53,16,39,38,33,32,7,6,17,16,23,22,33,51,50,55,23,5,58,235,2,254,96,254,220,254,219,1,37,1,37,1,161,1,160,1,37,1,37,131,130,165,17,100,67,91,2,99,60,90,36,34,53,54,206,170,69,79,9,10,86,103,98,134,130,21,
+21,137,128,140,78,80,174,160,227,226,160,175,1,18,48,64,80,225,221,254,201,254,200,224,222,225,222,1,53,2,180,199,95,254,104,1,38,1,33,1,157,1,156,1,33,1,39,254,217,254,223,254,100,251,190,189,8,65,86,236,20,223,154,87,53,16,7,17,63,237,196,87,36,2,6,
+69,221,78,10,1,64,72,128,130,158,1,1,152,142,141,153,254,255,225,24,133,15,3,106,132,164,1,61,225,221,224,222,254,195,254,194,225,220,103,217,0,0,0,0,2,0,110,0,0,4,121,6,26,0,30,0,41,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,
+52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,4,121,36,36,49,3,49,36,36,253,223,36,36,49,3,49,36,36,152,152,213,214,152,152,245,79,80,114,113,80,79,121,51,34,36,36,34,51,1,190,254,66,51,34,36,36,34,51,3,156,214,152,151,151,152,214,234,234,113,
+80,80,80,80,113,234,0,0,3,0,110,0,0,4,70,6,26,0,14,0,37,0,52,0,0,1,37,50,55,54,53,52,39,38,43,1,34,7,6,21,35,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,5,50,55,54,53,52,39,38,35,33,17,20,23,22,51,1,99,1,19,82,57,57,57,58,81,238,16,11,
+10,245,83,83,116,238,183,129,129,129,152,136,136,192,238,116,83,83,2,8,91,64,63,63,64,91,254,237,10,11,16,3,158,1,56,57,82,81,57,58,11,11,16,117,83,82,129,129,182,206,108,116,229,191,136,136,83,83,116,37,63,64,91,91,64,64,254,112,16,11,10,0,0,1,0,75,
+0,0,4,118,6,26,0,41,0,0,0,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,3,187,95,92,48,32,38,16,17,67,68,222,157,157,157,157,222,68,67,17,16,38,32,48,92,95,99,254,189,229,229,229,229,
+1,67,6,26,24,24,93,3,59,37,25,4,17,157,157,223,223,157,156,16,4,25,36,60,2,94,24,24,229,229,1,67,1,67,229,229,0,0,0,0,2,0,110,0,0,5,44,6,26,0,18,0,37,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,21,19,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,
+55,54,51,1,99,10,11,16,151,223,157,157,157,157,223,151,16,11,10,188,1,67,229,229,229,229,254,189,151,116,83,83,83,83,116,1,26,16,11,10,156,157,223,223,157,157,11,11,16,1,26,229,229,254,189,254,189,229,229,83,83,116,3,230,117,83,82,0,0,0,1,0,110,0,0,3,
+185,6,26,0,51,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,99,1,221,49,36,36,36,36,49,254,35,35,35,50,1,101,49,36,36,36,36,49,254,155,151,107,107,
+107,107,151,1,101,49,36,36,36,36,49,254,155,50,35,35,3,135,35,36,50,2,50,36,35,254,218,50,35,35,36,36,50,2,51,34,36,107,107,151,3,64,151,107,107,36,34,51,2,50,36,36,35,35,50,0,0,0,0,1,0,110,0,0,3,135,6,26,0,41,0,0,1,33,50,23,22,29,1,20,7,6,35,33,17,20,
+7,6,43,1,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,99,1,161,49,36,36,36,36,49,254,95,36,36,49,3,49,36,36,107,107,151,1,51,49,36,36,36,36,49,254,205,50,35,35,3,135,35,36,50,2,51,34,36,253,230,51,34,36,36,34,51,4,52,151,107,107,
+35,36,50,2,50,36,35,35,35,51,0,0,1,0,80,0,0,6,107,6,26,0,56,0,0,0,23,22,21,20,7,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,7,6,33,32,39,38,17,16,55,54,33,4,180,232,33,1,7,42,2,33,
+37,7,7,45,32,159,236,222,157,157,157,157,222,199,150,149,26,254,13,50,36,35,35,36,50,2,123,50,36,35,1,229,230,254,189,254,189,229,229,229,229,1,67,6,26,252,36,46,7,6,55,29,2,24,1,4,35,173,157,157,223,223,157,156,129,128,157,36,35,50,2,50,36,35,35,36,
+50,1,254,189,229,229,229,229,1,67,1,67,229,229,0,0,0,1,0,110,0,0,4,130,6,26,0,43,0,0,19,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,234,49,36,36,2,42,36,36,49,3,49,36,36,36,
+36,49,3,49,36,36,253,214,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,253,230,2,26,50,36,35,35,36,50,250,216,51,34,36,36,34,51,2,26,253,230,51,34,36,36,34,51,5,40,50,36,35,0,1,0,140,0,0,1,129,6,26,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,
+55,54,51,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,250,216,51,34,36,36,34,51,5,40,50,36,35,0,0,1,0,10,0,0,2,169,6,26,0,29,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,1,181,35,36,50,2,50,36,35,107,
+107,151,185,49,36,36,36,36,49,185,51,35,35,5,161,50,36,35,35,36,50,251,204,151,107,107,36,34,51,2,50,36,36,35,35,50,0,0,0,1,0,110,0,0,4,54,6,26,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,16,7,22,23,22,21,17,20,7,6,43,1,34,
+39,38,53,17,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,234,49,36,36,104,137,96,97,1,36,35,50,3,49,36,36,196,89,74,76,35,36,50,2,50,36,35,1,97,97,137,147,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,254,24,96,97,136,159,50,36,35,35,36,50,159,
+254,223,146,54,129,133,154,255,0,50,35,36,36,35,50,1,0,136,97,96,253,183,51,34,36,36,34,51,5,40,50,36,35,0,0,0,1,0,120,0,0,3,130,6,26,0,29,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,109,35,35,50,1,35,50,
+36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,0,1,0,110,0,0,6,253,6,26,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,
+17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,99,36,36,49,3,49,36,36,141,141,199,238,121,120,238,199,141,141,35,36,50,2,51,34,36,69,69,99,98,69,69,36,34,51,2,50,36,36,69,69,98,98,69,69,121,51,34,36,36,34,51,3,192,199,
+141,141,158,158,141,141,199,252,64,50,35,36,36,34,51,3,192,99,69,69,69,69,99,252,64,51,34,36,36,34,51,3,192,99,69,69,69,69,99,0,0,0,0,1,0,110,0,0,4,121,6,26,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,
+55,54,51,50,23,22,21,4,121,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,152,152,213,214,152,152,121,51,34,36,36,34,51,3,156,113,80,80,80,80,113,252,100,51,34,36,36,34,51,3,156,214,152,151,151,152,214,0,0,2,0,80,0,0,6,107,6,26,0,15,0,31,
+0,0,0,23,22,17,16,7,6,33,32,39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,4,160,230,229,229,230,254,189,254,189,229,229,229,229,1,67,222,157,157,157,157,222,223,157,157,157,157,223,6,26,229,229,254,189,254,189,229,229,229,229,1,67,
+1,67,229,229,244,157,157,223,223,157,156,156,157,223,223,157,157,0,0,2,0,110,0,0,4,148,6,26,0,13,0,37,0,0,1,33,50,55,54,53,52,39,38,35,34,7,6,21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,1,99,1,30,119,84,83,83,84,119,119,84,83,
+36,36,49,3,49,36,36,156,156,219,220,155,156,156,155,220,2,233,84,83,119,119,84,84,84,84,119,253,237,254,133,51,34,36,36,34,51,3,142,220,156,155,155,156,220,219,156,156,0,0,2,0,80,254,243,6,107,6,26,0,26,0,53,0,0,0,23,22,17,16,7,6,5,21,20,7,6,43,1,34,
+39,38,61,1,36,39,38,17,16,55,54,33,19,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,4,160,230,229,199,195,254,247,36,36,50,2,50,35,36,254,247,196,198,229,229,1,67,1,50,36,36,157,128,129,157,157,223,222,157,157,129,128,157,
+36,34,51,6,26,229,229,254,189,254,215,222,220,33,157,50,36,35,35,36,50,157,33,220,222,1,41,1,67,229,229,252,53,36,36,49,213,26,149,151,198,223,157,157,157,157,223,199,149,150,26,213,49,36,36,0,2,0,110,0,0,4,106,6,26,0,16,0,58,0,0,1,50,55,54,53,52,39,
+38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,2,118,106,75,75,75,75,106,115,75,42,33,9,2,2,20,75,68,94,254,217,35,36,50,2,51,34,36,114,115,161,130,207,146,
+147,147,23,24,146,36,36,49,2,49,36,36,3,38,74,75,106,107,75,74,41,33,45,11,24,254,155,254,12,106,75,69,5,254,72,50,35,36,36,34,51,4,27,161,114,115,147,147,207,206,147,24,25,146,207,185,51,34,36,36,34,51,0,0,1,0,70,0,0,4,2,6,32,0,53,0,0,1,34,7,6,21,20,
+23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,39,38,53,52,55,54,51,33,50,23,22,29,1,20,7,6,35,2,18,86,60,60,93,41,200,171,79,118,134,133,187,254,131,49,36,36,36,36,49,1,135,85,61,60,93,44,198,171,78,118,133,
+133,188,1,13,50,36,35,35,36,50,5,40,60,60,86,102,53,23,58,51,72,107,194,188,133,133,36,36,49,6,49,36,36,60,60,86,100,56,26,62,56,71,106,183,188,133,133,36,35,50,6,49,36,36,0,1,0,40,0,0,3,246,6,26,0,31,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,
+34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,246,36,35,50,244,35,36,50,2,50,36,35,244,49,36,36,36,36,49,2,220,50,35,36,5,159,50,36,35,251,83,50,35,36,36,35,50,4,173,35,36,50,2,50,36,35,35,36,50,0,1,0,110,0,0,4,121,6,26,0,37,0,0,1,20,7,6,35,34,39,38,53,
+17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,4,121,152,152,214,213,152,152,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,2,5,214,151,152,152,151,214,3,156,50,36,35,35,36,50,252,100,113,80,79,79,80,
+113,3,156,50,36,35,35,36,50,0,1,0,20,0,0,4,173,6,26,0,25,0,0,9,1,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,2,97,1,88,28,86,7,63,36,24,8,254,102,46,125,124,47,254,103,8,23,37,62,7,87,28,1,97,4,103,82,50,33,36,20,22,250,252,117,
+117,5,4,22,21,36,32,50,82,0,1,0,110,0,0,6,253,6,26,0,60,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,99,69,69,98,
+98,69,69,36,36,50,2,50,35,36,69,69,98,99,69,69,36,35,50,2,50,36,35,141,141,199,238,120,121,238,199,141,141,36,36,49,3,49,36,36,1,225,98,69,69,69,69,98,3,192,50,36,35,35,36,50,252,64,98,69,69,69,69,98,3,192,50,36,35,35,36,50,252,64,199,141,141,158,158,
+141,141,199,3,192,50,36,35,35,36,50,0,0,0,1,0,100,0,0,4,111,6,26,0,67,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,16,55,38,17,53,52,55,54,59,1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,
+1,16,7,22,17,4,111,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,181,181,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,181,181,121,51,34,36,36,34,51,1,47,113,80,80,80,80,113,254,209,51,34,36,36,34,51,1,47,1,8,131,131,1,8,227,
+50,36,35,35,36,50,227,113,80,80,80,80,113,227,50,36,35,35,36,50,227,254,248,131,131,254,248,0,0,1,0,100,0,0,4,111,6,26,0,48,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,
+1,50,23,22,21,4,111,120,119,156,36,36,49,3,49,36,36,156,119,120,36,36,49,3,49,36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,3,229,188,144,141,31,254,140,51,34,36,36,34,51,1,116,31,141,144,188,1,188,50,36,35,35,36,50,254,68,114,80,79,79,80,114,1,188,50,
+36,35,35,36,50,0,0,0,1,0,40,0,0,4,29,6,26,0,35,0,0,19,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,39,38,53,52,55,1,33,34,39,38,53,84,35,36,50,2,107,88,61,62,35,253,81,2,107,51,34,36,36,34,51,253,71,83,56,56,27,2,185,253,209,50,
+36,35,5,161,50,36,35,1,63,63,87,65,54,252,40,36,36,50,2,51,34,36,8,62,61,84,55,50,3,230,35,36,50,0,0,0,1,0,100,254,101,2,99,6,26,0,7,0,0,19,33,21,33,17,33,21,33,100,1,255,254,246,1,10,254,1,6,26,191,249,202,192,0,0,0,0,1,0,0,0,0,2,183,6,26,0,3,0,0,19,
+1,35,1,233,1,206,233,254,50,6,26,249,230,6,26,0,0,0,1,0,100,254,101,2,99,6,26,0,7,0,0,1,33,53,33,17,33,53,33,2,99,254,1,1,10,254,246,1,255,254,101,192,6,54,191,0,0,0,1,0,247,3,50,4,97,6,26,0,26,0,0,1,54,59,1,50,23,1,22,21,20,7,6,43,1,34,39,11,1,6,43,
+1,34,39,38,53,52,55,2,13,21,61,154,60,22,1,14,8,17,25,47,72,60,22,194,195,21,60,72,48,25,16,7,5,227,55,55,253,201,18,17,25,23,39,55,1,169,254,87,55,39,23,26,16,18,0,1,255,246,255,10,3,249,255,255,0,3,0,0,7,53,33,21,10,4,3,246,245,245,0,1,0,11,4,222,1,
+224,6,97,0,19,0,0,19,38,53,52,55,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,29,18,9,19,42,155,36,18,175,15,8,19,42,76,27,25,5,240,18,22,16,18,39,28,250,20,21,15,16,37,23,0,0,0,0,2,0,100,0,0,4,228,4,128,0,23,0,39,0,0,0,23,22,21,17,20,7,6,43,1,34,39,38,53,
+6,35,34,39,38,53,52,55,54,51,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,3,146,169,169,36,36,49,3,49,36,36,114,217,238,169,169,169,169,238,138,97,96,96,97,138,138,96,97,97,97,137,4,128,169,169,238,254,57,51,34,36,36,34,51,121,169,169,238,238,169,169,
+245,97,97,137,138,97,96,96,97,138,137,97,97,0,2,0,100,0,0,4,228,6,26,0,15,0,40,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,1,50,23,22,21,17,54,51,50,23,22,21,20,7,6,35,34,39,38,39,17,52,55,54,51,2,164,138,97,96,96,97,138,137,97,97,97,97,253,179,
+49,36,36,113,218,238,169,169,169,169,238,238,168,169,1,36,36,49,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,254,123,100,169,169,238,238,169,169,168,167,238,3,100,50,36,35,0,0,0,1,0,70,0,0,3,137,4,128,0,40,0,0,0,23,22,29,1,20,7,6,35,34,
+39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,2,224,84,85,49,34,36,19,20,49,52,138,97,96,96,97,138,52,49,19,19,37,34,49,85,84,90,238,169,169,169,169,238,4,128,27,27,89,5,61,36,24,6,16,97,97,138,137,97,97,16,
+6,24,36,62,88,28,26,169,169,238,238,169,169,0,0,2,0,70,0,0,4,198,6,26,0,15,0,40,0,0,0,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,1,50,23,22,21,17,6,7,6,35,34,39,38,53,52,55,54,51,50,23,17,52,55,54,51,1,252,97,96,96,97,138,137,97,97,97,97,137,1,199,49,
+36,36,1,169,169,237,238,169,169,169,169,238,217,114,36,36,49,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,252,156,238,167,168,169,169,238,238,169,169,100,1,133,50,36,35,0,0,0,2,0,70,0,0,4,173,4,128,0,7,0,47,0,0,1,34,7,6,29,1,37,38,5,22,
+21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,2,134,138,97,96,2,47,74,1,113,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,238,169,169,169,169,238,172,142,141,
+3,137,97,97,138,7,251,88,89,25,26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,169,238,238,169,169,94,92,0,1,0,100,0,0,2,207,6,26,0,40,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,51,50,23,22,29,1,20,7,6,43,1,17,20,7,6,43,1,34,
+39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,253,50,36,35,35,36,50,253,36,36,49,3,49,36,36,2,127,129,183,6,26,35,36,50,2,50,36,35,57,57,53,36,35,50,2,50,36,36,252,239,51,34,36,36,34,51,3,233,183,128,129,0,0,2,0,70,254,101,4,198,4,128,
+0,37,0,54,0,0,4,51,50,55,54,53,6,35,34,39,38,53,52,55,54,51,50,23,22,23,17,20,7,6,35,32,3,38,53,52,55,54,63,1,54,51,50,23,1,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,53,1,190,200,125,101,105,114,217,238,169,169,169,169,238,237,169,169,1,181,175,220,
+254,175,168,20,7,18,56,3,25,23,56,38,2,118,2,97,96,136,138,97,96,96,97,138,138,96,97,166,98,100,133,165,169,169,238,238,169,169,168,167,239,254,99,234,174,168,1,6,31,33,20,20,56,20,1,9,56,2,85,135,95,95,97,97,137,138,97,96,96,97,138,0,0,1,0,100,0,0,4,
+43,6,26,0,45,0,0,19,50,23,22,21,17,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,79,160,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,36,36,49,3,49,36,36,36,36,49,6,26,
+35,36,50,254,164,59,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,253,221,51,34,36,36,34,51,5,40,50,36,35,0,2,0,120,0,0,1,144,6,25,0,19,0,35,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,55,34,39,38,53,52,55,54,51,50,23,22,
+21,20,7,6,1,5,51,34,36,36,34,51,2,50,36,36,36,36,50,1,58,41,41,41,41,58,57,41,42,42,41,4,128,36,36,50,252,115,51,34,36,36,34,51,3,141,50,36,36,130,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,2,255,46,254,101,1,170,6,27,0,29,0,45,0,0,3,34,39,38,61,1,52,
+55,54,59,1,50,55,54,55,17,52,55,54,59,1,50,23,22,21,17,6,7,6,35,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,89,49,36,36,36,36,49,58,81,57,57,1,35,36,50,2,50,36,35,2,127,127,184,1,61,58,41,41,41,41,58,57,41,42,42,41,254,101,36,36,49,3,49,36,36,57,57,
+82,3,232,50,36,36,36,36,50,252,24,184,128,129,6,159,41,41,58,57,41,41,41,40,58,59,40,41,0,0,0,0,1,0,100,0,0,3,235,6,26,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,
+17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,253,75,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,
+51,51,34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,51,5,40,50,36,35,0,0,0,1,0,140,0,0,1,129,6,26,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,6,26,35,36,50,250,216,51,34,36,36,34,51,
+5,40,50,36,35,0,0,1,0,140,0,0,2,144,6,26,0,29,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,8,49,36,36,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,6,26,35,36,50,251,153,29,20,20,36,36,50,2,51,34,36,
+92,93,129,4,103,50,36,35,0,0,1,0,100,0,0,6,243,4,128,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,89,36,36,49,3,49,
+36,36,141,141,199,238,121,120,238,199,141,141,35,36,50,2,51,34,36,69,69,99,98,69,69,36,34,51,2,50,36,36,69,69,98,98,69,69,121,51,34,36,36,34,51,2,38,198,142,141,158,158,141,142,198,253,218,50,35,36,36,34,51,2,38,98,69,69,69,69,98,253,218,51,34,36,36,
+34,51,2,38,98,69,69,69,69,98,0,0,0,0,1,0,100,0,0,4,43,4,128,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,89,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,36,69,70,
+99,100,70,69,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,0,0,2,0,70,0,0,4,198,4,128,0,15,0,31,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,39,50,23,22,21,20,7,6,35,34,39,38,53,52,55,54,2,134,
+138,97,96,96,97,138,137,97,97,97,97,137,238,169,169,169,169,238,238,169,169,169,169,3,137,97,97,138,137,97,97,97,97,137,138,97,97,247,169,169,238,238,169,169,169,169,238,238,169,169,0,2,0,100,254,101,4,228,4,128,0,15,0,40,0,0,36,55,54,53,52,39,38,35,
+34,7,6,21,20,23,22,51,1,34,39,38,53,17,54,55,54,51,50,23,22,21,20,7,6,35,34,39,17,20,7,6,35,3,45,97,97,97,96,138,138,97,96,96,97,138,254,57,49,36,36,1,169,168,238,238,169,169,169,169,238,218,113,36,36,49,247,97,97,137,138,97,96,96,97,138,137,97,97,253,
+110,36,36,49,3,100,239,167,168,169,169,238,238,169,169,100,254,122,49,36,36,0,0,0,0,2,0,70,254,101,4,198,4,128,0,15,0,40,0,0,37,50,55,54,53,52,39,38,35,34,7,6,21,20,23,22,1,34,39,38,53,17,6,35,34,39,38,53,52,55,54,51,50,23,22,23,17,20,7,6,35,2,134,137,
+97,97,97,96,138,138,97,96,96,97,2,78,49,36,36,114,217,238,169,169,169,169,238,237,169,169,1,36,36,49,247,97,97,137,138,97,96,96,97,138,137,97,97,253,110,36,36,49,1,134,100,169,169,238,238,169,169,168,169,237,252,156,49,36,36,0,0,0,0,1,0,100,0,0,2,207,
+4,128,0,29,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,4,128,36,36,50,2,50,35,36,57,57,82,253,178,51,34,36,36,34,51,2,78,183,129,129,0,0,0,0,
+1,0,60,0,0,3,23,4,128,0,53,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,1,154,44,30,30,58,20,147,119,58,83,102,103,144,254,251,49,36,36,36,
+36,49,1,15,44,30,30,57,15,153,119,58,83,102,103,144,184,50,36,36,36,36,50,3,139,30,31,43,60,30,11,39,34,55,79,146,144,103,102,36,34,51,2,50,36,36,30,30,44,55,28,7,43,35,57,81,148,144,102,103,36,36,50,2,51,34,36,0,0,1,0,100,0,0,2,104,6,26,0,41,0,0,19,
+50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,150,49,36,36,36,36,49,150,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,6,26,35,36,50,254,223,36,36,50,2,51,34,36,253,
+175,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,0,0,1,0,100,0,0,4,43,4,128,0,37,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,70,100,99,70,69,36,36,50,2,51,34,36,142,
+142,199,200,142,142,36,36,49,3,49,36,36,1,227,99,70,69,69,70,99,2,35,50,36,36,36,36,50,253,221,199,142,142,142,142,199,2,35,50,36,36,36,36,50,0,1,0,21,0,0,4,102,4,128,0,28,0,0,9,1,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,18,23,
+20,2,61,1,61,32,80,2,65,36,21,11,254,141,46,124,126,45,254,140,10,21,36,65,3,80,31,239,37,1,83,2,227,74,55,31,34,24,25,252,157,116,116,3,99,25,23,34,32,55,74,253,209,85,4,0,0,0,0,1,0,100,0,0,6,243,4,128,0,60,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,
+59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,69,98,98,69,69,36,36,50,2,51,34,36,69,69,98,99,69,69,36,34,51,2,50,36,35,141,141,199,238,120,121,238,199,
+141,141,36,36,49,3,49,36,36,1,225,98,69,69,69,69,98,2,37,50,36,36,36,36,50,253,219,98,69,69,69,69,98,2,37,50,36,36,36,36,50,253,219,199,141,141,158,158,141,141,199,2,37,50,36,36,36,36,50,0,0,0,1,0,85,0,0,4,28,4,128,0,67,0,0,1,20,23,22,51,50,55,54,61,
+1,52,55,54,59,1,50,23,22,29,1,20,7,22,29,1,20,7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,1,50,23,22,21,1,74,69,70,100,99,70,69,36,36,50,2,51,34,36,160,160,36,34,51,2,50,36,36,69,70,99,100,70,69,
+36,36,49,3,49,36,36,160,160,36,36,49,3,49,36,36,3,174,99,70,70,70,70,99,88,50,36,36,36,36,49,89,240,121,122,239,99,51,34,36,36,34,51,99,99,70,69,69,70,99,99,51,34,36,36,34,51,99,239,122,121,240,88,50,36,36,36,36,50,0,0,0,0,1,0,100,254,101,4,43,4,128,
+0,65,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,38,39,38,53,52,55,54,63,1,54,51,50,23,22,23,22,23,22,51,50,55,54,61,1,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,89,69,70,100,98,70,70,36,36,50,2,51,34,36,149,145,
+189,150,123,120,62,14,10,20,50,4,22,21,22,21,41,21,32,64,65,76,95,71,72,79,159,200,142,142,36,36,49,3,49,36,36,1,249,99,70,70,70,70,99,2,13,50,36,36,36,36,50,252,67,198,144,142,74,72,121,27,27,23,23,52,17,2,7,8,17,40,60,37,38,70,72,97,8,59,142,141,200,
+2,13,50,36,36,36,36,50,0,0,0,1,0,65,0,3,3,254,4,131,0,39,0,0,37,5,50,23,22,29,1,20,7,6,35,33,34,39,38,53,52,55,54,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,20,7,0,1,139,1,250,50,35,36,36,35,50,253,115,118,47,18,57,98,200,175,93,254,50,51,35,
+35,35,35,51,2,92,121,48,18,57,254,188,248,1,35,36,50,2,50,36,35,111,41,38,67,57,102,210,184,97,36,36,49,3,49,36,36,111,41,38,68,56,254,172,0,0,0,1,0,50,254,94,2,175,6,26,0,71,0,0,18,55,54,55,54,53,52,55,54,55,54,55,54,55,54,55,50,23,22,29,1,20,7,6,7,
+6,7,6,7,6,7,6,7,22,19,22,21,20,23,22,23,22,23,22,23,22,29,1,20,7,6,35,38,39,38,39,38,39,38,61,1,52,39,38,39,38,39,38,61,1,52,55,166,21,41,14,17,4,10,26,27,41,42,61,39,78,41,30,29,26,27,39,63,20,25,3,5,4,37,85,94,31,9,2,6,23,19,57,38,28,27,30,29,41,92,
+46,72,46,47,15,12,17,14,40,22,28,86,86,2,189,17,34,58,76,143,187,46,90,55,57,34,35,18,10,1,29,30,41,20,39,28,29,3,4,22,29,182,247,25,220,41,39,254,248,80,127,149,20,56,19,15,4,1,29,29,40,19,43,28,29,1,17,26,57,57,87,77,185,17,153,73,59,34,18,8,27,89,
+9,90,26,0,0,0,1,0,200,254,96,1,185,6,26,0,3,0,0,19,51,17,35,200,241,241,6,26,248,70,0,0,0,0,1,0,50,254,94,2,175,6,26,0,70,0,0,1,22,29,1,20,7,6,7,6,7,6,21,20,7,6,7,6,7,6,7,34,39,38,61,1,52,55,54,55,54,55,54,55,54,53,52,55,18,55,38,39,38,39,38,39,38,39,
+38,39,38,61,1,52,55,54,51,22,23,22,23,22,23,22,23,22,21,20,23,22,23,22,2,89,86,85,29,22,40,13,18,12,14,47,47,72,46,92,41,29,30,27,28,38,57,19,23,7,1,9,31,95,86,37,4,4,4,26,18,63,40,26,27,30,29,41,78,39,63,40,41,27,26,10,4,18,13,41,22,2,180,26,90,9,89,
+27,8,18,33,60,77,166,185,77,87,57,57,26,17,1,29,28,43,19,40,29,29,1,4,15,19,56,20,149,127,80,1,8,39,41,220,25,247,182,29,22,4,3,29,28,39,20,41,30,29,1,10,18,35,34,57,55,90,46,187,142,77,58,34,17,0,0,0,0,1,0,37,2,33,3,250,3,105,0,58,0,0,18,55,54,51,50,
+23,22,23,22,23,22,59,1,54,55,54,51,50,23,22,23,22,23,22,21,20,7,6,7,6,7,6,7,6,35,34,39,38,39,38,43,1,6,7,6,7,35,34,39,38,39,38,39,38,53,52,55,54,55,157,151,12,12,51,57,43,73,76,27,45,35,13,57,63,24,27,20,22,24,13,11,4,1,4,8,18,52,57,59,73,12,12,58,60,
+43,88,94,63,12,64,58,19,26,4,22,20,24,14,13,2,2,3,6,17,3,96,8,1,14,10,26,27,8,12,3,45,16,9,13,26,20,29,9,8,18,15,28,17,49,24,25,4,1,16,11,35,36,3,42,15,3,9,11,25,20,26,11,11,13,13,28,17,255,255,0,40,254,42,1,64,4,68,0,11,0,4,1,164,4,68,192,0,0,2,0,48,
+254,104,4,80,5,255,0,8,0,42,0,0,1,19,6,7,6,21,20,23,22,1,3,51,50,55,23,6,7,6,35,34,39,3,35,19,38,39,38,53,52,55,54,51,50,23,19,51,3,22,23,22,23,7,38,1,153,161,104,78,86,94,9,1,96,166,10,163,107,233,70,117,140,191,42,13,98,207,116,57,69,168,157,156,225,
+37,9,91,206,105,28,47,122,69,247,41,1,50,2,122,6,99,117,140,134,122,11,2,41,253,120,200,52,190,96,104,2,254,128,1,196,33,75,182,244,249,177,178,1,1,98,254,103,13,34,99,192,44,75,0,0,1,0,100,0,0,4,97,6,26,0,65,0,0,0,39,38,35,34,7,6,21,17,33,50,23,22,29,
+1,20,7,6,35,33,17,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,51,34,39,38,61,1,52,55,54,51,35,17,52,55,54,51,50,23,22,23,22,21,20,7,6,43,1,34,39,3,73,57,59,74,91,64,64,1,32,50,36,35,35,36,50,254,224,2,55,50,36,36,36,36,50,253,77,49,36,36,1,36,26,26,
+26,26,36,1,136,136,192,157,125,123,41,5,25,36,61,3,92,25,4,203,45,46,64,64,91,254,244,36,36,49,3,49,36,36,254,171,36,36,50,2,51,34,36,36,34,51,1,209,26,26,37,67,37,26,26,1,12,192,135,136,96,94,150,18,16,38,33,48,89,0,2,0,38,0,212,4,173,5,89,0,11,0,39,
+0,0,1,34,6,21,20,22,51,50,54,53,52,38,5,39,55,23,54,51,50,23,55,23,7,22,21,20,7,23,7,39,6,35,34,39,7,39,55,38,53,52,2,105,110,157,157,110,111,156,156,253,237,159,167,159,99,155,155,100,158,166,159,69,69,159,167,158,100,154,155,99,158,167,159,70,4,34,
+156,111,112,156,156,112,111,156,15,159,167,158,69,69,158,165,159,100,154,155,100,159,165,158,69,69,158,165,159,101,154,153,0,1,255,247,0,0,4,201,6,89,0,22,0,0,37,21,35,53,33,53,33,53,33,53,33,1,51,9,1,51,1,33,21,33,21,33,21,2,205,237,254,228,1,28,254,
+228,1,0,254,51,253,1,99,1,125,245,254,33,1,17,254,210,1,46,226,226,226,183,113,193,3,142,253,32,2,224,252,114,193,113,183,0,0,0,0,2,0,150,254,49,1,137,6,87,0,3,0,7,0,0,19,51,17,35,17,51,17,35,150,243,243,243,243,6,87,252,120,254,234,252,120,0,0,0,0,2,
+0,70,254,13,4,65,6,115,0,89,0,117,0,0,37,22,23,22,23,22,29,1,6,7,6,7,6,43,1,36,3,55,22,23,22,23,22,51,50,55,54,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,54,53,52,35,34,7,38,39,38,53,52,55,54,55,54,59,1,22,23,22,23,7,38,39,38,35,34,7,6,7,21,20,23,22,
+23,30,1,23,4,23,22,23,22,29,1,6,7,6,37,51,50,55,54,55,54,53,52,39,38,39,38,39,38,35,34,7,6,7,21,20,23,22,23,22,23,22,3,140,64,56,33,15,13,4,91,81,132,90,90,16,254,84,87,227,42,129,45,67,13,12,114,77,40,13,8,22,33,86,73,89,233,88,113,156,18,1,1,7,12,40,
+113,156,87,122,49,51,23,193,113,118,38,233,33,107,45,63,90,67,70,3,13,11,26,42,115,115,1,1,90,33,15,13,4,91,57,254,167,17,110,77,40,13,8,22,33,86,38,39,22,28,90,67,70,3,13,11,26,42,54,36,250,31,78,46,56,49,56,21,135,106,94,45,32,12,1,180,39,189,63,21,
+5,1,74,38,50,28,25,43,34,52,38,30,25,68,78,102,176,214,115,13,1,1,4,6,35,102,176,214,115,64,22,7,6,92,95,219,35,164,52,22,49,52,84,6,43,35,33,25,43,38,31,77,126,46,56,49,56,21,135,106,66,104,73,38,50,28,25,43,34,52,38,16,13,4,49,52,84,6,43,35,33,25,43,
+17,12,0,0,2,0,100,4,159,2,231,5,182,0,15,0,31,0,0,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,1,50,58,41,41,41,41,58,57,41,42,42,41,4,159,41,41,58,57,41,41,41,40,58,
+59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,0,0,3,0,110,255,208,6,185,6,27,0,35,0,51,0,67,0,0,1,38,39,38,35,34,7,6,29,1,20,23,22,51,50,55,54,55,23,6,7,6,35,34,39,38,61,1,52,55,54,51,50,23,22,23,1,50,4,18,21,20,2,4,35,34,36,2,53,52,18,36,23,34,4,2,21,
+20,18,4,51,50,36,18,53,52,2,36,4,161,19,56,72,107,119,82,83,83,82,119,104,72,71,14,139,23,111,112,154,180,126,123,123,126,180,154,113,93,30,254,107,203,1,130,216,212,254,128,209,209,254,129,214,217,1,130,203,170,254,191,182,179,1,64,174,174,1,64,178,
+181,254,190,3,171,90,54,70,86,84,122,178,121,84,87,68,66,114,14,166,102,105,129,128,180,166,181,128,129,106,85,136,2,85,208,254,124,210,208,254,127,212,212,1,129,208,210,1,132,208,133,174,254,188,175,174,254,193,179,179,1,63,174,175,1,68,174,0,0,0,2,
+0,100,3,79,3,113,6,26,0,23,0,39,0,0,0,23,22,21,17,20,7,6,43,1,34,39,38,53,6,35,34,39,38,53,52,55,54,51,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,2,140,113,116,28,27,35,2,36,27,27,63,146,161,113,116,116,113,161,87,62,59,59,62,87,87,62,60,60,62,87,6,
+26,104,105,149,254,239,35,25,24,24,25,35,84,104,105,148,149,105,104,171,56,54,77,77,54,55,55,54,77,77,54,56,0,2,0,30,1,93,4,128,4,127,0,9,0,19,0,0,1,33,9,1,33,1,38,53,52,55,1,33,9,1,33,1,38,53,52,55,1,184,1,62,254,53,1,203,254,194,254,130,28,28,3,8,1,
+62,254,53,1,203,254,194,254,130,28,28,4,127,254,111,254,111,1,82,25,38,39,25,1,81,254,111,254,111,1,82,25,38,39,25,0,1,0,130,1,94,3,209,3,108,0,5,0,0,19,33,17,35,17,33,130,3,79,192,253,113,3,108,253,242,1,89,0,4,0,100,255,208,6,175,6,27,0,15,0,31,0,48,
+0,59,0,0,1,50,4,18,21,20,2,4,35,34,36,2,53,52,18,36,23,34,4,2,21,20,18,4,51,50,36,18,53,52,2,36,13,1,22,23,22,21,20,7,6,35,51,1,35,1,35,17,35,1,54,55,54,53,52,39,38,39,33,17,3,138,203,1,130,216,212,254,128,209,209,254,129,214,217,1,130,203,170,254,191,
+182,179,1,64,174,174,1,64,178,181,254,190,254,52,1,127,113,79,79,98,64,138,2,1,52,136,254,204,93,127,1,127,63,45,44,44,45,63,255,0,6,27,208,254,124,210,208,254,127,212,212,1,129,208,210,1,132,208,133,174,254,188,175,174,254,193,179,179,1,63,174,175,1,
+68,174,193,1,1,80,80,112,128,83,64,254,35,1,221,254,35,2,84,1,46,45,64,63,45,45,2,254,201,0,255,255,0,50,5,20,3,54,6,9,2,3,0,16,0,0,2,129,0,0,0,2,0,100,3,140,3,34,6,38,0,17,0,35,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,7,52,55,54,59,1,50,
+23,22,21,20,7,6,43,1,34,39,38,1,53,39,39,52,22,54,39,39,39,38,55,22,53,38,39,209,98,98,138,34,137,99,98,98,99,137,34,138,98,98,4,218,54,39,39,39,39,54,53,39,38,38,39,53,136,98,98,98,98,136,138,98,98,98,98,0,2,0,50,0,90,4,78,5,208,0,43,0,63,0,0,1,33,50,
+23,22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,17,52,55,54,59,1,50,23,22,21,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,187,1,25,50,36,36,36,36,50,254,231,36,36,50,2,51,34,36,254,229,51,34,36,36,34,
+51,1,27,36,34,51,2,50,36,36,1,147,36,36,50,252,215,51,34,36,36,34,51,3,41,50,36,36,4,60,36,36,50,2,51,34,36,254,231,50,36,36,36,36,50,1,25,36,34,51,2,50,36,36,1,27,51,34,36,36,34,51,251,124,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,1,0,182,4,222,2,140,
+6,97,0,19,0,0,1,6,43,1,34,39,38,53,52,63,1,54,59,1,50,23,22,21,20,7,1,124,25,27,77,43,18,8,14,176,19,36,154,43,18,10,19,4,245,23,38,15,15,21,19,251,28,39,18,15,22,19,0,0,0,1,0,110,254,101,4,53,4,127,0,53,0,0,37,17,20,7,6,43,1,34,39,38,53,17,52,55,54,
+59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,6,35,34,1,99,36,36,49,3,49,36,36,36,36,49,3,49,36,36,69,70,100,99,70,69,36,36,49,3,49,36,36,36,36,49,3,49,36,36,37,201,202,56,254,166,51,34,36,36,34,
+51,5,40,50,36,35,36,36,50,253,221,99,70,69,69,70,99,2,36,50,36,35,35,36,50,252,4,51,34,36,36,34,51,46,57,0,0,0,1,0,100,0,0,4,48,6,87,0,17,0,0,1,35,17,35,17,35,17,35,17,38,39,38,53,52,55,54,55,33,4,48,87,209,62,219,171,112,112,112,119,193,2,36,5,134,250,
+122,5,134,250,122,2,195,26,129,129,170,168,129,149,16,255,255,0,100,1,167,4,211,7,84,0,11,0,17,0,15,2,150,54,102,0,1,0,108,254,5,2,112,0,10,0,39,0,0,37,51,7,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,
+38,53,52,55,1,10,206,22,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,17,5,7,22,13,22,41,22,19,1,10,114,7,53,51,66,93,68,65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,2,255,236,1,93,4,88,4,127,0,9,0,19,0,0,1,22,21,20,7,1,
+33,9,1,33,1,22,21,20,7,1,33,9,1,33,2,168,28,28,254,130,254,194,1,203,254,53,1,62,3,18,28,28,254,130,254,194,1,203,254,53,1,62,3,46,25,39,38,25,254,174,1,145,1,145,254,175,25,39,38,25,254,174,1,145,1,145,255,255,0,40,255,132,6,204,6,96,0,34,0,234,0,0,
+0,35,0,213,1,181,0,0,0,3,0,237,3,105,253,207,255,255,0,40,255,132,6,116,6,96,0,34,0,234,0,0,0,35,0,213,1,181,0,0,0,3,0,235,3,105,253,207,255,255,0,40,255,132,7,166,6,96,0,34,0,236,0,0,0,35,0,213,2,143,0,0,0,3,0,237,4,67,253,207,255,255,0,14,254,57,3,
+184,4,68,0,11,0,34,4,10,4,67,192,0,255,255,0,110,0,0,4,121,7,251,2,34,0,36,0,0,0,3,0,67,1,58,1,154,255,255,0,110,0,0,4,121,7,251,2,34,0,36,0,0,0,3,0,115,1,23,1,154,255,255,0,110,0,0,4,121,7,226,2,34,0,36,0,0,0,3,0,190,0,157,1,154,255,255,0,110,0,0,4,
+121,7,131,2,34,0,36,0,0,0,3,0,197,0,144,1,154,255,255,0,110,0,0,4,121,7,80,2,34,0,36,0,0,0,3,0,106,0,206,1,154,255,255,0,110,0,0,4,121,8,16,2,34,0,36,0,0,0,3,0,195,1,18,1,154,0,2,0,110,0,0,6,208,6,26,0,10,0,83,0,0,1,53,52,39,38,35,34,7,6,29,1,1,38,61,
+1,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,17,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,3,132,79,80,114,113,80,79,2,34,1,253,223,36,36,49,3,49,
+36,36,152,152,213,214,138,29,107,151,1,100,50,36,36,36,36,50,254,156,51,35,35,1,221,50,36,36,36,36,50,254,35,35,35,51,1,100,50,36,36,36,36,50,254,156,151,107,107,3,43,234,113,80,80,80,80,113,234,254,156,7,9,96,254,66,51,34,36,36,34,51,3,156,214,152,151,
+137,1,29,107,36,36,49,3,49,36,36,35,35,50,254,218,36,36,49,3,49,36,36,254,219,51,35,35,35,36,50,2,50,36,35,107,107,151,0,0,0,255,255,0,75,254,30,4,118,6,26,2,34,0,38,0,0,0,3,0,119,2,3,0,25,255,255,0,110,0,0,3,185,7,251,2,34,0,40,0,0,0,3,0,67,0,218,1,
+154,255,255,0,110,0,0,3,185,7,251,2,34,0,40,0,0,0,3,0,115,0,183,1,154,255,255,0,110,0,0,3,185,7,226,2,34,0,40,0,0,0,3,0,190,0,111,1,154,255,255,0,110,0,0,3,185,7,80,2,34,0,40,0,0,0,3,0,106,0,150,1,154,255,255,255,206,0,0,1,163,7,251,2,34,0,44,0,0,0,3,
+0,67,255,195,1,154,255,255,0,106,0,0,2,64,7,251,2,34,0,44,0,0,0,3,0,115,255,180,1,154,255,255,255,153,0,0,2,116,7,226,2,34,0,44,0,0,0,3,0,190,255,48,1,154,255,255,255,197,0,0,2,72,7,80,2,34,0,44,0,0,0,3,0,106,255,97,1,154,0,2,0,10,0,0,5,64,6,26,0,22,
+0,45,0,0,19,17,52,55,54,59,1,32,23,22,17,16,7,6,33,35,34,39,38,53,17,35,53,41,1,21,33,17,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,21,130,83,83,116,151,1,67,229,229,229,229,254,189,151,116,83,83,120,1,109,1,49,254,207,10,11,16,151,223,157,157,157,
+157,223,151,16,11,10,3,136,1,120,117,83,82,229,229,254,189,254,189,229,229,83,83,116,1,121,245,245,254,135,16,11,10,156,157,223,223,157,157,11,11,16,255,255,0,110,0,0,4,121,7,131,2,34,0,49,0,0,0,3,0,197,0,144,1,154,255,255,0,80,0,0,6,107,7,251,2,34,0,
+50,0,0,0,3,0,67,2,36,1,154,255,255,0,80,0,0,6,107,7,251,2,34,0,50,0,0,0,3,0,115,2,1,1,154,255,255,0,80,0,0,6,107,7,226,2,34,0,50,0,0,0,3,0,190,1,135,1,154,255,255,0,80,0,0,6,107,7,131,2,34,0,50,0,0,0,3,0,197,1,122,1,154,255,255,0,80,0,0,6,107,7,80,2,
+34,0,50,0,0,0,3,0,106,1,184,1,154,0,1,0,51,1,118,3,99,4,166,0,47,0,0,1,55,54,51,50,31,1,22,21,20,15,1,23,22,21,20,15,1,6,35,34,47,1,7,6,43,1,34,47,1,38,61,1,52,63,1,39,38,61,1,52,63,1,54,59,1,50,23,1,203,199,36,50,51,39,1,32,35,199,199,35,39,2,32,50,
+50,36,199,199,36,48,6,47,35,1,36,35,200,200,35,35,1,36,50,3,48,36,3,187,199,36,39,2,33,49,50,36,199,199,36,50,50,40,1,32,36,199,200,35,35,1,36,50,3,48,35,200,200,35,48,6,47,35,1,36,35,0,3,0,80,255,39,6,107,6,156,0,10,0,21,0,47,0,0,1,38,35,34,7,6,21,20,
+23,22,31,1,22,51,50,55,54,53,52,39,38,39,55,22,23,22,17,16,7,6,33,34,39,7,35,19,38,39,38,17,16,55,54,33,50,23,55,51,3,211,38,80,222,157,157,157,47,22,198,35,77,223,157,157,157,45,21,101,62,76,229,229,230,254,189,127,85,108,237,147,65,77,229,229,229,1,
+67,130,88,70,236,5,27,11,157,157,223,223,157,46,14,86,10,156,157,223,223,157,44,14,226,37,75,229,254,189,254,189,229,229,27,244,1,75,38,77,229,1,67,1,67,229,229,28,158,0,0,0,255,255,0,110,0,0,4,121,7,251,2,34,0,56,0,0,0,3,0,67,1,58,1,154,255,255,0,110,
+0,0,4,121,7,251,2,34,0,56,0,0,0,3,0,115,1,23,1,154,255,255,0,110,0,0,4,121,7,226,2,34,0,56,0,0,0,3,0,190,0,157,1,154,255,255,0,110,0,0,4,121,7,80,2,34,0,56,0,0,0,3,0,106,0,206,1,154,255,255,0,100,0,0,4,111,7,251,2,34,0,60,0,0,0,3,0,115,1,13,1,154,0,2,
+0,140,0,0,4,181,6,26,0,30,0,41,0,0,1,21,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,33,50,23,22,21,20,7,6,35,1,17,33,50,55,54,53,52,39,38,35,1,129,36,36,49,3,49,36,36,36,36,49,3,49,36,36,1,80,200,142,142,142,142,200,254,176,1,80,99,70,70,70,
+70,99,1,42,177,51,34,36,36,34,51,5,40,50,36,35,35,36,50,176,142,142,199,200,142,142,2,210,254,35,69,70,100,99,70,69,0,0,0,1,0,100,0,0,4,60,6,26,0,70,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,
+54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,7,6,21,1,89,36,36,49,3,49,36,36,83,83,116,238,183,129,129,129,152,136,136,192,61,50,36,35,35,36,50,61,91,64,63,63,64,91,57,50,36,35,35,36,50,57,82,57,57,57,58,
+81,238,16,11,10,121,51,34,36,36,34,51,4,135,117,83,82,129,129,182,206,108,116,229,191,136,136,36,35,50,2,50,36,36,63,64,91,91,64,64,36,35,50,2,50,36,35,1,56,57,82,81,57,58,11,11,16,0,0,255,255,0,100,0,0,4,228,6,97,2,34,0,68,0,0,0,3,0,67,1,106,0,0,255,
+255,0,100,0,0,4,228,6,97,2,34,0,68,0,0,0,3,0,115,1,71,0,0,255,255,0,100,0,0,4,228,6,72,2,34,0,68,0,0,0,3,0,190,0,205,0,0,255,255,0,100,0,0,4,228,5,233,2,34,0,68,0,0,0,3,0,197,0,192,0,0,255,255,0,100,0,0,4,228,5,182,2,34,0,68,0,0,0,3,0,106,0,254,0,0,255,
+255,0,100,0,0,4,228,6,118,2,34,0,68,0,0,0,3,0,195,1,66,0,0,0,3,0,100,0,0,8,87,4,128,0,7,0,23,0,86,0,0,1,37,38,35,34,7,6,21,37,6,21,20,23,22,51,50,55,54,53,52,39,38,35,34,1,53,20,7,6,43,1,34,39,38,53,21,6,35,34,39,38,53,52,55,54,51,50,23,22,23,54,55,54,
+51,50,23,22,23,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,4,229,2,47,74,154,138,97,96,252,212,96,96,97,138,138,96,97,97,97,137,138,2,202,36,36,49,3,49,36,36,114,217,238,169,169,169,169,238,238,169,41,6,6,41,169,238,172,
+142,141,68,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,220,2,53,252,88,97,97,138,237,97,137,138,97,96,96,97,138,137,97,97,252,217,21,51,34,36,36,34,51,21,100,169,169,238,238,169,169,169,41,8,8,41,169,94,92,150,25,
+26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,0,0,255,255,0,70,254,14,3,151,4,128,2,34,0,70,0,0,0,3,0,119,1,39,0,9,255,255,0,70,0,0,4,173,6,97,2,34,0,72,0,0,0,3,0,67,1,64,0,0,255,255,0,70,0,0,4,173,6,97,2,34,0,72,0,0,0,3,0,115,
+1,29,0,0,255,255,0,70,0,0,4,173,6,72,2,34,0,72,0,0,0,3,0,190,0,162,0,0,255,255,0,70,0,0,4,173,5,182,2,34,0,72,0,0,0,3,0,106,0,212,0,0,255,255,255,203,0,0,1,160,6,97,2,34,0,189,0,0,0,2,0,67,192,0,0,0,255,255,0,103,0,0,2,61,6,97,2,34,0,189,0,0,0,2,0,115,
+177,0,0,0,255,255,255,150,0,0,2,113,6,72,2,34,0,189,0,0,0,3,0,190,255,45,0,0,255,255,255,194,0,0,2,69,5,182,2,34,0,189,0,0,0,3,0,106,255,94,0,0,0,2,0,100,0,0,4,228,6,91,0,15,0,76,0,0,1,34,7,6,21,20,23,22,51,50,55,54,53,52,39,38,3,23,22,21,20,15,1,4,19,
+22,23,22,21,20,7,6,35,34,39,38,53,52,55,54,51,50,53,52,39,38,39,7,6,35,34,47,1,38,53,52,63,1,38,39,38,39,38,53,52,63,1,54,51,50,23,22,23,55,54,51,50,2,164,138,97,96,96,97,138,137,97,97,97,97,45,8,31,18,49,1,54,129,65,5,3,169,169,238,238,169,169,169,169,
+238,69,4,13,123,65,22,28,21,24,8,31,18,56,5,35,29,7,3,11,43,21,31,15,17,49,23,61,23,29,21,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,192,5,23,28,21,23,66,211,254,195,158,120,31,30,238,169,169,169,169,238,238,169,169,4,1,1,16,90,87,32,18,5,23,28,
+21,24,75,2,17,14,30,10,9,18,18,64,34,7,22,12,81,32,0,255,255,0,100,0,0,4,43,5,233,2,34,0,82,0,0,0,2,0,197,100,0,0,0,255,255,0,70,0,0,4,198,6,97,2,34,0,83,0,0,0,3,0,67,1,76,0,0,255,255,0,70,0,0,4,198,6,97,2,34,0,83,0,0,0,3,0,115,1,41,0,0,255,255,0,70,
+0,0,4,198,6,72,2,34,0,83,0,0,0,3,0,190,0,175,0,0,255,255,0,70,0,0,4,198,5,233,2,34,0,83,0,0,0,3,0,197,0,162,0,0,255,255,0,70,0,0,4,198,5,182,2,34,0,83,0,0,0,3,0,106,0,224,0,0,0,3,0,50,1,50,3,134,4,234,0,19,0,35,0,51,0,0,1,20,7,6,35,33,34,39,38,61,1,52,
+55,54,51,33,50,23,22,21,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,3,134,36,36,50,253,159,51,34,36,36,34,51,2,97,50,36,36,254,86,58,41,41,41,41,58,57,41,42,42,41,57,58,41,41,41,41,58,57,41,42,42,41,3,12,
+51,34,36,36,34,51,2,50,36,36,36,36,50,254,36,41,41,58,57,41,41,41,40,58,59,40,41,2,161,41,41,58,57,41,41,41,40,58,59,40,41,0,3,0,70,255,46,4,198,5,72,0,9,0,20,0,46,0,0,9,1,35,34,7,6,21,20,23,22,23,54,51,50,55,54,53,52,39,38,39,1,38,39,38,53,52,55,54,
+51,50,23,55,51,3,22,23,22,21,20,7,6,35,34,39,7,35,1,163,1,7,36,138,97,96,96,5,199,4,27,137,97,97,98,2,1,253,207,30,46,169,169,169,238,87,54,99,236,140,27,44,169,169,169,238,84,50,103,237,1,76,2,61,97,97,138,137,97,5,93,1,97,97,137,138,97,2,2,253,59,20,
+46,169,238,238,169,169,16,216,254,206,19,44,169,238,238,169,169,14,224,255,255,0,100,0,0,4,43,6,97,2,34,0,89,0,0,0,3,0,67,1,14,0,0,255,255,0,100,0,0,4,43,6,97,2,34,0,89,0,0,0,3,0,115,0,235,0,0,255,255,0,100,0,0,4,43,6,72,2,34,0,89,0,0,0,2,0,190,113,0,
+0,0,255,255,0,100,0,0,4,43,5,182,2,34,0,89,0,0,0,3,0,106,0,162,0,0,255,255,0,100,254,101,4,43,6,97,2,34,0,93,0,0,0,3,0,115,0,235,0,0,0,2,0,100,254,101,4,228,6,26,0,32,0,48,0,0,1,54,51,50,23,22,21,20,7,6,35,34,39,17,20,7,6,43,1,34,39,38,53,17,52,55,54,
+59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,52,39,38,35,34,7,6,1,89,111,220,238,169,169,169,169,238,218,113,36,36,49,3,49,36,36,36,36,49,3,49,36,36,96,97,138,137,97,97,97,96,138,138,97,96,4,29,99,169,169,238,238,169,169,100,254,122,49,36,36,36,36,49,
+6,195,50,36,35,35,36,50,252,161,137,97,97,97,97,137,138,97,96,96,97,0,0,255,255,0,100,254,101,4,43,5,182,2,34,0,93,0,0,0,3,0,106,0,162,0,0,0,1,0,137,0,0,1,126,4,128,0,19,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,5,51,34,36,36,34,51,
+2,50,36,36,36,36,50,4,128,36,36,50,252,115,51,34,36,36,34,51,3,141,50,36,36,0,0,1,0,105,4,197,3,68,6,72,0,26,0,0,1,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,215,168,24,27,77,43,18,9,16,197,21,33,197,34,19,198,16,8,18,43,77,
+28,24,5,130,165,24,38,17,15,21,19,251,26,27,250,19,22,15,16,38,24,0,1,0,106,4,207,3,68,6,81,0,29,0,0,1,54,55,54,55,54,59,1,50,23,22,21,20,15,1,6,43,1,34,47,1,38,53,52,55,54,59,1,50,23,1,215,10,63,63,31,25,27,77,43,18,8,16,197,20,34,197,32,21,197,16,7,
+20,42,77,28,23,5,148,10,62,62,32,23,38,16,15,22,19,251,25,25,251,19,22,15,16,38,24,0,0,0,0,1,0,50,4,229,2,90,5,218,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,90,36,36,50,254,203,51,34,36,36,34,51,1,53,50,36,36,5,94,51,34,36,36,
+34,51,2,50,36,36,36,36,50,0,0,1,0,107,4,197,3,60,6,54,0,30,0,0,1,50,23,22,21,20,7,6,7,6,35,34,39,38,39,38,53,52,55,54,59,1,50,23,22,59,1,50,55,54,51,2,224,46,28,18,5,41,102,95,118,118,94,103,40,5,17,28,47,21,61,24,43,119,2,119,42,23,62,6,54,37,26,28,
+15,15,118,68,62,62,68,118,16,15,28,25,37,57,106,105,58,0,0,1,0,100,4,229,1,124,5,252,0,15,0,0,19,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,4,229,41,41,58,57,41,41,41,40,58,59,40,41,0,2,0,100,4,147,2,96,6,118,0,17,
+0,35,0,0,1,20,23,22,59,1,50,55,54,53,52,39,38,43,1,34,7,6,7,52,55,54,59,1,50,23,22,21,20,7,6,43,1,34,39,38,1,28,19,19,25,13,26,19,19,19,18,27,13,26,18,19,184,71,71,100,24,99,72,71,71,72,99,24,100,71,71,5,133,26,19,19,19,19,26,26,19,18,18,19,26,99,71,
+71,71,71,99,100,71,71,71,71,0,1,0,65,254,49,1,192,0,23,0,23,0,0,1,6,35,34,39,38,53,52,55,54,55,51,6,7,6,21,20,23,22,51,50,55,54,55,1,192,61,111,90,58,63,61,35,47,223,91,31,40,7,17,35,9,10,31,70,254,105,56,53,57,93,77,102,59,45,88,48,59,37,15,12,29,2,
+6,44,0,0,1,0,102,4,197,3,97,5,233,0,36,0,0,18,55,54,51,50,23,22,59,1,54,55,54,59,1,50,23,22,21,20,7,6,35,34,39,38,35,6,7,6,7,35,34,39,38,53,52,55,118,64,66,99,81,110,36,39,8,40,16,36,37,41,35,21,18,1,33,200,82,107,44,45,40,10,26,56,44,33,23,19,1,5,115,
+53,56,52,17,1,23,54,25,21,25,6,7,202,56,23,1,28,51,5,25,21,26,6,6,0,0,255,255,0,108,4,252,3,218,6,127,0,34,0,115,182,30,0,3,0,115,1,78,0,30,0,1,0,100,1,204,4,73,2,177,0,3,0,0,19,33,21,33,100,3,229,252,27,2,177,229,0,0,0,1,0,100,1,204,5,217,2,177,0,3,
+0,0,19,33,21,33,100,5,117,250,139,2,177,229,0,0,0,1,0,100,3,234,1,99,6,31,0,23,0,0,0,23,22,29,1,20,7,6,43,1,34,39,38,61,1,52,55,54,55,23,6,21,20,23,1,29,34,36,36,36,49,12,50,36,36,56,30,49,93,69,1,5,30,36,36,49,66,50,36,35,35,36,50,157,138,82,44,23,71,
+85,79,11,11,0,0,0,0,1,0,100,3,229,1,99,6,26,0,23,0,0,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,170,34,36,36,36,49,12,50,36,36,56,30,49,93,69,1,4,230,36,36,49,66,50,36,35,35,36,50,157,138,82,44,23,71,85,79,11,11,255,255,0,100,255,
+1,1,99,1,54,2,3,0,202,0,0,251,28,0,0,255,255,0,100,3,234,2,116,6,31,0,34,0,201,0,0,0,3,0,201,1,17,0,0,255,255,0,100,3,229,2,116,6,26,0,34,0,202,0,0,0,3,0,202,1,17,0,0,255,255,0,100,255,1,2,116,1,54,2,3,0,205,0,0,251,28,0,0,0,1,0,10,254,234,4,106,6,86,
+0,11,0,0,1,17,35,17,33,53,33,17,51,17,33,21,2,168,220,254,62,1,194,220,1,194,3,184,251,50,4,206,220,1,194,254,62,220,0,1,0,10,254,234,4,106,6,86,0,19,0,0,1,17,51,17,33,21,33,17,33,21,33,17,35,17,33,53,33,17,33,53,1,204,220,1,194,254,62,1,194,254,62,220,
+254,62,1,194,254,62,4,138,1,204,254,52,220,253,228,220,254,52,1,204,220,2,28,220,0,0,0,1,0,100,1,131,3,25,4,56,0,11,0,0,0,22,21,20,6,35,34,38,53,52,54,51,2,78,203,203,144,143,203,203,143,4,56,203,143,144,203,203,144,143,203,0,0,0,0,3,0,100,0,0,6,210,
+1,23,0,15,0,31,0,47,0,0,51,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,33,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,240,58,41,41,41,41,58,57,41,42,42,41,2,114,58,41,41,41,41,58,57,41,42,42,41,2,114,58,41,
+41,41,41,58,57,41,42,42,41,41,41,58,57,41,41,41,40,58,59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,41,41,58,57,41,41,41,40,58,59,40,41,0,1,0,30,1,93,2,246,4,127,0,9,0,0,1,33,9,1,33,1,38,53,52,55,1,184,1,62,254,53,1,203,254,194,254,130,28,28,4,127,254,
+111,254,111,1,82,25,38,39,25,0,0,0,1,255,236,1,93,2,196,4,127,0,9,0,0,1,22,21,20,7,1,33,9,1,33,2,168,28,28,254,130,254,194,1,203,254,53,1,62,3,46,25,39,38,25,254,174,1,145,1,145,0,0,0,1,255,207,255,132,2,142,6,96,0,3,0,0,9,1,35,1,2,142,253,249,184,2,
+9,6,96,249,36,6,220,0,0,1,0,10,0,0,3,212,6,26,0,67,0,0,1,22,23,22,29,1,20,7,6,35,21,35,21,20,7,6,43,1,34,39,38,61,1,35,53,34,39,38,61,1,52,55,54,55,51,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,21,2,2,46,35,
+36,36,35,16,112,36,36,49,3,49,36,36,90,18,33,36,36,33,48,60,107,107,151,1,51,49,36,36,36,36,49,254,205,50,35,35,1,161,49,36,36,36,36,49,254,95,2,16,1,34,36,50,2,50,36,34,2,162,51,34,36,36,34,51,162,2,34,36,50,2,50,36,34,1,2,157,151,107,107,35,36,50,2,
+50,36,35,35,35,51,254,218,35,36,50,2,51,34,36,131,0,0,0,255,255,0,100,0,0,4,97,6,26,2,2,0,101,0,0,0,3,0,160,255,243,9,143,6,110,0,10,0,63,0,86,0,0,0,53,52,39,38,39,33,17,33,54,55,1,34,39,38,3,17,35,6,7,6,35,33,17,35,17,33,21,22,23,22,23,51,17,55,17,33,
+54,59,1,4,19,7,38,35,34,7,6,7,21,20,23,22,23,22,23,22,21,20,7,6,7,6,7,55,50,55,54,55,54,53,52,39,38,39,38,39,38,53,52,55,35,17,22,23,22,23,3,126,53,53,73,254,191,1,65,73,53,2,214,211,66,122,1,73,27,94,96,193,254,222,234,2,74,138,116,113,3,71,233,1,108,
+79,99,21,1,110,64,236,35,176,68,59,64,2,65,46,166,195,81,121,2,14,158,123,163,5,63,51,72,18,5,71,31,166,183,82,137,10,121,5,34,20,136,3,215,139,139,60,58,3,253,248,3,58,252,88,44,79,1,22,2,39,114,87,108,253,138,6,87,1,2,132,126,205,1,88,145,254,23,25,
+11,254,175,29,165,31,32,49,3,57,27,18,44,50,60,88,148,17,17,164,94,75,9,222,19,27,49,16,14,53,35,15,43,46,54,91,165,82,21,253,198,123,20,11,6,0,1,0,100,0,0,5,56,6,26,0,89,0,0,1,21,20,23,33,50,23,22,29,1,20,7,6,35,33,22,23,22,51,50,55,54,51,50,23,22,29,
+1,20,7,6,35,32,39,38,39,35,34,39,38,61,1,52,55,54,59,1,53,35,34,39,38,61,1,52,55,54,59,1,54,55,54,33,50,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,7,33,50,23,22,29,1,20,7,6,35,2,2,1,1,148,36,27,26,26,27,36,254,160,44,134,137,169,68,66,16,16,38,34,47,91,
+95,99,254,247,209,207,65,117,36,27,25,26,26,36,82,82,36,27,25,26,26,36,111,58,209,214,1,15,99,95,91,47,34,38,16,17,65,68,174,141,139,40,1,172,36,26,26,25,26,37,3,26,13,31,6,25,27,36,23,36,26,27,111,93,95,16,4,25,36,60,2,94,24,24,160,158,226,26,27,36,
+23,36,26,26,50,26,27,36,23,36,26,26,235,166,167,24,24,93,3,58,38,25,4,17,102,101,121,26,26,36,23,36,26,27,0,0,4,0,160,0,0,8,196,6,87,0,11,0,15,0,31,0,47,0,0,1,0,23,17,51,17,35,0,39,17,35,17,1,53,33,21,1,52,55,54,51,50,23,22,21,20,7,6,35,34,39,38,55,20,
+23,22,51,50,55,54,53,52,39,38,35,34,7,6,1,144,2,35,123,253,240,253,222,124,253,4,242,3,18,252,231,129,115,169,167,117,128,128,117,167,169,115,129,242,55,47,68,68,47,55,55,47,68,68,47,55,6,87,252,104,235,4,131,249,169,3,154,241,251,117,6,87,249,170,235,
+235,3,39,217,129,117,117,129,217,216,128,117,117,128,217,105,60,51,51,60,105,104,61,51,51,61,0,0,1,0,20,3,170,4,194,6,87,0,18,0,0,1,35,17,35,17,35,53,33,27,1,51,17,35,17,3,35,3,17,35,2,64,204,147,205,2,220,145,145,176,141,126,108,126,141,5,212,253,214,
+2,42,131,254,98,1,158,253,83,1,140,254,154,1,102,254,116,0,0,0,0,2,0,123,0,95,3,197,5,187,0,15,0,65,0,0,1,6,7,6,7,6,21,20,23,22,51,50,55,54,55,54,55,6,7,6,7,6,7,6,35,34,39,38,53,52,55,54,55,54,55,53,52,39,38,35,34,7,6,7,6,7,6,35,34,39,38,39,38,53,52,
+55,54,55,54,51,50,23,22,17,20,7,3,3,164,124,152,18,3,50,23,28,51,68,131,58,38,207,2,2,14,52,81,188,113,101,74,67,147,4,28,215,174,235,24,30,63,45,54,47,28,17,36,16,16,20,20,34,13,6,9,30,53,118,142,92,70,141,1,3,33,10,70,86,164,29,24,95,28,12,40,78,158,
+105,226,38,33,184,140,220,112,68,37,80,206,35,38,249,131,107,11,52,96,63,81,54,47,60,35,13,6,9,16,37,17,16,19,19,65,63,140,52,106,254,244,97,43,0,0,0,0,2,0,105,0,180,4,199,5,130,0,18,0,21,0,0,1,54,51,50,23,1,22,21,20,7,6,35,33,34,39,38,53,52,55,37,9,
+1,2,86,19,47,47,19,1,230,7,12,21,39,252,51,39,22,12,6,3,95,254,202,254,201,5,87,43,43,251,195,16,15,20,18,33,33,19,20,14,15,88,2,182,253,74,0,0,1,0,100,255,70,5,25,6,28,0,29,0,0,1,33,17,20,7,6,35,34,39,38,53,17,52,55,54,51,33,50,23,22,21,17,20,7,6,35,
+34,39,38,53,4,94,252,193,28,28,38,39,26,28,28,26,39,3,250,40,26,28,28,26,40,39,26,28,5,97,250,66,39,26,28,28,26,39,6,27,38,28,28,28,28,38,249,229,39,26,28,28,26,39,0,0,0,1,0,110,255,126,5,49,6,26,0,39,0,0,9,1,22,21,20,7,1,33,50,23,22,21,20,7,6,35,33,
+34,39,38,53,52,55,9,1,38,53,52,55,54,51,33,50,23,22,21,20,7,6,35,1,141,1,219,23,23,254,37,3,71,39,28,26,27,27,39,251,248,57,27,10,22,2,36,253,220,22,10,27,57,4,8,39,28,26,27,27,39,5,95,253,167,29,29,29,29,253,167,28,28,38,38,27,28,53,21,20,30,28,2,182,
+2,182,27,30,21,21,53,28,28,38,38,27,28,0,1,0,50,2,147,3,134,3,136,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,134,36,36,50,253,159,51,34,36,36,34,51,2,97,50,36,36,3,12,51,34,36,36,34,51,2,50,36,36,36,36,50,0,0,1,0,106,0,1,4,94,
+6,148,0,41,0,0,1,54,55,54,51,50,23,22,23,22,21,20,7,3,6,7,6,35,34,39,1,7,6,35,34,39,38,39,38,53,52,55,54,63,1,54,51,50,23,22,23,19,3,165,6,32,25,29,7,8,39,22,17,1,241,10,68,9,9,54,26,254,171,124,18,18,18,18,36,14,7,7,15,35,206,18,17,17,16,35,17,250,6,
+70,37,23,18,1,6,32,25,29,8,8,250,40,66,11,1,53,2,186,52,7,7,15,37,18,17,18,18,35,15,85,7,6,13,34,254,0,0,0,0,3,0,100,1,208,4,151,4,82,0,24,0,40,0,49,0,0,0,51,50,23,22,21,20,7,6,35,34,39,6,35,34,39,38,53,52,55,54,55,51,50,23,22,23,22,51,50,55,54,53,52,
+39,38,35,34,7,6,7,39,38,43,1,6,21,20,51,50,2,208,172,154,69,60,68,76,146,169,120,95,156,124,65,56,59,64,116,10,150,99,138,33,55,61,56,27,42,30,23,65,44,37,50,73,176,81,85,1,80,80,92,4,82,90,77,154,147,83,91,162,113,85,73,121,114,71,78,6,123,225,32,52,
+22,32,102,107,27,21,22,30,108,1,115,4,100,114,0,0,0,1,0,7,255,12,2,151,6,27,0,67,0,0,0,39,38,53,6,7,6,7,6,17,16,7,6,7,6,7,6,7,6,35,34,39,38,39,38,53,52,55,54,55,54,51,50,23,22,23,22,21,54,55,54,55,54,17,16,55,54,55,54,55,54,55,54,51,50,23,22,23,22,21,
+20,7,6,7,6,35,34,39,1,241,37,9,7,7,6,3,1,1,2,7,10,23,44,109,10,10,69,77,36,15,7,7,14,36,18,18,17,17,38,36,10,6,7,6,3,1,1,2,7,11,23,44,108,10,10,70,77,35,16,8,8,15,35,18,18,17,17,5,93,3,1,5,12,96,89,142,49,254,177,254,177,51,151,95,134,45,84,7,1,31,15,
+35,18,18,18,18,36,15,7,6,15,3,1,6,12,97,89,142,49,1,78,1,80,51,151,95,134,45,84,7,1,31,15,35,18,19,18,18,35,15,7,6,0,0,0,2,0,102,1,205,4,132,4,3,0,35,0,71,0,0,0,51,50,23,22,51,50,55,54,59,1,22,23,22,29,1,6,7,6,35,34,39,38,35,34,7,6,43,1,38,39,38,61,1,
+54,55,22,51,50,23,22,51,50,55,54,59,1,22,23,22,29,1,6,7,6,35,34,39,38,35,34,7,6,43,1,38,39,38,61,1,54,55,1,15,167,81,132,164,29,72,87,26,35,8,39,23,22,3,31,138,140,61,195,101,49,97,86,26,33,8,39,25,22,3,29,137,167,81,131,165,29,72,87,26,33,8,41,23,22,
+5,29,138,140,61,196,100,49,97,86,26,33,8,39,25,22,3,29,4,3,48,59,72,22,5,29,26,33,8,39,25,116,71,36,73,22,3,30,26,33,8,38,27,155,48,59,72,22,3,31,26,34,8,38,25,116,71,36,72,22,3,29,25,35,8,39,25,0,0,0,2,0,100,0,231,4,33,5,47,0,17,0,49,0,0,1,50,23,22,
+21,20,7,6,35,33,34,39,38,53,52,55,54,51,37,22,23,22,21,20,7,6,7,6,35,34,39,1,38,53,52,55,1,54,51,50,23,22,23,22,21,20,7,6,7,5,3,196,39,26,28,28,26,39,252,253,39,26,28,28,26,39,3,39,35,15,7,7,15,36,18,18,18,18,252,254,57,57,3,2,18,18,18,18,36,15,7,7,15,
+35,253,202,1,162,28,26,39,40,26,28,28,26,40,39,26,28,254,15,36,18,18,18,18,35,15,7,7,1,68,25,62,62,24,1,68,7,7,15,35,18,18,18,18,36,15,237,0,2,0,100,0,231,4,33,5,48,0,17,0,49,0,0,1,50,23,22,21,20,7,6,35,33,34,39,38,53,52,55,54,51,1,37,38,39,38,53,52,
+55,54,55,54,51,50,23,1,22,21,20,7,1,6,35,34,39,38,39,38,53,52,55,54,55,3,196,39,28,26,26,28,39,252,253,39,26,28,28,26,39,2,18,253,203,36,14,7,7,15,36,18,17,18,18,3,2,57,57,252,254,18,18,17,18,36,15,7,7,14,36,1,162,28,27,38,39,27,28,28,26,40,39,26,28,
+1,236,237,15,36,18,18,18,18,35,15,8,8,254,188,24,62,62,25,254,188,7,7,15,35,18,18,18,18,36,15,0,0,0,255,255,0,100,0,0,4,75,6,26,0,34,0,73,0,0,0,3,0,76,2,187,0,0,255,255,0,100,0,0,4,60,6,26,0,34,0,73,0,0,0,3,0,79,2,187,0,0,0,2,0,40,2,49,3,44,6,27,0,17,
+0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,2,74,111,115,115,111,160,160,111,115,115,111,160,63,46,45,45,46,63,62,48,44,44,48,62,6,27,103,106,145,254,219,146,106,103,103,106,146,1,37,
+145,106,103,214,42,42,60,254,227,60,43,41,43,41,60,1,29,60,40,44,0,1,0,40,2,49,1,201,6,26,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,59,1,50,23,22,21,1,201,35,33,47,2,48,31,36,70,46,35,34,34,35,46,187,47,35,33,2,153,42,33,29,29,33,
+42,2,175,29,32,43,1,43,31,31,31,31,43,0,1,0,40,2,49,3,11,6,26,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,35,33,34,39,38,61,1,52,55,54,51,1,193,135,92,96,92,53,128,120,41,61,1,
+130,49,34,33,34,33,49,254,4,48,33,34,91,60,124,144,23,58,27,27,37,254,251,48,34,34,34,33,49,6,26,85,89,122,109,87,49,74,68,37,56,14,32,31,42,2,44,29,31,31,29,44,57,122,98,65,73,85,17,45,39,36,25,25,30,31,43,1,43,31,31,0,1,0,40,2,49,2,163,6,26,0,60,0,
+0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,1,81,134,95,94,64,79,101,96,141,182,48,33,34,35,32,48,182,43,32,30,30,32,43,
+153,49,32,34,32,34,49,153,37,27,26,27,26,37,182,46,35,34,34,35,46,6,26,87,87,122,138,49,55,153,128,93,89,31,29,44,2,42,33,30,28,29,42,42,29,28,30,32,43,1,42,31,31,1,24,25,36,36,25,25,29,32,43,1,43,31,31,0,0,0,2,0,40,2,49,3,99,6,26,0,38,0,41,0,0,1,54,
+59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,37,17,3,1,143,33,69,97,47,35,34,38,48,35,32,35,33,47,38,34,35,47,1,47,35,34,254,186,48,33,34,13,1,172,154,5,227,55,31,31,43,254,1,32,31,42,2,42,33,29,
+70,44,30,30,30,30,44,70,31,29,44,42,27,23,15,1,1,254,255,0,1,0,40,2,49,2,241,6,26,0,49,0,0,19,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,21,51,50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,155,48,33,34,34,
+35,46,1,141,46,35,34,34,35,46,254,232,143,140,99,99,101,97,140,254,252,48,33,34,35,32,48,1,4,43,31,31,31,31,43,3,202,31,31,43,1,126,43,31,31,31,31,43,1,43,32,29,172,91,90,128,128,93,89,31,29,44,2,42,33,30,28,29,42,42,29,28,0,0,0,0,2,0,40,2,49,3,33,6,
+26,0,14,0,49,0,0,1,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,29,1,51,50,23,22,21,20,7,6,35,1,16,31,32,42,86,43,31,31,31,31,43,86,140,96,101,99,98,140,199,47,35,34,34,35,47,199,42,34,29,191,
+140,99,99,101,97,140,3,202,99,42,29,28,28,29,42,42,29,28,254,103,89,93,128,1,125,128,90,92,31,31,43,1,43,32,29,31,27,42,72,91,90,128,128,93,89,0,0,0,1,0,40,2,49,2,199,6,26,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,50,23,22,
+21,2,199,35,33,47,1,49,33,34,254,188,46,35,34,34,35,46,1,185,47,35,33,2,153,42,33,29,31,29,44,2,175,29,32,43,1,43,31,31,31,31,43,0,0,0,3,0,40,2,49,3,44,6,26,0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,
+50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,1,219,134,94,95,64,78,98,98,141,98,140,96,101,79,64,96,92,134,98,43,33,29,32,30,43,98,42,34,29,31,32,42,98,37,27,26,27,27,36,98,36,27,27,27,27,36,6,26,
+87,87,122,138,49,56,152,128,91,91,89,93,128,153,55,49,138,122,89,85,252,234,30,27,42,41,30,28,30,28,41,42,29,28,1,153,24,25,36,36,25,25,25,25,36,36,25,24,0,0,0,0,2,0,40,2,49,3,33,6,26,0,14,0,49,0,0,1,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,
+21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,61,1,35,34,39,38,53,52,55,54,51,2,56,30,32,43,86,42,34,29,29,34,42,86,140,99,99,101,97,140,255,49,32,34,32,34,49,255,43,31,31,191,140,96,101,99,98,140,4,129,99,42,27,31,31,27,42,42,27,30,1,153,92,
+90,128,254,131,128,93,89,29,33,42,2,42,31,32,28,29,42,71,90,93,127,128,90,92,0,0,0,1,0,40,2,101,3,29,5,28,0,43,0,0,1,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,35,34,39,38,61,1,52,55,54,59,1,53,52,55,54,59,1,50,23,22,21,2,23,146,49,32,
+35,34,33,49,146,36,31,49,1,49,34,32,148,49,32,34,33,33,49,148,32,34,49,1,49,33,34,4,42,30,33,43,1,44,29,31,137,43,33,29,31,31,43,137,31,29,44,1,43,31,32,137,43,30,32,31,31,43,0,0,0,0,1,0,40,2,181,2,155,3,136,0,19,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,
+54,51,33,50,23,22,21,2,155,34,33,49,254,116,49,33,33,33,33,49,1,140,49,31,36,3,30,43,31,31,32,29,44,1,44,29,32,30,31,44,0,0,2,0,40,2,80,3,29,4,140,0,19,0,39,0,0,1,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,
+55,54,51,33,50,23,22,21,3,29,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,2,185,43,31,31,32,29,44,1,44,29,32,30,31,44,1,104,43,31,31,32,29,44,1,44,29,32,30,31,44,0,2,0,40,1,214,1,39,6,25,0,19,0,35,
+0,0,19,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,55,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,168,49,34,32,32,34,49,1,49,33,34,35,32,49,1,53,36,39,39,35,54,53,36,38,38,36,4,202,32,31,43,253,223,43,30,32,32,29,44,2,33,43,33,30,104,32,36,48,
+47,35,33,34,34,47,48,34,34,0,0,0,0,1,0,40,1,61,1,229,6,28,0,39,0,0,18,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,212,86,86,86,86,132,15,14,38,31,43,26,24,40,54,37,38,38,37,54,40,24,26,43,
+31,38,14,15,1,91,97,99,125,2,33,125,99,97,27,3,23,31,51,5,36,32,26,8,11,40,41,51,253,231,51,41,40,11,8,26,31,37,5,50,32,23,3,0,0,0,0,1,0,40,1,61,1,229,6,28,0,39,0,0,19,6,35,34,39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,38,39,38,39,38,61,1,52,55,54,51,
+50,23,22,23,22,21,17,20,7,6,181,15,14,37,32,43,26,24,40,55,37,37,37,37,55,40,24,26,43,32,37,14,15,132,86,86,86,86,1,64,3,23,32,50,5,37,31,26,8,11,40,41,51,2,25,51,41,40,11,8,26,32,36,5,51,31,23,3,27,97,99,125,253,223,125,99,97,0,0,0,0,1,0,40,3,39,2,230,
+6,26,0,37,0,0,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,16,34,33,48,2,48,33,34,105,100,146,146,100,105,34,33,49,1,47,35,34,34,36,48,49,35,35,3,143,44,29,31,31,29,44,1,73,132,97,93,93,97,
+132,254,183,44,29,31,30,30,44,1,73,46,33,32,32,33,46,0,2,0,40,254,41,3,44,2,19,0,17,0,35,0,0,0,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,51,6,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,35,2,74,111,115,115,111,160,160,111,115,115,111,160,63,46,
+45,45,46,63,62,48,44,44,48,62,2,19,103,106,145,254,219,146,106,103,103,106,146,1,37,145,106,103,214,42,42,60,254,227,60,43,41,43,41,60,1,29,60,40,44,0,1,0,40,254,41,1,201,2,19,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,59,1,50,23,
+22,21,1,201,35,32,48,2,48,31,36,70,46,35,34,34,35,46,187,47,35,33,254,146,43,32,30,30,31,44,2,174,31,31,43,1,43,31,31,31,31,43,0,1,0,40,254,41,3,11,2,19,0,50,0,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,
+54,55,54,53,52,39,38,35,33,34,39,38,61,1,52,55,54,51,1,193,135,92,96,92,53,128,120,41,61,1,130,49,33,34,34,33,49,254,4,48,33,34,91,60,124,143,24,58,27,27,37,254,251,49,33,34,34,33,49,2,19,86,88,122,109,87,49,74,69,37,55,15,31,31,43,1,44,29,32,32,29,44,
+56,122,98,66,72,86,17,45,39,35,25,25,31,31,43,1,43,31,31,0,1,0,40,254,41,2,163,2,19,0,60,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,55,50,55,54,53,52,39,38,43,1,34,39,38,61,
+1,52,55,54,51,1,81,134,95,94,64,79,101,96,141,182,48,33,34,36,31,48,182,43,32,30,31,31,43,153,49,31,35,32,34,49,153,38,26,26,27,26,37,182,46,35,34,34,35,46,2,19,88,86,122,139,49,55,153,127,93,90,32,29,44,1,43,33,29,28,29,42,42,29,29,29,32,43,1,43,31,
+31,1,23,25,37,35,25,25,31,31,43,1,43,31,31,0,0,0,2,0,40,254,41,3,99,2,19,0,38,0,41,0,0,1,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,20,7,6,43,1,34,39,38,61,1,33,34,39,38,61,1,52,55,37,17,3,1,143,33,69,97,47,35,34,38,47,35,33,35,32,48,38,34,
+34,48,1,48,34,34,254,186,48,33,34,13,1,172,154,1,219,56,31,31,43,254,0,31,31,43,1,43,32,30,69,44,29,32,32,29,44,69,32,29,44,42,26,23,15,1,2,254,254,0,1,0,40,254,41,2,241,2,19,0,49,0,0,23,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,21,51,
+50,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,35,155,48,33,34,34,35,46,1,141,46,35,34,34,35,46,254,232,143,140,99,99,101,97,140,254,252,48,33,34,36,31,48,1,4,43,31,31,32,30,43,61,31,29,44,1,127,43,31,31,31,31,43,1,43,31,31,
+171,91,91,128,127,93,90,32,29,44,1,43,33,29,28,29,42,42,29,29,0,2,0,40,254,41,3,33,2,19,0,14,0,49,0,0,5,21,20,23,22,59,1,50,55,54,53,52,39,38,35,3,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,29,1,51,50,23,22,21,20,7,6,35,1,16,31,32,
+42,86,43,31,31,32,30,43,86,140,96,101,99,98,140,199,47,35,34,34,35,47,199,42,34,29,191,140,99,99,101,97,140,61,100,42,29,28,28,29,42,42,29,29,254,102,90,93,127,1,126,128,90,92,31,31,43,1,43,31,31,30,27,42,72,91,91,128,127,93,90,0,0,0,0,1,0,40,254,41,
+2,199,2,19,0,25,0,0,1,20,7,6,43,1,34,39,38,53,17,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,199,35,32,48,1,49,33,34,254,188,46,35,34,34,35,46,1,185,47,35,33,254,146,43,32,30,32,29,44,2,174,31,31,43,1,43,31,31,31,31,43,0,0,0,3,0,40,254,41,3,44,2,19,
+0,25,0,43,0,61,0,0,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,52,55,38,53,52,55,54,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,55,54,53,52,39,38,43,1,34,7,6,21,20,23,22,51,1,219,134,94,95,64,78,98,98,141,98,140,96,101,79,64,96,92,
+134,98,43,33,29,32,30,43,98,42,34,29,31,32,42,98,38,26,26,27,27,36,98,36,27,27,27,26,37,2,19,88,86,122,139,49,56,152,127,91,92,90,93,127,153,55,49,139,122,88,86,252,233,30,27,42,42,29,29,31,27,42,42,29,28,1,154,23,25,37,35,25,25,25,25,35,37,25,23,0,0,
+0,0,2,0,40,254,41,3,33,2,19,0,14,0,49,0,0,37,53,52,39,38,43,1,34,7,6,21,20,23,22,51,19,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,61,1,35,34,39,38,53,52,55,54,51,2,56,29,33,43,86,42,34,29,29,34,42,86,140,99,99,101,97,140,255,49,32,
+34,32,34,49,255,43,31,31,191,140,96,101,99,98,140,121,100,42,27,30,30,27,42,42,27,31,1,154,92,90,128,254,130,127,93,90,30,32,43,1,43,31,31,28,29,42,72,90,92,128,128,90,92,0,0,0,0,1,0,40,254,194,3,29,1,122,0,43,0,0,37,51,50,23,22,29,1,20,7,6,43,1,21,20,
+7,6,43,1,34,39,38,61,1,35,34,39,38,61,1,52,55,54,59,1,53,52,55,54,59,1,50,23,22,21,2,23,146,49,31,36,34,33,49,146,35,32,49,1,49,34,32,148,49,33,33,33,33,49,148,32,34,49,1,49,33,34,135,29,33,43,1,44,29,32,136,43,33,30,32,31,43,136,32,29,44,1,43,31,31,
+138,43,30,32,32,29,44,0,1,0,40,255,181,2,155,0,136,0,19,0,0,37,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,155,34,33,49,254,116,49,32,34,33,33,49,1,140,49,32,35,29,44,29,31,31,29,44,1,43,31,32,30,33,43,0,0,0,2,0,40,255,50,3,29,1,10,0,19,0,
+39,0,0,5,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,17,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,29,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,34,33,49,253,242,49,33,33,33,33,49,2,14,49,31,36,101,43,31,31,32,29,44,1,44,
+29,32,30,31,44,1,4,43,31,31,32,29,44,1,44,29,32,30,31,44,0,0,1,0,40,254,99,1,229,3,66,0,39,0,0,18,39,38,53,17,52,55,54,55,54,51,50,23,22,29,1,20,7,6,7,6,7,6,21,17,20,23,22,23,22,23,22,29,1,20,7,6,35,34,39,212,85,87,86,86,132,15,14,37,32,43,26,24,40,54,
+37,38,38,37,54,40,24,26,43,31,38,14,15,254,129,97,98,126,2,33,125,99,97,27,3,24,31,50,5,37,31,26,8,12,39,42,50,253,230,50,41,40,11,8,26,32,36,6,49,32,23,3,0,0,0,0,1,0,40,254,99,1,229,3,66,0,39,0,0,19,6,35,34,39,38,61,1,52,55,54,55,54,55,54,53,17,52,39,
+38,39,38,39,38,61,1,52,55,54,51,50,23,22,23,22,21,17,20,7,6,181,15,14,37,32,43,26,24,40,55,37,37,37,37,55,40,24,26,43,32,38,14,14,132,86,86,87,85,254,102,3,23,32,49,6,36,32,26,8,11,40,41,51,2,25,50,42,39,12,8,26,31,37,5,50,31,24,3,27,97,99,125,253,223,
+126,98,97,0,0,0,0,2,0,70,0,0,3,133,4,232,0,30,0,41,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,3,133,31,35,52,2,52,35,31,254,158,32,35,51,3,51,35,32,118,123,174,176,122,118,238,
+56,51,71,70,51,55,113,44,32,37,37,32,44,1,73,254,183,44,32,37,37,32,44,2,209,172,123,127,127,123,172,164,164,83,57,54,54,57,83,164,0,0,3,0,70,0,0,3,95,4,232,0,12,0,35,0,48,0,0,1,51,50,55,54,53,52,39,38,43,1,6,21,35,52,55,54,59,1,50,23,22,21,20,7,22,21,
+20,7,6,43,1,34,39,38,53,5,50,55,54,53,52,39,38,43,1,17,20,23,1,53,178,47,34,39,39,34,46,171,8,239,66,71,102,179,152,102,104,90,107,109,108,158,179,102,68,69,1,162,53,39,44,44,39,53,179,3,2,248,35,40,59,58,39,37,3,8,96,70,73,107,108,147,167,78,84,185,
+154,114,112,70,73,96,11,41,45,66,66,45,41,254,219,8,3,0,0,0,1,0,70,0,0,3,157,4,232,0,41,0,0,0,23,22,29,1,20,7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,2,250,77,86,42,34,40,17,17,45,47,151,112,
+111,113,110,151,47,45,17,17,40,34,42,86,77,79,254,255,177,179,179,177,1,1,4,232,20,24,85,2,52,34,28,5,12,117,114,169,169,118,113,12,5,28,34,52,2,86,23,20,184,187,1,1,1,1,186,185,0,0,0,0,2,0,70,0,0,4,12,4,232,0,14,0,33,0,0,37,20,23,51,50,55,54,53,52,39,
+38,43,1,6,21,55,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,55,54,51,1,53,3,110,153,109,114,111,112,153,104,9,113,1,1,178,179,179,178,254,255,113,102,68,69,66,71,102,239,8,3,113,118,169,169,114,117,3,8,239,185,186,254,255,254,255,187,184,70,73,96,3,10,
+96,70,73,0,0,0,1,0,70,0,0,2,245,4,232,0,51,0,0,1,33,50,23,22,29,1,20,7,6,35,33,21,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,1,53,1,74,50,36,32,32,36,50,254,182,19,21,22,1,12,52,32,34,
+31,35,52,254,244,128,86,87,87,86,128,1,12,52,35,31,34,32,52,254,244,23,20,19,2,230,36,33,44,2,44,33,36,211,34,19,22,33,36,44,2,44,32,37,89,91,123,2,137,123,91,90,37,32,44,2,44,36,34,21,20,34,0,1,0,70,0,0,2,208,4,232,0,41,0,0,1,33,50,23,22,29,1,20,7,6,
+35,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,21,1,53,1,29,50,36,32,31,35,52,254,227,32,35,51,3,51,35,32,87,86,128,231,50,36,32,32,36,50,231,22,21,19,2,230,36,33,44,2,44,32,37,254,111,44,32,37,37,32,44,3,71,123,91,
+90,36,33,44,2,44,33,36,22,19,35,0,0,0,0,1,0,70,0,0,5,17,4,232,0,55,0,0,0,23,22,29,1,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,7,6,33,32,39,38,17,16,55,54,33,3,187,184,27,6,40,2,31,
+37,8,8,46,32,111,162,151,112,111,113,110,151,137,104,106,16,254,168,52,33,33,30,37,51,1,220,51,37,30,1,176,181,254,255,254,255,177,179,179,177,1,1,4,232,206,33,41,11,48,31,1,23,1,4,35,126,117,114,169,169,118,113,93,95,98,34,35,44,2,44,33,36,36,33,44,
+1,254,255,184,187,184,187,1,1,1,1,186,185,0,0,1,0,70,0,0,3,140,4,232,0,43,0,0,19,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,191,50,36,32,1,104,32,36,51,2,50,36,32,32,35,51,
+2,52,35,32,254,152,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,254,111,1,145,44,33,36,36,33,44,251,250,44,32,37,37,32,44,1,145,254,111,44,32,37,37,32,44,4,6,44,33,36,0,1,0,70,0,0,1,53,4,232,0,19,0,0,19,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,
+54,51,191,50,36,32,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,251,250,44,32,37,37,32,44,4,6,44,33,36,0,0,0,1,0,70,0,0,2,116,4,232,0,29,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,1,134,31,35,53,1,51,37,30,87,
+86,128,139,51,35,32,35,33,50,139,23,21,19,4,119,44,33,36,36,33,44,252,184,123,91,89,37,32,44,2,44,36,33,22,19,34,0,0,0,1,0,70,0,0,3,83,4,232,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,20,7,22,23,22,29,1,20,7,6,43,1,34,39,
+38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,191,50,36,32,50,88,64,68,1,34,32,52,3,50,36,32,138,54,57,59,33,33,52,2,52,33,33,1,66,67,87,83,32,35,51,3,51,35,32,32,36,50,4,232,36,33,44,254,150,66,70,102,124,44,36,33,36,33,44,124,233,
+105,34,105,106,123,200,44,35,34,34,35,44,200,101,67,70,254,74,44,32,37,37,32,44,4,6,44,33,36,0,0,1,0,70,0,0,2,197,4,232,0,29,0,0,1,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,19,21,22,219,51,33,35,33,34,52,219,
+128,86,87,32,36,50,3,50,36,32,1,47,34,19,22,33,36,44,2,45,31,37,89,91,123,3,72,44,33,36,36,33,44,0,0,0,1,0,70,0,0,5,104,4,232,0,60,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,
+21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,1,53,32,35,51,3,51,35,32,113,111,164,195,74,74,195,164,112,112,33,33,52,1,53,35,31,45,46,59,59,46,44,32,34,53,1,53,35,31,45,46,59,58,46,45,113,44,32,37,37,32,44,2,237,160,118,116,101,101,116,118,
+160,253,19,44,35,34,37,32,44,2,237,72,46,48,48,46,72,253,19,45,31,37,37,32,44,2,237,72,46,48,48,46,72,0,0,0,0,1,0,70,0,0,3,133,4,232,0,37,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,3,
+133,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,118,123,174,176,122,118,113,44,32,37,37,32,44,2,209,83,57,54,54,57,83,253,47,44,32,37,37,32,44,2,209,172,123,127,127,123,172,0,0,2,0,70,0,0,5,17,4,232,0,15,0,31,0,0,0,23,22,17,16,7,6,33,32,
+39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,3,172,181,176,176,181,254,255,254,255,177,179,179,177,1,1,151,112,111,113,110,151,153,109,114,111,112,153,4,232,188,183,254,255,254,255,184,187,184,187,1,1,1,1,186,185,228,117,114,169,
+169,118,113,113,118,169,169,114,117,0,0,2,0,70,0,0,3,154,4,232,0,13,0,37,0,0,1,51,50,55,54,53,52,39,38,35,34,7,6,21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,1,53,187,74,57,56,58,55,74,75,54,58,32,35,51,3,51,35,32,121,126,179,
+180,122,124,122,124,180,2,106,60,57,88,87,61,57,57,61,87,254,79,254,235,44,32,37,37,32,44,2,198,177,126,130,127,129,177,176,127,130,0,0,0,2,0,70,255,46,5,17,4,232,0,26,0,53,0,0,0,23,22,17,20,7,6,7,21,20,7,6,43,1,34,39,38,61,1,38,39,38,53,16,55,54,33,
+19,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,3,172,181,176,152,154,188,32,36,51,1,53,32,34,188,154,152,179,177,1,1,1,52,32,35,73,90,93,111,112,153,151,112,111,93,89,73,31,35,53,4,232,188,183,254,255,237,177,179,24,108,
+44,33,36,33,36,44,108,24,179,178,236,1,1,186,185,253,10,34,35,44,142,13,108,114,150,169,114,117,117,114,169,151,113,108,13,142,44,32,37,0,2,0,70,0,0,3,122,4,232,0,16,0,58,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,35,17,20,7,6,43,
+1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,1,232,64,48,52,52,48,64,87,42,23,21,5,2,1,88,52,44,55,193,33,33,52,2,52,35,31,92,92,136,98,170,118,114,118,8,9,117,32,35,51,2,51,35,32,2,154,49,54,77,78,54,49,23,22,
+30,9,17,254,252,254,103,78,53,47,3,254,187,44,35,34,37,32,44,3,52,130,97,96,124,119,167,166,122,5,7,122,167,144,44,32,37,37,32,44,0,0,0,1,0,70,0,0,3,74,4,236,0,53,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,
+54,53,52,39,38,39,38,39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,1,187,50,39,38,59,27,147,136,64,93,105,108,155,254,226,51,33,34,34,33,51,1,38,49,38,40,61,30,144,136,62,94,107,105,156,202,52,33,33,30,37,51,4,6,42,39,61,72,35,16,44,42,61,88,157,152,
+109,112,34,36,43,5,43,36,34,38,42,62,70,38,19,47,46,58,88,149,151,112,109,34,35,44,4,44,33,36,0,0,1,0,70,0,0,3,88,4,232,0,31,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,3,88,34,32,53,155,33,33,52,2,52,33,
+33,156,50,36,32,32,36,50,2,37,53,32,34,4,117,44,36,33,252,109,44,35,34,34,35,44,3,147,36,33,44,2,44,33,36,33,36,44,0,1,0,70,0,0,3,133,4,232,0,37,0,0,1,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,
+22,21,3,133,118,122,176,174,123,118,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,1,166,172,123,127,127,123,172,2,209,44,33,36,36,33,44,253,47,83,58,53,53,58,83,2,209,44,33,36,36,33,44,0,1,0,78,0,0,3,247,4,232,0,25,0,0,1,19,54,59,1,50,23,
+22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,2,35,232,25,87,5,64,35,20,6,254,205,41,114,114,41,254,205,7,20,36,63,5,87,27,1,135,3,17,80,51,29,31,18,18,252,21,106,106,3,235,18,18,31,29,51,80,0,0,1,0,70,0,0,5,104,4,232,0,60,0,0,1,20,23,22,51,50,
+55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,45,46,58,59,46,45,32,36,51,1,53,32,34,44,46,59,59,46,45,34,32,53,1,51,37,30,112,112,164,
+195,74,74,195,164,111,113,32,36,50,3,50,36,32,1,138,72,46,48,48,46,72,2,237,44,33,36,33,36,44,253,19,72,46,48,48,46,72,2,237,44,36,33,36,33,44,253,19,161,117,116,100,100,116,117,161,2,237,44,33,36,36,33,44,0,0,0,1,0,70,0,0,3,133,4,232,0,67,0,0,37,20,
+7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,1,20,7,22,21,3,133,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,127,127,
+32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,126,126,113,44,32,37,37,32,44,236,83,58,54,54,58,83,236,44,32,37,37,32,44,236,213,95,96,213,177,44,33,36,36,33,44,177,84,57,54,54,57,84,177,44,33,36,36,33,44,177,213,96,95,213,0,1,0,70,0,0,3,133,
+4,232,0,48,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,3,133,93,95,108,32,35,51,2,52,35,32,108,94,94,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,
+36,32,3,28,150,117,117,22,254,235,44,32,37,37,32,44,1,21,22,117,116,151,1,91,44,33,36,36,33,44,254,165,84,57,53,53,57,84,1,91,44,33,36,36,33,44,0,0,0,1,0,70,0,0,3,117,4,232,0,35,0,0,19,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,
+39,38,53,52,55,1,33,34,39,38,53,103,30,37,51,1,209,80,52,53,28,254,14,1,166,52,35,31,31,35,52,253,242,76,47,48,22,1,250,254,135,51,37,30,4,119,44,33,36,1,55,57,73,53,46,253,25,36,33,44,2,44,32,37,8,53,56,69,45,43,2,242,36,33,44,0,0,0,2,0,100,254,213,
+7,169,6,26,0,11,0,23,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,
+55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,4,0,70,254,207,7,139,6,20,0,30,0,41,0,53,0,65,0,0,37,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,7,53,52,39,38,35,34,7,6,29,1,8,1,17,16,0,33,32,0,17,16,0,
+33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,254,158,32,35,51,3,51,35,32,118,123,174,176,122,118,238,56,51,71,70,51,55,2,61,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,
+44,1,73,254,183,44,32,37,37,32,44,2,209,172,123,127,127,123,172,164,164,83,57,54,54,57,83,164,3,118,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,5,0,70,254,207,7,139,6,20,0,11,0,23,0,
+36,0,49,0,72,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,6,21,17,51,50,55,54,53,52,39,38,35,17,50,55,54,53,52,39,38,43,1,17,20,23,3,52,55,54,59,1,50,23,22,21,20,7,22,21,20,7,6,43,1,34,39,38,53,5,106,2,33,253,223,254,127,254,126,
+253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,63,2,178,47,34,39,39,34,46,53,39,44,44,39,53,179,3,242,66,71,102,179,152,102,104,90,107,109,108,158,179,102,68,69,6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,
+254,188,254,189,254,55,1,201,1,67,1,68,1,201,254,134,4,7,254,255,35,40,59,58,39,37,252,224,41,45,66,66,45,41,254,219,8,3,3,21,96,70,73,107,108,147,167,78,84,185,154,114,112,70,73,96,0,0,0,0,3,0,70,254,207,7,139,6,20,0,41,0,53,0,65,0,0,0,23,22,29,1,20,
+7,6,35,34,39,38,35,34,7,6,21,20,23,22,51,50,55,54,51,50,23,22,29,1,20,7,6,35,32,39,38,17,16,55,54,33,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,102,77,86,42,34,40,17,17,45,47,151,112,111,113,110,151,47,45,17,17,40,34,42,86,77,79,
+254,255,177,179,179,177,1,1,1,83,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,222,20,24,85,2,52,34,28,5,12,117,114,169,169,118,113,12,5,28,34,52,2,86,23,20,184,187,1,1,1,1,186,185,1,54,253,223,254,126,
+254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,4,0,70,254,207,7,139,6,20,0,11,0,23,0,38,0,57,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,6,21,17,20,23,51,50,55,54,53,52,39,
+38,35,53,32,23,22,17,16,7,6,33,35,34,39,38,53,17,52,55,54,51,5,106,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,43,2,3,110,153,109,114,111,112,153,1,1,178,179,179,178,254,255,113,102,68,69,66,71,102,
+6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,254,134,4,7,252,246,8,3,113,118,169,169,114,117,228,185,186,254,255,254,255,187,184,70,73,96,3,10,96,70,73,0,3,0,70,254,207,7,139,6,20,
+0,51,0,63,0,75,0,0,1,33,50,23,22,29,1,20,7,6,35,33,21,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,95,1,74,50,36,32,32,36,
+50,254,182,19,21,22,1,12,52,32,34,31,35,52,254,244,128,86,87,87,86,128,1,12,52,35,31,34,32,52,254,244,23,20,19,2,11,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,230,36,33,44,2,44,33,36,211,34,19,22,33,
+36,44,2,44,32,37,89,91,123,2,137,123,91,90,37,32,44,2,44,36,34,21,20,34,2,92,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,3,0,70,254,207,7,139,6,20,0,41,0,53,0,65,0,0,1,33,50,23,
+22,29,1,20,7,6,35,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,29,1,20,7,6,43,1,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,155,1,29,50,36,32,31,35,52,254,227,32,35,51,3,51,35,32,87,86,128,231,50,36,32,32,36,
+50,231,22,21,19,1,207,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,230,36,33,44,2,44,32,37,254,111,44,32,37,37,32,44,3,71,123,91,90,36,33,44,2,44,33,36,22,19,35,2,92,253,223,254,126,254,127,253,223,2,33,
+1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,55,0,67,0,79,0,0,0,23,22,29,1,6,15,1,6,35,34,39,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,33,34,39,38,61,1,52,55,54,51,33,50,23,22,23,21,16,
+7,6,33,32,39,38,17,16,55,54,33,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,255,184,27,6,40,2,31,37,8,8,46,32,111,162,151,112,111,113,110,151,137,104,106,16,254,168,52,33,33,30,37,51,1,220,51,37,30,1,176,181,254,255,254,255,177,179,
+179,177,1,1,1,123,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,222,206,33,41,11,48,31,1,23,1,4,35,126,117,114,169,169,118,113,93,95,98,34,35,44,2,44,33,36,36,33,44,1,254,255,184,187,184,187,1,1,1,1,186,
+185,1,54,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,43,0,55,0,67,0,0,1,50,23,22,21,17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,
+20,7,6,43,1,34,39,38,53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,173,50,36,32,1,104,32,36,51,2,50,36,32,32,35,51,2,52,35,32,254,152,32,35,51,3,51,35,32,32,36,50,2,192,2,33,253,223,254,127,254,126,253,223,2,33,1,
+130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,254,111,1,145,44,33,36,36,33,44,251,250,44,32,37,37,32,44,1,145,254,111,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,
+254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,19,0,31,0,43,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,231,50,36,32,32,35,51,3,51,35,32,32,36,50,1,134,2,
+33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,251,250,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,
+68,1,201,0,3,0,70,254,207,7,139,6,20,0,29,0,41,0,53,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,248,31,35,53,1,51,37,30,87,86,128,139,51,35,32,
+35,33,50,139,23,21,19,1,114,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,119,44,33,36,36,33,44,252,184,123,91,89,37,32,44,2,44,36,33,22,19,34,4,229,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,
+150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,58,0,70,0,82,0,0,1,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,20,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,
+53,17,52,55,54,51,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,232,50,36,32,50,88,64,68,1,34,32,52,3,50,36,32,138,54,57,59,33,33,52,2,52,33,33,1,66,67,87,83,32,35,51,3,51,35,32,32,36,50,2,133,2,33,253,223,254,127,254,126,253,223,2,
+33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,36,33,44,254,150,66,70,102,124,44,36,33,36,33,44,124,233,105,34,105,106,123,200,44,35,34,34,35,44,200,101,67,70,254,74,44,32,37,37,32,44,4,6,44,33,36,1,44,253,223,254,126,254,127,253,223,2,33,
+1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,3,0,70,254,207,7,139,6,20,0,29,0,41,0,53,0,0,1,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,
+16,0,33,32,0,17,16,0,3,173,19,21,22,219,51,33,35,33,34,52,219,128,86,87,32,36,50,3,50,36,32,1,189,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,47,34,19,22,33,36,44,2,45,31,37,89,91,123,3,72,44,33,36,36,
+33,44,1,157,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,60,0,72,0,84,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,54,51,50,23,22,21,17,20,7,6,43,
+1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,122,28,31,45,3,44,31,28,99,98,143,171,65,65,171,143,99,98,29,29,45,1,47,30,28,39,40,52,52,40,39,
+28,29,47,1,47,30,27,39,41,52,51,40,39,2,240,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,153,44,32,37,37,32,44,2,237,160,118,116,101,101,116,118,160,253,19,44,35,34,37,32,44,2,237,72,46,48,48,46,72,253,19,
+45,31,37,37,32,44,2,237,72,46,48,48,46,72,2,142,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,37,0,49,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,
+34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,118,123,174,176,122,118,19,2,33,253,223,254,127,254,126,253,
+223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,44,2,209,83,57,54,54,57,83,253,47,44,32,37,37,32,44,2,209,172,123,127,127,123,172,2,210,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,
+55,1,201,1,67,1,68,1,201,0,0,4,0,70,254,207,7,139,6,20,0,15,0,31,0,43,0,55,0,0,0,23,22,17,16,7,6,33,32,39,38,17,16,55,54,33,6,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,4,230,181,176,176,
+181,254,255,254,255,177,179,179,177,1,1,151,112,111,113,110,151,153,109,114,111,112,153,1,133,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,232,188,183,254,255,254,255,184,187,184,187,1,1,1,1,186,185,228,
+117,114,169,169,118,113,113,118,169,169,114,117,2,16,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,4,0,70,254,207,7,139,6,20,0,13,0,37,0,49,0,61,0,0,1,51,50,55,54,53,52,39,38,35,34,7,6,
+21,25,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,20,7,6,35,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,85,187,74,57,56,58,55,74,75,54,58,32,35,51,3,51,35,32,121,126,179,180,122,124,122,124,180,1,90,2,33,253,223,254,127,
+254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,106,60,57,88,87,61,57,57,61,87,254,79,254,235,44,32,37,37,32,44,2,198,177,126,130,127,129,177,176,127,130,4,142,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,
+254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,26,0,62,0,74,0,0,1,50,23,22,29,1,54,55,54,53,52,39,38,35,34,7,6,21,20,23,22,23,53,52,55,54,51,19,36,55,54,17,16,0,33,32,0,17,16,23,22,23,38,61,1,38,39,38,53,16,55,54,33,32,23,
+22,17,20,7,6,7,21,20,0,17,16,0,33,32,0,17,16,0,33,32,3,220,52,32,35,73,90,93,111,112,153,151,112,111,93,89,73,31,35,53,106,1,8,196,228,254,55,254,189,254,188,254,55,229,184,247,12,188,154,152,179,177,1,1,1,1,181,176,152,154,188,3,56,253,223,254,127,254,
+126,253,223,2,33,1,130,1,129,1,242,34,35,44,142,13,108,114,150,169,114,117,117,114,169,151,113,108,13,142,44,32,37,253,120,28,196,228,1,67,1,68,1,201,254,55,254,188,254,189,228,185,36,24,26,108,24,179,178,236,1,1,186,185,188,183,254,255,237,177,179,24,
+108,29,4,113,254,126,254,127,253,223,2,33,1,129,1,130,2,33,0,0,0,0,4,0,70,254,207,7,139,6,20,0,16,0,58,0,70,0,82,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,35,17,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,
+1,20,7,6,43,1,34,39,38,53,18,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,254,64,48,52,52,48,64,87,42,23,21,5,2,1,88,52,44,55,193,33,33,52,2,52,35,31,92,92,136,98,170,118,114,118,9,10,117,32,35,51,2,51,35,32,200,2,33,253,223,254,127,
+254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,2,154,49,54,77,78,54,49,23,22,30,9,17,254,252,254,103,78,53,47,3,254,187,44,35,34,37,32,44,3,52,130,97,96,124,119,167,166,122,5,7,122,167,144,44,32,37,37,32,44,5,163,253,223,254,126,
+254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,53,0,65,0,77,0,0,1,34,7,6,21,20,23,22,23,22,23,22,21,20,7,6,35,33,34,39,38,61,1,52,55,54,51,33,50,55,54,53,52,39,38,39,38,
+39,38,53,52,55,54,59,1,50,23,22,29,1,20,7,6,35,18,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,3,229,50,39,38,59,27,147,136,64,93,105,108,155,254,226,51,33,34,34,33,51,1,38,49,38,40,61,30,144,136,62,94,107,105,156,202,52,33,33,30,37,51,
+180,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,6,42,39,61,72,35,16,44,42,61,88,157,152,109,112,34,36,43,5,43,36,34,38,42,62,70,38,19,47,46,58,88,149,151,112,109,34,35,44,4,44,33,36,2,14,253,223,254,126,
+254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,31,0,43,0,55,0,0,1,20,7,6,43,1,17,20,7,6,43,1,34,39,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,21,2,0,17,16,0,33,32,0,
+17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,110,34,32,53,155,33,33,52,2,52,33,33,156,50,36,32,32,36,50,2,37,53,32,34,4,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,4,87,44,36,33,252,109,44,35,34,34,35,44,
+3,147,36,33,44,2,44,33,36,33,36,44,1,187,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,37,0,49,0,61,0,0,1,20,7,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,
+17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,135,118,122,176,174,123,118,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,2,50,36,32,29,2,33,253,223,254,127,254,126,253,223,2,33,
+1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,166,172,123,127,127,123,172,2,209,44,33,36,36,33,44,253,47,83,58,53,53,58,83,2,209,44,33,36,36,33,44,1,157,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,
+1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,11,0,23,0,49,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,19,54,59,1,50,23,22,21,20,7,1,6,35,34,39,1,38,53,52,55,54,59,1,50,23,5,106,2,33,253,223,254,127,254,126,253,223,2,33,1,130,
+254,188,254,55,1,201,1,68,1,67,1,201,254,55,254,199,231,26,87,5,64,35,20,6,254,204,40,114,115,40,254,204,6,19,37,63,5,87,27,6,20,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,252,9,3,17,
+80,51,29,32,17,18,252,21,106,106,3,235,18,18,31,29,51,80,0,3,0,70,254,207,7,139,6,20,0,60,0,72,0,84,0,0,1,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,6,35,34,39,6,35,34,39,38,53,
+17,52,55,54,59,1,50,23,22,21,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,151,37,39,48,49,39,37,26,30,43,1,44,26,29,36,39,49,49,39,37,28,27,44,1,43,30,25,94,93,136,163,61,61,163,136,93,94,26,30,42,3,42,30,26,2,211,2,33,253,223,254,
+127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,1,68,72,46,48,48,46,72,2,237,44,33,36,33,36,44,253,19,72,46,48,48,46,72,2,237,44,36,33,36,33,44,253,19,161,117,116,100,100,116,117,161,2,237,44,33,36,36,33,44,1,227,253,223,254,
+126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,3,0,70,254,207,7,139,6,20,0,67,0,79,0,91,0,0,37,20,7,6,43,1,34,39,38,61,1,52,39,38,35,34,7,6,29,1,20,7,6,43,1,34,39,38,61,1,52,55,38,61,1,52,55,54,59,
+1,50,23,22,29,1,20,23,22,51,50,55,54,61,1,52,55,54,59,1,50,23,22,29,1,20,7,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,31,35,52,2,52,35,31,56,51,71,70,51,55,32,35,51,3,51,35,32,127,127,32,36,50,3,50,36,32,55,51,70,71,51,
+56,31,35,52,2,50,36,32,126,126,19,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,113,44,32,37,37,32,44,236,83,58,54,54,58,83,236,44,32,37,37,32,44,236,213,95,96,213,177,44,33,36,36,33,44,177,84,57,54,54,57,
+84,177,44,33,36,36,33,44,177,213,96,95,213,4,183,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,3,0,70,254,207,7,139,6,20,0,48,0,60,0,72,0,0,1,20,7,6,7,17,20,7,6,43,1,34,39,38,53,17,38,
+39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,2,0,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,5,125,93,95,108,32,35,51,2,52,35,32,108,94,94,32,36,50,3,50,36,32,55,51,70,71,51,56,31,35,52,
+2,50,36,32,19,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,3,28,150,117,117,22,254,235,44,32,37,37,32,44,1,21,22,117,116,151,1,91,44,33,36,36,33,44,254,165,84,57,53,53,57,84,1,91,44,33,36,36,33,44,1,157,
+253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,3,0,70,254,207,7,139,6,20,0,35,0,47,0,59,0,0,1,52,55,54,51,33,22,23,22,21,20,7,1,33,50,23,22,29,1,20,7,6,35,33,38,39,38,53,52,55,1,33,
+34,39,38,53,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,2,95,30,37,51,1,209,80,52,53,28,254,14,1,166,52,35,31,31,35,52,253,242,76,47,48,22,1,250,254,135,51,37,30,3,11,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,
+201,1,68,1,67,1,201,254,55,4,119,44,33,36,1,55,57,73,53,46,253,25,36,33,44,2,44,32,37,8,53,56,69,45,43,2,242,36,33,44,1,159,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,255,255,0,100,254,
+213,7,169,6,26,2,34,1,100,0,0,0,11,0,68,2,36,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,69,2,66,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,70,2,128,0,219,44,205,0,0,255,255,0,100,254,213,7,169,
+6,26,2,34,1,100,0,0,0,11,0,71,2,7,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,72,2,66,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,73,2,223,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,
+100,0,0,0,11,0,74,2,57,1,107,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,75,2,101,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,76,3,72,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,
+0,77,3,138,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,78,2,164,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,79,3,40,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,81,1,108,
+0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,82,2,101,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,83,2,57,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,84,2,76,1,47,44,205,
+0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,85,2,37,1,67,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,86,2,233,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,87,2,212,0,219,44,205,0,0,255,255,
+0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,88,3,53,0,76,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,89,2,101,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,90,2,108,0,219,44,205,0,0,255,255,0,100,254,
+213,7,169,6,26,2,34,1,100,0,0,0,11,0,91,1,108,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,92,2,112,0,219,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,11,0,93,2,101,1,73,44,205,0,0,255,255,0,100,254,213,7,169,
+6,26,2,34,1,100,0,0,0,11,0,94,2,129,0,217,44,205,0,0,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,233,2,93,254,81,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,
+23,22,59,1,50,55,54,53,1,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,80,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,151,13,17,25,187,24,17,14,14,17,24,130,16,
+15,24,2,25,15,15,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,24,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,0,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,88,0,0,8,1,
+17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,19,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,38,35,5,136,2,33,
+253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,178,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,25,254,66,81,45,126,122,47,74,76,76,111,6,26,253,223,254,126,254,
+127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,0,0,0,3,0,100,254,213,7,169,6,
+26,0,11,0,37,0,98,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,19,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,35,7,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,
+1,50,55,54,53,52,39,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,180,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,215,24,17,14,14,17,24,182,61,44,45,46,43,61,153,25,16,14,16,14,25,153,67,48,50,50,48,67,182,24,14,17,
+14,17,24,182,117,80,81,119,104,74,79,110,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,15,13,17,1,17,12,15,41,43,62,62,43,40,1,15,13,16,1,17,14,14,44,47,68,68,47,44,14,15,
+16,2,16,13,15,73,75,102,121,85,81,108,96,69,71,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,76,0,79,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,55,6,29,1,20,23,22,51,33,21,20,23,22,59,1,50,55,
+54,61,1,51,50,55,54,61,1,52,39,38,43,1,17,52,39,38,43,1,34,7,3,1,17,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,105,5,14,17,24,1,130,14,17,25,1,25,17,14,98,25,15,15,14,17,24,98,14,17,
+25,97,35,15,230,1,64,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,236,9,11,42,16,13,15,130,16,12,16,16,12,16,130,13,15,16,2,16,13,16,2,59,17,13,15,25,253,177,2,23,253,233,0,0,
+0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,50,23,22,21,20,7,6,35,33,34,7,6,29,1,20,23,22,51,33,50,55,54,53,52,39,38,43,1,17,33,50,55,54,61,1,
+52,39,38,35,33,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,220,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,219,67,47,51,51,47,67,254,252,24,14,17,14,17,24,1,4,116,81,81,79,83,116,203,1,84,24,17,14,14,17,
+24,254,115,24,17,14,14,17,24,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,109,44,47,68,68,47,44,14,15,16,2,16,13,15,73,75,102,102,72,75,1,36,15,12,17,1,17,13,15,15,13,17,254,
+130,17,13,15,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,52,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,50,23,22,21,20,7,6,43,1,34,39,38,61,1,19,50,55,54,53,52,39,38,43,1,53,52,55,
+54,59,1,50,55,54,61,1,52,39,38,43,1,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,240,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,2,11,67,47,51,51,47,67,86,66,48,51,251,116,81,81,79,83,116,251,49,50,66,199,
+25,17,14,14,17,25,199,116,82,79,81,80,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,109,44,47,68,68,47,44,44,47,68,159,254,103,73,75,102,102,72,75,132,68,45,47,15,12,17,
+1,17,13,15,76,72,102,254,131,102,75,73,0,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,52,39,38,35,33,34,7,6,29,1,20,23,22,51,33,17,20,23,22,
+59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,200,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,2,119,13,17,25,254,71,24,17,14,14,17,24,1,128,14,17,25,1,25,15,15,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,
+2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,24,17,13,15,15,13,17,1,17,12,15,253,21,16,13,15,13,15,16,0,0,0,0,5,0,100,254,213,7,169,6,26,0,11,0,37,0,63,0,81,0,99,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,52,39,38,43,1,34,7,6,29,1,20,
+23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,34,7,6,21,20,23,6,21,20,23,22,59,1,50,55,54,53,52,39,54,53,52,39,38,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,5,136,2,33,253,223,254,127,254,126,253,
+223,2,33,1,130,254,232,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,181,110,76,76,104,119,81,80,116,98,117,82,78,118,104,75,78,110,98,66,48,51,49,50,66,98,67,48,50,49,49,67,98,60,43,47,47,43,60,98,60,43,47,46,43,61,6,26,253,223,254,126,254,
+127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,69,71,96,108,81,85,121,102,75,73,75,73,102,122,84,81,108,96,69,71,252,234,44,47,68,67,46,46,44,48,67,68,45,46,1,153,40,43,62,62,43,41,41,43,62,62,43,
+40,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,52,0,87,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,1,34,39,38,53,52,55,54,59,1,50,23,22,29,1,3,34,7,6,21,20,23,22,59,1,21,20,7,6,43,1,34,
+7,6,29,1,20,23,22,59,1,50,55,54,53,17,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,242,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,181,66,50,49,49,50,66,86,67,50,48,251,116,82,79,81,80,116,251,51,47,67,255,25,16,
+14,16,14,25,255,116,81,81,79,83,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,1,172,46,45,68,68,45,47,47,45,68,159,1,153,76,72,102,101,75,74,131,68,47,44,16,13,16,2,16,15,
+13,73,75,102,1,125,102,72,76,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,62,0,80,0,98,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,
+38,35,33,34,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,253,197,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,
+25,254,66,81,45,126,122,47,74,76,76,111,2,184,136,95,95,95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,
+15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,29,0,47,0,0,8,1,17,16,0,33,32,0,17,16,0,33,17,34,7,
+6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,136,95,95,95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,
+253,223,2,33,1,129,1,130,2,33,254,22,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,0,0,2,0,100,254,213,7,169,6,26,0,11,0,23,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,
+0,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,0,0,0,0,1,0,100,254,213,7,169,6,26,
+0,11,0,0,8,1,17,16,0,33,32,0,17,16,0,33,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,234,2,240,254,82,255,255,0,100,254,213,7,169,
+6,26,2,34,1,100,0,0,0,3,0,235,2,109,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,236,2,191,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,237,2,45,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,238,2,162,254,
+82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,239,2,128,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,240,2,94,254,81,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,3,0,241,2,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,
+1,100,0,0,0,3,0,242,2,98,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,128,254,82,0,3,0,233,3,63,254,81,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,250,254,82,0,3,0,234,3,193,254,82,255,255,0,100,254,213,7,169,6,
+26,2,34,1,100,0,0,0,35,0,234,1,138,254,82,0,3,0,235,3,73,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,173,254,82,0,3,0,236,3,103,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,126,254,82,0,3,0,237,3,33,254,
+82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,148,254,82,0,3,0,238,3,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,118,254,82,0,3,0,239,3,63,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,
+1,148,254,82,0,3,0,240,3,93,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,98,254,82,0,3,0,241,3,43,254,82,255,255,0,100,254,213,7,169,6,26,2,34,1,100,0,0,0,35,0,234,1,98,254,82,0,3,0,242,3,43,254,82,0,5,0,100,254,213,7,169,6,26,
+0,11,0,23,0,74,0,92,0,110,0,0,8,1,17,16,0,33,32,0,17,16,0,33,21,32,0,17,16,0,33,32,0,17,16,0,1,50,23,22,21,20,7,6,7,6,7,6,21,33,50,23,22,29,1,20,7,6,35,33,34,39,38,61,1,52,55,54,55,54,55,54,53,52,39,38,43,1,34,39,38,61,1,52,55,54,51,32,23,22,29,1,20,
+7,6,35,34,39,38,61,1,52,55,54,51,6,7,6,29,1,20,23,22,51,50,55,54,61,1,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,188,254,55,1,201,1,68,1,67,1,201,254,55,253,149,117,80,82,79,46,110,104,35,53,1,77,43,29,29,30,29,42,254,73,41,
+29,29,79,51,107,125,20,50,24,23,32,225,42,29,29,29,29,42,3,249,97,99,99,97,138,138,96,99,99,96,138,54,39,40,40,39,54,54,41,39,39,41,54,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,150,254,55,254,188,254,189,254,55,1,201,1,67,1,68,1,201,
+254,192,73,77,106,94,75,43,63,60,31,49,12,27,27,36,2,38,25,27,27,25,38,49,105,86,55,63,74,15,38,34,31,22,22,25,27,37,1,38,26,27,89,91,126,253,126,92,89,89,92,126,253,126,91,89,185,36,37,51,247,51,38,35,37,36,51,247,51,35,38,0,0,0,2,0,100,254,213,7,169,
+6,26,0,11,0,37,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,78,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,6,26,253,223,254,
+126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,0,0,2,0,100,254,213,7,169,6,26,0,11,0,62,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,7,6,29,1,20,23,22,51,33,50,23,22,21,20,7,6,7,6,7,6,29,1,20,23,22,
+51,33,50,55,54,61,1,52,39,38,35,33,52,55,54,55,54,55,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,222,25,17,14,14,16,26,1,5,61,43,47,82,27,146,116,54,75,14,17,24,1,252,25,17,14,15,16,25,254,66,81,45,126,122,47,74,76,76,111,
+6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,13,14,41,43,62,69,63,19,87,69,57,82,98,57,16,13,15,15,13,16,2,16,13,16,100,74,41,72,70,45,69,83,96,71,69,0,0,2,0,100,254,213,7,169,6,26,0,11,0,72,0,0,8,1,17,16,0,33,32,0,
+17,16,0,33,3,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,35,7,34,7,6,29,1,20,23,22,59,1,50,23,22,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,1,50,55,54,53,52,39,54,53,52,39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,173,24,17,14,14,17,24,
+182,61,44,45,46,43,61,153,25,16,14,16,14,25,153,67,48,50,50,48,67,182,24,14,17,14,17,24,182,117,80,81,119,104,74,79,110,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,15,13,17,1,17,12,15,41,43,62,62,43,40,1,15,13,16,1,17,14,14,44,47,
+68,68,47,44,14,15,16,2,16,13,15,73,75,102,121,85,81,108,96,69,71,0,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,50,0,53,0,0,8,1,17,16,0,33,32,0,17,16,0,33,1,6,29,1,20,23,22,51,33,21,20,23,22,59,1,50,55,54,61,1,51,50,55,54,61,1,52,39,38,43,1,17,52,39,38,43,
+1,34,7,3,1,17,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,254,143,5,14,17,24,1,130,14,17,25,1,25,17,14,98,25,15,15,14,17,24,98,14,17,25,97,35,15,230,1,64,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,251,189,9,11,42,16,13,15,130,
+16,12,16,16,12,16,130,13,15,16,2,16,13,16,2,59,17,13,15,25,253,177,2,23,253,233,0,0,0,0,2,0,100,254,213,7,169,6,26,0,11,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,50,23,22,21,20,7,6,35,33,34,7,6,29,1,20,23,22,51,33,50,55,54,53,52,39,38,43,1,17,33,50,
+55,54,61,1,52,39,38,35,33,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,78,67,47,51,51,47,67,254,252,24,14,17,14,17,24,1,4,116,81,81,79,83,116,203,1,84,24,17,14,14,17,24,254,115,24,17,14,14,17,24,6,26,253,223,254,126,
+254,127,253,223,2,33,1,129,1,130,2,33,252,62,44,47,68,68,47,44,14,15,16,2,16,13,15,73,75,102,102,72,75,1,36,15,12,17,1,17,13,15,15,13,17,254,130,17,13,15,0,0,0,3,0,100,254,213,7,169,6,26,0,11,0,26,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,50,23,22,21,
+20,7,6,43,1,34,39,38,61,1,19,50,55,54,53,52,39,38,43,1,53,52,55,54,59,1,50,55,54,61,1,52,39,38,43,1,34,7,6,21,17,20,23,22,51,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,82,67,47,51,51,47,67,86,66,48,51,251,116,81,81,79,83,116,251,49,50,66,199,
+25,17,14,14,17,25,199,116,82,79,81,80,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,252,62,44,47,68,68,47,44,44,47,68,159,254,103,73,75,102,102,72,75,132,68,45,47,15,12,17,1,17,13,15,76,72,102,254,131,102,75,73,0,0,0,0,2,0,100,254,213,
+7,169,6,26,0,11,0,37,0,0,8,1,17,16,0,33,32,0,17,16,0,33,19,52,39,38,35,33,34,7,6,29,1,20,23,22,51,33,17,20,23,22,59,1,50,55,54,53,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,205,13,17,25,254,71,24,17,14,14,17,24,1,128,14,17,25,1,25,15,15,6,
+26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,13,15,13,15,16,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,55,0,73,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,7,6,21,20,23,6,21,20,23,22,59,1,50,55,
+54,53,52,39,54,53,52,39,38,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,3,34,39,38,53,52,55,54,59,1,50,23,22,21,20,7,6,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,39,110,76,76,104,119,81,80,116,98,117,82,78,118,104,75,78,110,98,66,
+48,51,49,50,66,98,67,48,50,49,49,67,98,60,43,47,47,43,60,98,60,43,47,46,43,61,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,254,22,69,71,96,108,81,85,121,102,75,73,75,73,102,122,84,81,108,96,69,71,252,234,44,47,68,67,46,46,44,48,67,68,45,
+46,1,153,40,43,62,62,43,41,41,43,62,62,43,40,0,3,0,100,254,213,7,169,6,26,0,11,0,26,0,61,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,34,39,38,53,52,55,54,59,1,50,23,22,29,1,3,34,7,6,21,20,23,22,59,1,21,20,7,6,43,1,34,7,6,29,1,20,23,22,59,1,50,55,54,53,17,52,
+39,38,35,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,44,66,50,49,49,50,66,86,67,50,48,251,116,82,79,81,80,116,251,51,47,67,255,25,16,14,16,14,25,255,116,81,81,79,83,116,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,252,125,46,45,
+68,68,45,47,47,45,68,159,1,153,76,72,102,101,75,74,131,68,47,44,16,13,16,2,16,15,13,73,75,102,1,125,102,72,76,0,0,0,0,4,0,100,254,213,7,169,6,26,0,11,0,37,0,55,0,73,0,0,8,1,17,16,0,33,32,0,17,16,0,33,3,52,39,38,43,1,34,7,6,29,1,20,23,22,59,1,17,20,23,
+22,59,1,50,55,54,53,1,34,7,6,21,17,20,23,22,51,50,55,54,53,17,52,39,38,7,50,23,22,21,17,20,7,6,35,34,39,38,53,17,52,55,54,5,136,2,33,253,223,254,127,254,126,253,223,2,33,1,130,240,13,17,25,187,24,17,14,14,17,24,130,16,15,24,2,25,15,15,1,240,136,95,95,
+95,95,136,136,95,95,95,95,136,86,64,64,64,64,86,87,62,65,65,62,6,26,253,223,254,126,254,127,253,223,2,33,1,129,1,130,2,33,253,233,17,13,15,15,13,17,1,17,12,15,253,21,16,15,13,13,15,16,3,69,87,88,119,254,219,120,88,87,87,88,120,1,37,119,88,87,94,60,58,
+86,254,227,86,59,59,57,61,86,1,29,86,60,58,0,255,255,0,110,0,0,4,121,7,116,2,34,0,36,0,0,0,3,0,192,1,46,1,154,255,255,0,100,0,0,4,228,5,218,2,34,0,68,0,0,0,3,0,192,1,94,0,0,255,255,0,110,0,0,4,121,7,208,2,34,0,36,0,0,0,3,0,193,0,161,1,154,255,255,0,100,
+0,0,4,228,6,54,2,34,0,68,0,0,0,3,0,193,0,209,0,0,255,255,0,110,254,84,4,124,6,26,2,34,0,36,0,0,0,3,0,196,2,188,0,35,255,255,0,100,254,86,4,235,4,128,2,34,0,68,0,0,0,3,0,196,3,43,0,37,255,255,0,75,0,0,4,118,7,251,2,34,0,38,0,0,0,3,0,115,1,199,1,154,255,
+255,0,70,0,0,3,163,6,97,2,34,0,70,0,0,0,3,0,115,1,23,0,0,255,255,0,75,0,0,4,145,7,226,2,34,0,38,0,0,0,3,0,190,1,77,1,154,255,255,0,70,0,0,3,192,6,72,2,34,0,70,0,0,0,2,0,190,124,0,0,0,255,255,0,75,0,0,4,118,7,150,2,34,0,38,0,0,0,3,0,194,2,115,1,154,255,
+255,0,70,0,0,3,137,5,252,2,34,0,70,0,0,0,3,0,194,1,155,0,0,255,255,0,75,0,0,4,178,7,235,2,34,0,38,0,0,0,3,0,191,1,110,1,154,255,255,0,70,0,0,3,248,6,81,2,34,0,70,0,0,0,3,0,191,0,180,0,0,255,255,0,110,0,0,5,44,7,235,2,34,0,39,0,0,0,3,0,191,0,182,1,154,
+255,255,0,70,0,0,5,246,6,26,0,34,0,71,0,0,0,3,0,202,4,147,0,0,255,255,0,10,0,0,5,64,6,26,2,2,0,141,0,0,0,3,0,70,0,0,5,45,6,26,0,15,0,40,0,44,0,0,0,7,6,21,20,23,22,51,50,55,54,53,52,39,38,35,1,50,23,22,21,17,6,7,6,35,34,39,38,53,52,55,54,51,50,23,17,52,
+55,54,51,1,53,33,21,1,252,97,96,96,97,138,137,97,97,97,97,137,1,199,49,36,36,1,169,169,237,238,169,169,169,169,238,217,114,36,36,49,254,167,2,60,3,137,97,97,138,137,97,97,97,97,137,138,97,97,2,145,35,36,50,252,156,238,167,168,169,169,238,238,169,169,
+100,1,133,50,36,35,254,192,168,168,255,255,0,110,0,0,3,185,7,116,2,34,0,40,0,0,0,3,0,192,1,34,1,154,255,255,0,70,0,0,4,173,5,218,2,34,0,72,0,0,0,3,0,192,1,51,0,0,255,255,0,110,0,0,3,185,7,208,2,34,0,40,0,0,0,3,0,193,0,118,1,154,255,255,0,70,0,0,4,173,
+6,54,2,34,0,72,0,0,0,3,0,193,0,166,0,0,255,255,0,110,0,0,3,185,7,150,2,34,0,40,0,0,0,3,0,194,1,36,1,154,255,255,0,70,0,0,4,173,5,252,2,34,0,72,0,0,0,3,0,194,1,137,0,0,255,255,0,110,254,49,3,185,6,26,2,34,0,40,0,0,0,3,0,196,1,187,0,0,0,3,0,70,255,0,4,
+173,4,128,0,9,0,49,0,76,0,0,1,34,7,6,21,20,35,39,37,38,5,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,19,6,35,34,39,38,53,52,55,54,55,51,50,55,51,6,7,6,21,20,23,22,51,50,55,54,55,2,134,138,
+97,96,1,1,2,49,74,1,113,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,62,37,23,8,59,148,150,186,238,169,169,169,169,238,172,142,141,33,61,111,90,58,63,61,19,25,9,65,28,159,91,31,40,7,17,35,9,10,31,70,3,137,97,97,138,15,6,253,88,89,25,26,21,
+21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,169,238,238,169,169,94,92,251,114,56,53,57,93,77,102,30,32,42,88,48,59,37,15,12,29,2,6,44,0,0,255,255,0,110,0,0,3,185,7,235,2,34,0,40,0,0,0,3,0,191,0,112,1,154,255,255,0,70,0,0,4,173,
+6,81,2,34,0,72,0,0,0,3,0,191,0,163,0,0,255,255,0,80,0,0,6,107,7,226,2,34,0,42,0,0,0,3,0,190,1,135,1,154,255,255,0,70,254,101,4,198,6,72,2,34,0,74,0,0,0,3,0,190,0,175,0,0,255,255,0,80,0,0,6,107,7,208,2,34,0,42,0,0,0,3,0,193,1,139,1,154,255,255,0,70,254,
+101,4,198,6,54,2,34,0,74,0,0,0,3,0,193,0,179,0,0,255,255,0,80,0,0,6,107,7,150,2,34,0,42,0,0,0,3,0,194,2,110,1,154,255,255,0,70,254,101,4,198,5,252,2,34,0,74,0,0,0,3,0,194,1,150,0,0,255,255,0,80,253,163,6,107,6,26,2,34,0,42,0,0,0,3,0,202,2,168,249,190,
+255,255,0,70,254,101,4,198,6,238,2,34,0,74,0,0,0,3,0,201,1,166,0,207,255,255,0,110,0,0,4,130,7,226,2,34,0,43,0,0,0,3,0,190,0,161,1,154,255,255,0,100,0,0,4,43,7,192,2,34,0,75,0,0,0,3,0,190,0,125,1,120,0,2,0,10,0,0,5,51,6,26,0,43,0,47,0,0,1,50,23,22,21,
+17,33,17,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,33,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,53,33,21,1,18,49,36,36,2,42,36,36,49,3,49,36,36,36,36,49,3,49,36,36,253,214,36,36,49,3,49,36,36,36,36,49,254,251,5,41,6,26,35,36,50,253,230,
+2,26,50,36,35,35,36,50,250,216,51,34,36,36,34,51,2,26,253,230,51,34,36,36,34,51,5,40,50,36,35,254,90,197,197,0,0,2,0,10,0,0,4,83,6,26,0,45,0,49,0,0,1,50,23,22,21,17,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,
+34,39,38,53,17,52,55,54,51,3,53,33,21,1,8,49,36,36,79,160,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,36,36,49,3,49,36,36,36,36,49,251,2,226,6,26,35,36,50,254,164,59,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,253,221,51,34,36,
+36,34,51,5,40,50,36,35,254,150,199,199,0,0,255,255,255,137,0,0,2,132,7,131,2,34,0,44,0,0,0,3,0,197,255,35,1,154,255,255,255,134,0,0,2,129,5,233,2,34,0,189,0,0,0,3,0,197,255,32,0,0,255,255,255,243,0,0,2,27,7,116,2,34,0,44,0,0,0,3,0,192,255,193,1,154,255,
+255,255,240,0,0,2,24,5,218,2,34,0,189,0,0,0,2,0,192,190,0,0,0,255,255,255,158,0,0,2,111,7,208,2,34,0,44,0,0,0,3,0,193,255,51,1,154,255,255,255,155,0,0,2,108,6,54,2,34,0,189,0,0,0,3,0,193,255,48,0,0,255,255,0,2,254,49,1,129,6,26,2,34,0,44,0,0,0,2,0,196,
+193,0,0,0,255,255,0,17,254,49,1,144,6,25,2,34,0,76,0,0,0,2,0,196,208,0,0,0,255,255,0,123,0,0,1,147,7,150,2,34,0,44,0,0,0,3,0,194,0,23,1,154,255,255,0,140,0,0,4,122,6,26,0,34,0,44,0,0,0,3,0,45,1,209,0,0,255,255,0,120,254,101,3,118,6,27,0,34,0,76,0,0,0,
+3,0,77,1,204,0,0,0,2,255,96,0,0,2,228,7,156,0,29,0,56,0,0,1,52,55,54,59,1,50,23,22,21,17,20,7,6,43,1,34,39,38,61,1,52,55,54,59,1,50,55,54,53,19,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,11,35,36,50,2,50,36,35,107,107,151,
+185,49,36,36,36,36,49,185,51,35,35,108,168,24,27,77,43,18,8,16,196,22,32,197,34,20,197,16,8,18,43,77,27,24,5,161,50,36,35,35,36,50,251,204,151,107,107,36,34,51,2,50,36,36,35,35,50,5,105,165,24,38,16,15,22,19,251,26,27,250,19,22,15,16,38,24,0,0,0,0,2,
+255,148,254,101,2,224,6,2,0,26,0,56,0,0,1,7,6,43,1,34,39,38,53,52,63,1,54,59,1,50,31,1,22,21,20,7,6,43,1,34,39,1,34,39,38,61,1,52,55,54,59,1,50,55,54,55,17,52,55,54,59,1,50,23,22,21,17,6,7,6,35,1,115,168,24,27,77,43,18,8,16,196,22,32,197,34,20,197,16,
+8,18,43,77,27,24,253,242,49,36,36,36,36,49,58,81,57,57,1,35,36,50,2,50,36,35,2,127,127,184,5,60,165,24,38,16,15,22,19,251,26,27,250,19,22,15,16,38,24,249,206,36,36,49,3,49,36,36,57,57,82,3,232,50,36,36,36,36,50,252,24,184,128,129,0,0,0,0,2,0,110,254,
+107,4,54,6,26,0,58,0,82,0,0,19,50,23,22,21,17,51,50,55,54,55,53,52,55,54,59,1,50,23,22,29,1,16,7,22,23,22,21,17,20,7,6,43,1,34,39,38,53,17,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,
+53,52,39,234,49,36,36,104,137,96,97,1,36,35,50,3,49,36,36,196,89,74,76,35,36,50,2,50,36,35,1,97,97,137,147,36,36,49,3,49,36,36,36,36,49,1,27,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,254,24,96,97,136,159,50,36,35,35,36,50,159,254,223,
+146,54,129,133,154,255,0,50,35,36,36,35,50,1,0,136,97,96,253,183,51,34,36,36,34,51,5,40,50,36,35,249,22,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,2,0,100,254,107,3,235,6,26,0,58,0,82,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,
+59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,
+74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,1,17,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,253,75,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,51,51,34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,
+51,5,40,50,36,35,249,22,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,1,0,100,0,0,3,235,4,128,0,58,0,0,19,50,23,22,21,17,51,50,55,54,55,54,55,54,59,1,50,23,22,21,20,7,6,7,22,23,22,29,1,20,7,6,43,1,34,39,38,61,1,38,39,38,43,1,17,20,7,
+6,43,1,34,39,38,53,17,52,55,54,51,224,49,36,36,38,128,95,93,13,6,34,34,47,3,53,36,32,1,24,168,88,74,77,36,36,49,3,49,36,36,1,96,97,137,82,36,36,49,3,49,36,36,36,36,49,4,127,35,36,50,254,230,85,85,125,47,30,32,40,35,46,6,7,251,125,54,129,133,154,51,51,
+34,36,36,34,51,51,136,97,96,254,132,51,34,36,36,34,51,3,141,50,36,35,0,0,255,255,0,120,0,0,3,130,7,251,2,34,0,47,0,0,0,3,0,115,0,160,1,154,0,2,0,144,0,0,2,145,7,244,0,29,0,49,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,
+52,55,54,51,55,6,43,1,34,39,38,53,52,63,1,54,59,1,50,23,22,21,20,7,1,12,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,120,25,27,77,43,18,8,14,176,19,36,154,43,18,10,19,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,
+50,36,35,110,23,38,15,15,21,19,251,28,39,18,15,22,19,0,0,2,0,120,254,6,3,130,6,26,0,29,0,53,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,109,
+35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,171,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,249,42,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,
+3,3,0,2,0,140,253,244,2,100,6,26,0,29,0,53,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,18,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,8,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,
+92,36,36,49,93,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,50,36,35,248,159,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,2,0,120,0,0,3,130,6,26,0,29,0,53,0,0,1,20,23,
+22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,4,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,109,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,61,34,36,36,36,49,12,50,36,36,
+56,30,49,93,71,1,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,157,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,140,0,0,2,223,6,26,0,29,0,53,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,
+38,53,17,52,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,8,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,1,33,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,
+92,93,129,4,103,50,36,35,254,234,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,120,0,0,3,130,6,26,0,29,0,45,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,34,39,38,53,52,55,54,51,50,23,22,
+21,20,7,6,1,109,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,36,36,49,3,49,36,36,1,78,49,35,35,35,35,49,48,35,36,36,35,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,252,245,35,35,49,49,35,35,35,34,50,50,34,35,0,0,0,0,2,
+0,140,0,0,3,7,6,26,0,19,0,35,0,0,1,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,34,39,38,53,52,55,54,51,50,23,22,21,20,7,6,1,8,49,36,36,36,36,49,3,49,36,36,36,36,49,1,139,49,35,35,35,35,49,48,35,36,36,35,6,26,35,36,50,250,216,51,34,36,36,34,
+51,5,40,50,36,35,252,124,35,35,49,49,35,35,35,34,50,50,34,35,0,2,0,1,0,0,3,230,6,26,0,29,0,33,0,0,1,20,23,22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,53,17,52,55,54,59,1,50,23,22,21,1,53,1,21,1,209,35,35,50,1,35,50,36,36,36,36,50,254,221,151,107,107,
+36,36,49,3,49,36,36,254,48,2,215,1,109,50,35,35,36,36,50,2,51,34,36,107,107,151,4,52,50,36,35,35,36,50,252,96,211,1,80,211,0,2,0,1,0,0,2,216,6,26,0,29,0,33,0,0,1,50,23,22,21,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,51,1,53,1,
+21,1,108,49,36,36,20,20,30,36,50,36,35,35,36,50,36,130,93,92,36,36,49,254,152,2,215,6,26,35,36,50,251,153,29,20,20,36,36,50,2,50,35,36,92,93,129,4,103,50,36,35,251,231,211,1,80,211,0,255,255,0,110,0,0,4,121,7,251,2,34,0,49,0,0,0,3,0,115,1,23,1,154,255,
+255,0,100,0,0,4,43,6,97,2,34,0,82,0,0,0,3,0,115,0,235,0,0,0,2,0,110,254,67,4,121,6,26,0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,17,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,
+7,6,7,39,54,53,52,39,4,121,36,36,49,3,49,36,36,79,80,114,113,80,79,36,36,49,3,49,36,36,152,152,213,214,152,152,253,207,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,3,156,113,80,80,80,80,113,252,100,51,34,36,36,34,51,3,156,214,152,
+151,151,152,214,250,243,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,100,254,67,4,43,4,128,0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,18,39,38,61,1,52,55,
+54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,89,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,36,69,70,99,100,70,69,199,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,
+36,34,51,2,35,99,70,70,70,70,99,252,108,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,255,255,0,110,0,0,4,121,7,235,2,34,0,49,0,0,0,3,0,191,0,157,1,154,255,255,0,100,0,0,4,43,6,81,2,34,0,82,0,0,0,2,0,191,113,0,0,0,0,2,0,10,0,0,4,84,5,96,
+0,37,0,61,0,0,37,20,7,6,43,1,34,39,38,53,17,52,55,54,51,50,23,22,21,17,20,7,6,43,1,34,39,38,53,17,52,39,38,35,34,7,6,21,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,1,130,36,36,49,3,49,36,36,142,142,200,199,142,142,36,34,51,2,50,36,
+36,69,70,99,100,70,69,254,206,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,121,51,34,36,36,34,51,2,35,200,142,142,142,142,200,253,221,51,34,36,36,34,51,2,35,99,70,70,70,70,99,1,184,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,255,255,0,110,
+254,254,4,123,6,26,2,34,0,49,0,0,0,3,0,15,3,23,255,182,255,255,0,100,254,251,4,46,4,128,2,34,0,82,0,0,0,3,0,15,2,202,255,179,255,255,0,80,0,0,6,107,7,116,2,34,0,50,0,0,0,3,0,192,2,24,1,154,255,255,0,70,0,0,4,198,5,218,2,34,0,83,0,0,0,3,0,192,1,64,0,0,
+255,255,0,80,0,0,6,107,7,208,2,34,0,50,0,0,0,3,0,193,1,139,1,154,255,255,0,70,0,0,4,198,6,54,2,34,0,83,0,0,0,3,0,193,0,179,0,0,255,255,0,80,0,0,6,107,8,25,2,34,0,50,0,0,0,3,0,198,1,189,1,154,255,255,0,70,0,0,4,198,6,127,2,34,0,83,0,0,0,3,0,198,0,229,
+0,0,0,2,0,80,0,0,8,191,6,26,0,16,0,89,0,0,1,38,39,38,35,34,7,6,21,20,23,22,51,50,55,54,55,19,54,53,52,35,7,6,33,32,39,38,17,16,55,54,33,32,31,1,50,53,52,39,54,55,54,51,33,50,23,22,29,1,20,7,6,35,33,34,7,6,21,17,33,50,23,22,29,1,20,7,6,35,33,17,20,23,
+22,51,33,50,23,22,29,1,20,7,6,35,33,34,39,38,5,116,15,140,157,223,222,157,157,157,157,222,223,157,140,15,20,10,1,11,230,254,189,254,189,229,229,229,229,1,67,1,67,230,11,1,10,8,79,107,151,1,101,49,36,36,36,36,49,254,155,50,35,35,1,221,49,36,36,36,36,49,
+254,35,35,35,50,1,101,49,36,36,36,36,49,254,155,151,107,79,3,63,190,140,157,157,157,223,223,157,156,156,140,190,254,8,11,1,1,11,229,229,229,1,67,1,67,229,229,229,11,1,1,11,42,78,107,36,34,51,2,50,36,36,35,35,50,254,218,35,36,50,2,50,36,35,254,218,50,
+35,35,36,36,50,2,51,34,36,107,78,0,3,0,70,0,0,8,57,4,128,0,15,0,23,0,79,0,0,0,35,34,7,6,21,20,23,22,51,50,55,54,53,52,39,36,35,34,7,6,29,1,37,1,6,7,6,35,34,39,38,53,52,55,54,51,50,23,22,23,54,55,54,51,50,23,22,23,22,21,20,7,6,7,6,7,4,7,22,51,50,55,54,
+55,54,51,50,23,22,21,20,7,6,7,6,35,34,39,38,3,15,137,138,97,96,96,97,138,137,97,97,97,3,60,154,138,97,96,2,47,253,86,6,41,169,238,238,169,169,169,169,238,238,169,41,6,6,41,169,238,172,142,141,68,12,8,17,47,140,228,254,229,49,76,161,107,87,85,34,29,87,
+62,37,23,8,59,148,150,186,238,169,41,3,137,97,97,138,137,97,97,97,97,137,138,97,97,97,97,138,8,252,253,169,8,41,169,169,169,238,238,169,169,169,41,8,8,41,169,94,92,150,25,26,21,21,47,21,63,103,128,23,96,63,62,98,82,52,32,35,21,22,171,105,109,169,41,0,
+255,255,0,110,0,0,4,106,7,251,2,34,0,53,0,0,0,3,0,115,1,15,1,154,255,255,0,100,0,0,2,207,6,97,2,34,0,86,0,0,0,2,0,115,61,0,0,0,0,3,0,110,254,67,4,106,6,26,0,16,0,58,0,82,0,0,1,50,55,54,53,52,39,38,43,1,34,7,6,7,6,21,17,1,52,39,38,39,33,17,20,7,6,43,1,
+34,39,38,53,17,52,55,54,59,1,50,23,22,21,20,15,1,23,22,29,1,20,7,6,43,1,34,39,38,53,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,2,118,106,75,75,75,75,106,115,75,42,33,9,2,2,20,75,68,94,254,217,35,36,50,2,51,34,36,114,115,161,130,
+207,146,147,147,23,24,146,36,36,49,2,49,36,36,254,180,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,3,38,74,75,106,107,75,74,41,33,45,11,24,254,155,254,12,106,75,69,5,254,72,50,35,36,36,34,51,4,27,161,114,115,147,147,207,206,147,24,25,146,207,185,51,34,
+36,36,34,51,254,143,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,2,0,100,254,0,2,207,4,128,0,29,0,53,0,0,1,50,23,22,29,1,20,7,6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,0,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,
+39,54,53,52,39,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,254,157,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,4,128,36,36,50,2,50,35,36,57,57,82,253,178,51,34,36,36,34,51,2,78,183,129,129,250,69,36,36,49,26,50,36,35,35,36,
+50,117,78,82,44,23,71,87,33,3,3,0,0,255,255,0,110,0,0,4,106,7,235,2,34,0,53,0,0,0,3,0,191,0,149,1,154,255,255,0,106,0,0,3,68,6,81,2,34,0,86,61,0,0,2,0,191,0,0,0,0,255,255,0,70,0,0,4,2,7,251,2,34,0,54,0,0,0,3,0,115,0,199,1,154,255,255,0,60,0,0,3,23,6,
+97,2,34,0,87,0,0,0,2,0,115,77,0,0,0,255,255,0,70,0,0,4,2,7,226,2,34,0,54,0,0,0,3,0,190,0,77,1,154,255,255,0,65,0,0,3,28,6,72,2,34,0,87,5,0,0,2,0,190,216,0,0,0,255,255,0,70,254,5,4,2,6,32,2,34,0,54,0,0,0,3,0,119,0,158,0,0,255,255,0,60,254,5,3,23,4,128,
+2,34,0,87,0,0,0,2,0,119,35,0,0,0,255,255,0,70,0,0,4,2,7,235,2,34,0,54,0,0,0,3,0,191,0,77,1,154,255,255,0,65,0,0,3,28,6,81,2,34,0,87,5,0,0,2,0,191,216,0,0,0,0,1,0,40,254,89,3,246,6,26,0,65,0,0,37,38,53,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,29,1,
+20,7,6,43,1,17,20,15,1,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,1,170,21,244,49,36,36,36,36,49,2,220,50,35,36,36,35,50,244,15,16,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,
+17,5,7,22,13,22,41,22,19,1,52,30,39,4,173,35,36,50,2,50,36,35,35,36,50,2,50,36,35,251,83,33,27,81,7,53,51,66,93,68,65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,0,0,0,1,0,102,254,43,2,134,6,26,0,80,0,0,37,38,39,38,53,17,52,55,54,59,
+1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,7,22,23,22,21,20,7,6,43,1,34,39,38,61,1,55,54,55,54,51,22,51,50,55,54,53,52,39,38,39,38,39,38,39,38,53,52,55,1,28,48,42,92,36,36,49,3,49,36,36,150,49,36,36,36,36,
+49,150,20,20,30,80,49,36,36,36,36,49,12,13,67,54,53,86,83,161,95,40,27,24,1,3,27,25,37,31,21,89,32,17,5,7,22,13,22,41,22,19,1,28,23,41,93,129,4,103,50,36,35,35,36,50,254,223,36,36,50,2,51,34,36,253,175,29,20,20,36,36,50,2,51,34,36,66,7,53,51,66,93,68,
+65,30,25,36,8,8,35,24,24,1,22,12,13,8,6,8,7,4,2,5,31,25,30,7,8,0,0,255,255,0,40,0,0,3,246,7,235,2,34,0,55,0,0,0,3,0,191,0,56,1,154,0,2,0,100,0,0,2,190,6,73,0,41,0,65,0,0,19,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,17,20,23,22,59,1,50,23,22,29,1,20,
+7,6,43,1,34,39,38,53,17,52,55,54,51,4,39,38,61,1,52,55,54,59,1,50,23,22,29,1,20,7,6,7,39,54,53,52,39,224,49,36,36,150,49,36,36,36,36,49,150,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,1,40,34,36,36,36,49,12,50,36,36,56,30,49,93,71,1,6,26,35,36,
+50,254,223,36,36,50,2,51,34,36,253,175,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,221,36,36,49,26,50,36,35,35,36,50,117,78,82,44,23,71,87,33,3,3,0,0,1,0,15,0,0,3,221,6,26,0,39,0,0,1,17,35,34,39,38,61,1,52,55,54,51,33,50,23,22,29,1,20,7,6,43,
+1,17,33,21,33,17,20,7,6,43,1,34,39,38,53,17,33,53,1,124,244,49,36,36,36,36,49,2,220,50,35,36,36,35,50,244,1,36,254,220,35,36,50,2,50,36,35,254,221,3,136,1,158,35,36,50,2,50,36,35,35,36,50,2,50,36,35,254,98,195,253,180,50,35,36,36,35,50,2,76,195,0,0,0,
+0,1,0,110,0,0,2,114,6,26,0,45,0,0,1,21,20,23,22,59,1,50,23,22,29,1,20,7,6,43,1,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,51,50,23,22,29,1,20,7,6,43,1,21,33,21,1,99,20,20,30,80,49,36,36,36,36,49,80,130,93,92,36,36,49,3,49,36,36,150,49,36,36,36,36,49,
+150,1,0,2,48,246,29,20,20,36,36,50,2,51,34,36,92,93,129,4,103,50,36,35,35,36,50,254,223,36,36,50,2,51,34,36,152,195,255,255,0,110,0,0,4,121,7,131,2,34,0,56,0,0,0,3,0,197,0,144,1,154,255,255,0,100,0,0,4,43,5,233,2,34,0,89,0,0,0,2,0,197,100,0,0,0,255,255,
+0,110,0,0,4,121,7,116,2,34,0,56,0,0,0,3,0,192,1,46,1,154,255,255,0,100,0,0,4,43,5,218,2,34,0,89,0,0,0,3,0,192,1,2,0,0,255,255,0,110,0,0,4,121,7,208,2,34,0,56,0,0,0,3,0,193,0,161,1,154,255,255,0,100,0,0,4,43,6,54,2,34,0,89,0,0,0,2,0,193,117,0,0,0,255,
+255,0,110,0,0,4,121,8,16,2,34,0,56,0,0,0,3,0,195,1,18,1,154,255,255,0,100,0,0,4,43,6,118,2,34,0,89,0,0,0,3,0,195,0,230,0,0,255,255,0,110,0,0,4,173,8,25,2,34,0,56,0,0,0,3,0,198,0,211,1,154,255,255,0,100,0,0,4,129,6,127,2,34,0,89,0,0,0,3,0,198,0,167,0,
+0,0,1,0,110,254,213,4,121,6,26,0,59,0,0,37,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,51,6,7,6,21,20,23,22,51,50,55,54,55,21,6,35,34,39,38,53,52,2,172,28,29,213,152,152,36,36,49,3,49,
+36,36,79,80,113,114,80,79,36,36,49,3,49,36,36,120,4,91,31,40,7,17,35,9,10,31,70,61,111,90,58,63,3,3,152,151,214,3,156,50,36,35,35,36,50,252,100,113,80,79,79,80,113,3,156,50,36,35,35,36,50,252,100,190,140,88,48,59,37,15,12,29,2,6,44,194,56,53,57,93,45,
+0,0,1,0,100,254,215,4,43,4,128,0,59,0,0,37,6,35,34,39,38,53,17,52,55,54,59,1,50,23,22,21,17,20,23,22,51,50,55,54,53,17,52,55,54,59,1,50,23,22,21,17,20,7,51,6,7,6,21,20,23,22,51,50,55,54,55,21,6,35,34,39,38,53,52,2,115,21,22,200,142,142,36,36,49,3,49,
+36,36,69,70,100,99,70,69,36,36,50,2,51,34,36,100,6,91,31,40,7,17,35,9,10,31,70,61,111,90,58,63,2,2,142,142,199,2,35,50,36,36,36,36,50,253,221,99,70,69,69,70,99,2,35,50,36,36,36,36,50,253,221,167,127,88,48,59,37,15,12,29,2,6,44,194,56,53,57,93,44,0,255,
+255,0,110,0,0,6,253,7,226,2,34,0,58,0,0,0,3,0,190,1,223,1,154,255,255,0,100,0,0,6,243,6,72,2,34,0,91,0,0,0,3,0,190,1,213,0,0,255,255,0,100,0,0,4,111,7,226,2,34,0,60,0,0,0,3,0,190,0,147,1,154,255,255,0,100,254,101,4,43,6,72,2,34,0,93,0,0,0,2,0,190,113,
+0,0,0,255,255,0,100,0,0,4,111,7,80,2,34,0,60,0,0,0,3,0,106,0,196,1,154,255,255,0,40,0,0,4,29,7,251,2,34,0,61,0,0,0,3,0,115,0,198,1,154,255,255,0,65,0,3,3,254,6,97,2,34,0,94,0,0,0,3,0,115,0,195,0,0,255,255,0,40,0,0,4,29,7,150,2,34,0,61,0,0,0,3,0,194,1,
+51,1,154,255,255,0,65,0,3,3,254,5,252,2,34,0,94,0,0,0,3,0,194,1,48,0,0,255,255,0,40,0,0,4,29,7,235,2,34,0,61,0,0,0,3,0,191,0,76,1,154,255,255,0,65,0,3,3,254,6,81,2,34,0,94,0,0,0,2,0,191,72,0,0,0,0,1,0,100,0,0,2,207,6,26,0,29,0,0,1,50,23,22,29,1,20,7,
+6,43,1,34,7,6,7,17,20,7,6,43,1,34,39,38,53,17,54,55,54,51,2,86,50,36,35,35,36,50,57,82,57,56,1,36,36,49,3,49,36,36,2,127,129,183,6,26,35,36,50,2,50,36,35,57,57,82,252,23,51,34,36,36,34,51,3,233,183,128,129,0,0,0,0,0,0,24,1,38,0,1,0,0,0,0,0,0,0,48,0,0,
+0,1,0,0,0,0,0,1,0,20,0,55,0,1,0,0,0,0,0,2,0,7,0,48,0,1,0,0,0,0,0,3,0,33,0,55,0,1,0,0,0,0,0,4,0,20,0,55,0,1,0,0,0,0,0,5,0,45,0,88,0,1,0,0,0,0,0,6,0,17,0,133,0,1,0,0,0,0,0,7,0,37,0,150,0,1,0,0,0,0,0,8,0,10,0,11,0,1,0,0,0,0,0,10,0,160,0,187,0,1,0,0,0,0,
+0,12,0,25,1,55,0,1,0,0,0,0,0,14,0,25,1,55,0,3,0,1,4,9,0,0,0,96,1,91,0,3,0,1,4,9,0,1,0,40,1,201,0,3,0,1,4,9,0,2,0,14,1,187,0,3,0,1,4,9,0,3,0,66,1,201,0,3,0,1,4,9,0,4,0,40,1,201,0,3,0,1,4,9,0,5,0,90,2,11,0,3,0,1,4,9,0,6,0,34,2,101,0,3,0,1,4,9,0,7,0,74,
+2,135,0,3,0,1,4,9,0,8,0,20,1,113,0,3,0,1,4,9,0,10,1,64,2,209,0,3,0,1,4,9,0,12,0,50,3,201,0,3,0,1,4,9,0,14,0,50,3,201,84,121,112,101,102,97,99,101,32,169,32,83,116,117,100,105,111,84,121,112,111,46,32,50,48,49,54,46,32,65,108,108,32,82,105,103,104,116,
+115,32,82,101,115,101,114,118,101,100,82,101,103,117,108,97,114,84,121,112,111,32,82,111,117,110,100,32,66,111,108,100,32,68,101,109,111,58,86,101,114,115,105,111,110,32,49,46,48,48,86,101,114,115,105,111,110,32,49,46,48,48,32,74,97,110,117,97,114,121,
+32,56,44,32,50,48,49,54,44,32,105,110,105,116,105,97,108,32,114,101,108,101,97,115,101,84,121,112,111,82,111,117,110,100,66,111,108,100,68,101,109,111,84,121,112,111,32,82,111,117,110,100,32,168,32,84,114,97,100,101,109,97,114,107,32,111,102,32,83,116,
+117,100,105,111,84,121,112,111,46,84,104,105,115,32,105,115,32,108,105,109,105,116,101,100,32,99,104,97,114,97,99,116,101,114,32,100,101,109,111,32,118,101,114,115,105,111,110,46,13,10,105,102,32,121,111,117,32,119,111,117,108,100,32,108,105,107,101,
+32,116,111,32,99,111,110,115,105,100,101,114,32,117,115,105,110,103,32,105,116,32,102,111,114,32,99,111,109,109,101,114,99,105,97,108,32,112,114,111,106,101,99,116,115,46,32,13,10,112,108,101,97,115,101,32,118,105,115,105,116,32,13,10,13,10,104,116,116,
+112,58,47,47,119,119,119,46,115,116,117,100,105,111,116,121,112,111,46,99,111,109,47,13,10,13,10,84,104,97,110,107,115,0,84,0,121,0,112,0,101,0,102,0,97,0,99,0,101,0,32,0,169,0,32,0,83,0,116,0,117,0,100,0,105,0,111,0,84,0,121,0,112,0,111,0,46,0,32,0,
+50,0,48,0,49,0,54,0,46,0,32,0,65,0,108,0,108,0,32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,84,0,121,0,112,0,111,0,32,0,82,0,111,0,117,0,110,0,100,0,32,0,66,0,111,
+0,108,0,100,0,32,0,68,0,101,0,109,0,111,0,58,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,32,0,74,0,97,0,110,0,117,0,97,0,114,0,121,0,32,0,56,0,44,0,32,0,50,0,48,
+0,49,0,54,0,44,0,32,0,105,0,110,0,105,0,116,0,105,0,97,0,108,0,32,0,114,0,101,0,108,0,101,0,97,0,115,0,101,0,84,0,121,0,112,0,111,0,82,0,111,0,117,0,110,0,100,0,66,0,111,0,108,0,100,0,68,0,101,0,109,0,111,0,84,0,121,0,112,0,111,0,32,0,82,0,111,0,117,
+0,110,0,100,0,32,0,174,0,32,0,84,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,83,0,116,0,117,0,100,0,105,0,111,0,84,0,121,0,112,0,111,0,46,0,84,0,104,0,105,0,115,0,32,0,105,0,115,0,32,0,108,0,105,0,109,0,105,0,116,0,101,0,100,
+0,32,0,99,0,104,0,97,0,114,0,97,0,99,0,116,0,101,0,114,0,32,0,100,0,101,0,109,0,111,0,32,0,118,0,101,0,114,0,115,0,105,0,111,0,110,0,46,0,13,0,10,0,105,0,102,0,32,0,121,0,111,0,117,0,32,0,119,0,111,0,117,0,108,0,100,0,32,0,108,0,105,0,107,0,101,0,32,
+0,116,0,111,0,32,0,99,0,111,0,110,0,115,0,105,0,100,0,101,0,114,0,32,0,117,0,115,0,105,0,110,0,103,0,32,0,105,0,116,0,32,0,102,0,111,0,114,0,32,0,99,0,111,0,109,0,109,0,101,0,114,0,99,0,105,0,97,0,108,0,32,0,112,0,114,0,111,0,106,0,101,0,99,0,116,0,115,
+0,46,0,32,0,13,0,10,0,112,0,108,0,101,0,97,0,115,0,101,0,32,0,118,0,105,0,115,0,105,0,116,0,32,0,13,0,10,0,13,0,10,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,115,0,116,0,117,0,100,0,105,0,111,0,116,0,121,0,112,0,111,0,46,0,99,0,111,
+0,109,0,47,0,13,0,10,0,13,0,10,0,84,0,104,0,97,0,110,0,107,0,115,0,0,2,0,0,0,0,0,0,255,39,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,0,0,0,1,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,
+0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,
+0,74,0,75,0,76,0,77,0,78,0,79,1,2,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,138,0,218,0,131,0,147,0,141,0,151,0,136,0,195,0,222,
+0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,
+0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,0,215,0,216,0,225,1,3,0,219,0,220,0,221,0,224,0,217,0,223,0,178,0,179,0,182,0,183,0,196,
+0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,190,0,191,0,188,0,247,1,4,1,5,1,6,1,7,0,140,0,152,0,168,0,154,0,153,0,239,0,165,0,146,0,156,0,167,0,148,0,149,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,
+1,78,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,1,114,1,115,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,
+123,1,124,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,
+1,165,1,166,1,167,1,168,1,169,1,170,0,253,0,254,1,171,1,172,1,173,1,174,0,255,1,0,1,175,1,176,1,177,1,1,1,178,1,179,1,180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,0,248,0,249,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,
+200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,0,226,0,227,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,0,176,0,177,1,237,
+1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,0,251,0,252,0,228,0,229,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,0,187,2,13,2,14,2,15,2,16,0,230,0,231,2,17,5,108,95,97,108,116,
+7,117,110,105,48,50,67,57,4,108,105,114,97,6,112,101,115,101,116,97,4,69,117,114,111,7,117,110,105,50,49,49,54,7,117,110,105,70,48,48,49,7,117,110,105,70,48,48,50,7,117,110,105,50,48,55,48,7,117,110,105,48,48,66,57,7,117,110,105,48,48,66,50,7,117,110,
+105,48,48,66,51,7,117,110,105,50,48,55,52,7,117,110,105,50,48,55,53,7,117,110,105,50,48,55,54,7,117,110,105,50,48,55,55,7,117,110,105,50,48,55,56,7,117,110,105,50,48,55,57,7,117,110,105,50,48,55,65,7,117,110,105,50,48,55,66,7,117,110,105,50,48,55,67,
+7,117,110,105,50,48,55,49,7,117,110,105,50,48,55,68,7,117,110,105,50,48,55,69,7,117,110,105,50,48,55,70,7,117,110,105,50,48,56,48,7,117,110,105,50,48,56,49,7,117,110,105,50,48,56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,7,117,110,105,50,
+48,56,53,7,117,110,105,50,48,56,54,7,117,110,105,50,48,56,55,7,117,110,105,50,48,56,56,7,117,110,105,50,48,56,57,7,117,110,105,50,48,56,65,7,117,110,105,50,48,56,66,7,117,110,105,50,48,56,67,7,117,110,105,50,48,56,68,7,117,110,105,50,48,56,69,6,65,46,
+115,109,99,112,6,66,46,115,109,99,112,6,67,46,115,109,99,112,6,68,46,115,109,99,112,6,69,46,115,109,99,112,6,70,46,115,109,99,112,6,71,46,115,109,99,112,6,72,46,115,109,99,112,6,73,46,115,109,99,112,6,74,46,115,109,99,112,6,75,46,115,109,99,112,6,76,
+46,115,109,99,112,6,77,46,115,109,99,112,6,78,46,115,109,99,112,6,79,46,115,109,99,112,6,80,46,115,109,99,112,6,81,46,115,109,99,112,6,82,46,115,109,99,112,6,83,46,115,109,99,112,6,84,46,115,109,99,112,6,85,46,115,109,99,112,6,86,46,115,109,99,112,6,
+87,46,115,109,99,112,6,88,46,115,109,99,112,6,89,46,115,109,99,112,6,90,46,115,109,99,112,7,117,110,105,50,48,68,68,7,117,110,105,50,52,66,54,7,117,110,105,50,52,66,55,7,117,110,105,50,52,66,56,7,117,110,105,50,52,66,57,7,117,110,105,50,52,66,65,7,117,
+110,105,50,52,66,66,7,117,110,105,50,52,66,67,7,117,110,105,50,52,66,68,7,117,110,105,50,52,66,69,7,117,110,105,50,52,66,70,7,117,110,105,50,52,67,48,7,117,110,105,50,52,67,49,7,117,110,105,50,52,67,50,7,117,110,105,50,52,67,51,7,117,110,105,50,52,67,
+52,7,117,110,105,50,52,67,53,7,117,110,105,50,52,67,54,7,117,110,105,50,52,67,55,7,117,110,105,50,52,67,56,7,117,110,105,50,52,67,57,7,117,110,105,50,52,67,65,7,117,110,105,50,52,67,66,7,117,110,105,50,52,67,67,7,117,110,105,50,52,67,68,7,117,110,105,
+50,52,67,69,7,117,110,105,50,52,67,70,7,117,110,105,50,52,68,48,7,117,110,105,50,52,68,49,7,117,110,105,50,52,68,50,7,117,110,105,50,52,68,51,7,117,110,105,50,52,68,52,7,117,110,105,50,52,68,53,7,117,110,105,50,52,68,54,7,117,110,105,50,52,68,55,7,117,
+110,105,50,52,68,56,7,117,110,105,50,52,68,57,7,117,110,105,50,52,68,65,7,117,110,105,50,52,68,66,7,117,110,105,50,52,68,67,7,117,110,105,50,52,68,68,7,117,110,105,50,52,68,69,7,117,110,105,50,52,68,70,7,117,110,105,50,52,69,48,7,117,110,105,50,52,69,
+49,7,117,110,105,50,52,69,50,7,117,110,105,50,52,69,51,7,117,110,105,50,52,69,52,7,117,110,105,50,52,69,53,7,117,110,105,50,52,69,54,7,117,110,105,50,52,69,55,7,117,110,105,50,52,69,56,7,117,110,105,50,52,69,57,7,117,110,105,50,52,69,65,7,117,110,105,
+50,52,69,66,7,117,110,105,50,52,69,67,7,117,110,105,50,52,69,68,7,117,110,105,50,52,69,69,7,117,110,105,50,52,69,70,7,117,110,105,50,52,70,48,7,117,110,105,50,52,70,49,7,117,110,105,50,52,70,50,7,117,110,105,50,52,70,51,7,117,110,105,50,52,70,52,7,117,
+110,105,50,52,70,70,6,99,105,114,99,108,101,6,72,49,56,53,51,51,7,117,110,105,50,52,54,48,7,117,110,105,50,52,54,49,7,117,110,105,50,52,54,50,7,117,110,105,50,52,54,51,7,117,110,105,50,52,54,52,7,117,110,105,50,52,54,53,7,117,110,105,50,52,54,54,7,117,
+110,105,50,52,54,55,7,117,110,105,50,52,54,56,7,117,110,105,50,52,54,57,7,117,110,105,50,52,54,65,7,117,110,105,50,52,54,66,7,117,110,105,50,52,54,67,7,117,110,105,50,52,54,68,7,117,110,105,50,52,54,69,7,117,110,105,50,52,54,70,7,117,110,105,50,52,55,
+48,7,117,110,105,50,52,55,49,7,117,110,105,50,52,55,50,7,117,110,105,50,52,55,51,7,117,110,105,50,55,55,54,7,117,110,105,50,55,55,55,7,117,110,105,50,55,55,56,7,117,110,105,50,55,55,57,7,117,110,105,50,55,55,65,7,117,110,105,50,55,55,66,7,117,110,105,
+50,55,55,67,7,117,110,105,50,55,55,68,7,117,110,105,50,55,55,69,7,117,110,105,50,55,55,70,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,110,6,65,98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,101,107,7,97,111,103,111,110,101,107,
+11,67,99,105,114,99,117,109,102,108,101,120,11,99,99,105,114,99,117,109,102,108,101,120,10,67,100,111,116,97,99,99,101,110,116,10,99,100,111,116,97,99,99,101,110,116,6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,97,116,7,69,109,97,99,
+114,111,110,7,101,109,97,99,114,111,110,6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,116,97,99,99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,103,111,110,101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,
+6,101,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,99,105,114,99,117,109,102,108,101,120,10,71,100,111,116,97,99,99,101,110,116,10,103,100,111,116,97,99,99,101,110,116,7,117,110,105,48,49,50,50,7,117,110,105,48,49,50,51,11,72,
+99,105,114,99,117,109,102,108,101,120,11,104,99,105,114,99,117,109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,108,100,101,6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,97,99,114,111,110,6,73,98,114,101,118,101,6,105,
+98,114,101,118,101,7,73,111,103,111,110,101,107,7,105,111,103,111,110,101,107,10,73,100,111,116,97,99,99,101,110,116,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,120,11,106,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,51,54,
+7,117,110,105,48,49,51,55,12,107,103,114,101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,99,117,116,101,7,117,110,105,48,49,51,66,7,117,110,105,48,49,51,67,6,76,99,97,114,111,110,6,108,99,97,114,111,110,4,76,100,111,116,4,108,100,111,
+116,6,78,97,99,117,116,101,6,110,97,99,117,116,101,7,117,110,105,48,49,52,53,7,117,110,105,48,49,52,54,6,78,99,97,114,111,110,6,110,99,97,114,111,110,11,110,97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,7,79,109,97,99,114,111,110,
+7,111,109,97,99,114,111,110,6,79,98,114,101,118,101,6,111,98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,117,116,13,111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,116,101,6,114,97,99,117,116,101,7,117,110,105,48,49,53,
+54,7,117,110,105,48,49,53,55,6,82,99,97,114,111,110,6,114,99,97,114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,83,99,105,114,99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,54,50,7,117,110,105,
+48,49,54,51,6,84,99,97,114,111,110,6,116,99,97,114,111,110,4,84,98,97,114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,100,101,7,85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,101,118,101,6,117,98,114,101,118,101,5,85,
+114,105,110,103,5,117,114,105,110,103,13,85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,103,97,114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,103,111,110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,
+99,105,114,99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,120,11,121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,122,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,116,97,99,99,101,110,116,
+5,108,111,110,103,115,0,0,0,1,255,255,0,2,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,12,0,14,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,36,0,88,0,1,108,97,116,110,0,8,0,4,0,0,0,0,255,255,0,4,0,3,0,0,0,2,0,1,0,4,102,114,97,99,0,26,104,105,115,116,
+0,34,110,97,108,116,0,40,115,105,110,102,0,46,0,0,0,2,0,1,0,2,0,0,0,1,0,4,0,0,0,1,0,3,0,0,0,1,0,0,0,5,0,12,0,90,0,112,0,172,1,34,0,1,0,0,0,1,0,8,0,2,0,36,0,15,1,7,1,8,1,4,0,250,0,251,0,252,0,253,0,254,0,255,1,0,1,1,1,2,1,3,1,6,1,5,0,1,0,15,0,11,0,12,
+0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,224,0,1,0,0,0,1,0,8,0,2,0,8,0,1,0,213,0,1,0,1,0,18,0,4,0,0,0,1,0,8,0,1,0,44,0,2,0,10,0,32,0,2,0,6,0,14,0,122,0,3,0,213,0,21,0,121,0,3,0,213,0,23,0,1,0,4,0,123,0,3,0,213,0,23,0,1,0,2,0,20,0,
+22,0,1,0,0,0,1,0,8,0,2,0,56,0,25,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,0,1,0,25,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,51,0,52,0,53,
+0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,1,0,0,0,1,0,8,0,2,0,8,0,1,2,2,0,1,0,1,0,87,0,0 };
+
+const char* typoround_bold_otf = (const char*) temp_binary_data_0;
+
+
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes);
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
+{
+    unsigned int hash = 0;
+
+    if (resourceNameUTF8 != nullptr)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0x3a77363c:  numBytes = 65816; return typoround_bold_otf;
+        default: break;
+    }
+
+    numBytes = 0;
+    return nullptr;
+}
+
+const char* namedResourceList[] =
+{
+    "typoround_bold_otf"
+};
+
+const char* originalFilenames[] =
+{
+    "typo-round.bold.otf"
+};
+
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
+{
+    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
+        if (strcmp (namedResourceList[i], resourceNameUTF8) == 0)
+            return originalFilenames[i];
+
+    return nullptr;
+}
+
+}
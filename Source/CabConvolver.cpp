@@ -0,0 +1,301 @@
+/*
+  ==============================================================================
+
+    CabConvolver.cpp
+    Created: 19 Oct 2026 6:48:12pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "CabConvolver.h"
+
+namespace
+{
+    /* FNV-1a, only used to tell IR files apart */
+    uint64_t hashBytes(const void* data, const size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = 14695981039346656037ull;
+
+        for (size_t i = 0; i < size; i++)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+        return hash;
+    }
+
+    /* acc += x * h over interleaved re/im bins */
+    void multiplyAdd(float* acc, const float* x, const float* h, const int numBins)
+    {
+        for (int i = 0; i < numBins * 2; i += 2)
+        {
+            acc[i]     += (x[i] * h[i]) - (x[i + 1] * h[i + 1]);
+            acc[i + 1] += (x[i] * h[i + 1]) + (x[i + 1] * h[i]);
+        }
+    }
+
+    float dot(const float* a, const float* b, const int n)
+    {
+        float sum = 0.f;
+
+        for (int i = 0; i < n; i++)
+            sum += a[i] * b[i];
+
+        return sum;
+    }
+}
+
+std::shared_ptr<const CabImpulse_t> CabConvolver::loadImpulse(const juce::File& file, const double sampleRate, const bool portable)
+{
+    /* same weak reference cache as the filter tables, an IR goes away with the last instance using it */
+    static juce::CriticalSection cacheLock;
+    static std::vector<std::weak_ptr<const CabImpulse_t>> cache;
+
+    juce::MemoryMappedFile mapped(file, juce::MemoryMappedFile::readOnly);
+
+    if (mapped.getData() == nullptr || sampleRate <= 0.0) return {};
+
+    const uint64_t hash = hashBytes(mapped.getData(), mapped.getSize());
+    const juce::ScopedLock lock(cacheLock);
+
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+        std::shared_ptr<const CabImpulse_t> impulse = it->lock();
+
+        if (impulse == nullptr)
+        {
+            it = cache.erase(it);
+            continue;
+        }
+
+        if (impulse->hash == hash && impulse->sampleRate == sampleRate && impulse->portable == portable) return impulse;
+
+        ++it;
+    }
+
+    /* decoded straight out of the mapping, nothing gets copied into memory first */
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(
+        std::make_unique<juce::MemoryInputStream>(mapped.getData(), mapped.getSize(), false)));
+
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0) return {};
+
+    const int numChannels = juce::jmin(2, (int) reader->numChannels);
+    const double ratio = reader->sampleRate / sampleRate;
+    const int maxLength = (int) (maxSeconds * sampleRate);
+    const int fileLength = (int) juce::jmin(reader->lengthInSamples, (juce::int64) (maxLength * ratio) + 1);
+
+    juce::AudioBuffer<float> decoded(numChannels, fileLength);
+    reader->read(&decoded, 0, fileLength, 0, true, numChannels > 1);
+
+    /* brought to the rate the cab runs at */
+    const int length = juce::jlimit(1, maxLength, (int) std::ceil(fileLength / ratio));
+    juce::AudioBuffer<float> ir(numChannels, length);
+
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        if (ratio == 1.0)
+        {
+            ir.copyFrom(ch, 0, decoded, ch, 0, length);
+            continue;
+        }
+
+        juce::LagrangeInterpolator interpolator;
+        interpolator.process(ratio, decoded.getReadPointer(ch), ir.getWritePointer(ch), length, fileLength, 0);
+    }
+
+    std::shared_ptr<CabImpulse_t> impulse = prepareImpulse(ir, sampleRate, portable, hash);
+
+    cache.push_back(impulse);
+    return impulse;
+}
+
+std::shared_ptr<CabImpulse_t> CabConvolver::prepareImpulse(const juce::AudioBuffer<float>& ir, const double sampleRate,
+                                                           const bool portable, const uint64_t hash)
+{
+    std::shared_ptr<CabImpulse_t> impulse = std::make_shared<CabImpulse_t>();
+    const int numChannels = juce::jmin(2, ir.getNumChannels());
+    const int length = ir.getNumSamples();
+
+    juce::dsp::FFT fft(fftOrder);
+    PortableFFT<fftOrder> portableFft;
+    std::vector<float> buffer((size_t) fftSize * 2);
+
+    impulse->hash = hash;
+    impulse->sampleRate = sampleRate;
+    impulse->numChannels = numChannels;
+    impulse->numPartitions = juce::jmax(0, (length - 1) / partitionSize);
+    impulse->portable = portable;
+
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        const float* h = ir.getReadPointer(ch);
+
+        impulse->head[ch].assign((size_t) partitionSize, 0.f);
+
+        for (int i = 0; i < juce::jmin(partitionSize, length); i++)
+            impulse->head[ch][(size_t) (partitionSize - 1 - i)] = h[i];
+
+        impulse->spectra[ch].assign((size_t) (impulse->numPartitions * spectrumSize), 0.f);
+
+        for (int p = 0; p < impulse->numPartitions; p++)
+        {
+            const int start = (p + 1) * partitionSize;
+            const int n = juce::jmin(partitionSize, length - start);
+
+            std::fill(buffer.begin(), buffer.end(), 0.f);
+            std::copy(h + start, h + start + n, buffer.begin());
+
+            if (portable)
+                portableFft.performRealOnlyForwardTransform(buffer.data());
+            else
+                fft.performRealOnlyForwardTransform(buffer.data(), true);
+
+            std::copy(buffer.begin(), buffer.begin() + spectrumSize, impulse->spectra[ch].begin() + p * spectrumSize);
+        }
+    }
+
+    return impulse;
+}
+
+CabConvolver::CabConvolver(std::shared_ptr<const CabImpulse_t> newImpulse) : impulse(std::move(newImpulse))
+{
+    if (impulse == nullptr) return;
+
+    const size_t numPartitions = (size_t) juce::jmax(1, impulse->numPartitions);
+
+    if (impulse->portable)
+        portableFft = std::make_unique<PortableFFT<fftOrder>>();
+    else
+        fft = std::make_unique<juce::dsp::FFT>(fftOrder);
+
+    for (int ch = 0; ch < 2; ch++)
+    {
+        input[ch].assign((size_t) partitionSize * 2, 0.f);
+        tailOut[ch].assign((size_t) partitionSize, 0.f);
+        fdl[ch].assign(numPartitions * spectrumSize, 0.f);
+        acc[ch].assign((size_t) spectrumSize, 0.f);
+    }
+
+    scratch.assign((size_t) fftSize * 2, 0.f);
+}
+
+void CabConvolver::reset()
+{
+    if (impulse == nullptr) return;
+
+    for (int ch = 0; ch < 2; ch++)
+    {
+        std::fill(input[ch].begin(), input[ch].end(), 0.f);
+        std::fill(tailOut[ch].begin(), tailOut[ch].end(), 0.f);
+        std::fill(fdl[ch].begin(), fdl[ch].end(), 0.f);
+        std::fill(acc[ch].begin(), acc[ch].end(), 0.f);
+    }
+
+    fill = fdlPos = partsDone = 0;
+}
+
+void CabConvolver::process(float* left, float* right, const int numSamples)
+{
+    float* const io[2] = { left, right };
+    const int numPartitions = impulse->numPartitions;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        for (int ch = 0; ch < 2; ch++)
+        {
+            const int irChannel = juce::jmin(ch, impulse->numChannels - 1);
+
+            input[ch][(size_t) (partitionSize + fill)] = io[ch][i];
+
+            /* the window ends on the sample just written, the head is stored reversed to match */
+            io[ch][i] = dot(impulse->head[irChannel].data(), input[ch].data() + fill + 1, partitionSize) + tailOut[ch][(size_t) fill];
+        }
+
+        if (++fill == partitionSize) finishBlock();
+    }
+
+    /* keep pace: by the end of the partition every older spectrum has been multiplied in */
+    if (numPartitions > 1)
+        accumulatePartitions(((numPartitions - 1) * fill) / partitionSize);
+}
+
+void CabConvolver::forwardTransform(float* data)
+{
+    if (portableFft != nullptr)
+        portableFft->performRealOnlyForwardTransform(data);
+    else
+        fft->performRealOnlyForwardTransform(data, true);
+}
+
+void CabConvolver::inverseTransform(float* data)
+{
+    if (portableFft != nullptr)
+        portableFft->performRealOnlyInverseTransform(data);
+    else
+        fft->performRealOnlyInverseTransform(data);
+}
+
+void CabConvolver::accumulatePartitions(const int last)
+{
+    const int numPartitions = impulse->numPartitions;
+
+    /* partition j of the IR meets the input spectrum from j blocks before the coming boundary */
+    for (int j = partsDone + 1; j <= last; j++)
+    {
+        const int slot = ((fdlPos - (j - 1)) % numPartitions + numPartitions) % numPartitions;
+
+        for (int ch = 0; ch < 2; ch++)
+        {
+            const int irChannel = juce::jmin(ch, impulse->numChannels - 1);
+
+            multiplyAdd(acc[ch].data(), fdl[ch].data() + slot * spectrumSize,
+                        impulse->spectra[irChannel].data() + j * spectrumSize, partitionSize + 1);
+        }
+    }
+
+    partsDone = juce::jmax(partsDone, last);
+}
+
+void CabConvolver::finishBlock()
+{
+    const int numPartitions = impulse->numPartitions;
+
+    if (numPartitions > 0)
+    {
+        accumulatePartitions(numPartitions - 1);
+
+        fdlPos = (fdlPos + 1) % numPartitions;
+
+        for (int ch = 0; ch < 2; ch++)
+        {
+            const int irChannel = juce::jmin(ch, impulse->numChannels - 1);
+            float* x = fdl[ch].data() + fdlPos * spectrumSize;
+
+            std::copy(input[ch].begin(), input[ch].end(), scratch.begin());
+            std::fill(scratch.begin() + fftSize, scratch.end(), 0.f);
+
+            forwardTransform(scratch.data());
+            std::copy(scratch.begin(), scratch.begin() + spectrumSize, x);
+
+            multiplyAdd(acc[ch].data(), x, impulse->spectra[irChannel].data(), partitionSize + 1);
+
+            /* overlap-save: only the second half of the inverse is free of wrap-around */
+            std::copy(acc[ch].begin(), acc[ch].end(), scratch.begin());
+            std::fill(scratch.begin() + spectrumSize, scratch.end(), 0.f);
+
+            inverseTransform(scratch.data());
+            std::copy(scratch.begin() + partitionSize, scratch.begin() + fftSize, tailOut[ch].begin());
+
+            std::fill(acc[ch].begin(), acc[ch].end(), 0.f);
+        }
+    }
+
+    for (int ch = 0; ch < 2; ch++)
+        std::copy(input[ch].begin() + partitionSize, input[ch].end(), input[ch].begin());
+
+    fill = 0;
+    partsDone = 0;
+}
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    CabConvolver.h
+    Created: 19 Oct 2026 6:48:12pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PortableFFT.h"
+
+/* a cab IR set up for one sample rate, shared by every instance that loads the same file content */
+typedef struct CabImpulse_t
+{
+public:
+
+    uint64_t hash;
+    double sampleRate;
+    int numChannels, numPartitions;
+
+    /* spectra made with PortableFFT, for the deterministic render mode */
+    bool portable;
+
+    /* first partition as a plain FIR (reversed), the rest as spectra of partitionSize taps each */
+    std::vector<float> head[2], spectra[2];
+
+} CabImpulse_t;
+
+/*
+ * uniformly partitioned FFT convolution (overlap-save) with the first partition run as a direct
+ * FIR, so the stage adds no latency: the FFT part only has to start one partition late. at each
+ * partition boundary there's one forward FFT, one spectrum multiply and one inverse FFT per channel,
+ * the multiplies for all the older partitions are spread evenly over the samples in between, so the
+ * cost goes up with the IR length evenly across every block: a sub-block that reaches a boundary only
+ * costs the FFTs more than the others (Tools/Bench cab).
+ *
+ * everything is allocated in the constructor, off the audio thread, process() only does arithmetic.
+ * an IR prepared for the deterministic render mode runs every FFT through PortableFFT instead of
+ * juce::dsp::FFT, whose engine (and rounding) changes from platform to platform
+ */
+class CabConvolver
+{
+public:
+    static constexpr int partitionSize = 128;
+    static constexpr int fftOrder = 8;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int spectrumSize = (partitionSize + 1) * 2;
+
+    /* anything longer gets cut, ~1s is already well past any cab */
+    static constexpr double maxSeconds = 1.0;
+
+    /* null impulse = bypassed, which is how an unloaded cab gets handed to the audio thread */
+    CabConvolver(std::shared_ptr<const CabImpulse_t> newImpulse);
+    ~CabConvolver() {};
+
+    /* memory maps the file and hashes its content, decoding and FFTs only happen on a cache miss */
+    static std::shared_ptr<const CabImpulse_t> loadImpulse(const juce::File& file, const double sampleRate, const bool portable);
+
+    /* partitions an IR that's already at the right rate, hash is only what the cache tells IRs apart by */
+    static std::shared_ptr<CabImpulse_t> prepareImpulse(const juce::AudioBuffer<float>& ir, const double sampleRate,
+                                                        const bool portable, const uint64_t hash);
+
+    bool isActive() const { return impulse != nullptr; }
+    bool isPortable() const { return impulse != nullptr && impulse->portable; }
+    double getSampleRate() const { return impulse != nullptr ? impulse->sampleRate : 0.0; }
+
+    void reset();
+
+    /* in place, any block size */
+    void process(float* left, float* right, const int numSamples);
+
+private:
+    void finishBlock();
+    void accumulatePartitions(const int last);
+
+    /* whichever of the two FFTs the impulse was prepared with */
+    void forwardTransform(float* data);
+    void inverseTransform(float* data);
+
+    std::shared_ptr<const CabImpulse_t> impulse;
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::unique_ptr<PortableFFT<fftOrder>> portableFft;
+
+    /* per channel: the last two partitions of input, the FFT part of the current output partition,
+       the past input spectra (newest at fdlPos) and the sum building up for the next boundary */
+    std::vector<float> input[2], tailOut[2], fdl[2], acc[2];
+    std::vector<float> scratch;
+
+    int fill = 0, fdlPos = 0, partsDone = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CabConvolver)
+};
@@ -0,0 +1,236 @@
+/*
+  ==============================================================================
+
+    Crossover.h
+    Created: 19 Oct 2026 7:31:56pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "PortableMath.h"
+#include "FloatLanes.h"
+
+/*
+ * 2 or 3 band Linkwitz-Riley (LR4) split of the input. every band filter is two cascaded
+ * butterworth biquads, and filters that see the same input run side by side as SIMD lanes:
+ * one register holds low pass L/R and high pass L/R of a crossover, so a whole crossover costs
+ * two 4 lane biquads. in 3 band mode the low band also goes through the allpass the upper
+ * crossover leaves on the other bands, so the bands still add back up flat.
+ *
+ * the bands picked in the mask are summed into one signal for the engine, the rest into another
+ * that skips it, so the engine runs once per sample however many bands it's fed
+ */
+class LinkwitzRileySplit
+{
+public:
+    typedef FloatLanes Lanes;
+
+    enum { lowBand = 1, midBand = 2, highBand = 4 };
+
+    LinkwitzRileySplit() {};
+    ~LinkwitzRileySplit() {};
+
+    /* clears the filter states, the next setup() call is never skipped */
+    void reset()
+    {
+        for (auto& crossover : split)
+            for (auto& section : crossover)
+                section.clear();
+
+        allpass.clear();
+
+        lowFreq = highFreq = -1.f;
+    }
+
+    /* once per block is plenty, per lane since a single bad lane is enough to ruin a band */
+    void flushDenormals()
+    {
+        for (auto& crossover : split)
+            for (auto& section : crossover)
+                section.flush();
+
+        allpass.flush();
+    }
+
+    /* coefficients only, the states carry on so the crossovers can move without clicks */
+    void setup(const double sampleRate, const float newLowFreq, const float newHighFreq, const bool portable = false)
+    {
+        const double nyquist = sampleRate * 0.49;
+
+        lowFreq = newLowFreq;
+        highFreq = newHighFreq;
+
+        /* the upper crossover never sits below the lower one */
+        const double low = std::min((double) lowFreq, nyquist);
+        const double high = std::clamp((double) highFreq, low, nyquist);
+
+        for (auto& section : split[0]) section.setCrossover(sampleRate, low, portable);
+        for (auto& section : split[1]) section.setCrossover(sampleRate, high, portable);
+
+        allpass.setAllpass(sampleRate, high, portable);
+    }
+
+    /*
+     * numBands 2: low/high at lowFreq, 3: low/mid/high at lowFreq and highFreq.
+     * the bands set in mask end up in engineL/R, the others in cleanL/R
+     */
+    void process(const float* inL, const float* inR, float* engineL, float* engineR, float* cleanL, float* cleanR,
+                 const int numSamples, const int numBands, const int mask)
+    {
+        alignas(Lanes) float lanes[Lanes::SIMDNumElements] = {};
+        float gain[3][2];
+
+        /* 1 where the band goes to the engine, 0 where it's passed clean */
+        for (int band = 0; band < 3; band++)
+        {
+            gain[band][0] = (mask >> band) & 1 ? 1.f : 0.f;
+            gain[band][1] = 1.f - gain[band][0];
+        }
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            float bands[3][2] = {};
+
+            lanes[0] = lanes[2] = inL[i];
+            lanes[1] = lanes[3] = inR[i];
+
+            /* lanes: low L, low R, high L, high R */
+            Lanes y = split[0][1].process(split[0][0].process(Lanes::fromRawArray(lanes)));
+            y.copyToRawArray(lanes);
+
+            bands[0][0] = lanes[0];
+            bands[0][1] = lanes[1];
+            bands[2][0] = lanes[2];
+            bands[2][1] = lanes[3];
+
+            if (numBands > 2)
+            {
+                /* the high band splits again into mid and high, the low band gets the matching allpass */
+                lanes[0] = lanes[2];
+                lanes[1] = lanes[3];
+
+                y = split[1][1].process(split[1][0].process(Lanes::fromRawArray(lanes)));
+                y.copyToRawArray(lanes);
+
+                bands[1][0] = lanes[0];
+                bands[1][1] = lanes[1];
+                bands[2][0] = lanes[2];
+                bands[2][1] = lanes[3];
+
+                lanes[0] = bands[0][0];
+                lanes[1] = bands[0][1];
+                lanes[2] = lanes[3] = 0.f;
+
+                y = allpass.process(Lanes::fromRawArray(lanes));
+                y.copyToRawArray(lanes);
+
+                bands[0][0] = lanes[0];
+                bands[0][1] = lanes[1];
+            }
+
+            engineL[i] = (bands[0][0] * gain[0][0]) + (bands[1][0] * gain[1][0]) + (bands[2][0] * gain[2][0]);
+            engineR[i] = (bands[0][1] * gain[0][0]) + (bands[1][1] * gain[1][0]) + (bands[2][1] * gain[2][0]);
+
+            cleanL[i] = (bands[0][0] * gain[0][1]) + (bands[1][0] * gain[1][1]) + (bands[2][0] * gain[2][1]);
+            cleanR[i] = (bands[0][1] * gain[0][1]) + (bands[1][1] * gain[1][1]) + (bands[2][1] * gain[2][1]);
+        }
+    }
+
+    float lowFreq = -1.f, highFreq = -1.f;
+
+private:
+    /* transposed direct form II, one independent filter per lane */
+    typedef struct Biquad_t
+    {
+    public:
+
+        Lanes b0, b1, b2, a1, a2, s1, s2;
+
+        void clear()
+        {
+            s1 = Lanes::expand(0.f);
+            s2 = Lanes::expand(0.f);
+        }
+
+        void flush()
+        {
+            flushLanes(s1);
+            flushLanes(s2);
+        }
+
+        static void flushLanes(Lanes& lanes)
+        {
+            alignas(Lanes) float x[Lanes::SIMDNumElements];
+            lanes.copyToRawArray(x);
+
+            for (float& state : x)
+                if (!std::isfinite(state) || std::abs(state) < 1e-15f) state = 0.f;
+
+            lanes = Lanes::fromRawArray(x);
+        }
+
+        Lanes process(const Lanes x)
+        {
+            const Lanes y = (b0 * x) + s1;
+
+            s1 = (b1 * x) - (a1 * y) + s2;
+            s2 = (b2 * x) - (a2 * y);
+
+            return y;
+        }
+
+        /* butterworth (Q = 1/sqrt(2)) low pass in lanes 0/1, high pass in lanes 2/3 */
+        void setCrossover(const double sampleRate, const double freq, const bool portable)
+        {
+            const double w0 = (twoPi * freq) / sampleRate;
+            const double c = CoeffMath::cos(w0, portable);
+            const double alpha = CoeffMath::sin(w0, portable) * 0.70710678118654752440;
+            const double a0 = 1.0 + alpha;
+
+            alignas(Lanes) float b[3][Lanes::SIMDNumElements];
+
+            for (size_t lane = 0; lane < Lanes::SIMDNumElements; lane++)
+            {
+                const bool lowPass = lane < 2;
+
+                b[0][lane] = (float) ((lowPass ? (1.0 - c) * 0.5 : (1.0 + c) * 0.5) / a0);
+                b[1][lane] = (float) ((lowPass ? 1.0 - c : -(1.0 + c)) / a0);
+                b[2][lane] = (float) ((lowPass ? (1.0 - c) * 0.5 : (1.0 + c) * 0.5) / a0);
+            }
+
+            b0 = Lanes::fromRawArray(b[0]);
+            b1 = Lanes::fromRawArray(b[1]);
+            b2 = Lanes::fromRawArray(b[2]);
+            a1 = Lanes::expand((float) ((-2.0 * c) / a0));
+            a2 = Lanes::expand((float) ((1.0 - alpha) / a0));
+        }
+
+        /* LR4 low + high pass at the same frequency sum to this 2nd order allpass */
+        void setAllpass(const double sampleRate, const double freq, const bool portable)
+        {
+            const double w0 = (twoPi * freq) / sampleRate;
+            const double c = CoeffMath::cos(w0, portable);
+            const double alpha = CoeffMath::sin(w0, portable) * 0.70710678118654752440;
+            const double a0 = 1.0 + alpha;
+
+            b0 = Lanes::expand((float) ((1.0 - alpha) / a0));
+            b1 = Lanes::expand((float) ((-2.0 * c) / a0));
+            b2 = Lanes::expand(1.f);
+            a1 = Lanes::expand((float) ((-2.0 * c) / a0));
+            a2 = Lanes::expand((float) ((1.0 - alpha) / a0));
+        }
+
+    } Biquad_t;
+
+    static constexpr double twoPi = 2.0 * 3.141592653589793238;
+
+    /* [lower/upper crossover][section] */
+    Biquad_t split[2][2];
+    Biquad_t allpass;
+};
@@ -0,0 +1,491 @@
+/*
+  ==============================================================================
+
+    Engine.cpp
+    Created: 19 Oct 2026 10:41:08pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <mutex>
+#include <vector>
+#include "Engine.h"
+
+void SubdominantEngine::prepare(const double sampleRate, const int decimationStages, const bool portable)
+{
+    stages = decimationStages;
+
+    if (sampleRate != engineRate || portable != portableMath || coeffTables == nullptr)
+        coeffTables = getCoeffTables(sampleRate, portable);
+
+    engineRate = sampleRate;
+    portableMath = portable;
+}
+
+void SubdominantEngine::renderChunk(DSPState_t* s, const float* inL, const float* inR, const int numEngineSamples,
+                                    const float* dryL, const float* dryR, float* outL, float* outR,
+                                    float* dryOutL, float* dryOutR, const int numSamples)
+{
+    if (stages == 0)
+    {
+        renderBlock(s, inL, inR, outL, outR, numSamples);
+    }
+    else
+    {
+        renderBlock(s, inL, inR, blockBuf.wet[0], blockBuf.wet[1], numEngineSamples);
+        s->upsampler.process(blockBuf.wet[0], blockBuf.wet[1], numEngineSamples, outL, outR, numSamples);
+    }
+
+    blendDry(s, dryL, dryR, outL, outR, dryOutL, dryOutR, numSamples);
+}
+
+/* wet side scaled in place, dry side written out separately so the cab can sit between the two */
+void SubdominantEngine::blendDry(const DSPState_t* s, const float* dryL, const float* dryR, float* outL, float* outR,
+                                 float* dryOutL, float* dryOutR, const int numSamples) const
+{
+    const float wetGain = s->blend * s->masterVol;
+    const float dryGain = std::abs(s->blend - 1.f) * s->masterVol;
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        outL[i] *= wetGain;
+        outR[i] *= wetGain;
+
+        dryOutL[i] = dryL[i] * dryGain;
+        dryOutR[i] = dryR[i] * dryGain;
+    }
+}
+
+void SubdominantEngine::renderBlock(DSPState_t* s, const float* inL, const float* inR, float* outL, float* outR, const int numSamples)
+{
+    BlockBuffers_t& b = blockBuf;
+
+    const bool glitchModulated = s->glitchEnvDepth != 0.f || s->glitchLfoDepth != 0.f;
+    const bool filterModulated = s->filterEnvDepth != 0.f || s->filterLfoDepth != 0.f;
+
+    /*
+     * modulated cutoff positions, both filters share the one envelope follower and LFO. both keep running
+     * with every depth at zero, so turning one up picks the envelope and the LFO phase up where they are
+     * instead of from wherever they stopped. only the coefficient lookups below are skipped then
+     */
+    for (int i = 0; i < numSamples; i++)
+    {
+        const float env = s->envFollower.process(std::max(std::abs(inL[i]), std::abs(inR[i])));
+        const float lfo = s->lfo.process();
+
+        b.glitchPos[i] = std::clamp(s->glitchPos + (env * s->glitchEnvDepth) + (lfo * s->glitchLfoDepth), 0.f, 1.f);
+        b.filterPos[i] = std::clamp(s->filterPos + (env * s->filterEnvDepth) + (lfo * s->filterLfoDepth), 0.f, 1.f);
+    }
+
+    /* the envelope above follows the whole input, the engine below only sees the picked bands */
+    const bool split = s->numBands > 1;
+
+    const float* engineL = inL;
+    const float* engineR = inR;
+
+    if (split)
+    {
+        s->crossover.process(inL, inR, b.bandIn[0], b.bandIn[1], b.clean[0], b.clean[1], numSamples, s->numBands, s->bandMask);
+
+        engineL = b.bandIn[0];
+        engineR = b.bandIn[1];
+    }
+
+    /* gain stage, rectifier and the counter input filter, one sample at a time */
+    for (int i = 0; i < numSamples; i++)
+    {
+        if (glitchModulated) lookupTwoPoleCoeffs(b.glitchPos[i], &s->inSubOctLPF);
+
+        inputGain(s, &engineL[i], &engineR[i], &s->lm386);
+
+        fullWaveRect(&engineL[i], &engineR[i], &s->rectifier);
+
+        twoPoleLPFilter(&s->inSubOctLPF, &s->lm386.left, &s->lm386.right, &b.filtered[0][i], &b.filtered[1][i]);
+
+        b.lm386[0][i] = s->lm386.left;
+        b.lm386[1][i] = s->lm386.right;
+
+        b.rectifier[0][i] = s->rectifier.left;
+        b.rectifier[1][i] = s->rectifier.right;
+    }
+
+    /* counters run over the whole chunk, writing the already weighted sum of all sub-octave taps */
+    for (int ch = 0; ch < 2; ch++)
+        s->cd4024[ch].processBlock(b.filtered[ch], b.subOct[ch], s->subOctGain, Params::numSubOctaves, numSamples);
+
+    /* wet only, the dry side gets blended back in at the host rate by blendDry() */
+    for (int i = 0; i < numSamples; i++)
+    {
+        s->lm386.left  = b.lm386[0][i];
+        s->lm386.right = b.lm386[1][i];
+
+        s->rectifier.left  = b.rectifier[0][i];
+        s->rectifier.right = b.rectifier[1][i];
+
+        s->subOct.left  = b.subOct[0][i];
+        s->subOct.right = b.subOct[1][i];
+
+        mixWaves(s);
+
+        if (filterModulated) lookupOnePoleCoeffs(b.filterPos[i], &s->filterLPF);
+
+        onePoleLPFilter(&s->filterLPF, &s->mix.left, &s->mix.right, &outL[i], &outR[i]);
+
+        /* the bands left out join back in untouched, past the tone filter */
+        if (split)
+        {
+            outL[i] += b.clean[0][i];
+            outR[i] += b.clean[1][i];
+        }
+    }
+}
+
+void SubdominantEngine::sanitizeInput(float* samples, const int numSamples)
+{
+    for (int i = 0; i < numSamples; i++)
+        samples[i] = std::isfinite(samples[i]) && std::abs(samples[i]) >= 1e-20f ? samples[i] : 0.f;
+}
+
+void SubdominantEngine::flushFilterState(double* state, const int numStates)
+{
+    for (int i = 0; i < numStates; i++)
+        if (!std::isfinite(state[i]) || std::abs(state[i]) < 1e-15) state[i] = 0.0;
+}
+
+void SubdominantEngine::flushDenormals(DSPState_t* s)
+{
+    flushFilterState(s->inSubOctLPF.tmpL, 4);
+    flushFilterState(s->inSubOctLPF.tmpR, 4);
+    flushFilterState(&s->filterLPF.tmpL, 1);
+    flushFilterState(&s->filterLPF.tmpR, 1);
+
+    s->envFollower.flushDenormals();
+
+    if (s->numBands > 1) s->crossover.flushDenormals();
+}
+
+void SubdominantEngine::resetState(DSPState_t* s) const
+{
+    for (int i = 0; i < 2; i++)
+        s->cd4024[i] = PulseGen();
+
+    s->envFollower.setup(engineRate, 5.0, 120.0, portableMath);
+    s->envFollower.reset();
+    s->lfo.reset();
+
+    /* clearing leaves val < 0, which forces the next applyParams() to set the cutoffs up again */
+    clearOnePoleFilterState(&s->filterLPF);
+    clearTwoPoleFilterState(&s->inSubOctLPF);
+
+    s->crossover.reset();
+    s->numBands = 1;
+}
+
+
+/* 1-pole RC low-pass/high-pass filter, based on:
+** https://github.com/8bitbubsy/pt2-clone/blob/master/src/pt2_rcfilters.c
+** https://www.musicdsp.org/en/latest/Filters/116-one-pole-lp-and-hp.html
+*/
+
+void SubdominantEngine::clearOnePoleFilterState(OnePoleFilter_t* f) const
+{
+    f->tmpL = f->tmpR = 0.0;
+    f->val = -1.0;
+}
+
+void SubdominantEngine::setupOnePoleFilter(const double audioRate, const double cutOff, OnePoleFilter_t* f, const bool portable)
+{
+    const double a = cutOff < audioRate / 2.0 ? 2.0 - CoeffMath::cos((twoPi * cutOff) / audioRate, portable) :
+                             2.0 - CoeffMath::cos((twoPi * ((audioRate / 2.0) - 1E-4)) / audioRate, portable);
+
+    const double b = a - std::sqrt((a * a) - 1.0);
+
+    f->a1 = 1.0 - b;
+    f->a2 = b;
+}
+
+void SubdominantEngine::onePoleLPFilter(OnePoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR)
+{
+    f->tmpL = (*inL * f->a1) + (f->tmpL * f->a2);
+    *outL = (float)f->tmpL;
+
+    f->tmpR = (*inR * f->a1) + (f->tmpR * f->a2);
+    *outR = (float)f->tmpR;
+}
+
+/* 2-pole RC low-pass filter with Q factor, based on:
+** https://github.com/8bitbubsy/pt2-clone/blob/master/src/pt2_rcfilters.c
+** https://www.musicdsp.org/en/latest/Filters/38-lp-and-hp-filter.html
+*/
+
+void SubdominantEngine::clearTwoPoleFilterState(TwoPoleFilter_t* f) const
+{
+    f->tmpL[0] = f->tmpL[1] = f->tmpL[2] = f->tmpL[3] = 0.0;
+    f->tmpR[0] = f->tmpR[1] = f->tmpR[2] = f->tmpR[3] = 0.0;
+
+    f->val = -1.f;
+}
+
+void SubdominantEngine::setupTwoPoleFilter(const double audioRate, const double cutOff, const double qFactor, TwoPoleFilter_t* f,
+                                           const bool portable)
+{
+    const double a = cutOff < audioRate / 2.0 ? 1.0 / CoeffMath::tan((pi * cutOff) / audioRate, portable) : 
+                              1.0 / CoeffMath::tan((pi * ((audioRate / 2.0) - 1E-4)) / audioRate, portable);
+
+    const double b = 1.0 / qFactor;
+
+    f->a1 = 1.0 / (1.0 + b * a + a * a);
+    f->a2 = 2.0 * f->a1;
+    f->b1 = 2.0 * (1.0 - a * a) * f->a1;
+    f->b2 = (1.0 - b * a + a * a) * f->a1;
+}
+
+void SubdominantEngine::twoPoleLPFilter(TwoPoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR)
+{
+    const double LOut = (*inL * f->a1) + (f->tmpL[0] * f->a2) + (f->tmpL[1] * f->a1) - (f->tmpL[2] * f->b1) - (f->tmpL[3] * f->b2);
+    const double ROut = (*inR * f->a1) + (f->tmpR[0] * f->a2) + (f->tmpR[1] * f->a1) - (f->tmpR[2] * f->b1) - (f->tmpR[3] * f->b2);
+
+    // shift states
+
+    f->tmpL[1] = f->tmpL[0];
+    f->tmpL[0] = *inL;
+    f->tmpL[3] = f->tmpL[2];
+    f->tmpL[2] = LOut;
+
+    f->tmpR[1] = f->tmpR[0];
+    f->tmpR[0] = *inR;
+    f->tmpR[3] = f->tmpR[2];
+    f->tmpR[2] = ROut;
+
+    // set output
+
+    *outL = (float)LOut;
+    *outR = (float)ROut;
+}
+
+void SubdominantEngine::inputGain(const DSPState_t* s, const float* inL, const float* inR, squarewave_t* out) const
+{
+    /* total output gain of 200, 10:1 pad for "inst level" */
+    float gain[2] = { s->lineInstState ? *inL * 200.f : *inL * 20.f, s->lineInstState ? *inR * 200.f : *inR * 20.f };
+
+    /* output is already harshly squared off even without accounting for output gain*/
+    out->left  = gain[0] > 1.f ? 1.f : gain[0] < -1.f ? -1.f : gain[0];
+    out->right = gain[1] > 1.f ? 1.f : gain[1] < -1.f ? -1.f : gain[1];
+}
+
+void SubdominantEngine::fullWaveRect(const float* inL, const float* inR, squarewave_t* out) const
+{
+    /* invert phase of negative amplitude, applying gain/clipping */
+    float rectify[2] = { std::abs(*inL * 20.f) > 1.f ? 2.f : std::abs(*inL * 20.f),
+                         std::abs(*inR * 20.f) > 1.f ? 2.f : std::abs(*inR * 20.f) };
+
+    /* re-center back to +/- 1.0 range */
+    out->left  = rectify[0] == 0.f ? 0.0f : (rectify[0] - 1.f) * out->volume;
+    out->right = rectify[1] == 0.f ? 0.0f : (rectify[1] - 1.f) * out->volume;
+}
+
+void SubdominantEngine::mixWaves(DSPState_t* s)
+{
+    squarewave_t& mix = s->mix;
+
+    /* subOct already holds the sub-octave taps summed at 0.2 * their volumes */
+    mix.right = ((s->lm386.right * s->lm386.volume * 0.3f) + (s->rectifier.right * 0.3f) + s->subOct.right) * (10.f * mix.volume);
+    mix.left  = ((s->lm386.left  * s->lm386.volume * 0.3f) + (s->rectifier.left  * 0.3f) + s->subOct.left) * (10.f * mix.volume);
+
+    mix.left  = mix.left  > 1.f ? 1.f : mix.left < -1.f ? -1.f : mix.left;
+    mix.right = mix.right > 1.f ? 1.f : mix.right< -1.f ? -1.f : mix.right;
+}
+
+void SubdominantEngine::applyParams(DSPState_t* s, const float* values) const
+{
+    double glitchval = 0.f;
+    double filterval = 0.f;
+
+    glitchval = (double) values[Params::glitchAmount];
+    filterval = (double) values[Params::filterAmount];
+
+    s->glitchPos = values[Params::glitchAmount];
+    s->filterPos = values[Params::filterAmount];
+
+    s->glitchEnvDepth = values[Params::envGlitchDepth];
+    s->glitchLfoDepth = values[Params::lfoGlitchDepth];
+    s->filterEnvDepth = values[Params::envFilterDepth];
+    s->filterLfoDepth = values[Params::lfoFilterDepth];
+
+    s->lfoRate = values[Params::lfoRate];
+    s->lfoBeats = Params::lfoSyncBeats[std::clamp((int) values[Params::lfoSync], 0, Params::numLfoSyncs - 1)];
+
+    /*
+     * filter states are left alone on cutoff changes, only the coefficients move.
+     * a modulated filter gets its coefficients from the tables every sample, val < 0 makes
+     * sure the static ones are set up again as soon as the modulation is turned off
+     */
+    if (s->glitchEnvDepth != 0.f || s->glitchLfoDepth != 0.f)
+    {
+        s->inSubOctLPF.val = -1.0;
+    }
+    else if (glitchval != s->inSubOctLPF.val || s->inSubOctLPF.val < 0.f)
+    {
+        s->inSubOctLPF.val = glitchval;
+
+        setupTwoPoleFilter(engineRate, glitchCutoff(glitchval, portableMath), 0.660225, &s->inSubOctLPF, portableMath);
+    }
+
+    if (s->filterEnvDepth != 0.f || s->filterLfoDepth != 0.f)
+    {
+        s->filterLPF.val = -1.0;
+    }
+    else if (filterval != s->filterLPF.val || s->filterLPF.val < 0.f)
+    {
+        s->filterLPF.val = filterval;
+
+        setupOnePoleFilter(engineRate, filterCutoff(filterval, portableMath), &s->filterLPF, portableMath);
+    }
+
+    /*
+     * same goes for the crossovers, except a split that's only just been switched on starts from
+     * clear states, whatever it held from the last time it ran is long stale
+     */
+    const int numBands = 1 + std::clamp((int) values[Params::bandMode], 0, Params::numBandModes - 1);
+
+    s->bandMask = (values[Params::fuzzLow]  > 0.5f ? LinkwitzRileySplit::lowBand  : 0)
+                | (values[Params::fuzzMid]  > 0.5f ? LinkwitzRileySplit::midBand  : 0)
+                | (values[Params::fuzzHigh] > 0.5f ? LinkwitzRileySplit::highBand : 0);
+
+    if (numBands > 1)
+    {
+        if (s->numBands <= 1) s->crossover.reset();
+
+        if (values[Params::lowCrossover] != s->crossover.lowFreq || values[Params::highCrossover] != s->crossover.highFreq)
+            s->crossover.setup(engineRate, values[Params::lowCrossover], values[Params::highCrossover], portableMath);
+    }
+
+    s->numBands = numBands;
+
+    s->lm386.volume = values[Params::normVolume];
+    s->rectifier.volume = values[Params::domVolume];
+
+    for (int i = 0; i < Params::numSubOctaves; i++)
+        s->subOctGain[i] = values[Params::subVolume[i]] * 0.2f;
+
+    s->lineInstState = (int)values[Params::lineInst];
+
+    s->mix.volume = values[Params::gainAmount];
+    s->blend = values[Params::blendAmount];
+    s->masterVol = values[Params::masterVolume];
+}
+
+double SubdominantEngine::glitchCutoff(const double pos, const bool portable)
+{
+    /*
+     * logarithmic frequency sweep from 159hz - 20khz based on:
+     *   https://stackoverflow.com/questions/32320028/convert-linear-audio-frequency-distribution-to-logarithmic-perceptual-distributi 
+     */
+
+    return 159. * CoeffMath::pow(20000. / 159., pos / 1., portable);
+}
+
+double SubdominantEngine::filterCutoff(const double pos, const bool portable)
+{
+    /*
+     * logarithmic frequency sweep from 14.5hz - 20khz based on:
+     *   https://stackoverflow.com/questions/32320028/convert-lineaaudio-frequency-distribution-to-logarithmic-perceptual-distributi
+     */
+
+    return 1446.8 * CoeffMath::pow(20000. / 1446.8, pos / 1., portable);
+}
+
+/*
+ * the knob sweeps are exponential, so 256 linearly interpolated steps keep the effective cutoff
+ * within ~0.05% of the exact setup at 44.1khz - 192khz
+ */
+std::shared_ptr<const SubdominantEngine::CoeffTables_t> SubdominantEngine::getCoeffTables(const double sampleRate, const bool portable)
+{
+    /* the cache only holds weak references, a set goes away with the last instance using it */
+    static std::mutex cacheLock;
+    static std::vector<std::weak_ptr<const CoeffTables_t>> cache;
+
+    const std::lock_guard<std::mutex> lock(cacheLock);
+
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+        std::shared_ptr<const CoeffTables_t> tables = it->lock();
+
+        if (tables == nullptr)
+        {
+            it = cache.erase(it);
+            continue;
+        }
+
+        if (tables->sampleRate == sampleRate && tables->portable == portable) return tables;
+
+        ++it;
+    }
+
+    std::shared_ptr<CoeffTables_t> tables = std::make_shared<CoeffTables_t>();
+    TwoPoleFilter_t twoPole;
+    OnePoleFilter_t onePole;
+
+    tables->sampleRate = sampleRate;
+    tables->portable = portable;
+
+    for (int i = 0; i <= coeffTableSize; i++)
+    {
+        const double pos = (double) i / coeffTableSize;
+
+        setupTwoPoleFilter(sampleRate, glitchCutoff(pos, portable), 0.660225, &twoPole, portable);
+        setupOnePoleFilter(sampleRate, filterCutoff(pos, portable), &onePole, portable);
+
+        tables->glitch.a1[i] = twoPole.a1;
+        tables->glitch.a2[i] = twoPole.a2;
+        tables->glitch.b1[i] = twoPole.b1;
+        tables->glitch.b2[i] = twoPole.b2;
+
+        tables->filter.a1[i] = onePole.a1;
+        tables->filter.a2[i] = onePole.a2;
+    }
+
+    cache.push_back(tables);
+    return tables;
+}
+
+void SubdominantEngine::lookupTwoPoleCoeffs(const float pos, TwoPoleFilter_t* f) const
+{
+    const float x = pos * (float) coeffTableSize;
+    const int i = std::min((int) x, coeffTableSize - 1);
+    const double frac = (double) (x - (float) i);
+
+    const CoeffTable_t& t = coeffTables->glitch;
+
+    f->a1 = t.a1[i] + (t.a1[i + 1] - t.a1[i]) * frac;
+    f->a2 = t.a2[i] + (t.a2[i + 1] - t.a2[i]) * frac;
+    f->b1 = t.b1[i] + (t.b1[i + 1] - t.b1[i]) * frac;
+    f->b2 = t.b2[i] + (t.b2[i + 1] - t.b2[i]) * frac;
+}
+
+void SubdominantEngine::lookupOnePoleCoeffs(const float pos, OnePoleFilter_t* f) const
+{
+    const float x = pos * (float) coeffTableSize;
+    const int i = std::min((int) x, coeffTableSize - 1);
+    const double frac = (double) (x - (float) i);
+
+    const CoeffTable_t& t = coeffTables->filter;
+
+    f->a1 = t.a1[i] + (t.a1[i + 1] - t.a1[i]) * frac;
+    f->a2 = t.a2[i] + (t.a2[i + 1] - t.a2[i]) * frac;
+}
+
+void SubdominantEngine::updateLfo(DSPState_t* s, const double bpm) const
+{
+    /* tempo synced runs lfoBeats per cycle, free running goes at LFO RATE */
+    if (s->lfoBeats > 0.f && bpm > 0.0)
+        s->lfo.setIncrement(bpm / (60.0 * s->lfoBeats * engineRate));
+    else
+        s->lfo.setIncrement(s->lfoRate / engineRate);
+}
+
+void SubdominantEngine::lockLfoPhase(DSPState_t* s, const double bpm, const double ppq) const
+{
+    if (s->lfoBeats > 0.f && bpm > 0.0) s->lfo.setPhase(ppq / s->lfoBeats);
+}
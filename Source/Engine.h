@@ -0,0 +1,246 @@
+/*
+  ==============================================================================
+
+    Engine.h
+    Created: 19 Oct 2026 10:41:08pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include "Params.h"
+#include "PulseGen.h"
+#include "ModSources.h"
+#include "PortableMath.h"
+#include "Halfband.h"
+#include "Crossover.h"
+
+constexpr double pi = 3.141592653589793238;
+constexpr double twoPi = 2.0 * 3.141592653589793238;
+
+/*
+ * the sound of the pedal and nothing else: gain stage, rectifier, counters, mix, tone filter and
+ * blend, run over DSPState_t snapshots. no JUCE in here or in anything it includes, so the plugin
+ * and the C library in Core/ build the same render path. what goes around it (state hand-offs,
+ * programs, crossfades, the gate, the cab, resampling) is up to whoever owns the states
+ */
+class SubdominantEngine
+{
+public:
+    SubdominantEngine() {};
+    ~SubdominantEngine() {};
+
+    /*
+     * anything both threads write to gets a cache line of its own, and the hot per-sample state
+     * starts on one, so the audio thread never shares a line with something the message thread
+     * is busy with
+     */
+    static constexpr size_t cacheLine = 64;
+
+    static constexpr int subBlockSize = 32;
+    static constexpr int blockChunk = subBlockSize;
+
+    typedef struct SquareWave
+    {
+        float left;
+        float right;
+        float volume;
+    } squarewave_t;
+
+    typedef struct OnePoleFilter_t
+    {
+    public:
+
+        double tmpL, tmpR, a1, a2, val;
+
+    } OnePoleFilter_t;
+
+    typedef struct  TwoPoleFilter_t
+    {
+    public:
+
+        double tmpL[4], tmpR[4], a1, a2, b1, b2, val;
+
+    } TwoPoleFilter_t;
+
+    /* laid out in the order renderBlock() walks through it, block-rate fields at the end */
+    typedef struct alignas(cacheLine) DSPState_t
+    {
+    public:
+
+        /* modulation pass: knob positions (0..1) of both cutoffs, and how far the envelope/LFO push them around */
+        EnvelopeFollower envFollower;
+        TriangleLFO lfo;
+
+        float glitchPos, filterPos;
+        float glitchEnvDepth, glitchLfoDepth, filterEnvDepth, filterLfoDepth;
+
+        /* multiband: the bands set in bandMask go through the engine, the others skip it */
+        LinkwitzRileySplit crossover;
+        int numBands, bandMask;
+
+        /* gain stage, rectifier and counter input filter */
+        int lineInstState;
+        squarewave_t lm386, rectifier;
+        TwoPoleFilter_t inSubOctLPF;
+
+        /* counters */
+        PulseGen cd4024[2];
+        float subOctGain[Params::numSubOctaves];
+
+        /* mix, tone filter and output */
+        squarewave_t subOct, mix;
+        OnePoleFilter_t filterLPF;
+        HalfbandInterpolatorChain<blockChunk> upsampler;
+        float blend, masterVol;
+
+        /* only read once per block */
+        float lfoRate, lfoBeats;
+
+    } DSPState_t;
+
+    /*
+     * sub-blocks are rendered through these scratch buffers, small enough that a sub-block's whole
+     * working set stays in L1. the voices are left in them after every render for anyone who wants
+     * to look (the plugin's scope)
+     */
+    typedef struct BlockBuffers_t
+    {
+    public:
+
+        float lm386[2][blockChunk], rectifier[2][blockChunk], filtered[2][blockChunk],
+              subOct[2][blockChunk];
+
+        float glitchPos[blockChunk], filterPos[blockChunk];
+
+        /* multiband: what the engine gets and the bands passed around it */
+        float bandIn[2][blockChunk], clean[2][blockChunk];
+
+        /* decimated mode: the wet signal before it goes back up */
+        float wet[2][blockChunk];
+
+    } BlockBuffers_t;
+
+    /*
+     * sampleRate is the rate the states run at, with decimationStages > 0 renderChunk() takes the input
+     * at that rate and brings the wet side back up by 2^stages. everything below reads these, so they
+     * only change with no render running. only looks the coefficient tables up again if they moved
+     */
+    void prepare(const double sampleRate, const int decimationStages, const bool portable);
+
+    double getSampleRate() const { return engineRate; }
+    int getDecimationStages() const { return stages; }
+    bool isPortable() const { return portableMath; }
+
+    /* clears everything that carries over between samples, ready for applyParams() */
+    void resetState(DSPState_t* s) const;
+
+    /* values are plain parameter values, indexed by Params::Index */
+    void applyParams(DSPState_t* s, const float* values) const;
+
+    /*
+     * LFO speed from LFO RATE/SYNC and the tempo. it only goes into the state here, so whoever drives
+     * the engine calls it on every grid line, after applyParams(), like any other parameter change
+     */
+    void updateLfo(DSPState_t* s, const double bpm) const;
+
+    /* tempo synced only: moves the LFO to the host's beat position, free running it's left alone */
+    void lockLfoPhase(DSPState_t* s, const double bpm, const double ppq) const;
+
+    /*
+     * one sub-block of at most blockChunk samples: numEngineSamples of engine rate input in, numSamples
+     * of output rate wet signal out, scaled by the blend, and the dry input scaled by the other side of it
+     * in dryOutL/R, so something can sit on the wet side before they're summed
+     */
+    void renderChunk(DSPState_t* s, const float* inL, const float* inR, const int numEngineSamples, const float* dryL, const float* dryR,
+                     float* outL, float* outR, float* dryOutL, float* dryOutR, const int numSamples);
+
+    /*
+     * flush-to-zero is only a request, some hosts switch it back off under us. the feedback paths get
+     * cleared by hand, which also clears out anything non-finite. whoever drives the engine calls it
+     * when a grid sub-block is done, never partway through one, or the output would depend on where
+     * the host cuts its blocks
+     */
+    void flushDenormals(DSPState_t* s);
+
+    const BlockBuffers_t& getBuffers() const { return blockBuf; }
+
+    /*
+     * a NaN or inf from upstream would stick in every filter state for good. anything below 1e-20
+     * goes too: that's an upstream tail on its way into subnormals, and from there no gain in here
+     * (the gate's stops at 1e-15) can take it below the smallest normal float (Tools/Soak)
+     */
+    static void sanitizeInput(float* samples, const int numSamples);
+
+private:
+    void clearOnePoleFilterState(OnePoleFilter_t* f) const;
+    static void setupOnePoleFilter(const double audioRate, const double cutOff, OnePoleFilter_t* f, const bool portable);
+    void onePoleLPFilter(OnePoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR);
+
+    void clearTwoPoleFilterState(TwoPoleFilter_t* f) const;
+    static void setupTwoPoleFilter(const double audioRate, const double cutOff, const double qFactor, TwoPoleFilter_t* f,
+                                   const bool portable);
+    void twoPoleLPFilter(TwoPoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR);
+
+    void inputGain(const DSPState_t* s, const float* inL, const float* inR, squarewave_t* out)const;
+    void fullWaveRect(const float* inL, const float* inR, squarewave_t* out) const;
+
+    void mixWaves(DSPState_t* s);
+
+    static void flushFilterState(double* state, const int numStates);
+
+    void renderBlock(DSPState_t* s, const float* inL, const float* inR, float* outL, float* outR, const int numSamples);
+    void blendDry(const DSPState_t* s, const float* dryL, const float* dryR, float* outL, float* outR,
+                  float* dryOutL, float* dryOutR, const int numSamples) const;
+
+    alignas(cacheLine) BlockBuffers_t blockBuf;
+
+    /*
+     * coefficients of both filters over the whole knob range, so modulated cutoffs can be
+     * looked up every sample instead of going through cos/tan/sqrt
+     */
+    static constexpr int coeffTableSize = 256;
+
+    typedef struct CoeffTable_t
+    {
+    public:
+
+        double a1[coeffTableSize + 1], a2[coeffTableSize + 1], b1[coeffTableSize + 1], b2[coeffTableSize + 1];
+
+    } CoeffTable_t;
+
+    /* the tables only depend on the sample rate and math mode, so every engine running the same shares one set */
+    typedef struct CoeffTables_t
+    {
+    public:
+
+        double sampleRate;
+        bool portable;
+        CoeffTable_t glitch, filter;
+
+    } CoeffTables_t;
+
+    static double glitchCutoff(const double pos, const bool portable);
+    static double filterCutoff(const double pos, const bool portable);
+
+    static std::shared_ptr<const CoeffTables_t> getCoeffTables(const double sampleRate, const bool portable);
+    void lookupTwoPoleCoeffs(const float pos, TwoPoleFilter_t* f) const;
+    void lookupOnePoleCoeffs(const float pos, OnePoleFilter_t* f) const;
+
+    std::shared_ptr<const CoeffTables_t> coeffTables;
+
+    double engineRate = 0.0;
+    int stages = 0;
+
+    /*
+     * deterministic render mode: every coefficient goes through PortableMath instead of the platform's
+     * libm, see the processor for the rest of it
+     */
+    bool portableMath = false;
+};
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    FloatLanes.h
+    Created: 20 Oct 2026 11:48:12pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/* SD_NO_SIMD forces the plain loops, so the tests can check both ways give the same bits */
+#if defined(SD_NO_SIMD)
+ #define SD_FLOAT_LANES_SCALAR 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define SD_FLOAT_LANES_SSE2 1
+#elif defined(__ARM_NEON)
+ #include <arm_neon.h>
+ #define SD_FLOAT_LANES_NEON 1
+#endif
+
+/*
+ * four float lanes with just the operations the crossover, the halfbands and the scope need: one SSE or NEON
+ * register where there is one, plain loops elsewhere (gcc doesn't vectorise those at -O2, which is
+ * what the Release builds use, Tools/Bench bands). loads and stores take any alignment. the lanes
+ * are independent IEEE ops every way, with no fused multiply-add, so the result doesn't depend on
+ * which one it got
+ */
+typedef struct alignas(16) FloatLanes
+{
+public:
+
+    static constexpr size_t SIMDNumElements = 4;
+
+   #if SD_FLOAT_LANES_SSE2
+    __m128 v;
+
+    static FloatLanes expand(const float x)                 { return { _mm_set1_ps(x) }; }
+    static FloatLanes fromRawArray(const float* x)          { return { _mm_loadu_ps(x) }; }
+    void copyToRawArray(float* x) const                     { _mm_storeu_ps(x, v); }
+
+    FloatLanes operator+(const FloatLanes& o) const         { return { _mm_add_ps(v, o.v) }; }
+    FloatLanes operator-(const FloatLanes& o) const         { return { _mm_sub_ps(v, o.v) }; }
+    FloatLanes operator*(const FloatLanes& o) const         { return { _mm_mul_ps(v, o.v) }; }
+   #elif SD_FLOAT_LANES_NEON
+    float32x4_t v;
+
+    static FloatLanes expand(const float x)                 { return { vdupq_n_f32(x) }; }
+    static FloatLanes fromRawArray(const float* x)          { return { vld1q_f32(x) }; }
+    void copyToRawArray(float* x) const                     { vst1q_f32(x, v); }
+
+    FloatLanes operator+(const FloatLanes& o) const         { return { vaddq_f32(v, o.v) }; }
+    FloatLanes operator-(const FloatLanes& o) const         { return { vsubq_f32(v, o.v) }; }
+    FloatLanes operator*(const FloatLanes& o) const         { return { vmulq_f32(v, o.v) }; }
+   #else
+    float v[SIMDNumElements];
+
+    static FloatLanes expand(const float x)                 { FloatLanes r; for (size_t i = 0; i < SIMDNumElements; i++) r.v[i] = x; return r; }
+    static FloatLanes fromRawArray(const float* x)          { FloatLanes r; for (size_t i = 0; i < SIMDNumElements; i++) r.v[i] = x[i]; return r; }
+    void copyToRawArray(float* x) const                     { for (size_t i = 0; i < SIMDNumElements; i++) x[i] = v[i]; }
+
+    FloatLanes operator+(const FloatLanes& o) const         { FloatLanes r; for (size_t i = 0; i < SIMDNumElements; i++) r.v[i] = v[i] + o.v[i]; return r; }
+    FloatLanes operator-(const FloatLanes& o) const         { FloatLanes r; for (size_t i = 0; i < SIMDNumElements; i++) r.v[i] = v[i] - o.v[i]; return r; }
+    FloatLanes operator*(const FloatLanes& o) const         { FloatLanes r; for (size_t i = 0; i < SIMDNumElements; i++) r.v[i] = v[i] * o.v[i]; return r; }
+   #endif
+
+    /* across the lanes, in the same order on every platform */
+    float sum() const
+    {
+        float x[SIMDNumElements];
+        copyToRawArray(x);
+
+        return (x[0] + x[1]) + (x[2] + x[3]);
+    }
+
+} FloatLanes;
@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    KnobAtlas.h
+    Created: 19 Oct 2026 3:12:48pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* pre-rendered knob frames, owned by the process-wide NewLookAndFeel and
+   dropped together with the last editor */
+class KnobAtlas
+{
+public:
+    KnobAtlas() {};
+    ~KnobAtlas() {};
+
+    /*
+     * pointer positions per strip, ~2.8px of pointer travel per frame on the editor's 120px knobs.
+     * a strip is one knob size, scale and colour set: the editor only has the one, and a second
+     * scale when it moves to another screen. a full strip of 120px knobs is 3.7MB at 1x, 14.7MB
+     * at 2x (Tools/Bench knobAtlas), but frames only get rendered once a knob is set to them
+     */
+    static constexpr int numFrames = 64;
+    static constexpr int maxStrips = 4;
+
+    typedef struct KnobStyle_t
+    {
+    public:
+        float startAngle, endAngle;
+        juce::Colour fill, outline, pointer;
+    } KnobStyle_t;
+
+    /* the original vector drawing, used to render atlas frames */
+    static void renderKnob(juce::Graphics& g, const float x, const float y, const float width, const float height,
+                           const float sliderPos, const KnobStyle_t& style)
+    {
+        auto radius = juce::jmin(width / 2, height / 2) - 4.0f;
+        auto centreX = x + width * 0.5f;
+        auto centreY = y + height * 0.5f;
+        auto rx = centreX - radius;
+        auto ry = centreY - radius;
+        auto rw = radius * 2.0f;
+        auto angle = style.startAngle + sliderPos * (style.endAngle - style.startAngle);
+
+        // fill
+        g.setColour(style.fill);
+        g.fillEllipse(rx, ry, rw, rw);
+
+        // outline
+        g.setColour(style.outline);
+        g.drawEllipse(rx, ry, rw, rw, 4.0f);
+
+        juce::Path p;
+        auto pointerLength = radius * 0.33f;
+        p.addEllipse(-pointerLength * 0.5f, -radius * 0.8f, pointerLength, pointerLength);
+        p.applyTransform(juce::AffineTransform::rotation(angle).translated(centreX, centreY));
+
+        // pointer
+        g.setColour(style.pointer);
+        g.fillPath(p);
+    }
+
+    /* one blit per knob, frames are rendered the first time they are hit */
+    void draw(juce::Graphics& g, const int x, const int y, const int width, const int height,
+              const float sliderPos, const KnobStyle_t& style)
+    {
+        /* the knob is a circle in the middle, only its square is kept */
+        const int side = juce::jmin(width, height);
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        Strip_t* strip = getStrip(side, scale, style);
+        const int frame = juce::jlimit(0, numFrames - 1, juce::roundToInt(sliderPos * (float) (numFrames - 1)));
+
+        juce::Image& image = strip->frames[(size_t) frame];
+
+        if (!image.isValid())
+        {
+            const int pixels = juce::jmax(1, juce::roundToInt(side * scale));
+
+            image = juce::Image(juce::Image::ARGB, pixels, pixels, true);
+
+            juce::Graphics ig(image);
+            ig.addTransform(juce::AffineTransform::scale(scale));
+            renderKnob(ig, 0.f, 0.f, (float) side, (float) side, (float) frame / (float) (numFrames - 1), style);
+        }
+
+        g.drawImage(image, x + (width - side) / 2, y + (height - side) / 2, side, side, 0, 0, image.getWidth(), image.getHeight());
+    }
+
+    /* what the rendered frames take up, for Tools/Bench */
+    size_t getNumBytes() const
+    {
+        size_t bytes = 0;
+
+        for (const auto& s : strips)
+            for (const juce::Image& image : s->frames)
+                if (image.isValid()) bytes += (size_t) image.getWidth() * (size_t) image.getHeight() * 4;
+
+        return bytes;
+    }
+
+private:
+    typedef struct Strip_t
+    {
+    public:
+        int side;
+        float scale;
+        KnobStyle_t style;
+        std::vector<juce::Image> frames;
+    } Strip_t;
+
+    /* a handful of entries at most (one per knob size, scale and colour set), linear search is fine */
+    Strip_t* getStrip(const int side, const float scale, const KnobStyle_t& style)
+    {
+        for (auto& s : strips)
+        {
+            if (s->side == side && s->scale == scale &&
+                s->style.startAngle == style.startAngle && s->style.endAngle == style.endAngle &&
+                s->style.fill == style.fill && s->style.outline == style.outline && s->style.pointer == style.pointer)
+                return s.get();
+        }
+
+        if ((int) strips.size() >= maxStrips)
+            strips.erase(strips.begin());
+
+        auto s = std::make_unique<Strip_t>();
+        s->side = side;
+        s->scale = scale;
+        s->style = style;
+        s->frames.resize((size_t) numFrames);
+
+        strips.push_back(std::move(s));
+        return strips.back().get();
+    }
+
+    /* painting only ever happens on the message thread, so the cache needs no lock */
+    std::vector<std::unique_ptr<Strip_t>> strips;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (KnobAtlas)
+};
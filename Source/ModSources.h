@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    ModSources.h
+    Created: 19 Oct 2026 1:26:37pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include "PortableMath.h"
+
+/* peak envelope of the dry input, one-pole attack/release */
+class EnvelopeFollower
+{
+public:
+    EnvelopeFollower() {};
+    ~EnvelopeFollower() {};
+
+    void setup(const double sampleRate, const double attackMs, const double releaseMs, const bool portable = false)
+    {
+        attack  = (float) (1.0 - CoeffMath::exp(-1.0 / (sampleRate * attackMs * 0.001), portable));
+        release = (float) (1.0 - CoeffMath::exp(-1.0 / (sampleRate * releaseMs * 0.001), portable));
+    }
+
+    void reset() { env = 0.f; }
+
+    /* the release tail after silence ends up in denormals, a NaN never decays at all */
+    void flushDenormals() { if (!(env >= 1e-15f)) env = 0.f; }
+
+    float process(const float in)
+    {
+        env += (in - env) * (in > env ? attack : release);
+        return env;
+    }
+
+private:
+    float env = 0.f, attack = 1.f, release = 1.f;
+};
+
+/* bipolar triangle, phase runs 0..1 */
+class TriangleLFO
+{
+public:
+    TriangleLFO() {};
+    ~TriangleLFO() {};
+
+    void reset() { phase = 0.f; }
+
+    void setPhase(const double newPhase) { phase = (float) (newPhase - std::floor(newPhase)); }
+    void setIncrement(const double newInc) { inc = (float) newInc; }
+
+    float process()
+    {
+        const float out = 4.f * std::abs(phase - 0.5f) - 1.f;
+
+        phase += inc;
+
+        if (phase >= 1.f) phase -= 1.f;
+
+        return out;
+    }
+
+private:
+    float phase = 0.f, inc = 0.f;
+};
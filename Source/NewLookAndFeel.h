@@ -1,116 +1,171 @@
-/*
-  ==============================================================================
-
-    NewLookAndFeel.h
-    Created: 14 Jan 2024 7:07:33am
-    Author:  _astriid_
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-
-//==============================================================================
-/*
-*/
-class NewLookAndFeel  : public juce::LookAndFeel_V4
-{
-public:
-    NewLookAndFeel()
-    {
-        bauTypeface = juce::Typeface::createSystemTypefaceFor(BinaryData::typoround_bold_otf, BinaryData::typoround_bold_otfSize);
-        bauFont = juce::Font(bauTypeface);
-    }
-
-    ~NewLookAndFeel() override {}
-
-    juce::Font getCustomFont()
-    {
-        return bauFont;
-    }
-
-    juce::Font getLabelFont(juce::Label& label) override
-    {
-        const float height = label.getFont().getHeight();
-        return bauFont.withHeight(height);
-    }
-
-
-    void drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
-        const float rotaryStartAngle, const float rotaryEndAngle, juce::Slider&) override
-    {
-        auto radius = (float)juce::jmin(width / 2, height / 2) - 4.0f;
-        auto centreX = (float)x + (float)width * 0.5f;
-        auto centreY = (float)y + (float)height * 0.5f;
-        auto rx = centreX - radius;
-        auto ry = centreY - radius;
-        auto rw = radius * 2.0f;
-        auto angle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
-
-        // fill
-        g.setColour(juce::Colours::darkred);
-        g.fillEllipse(rx, ry, rw, rw);
-
-        // outline
-        g.setColour(juce::Colours::green);
-        g.drawEllipse(rx, ry, rw, rw, 4.0f);
-
-        juce::Path p;
-        auto pointerLength = radius * 0.33f;
-        p.addEllipse(-pointerLength * 0.5f, -radius * 0.8f, pointerLength, pointerLength);
-        p.applyTransform(juce::AffineTransform::rotation(angle).translated(centreX, centreY));
-
-        // pointer
-        g.setColour(juce::Colours::yellow);
-        g.fillPath(p);
-    }
-
-    void drawToggleButton(juce::Graphics& g, juce::ToggleButton& button,
-        bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
-    {
-        auto fontSize = (float)button.getHeight()   ;
-        auto tickWidth = fontSize * 1.1f;
-
-        drawTickBox(g, button, 4.0f, ((float)button.getHeight() - tickWidth) * 0.5f,
-            tickWidth, tickWidth,
-            button.getToggleState(),
-            button.isEnabled(),
-            shouldDrawButtonAsHighlighted,
-            shouldDrawButtonAsDown);
-
-        g.setColour(button.findColour(juce::ToggleButton::textColourId));
-        g.setFont(bauFont.withHeight(fontSize));
-
-        if (!button.isEnabled())
-            g.setOpacity(0.5f);
-
-        g.drawFittedText(button.getButtonText(),
-            button.getLocalBounds().withTrimmedLeft(juce::roundToInt(tickWidth) + 10)
-            .withTrimmedRight(2),
-            juce::Justification::centredLeft, 10);
-    }
-
-    void drawTickBox(juce::Graphics& g, juce::Component& component, float x, float y, float w, float h, const bool ticked,
-        const bool /*isEnabled*/, const bool /*shouldDrawButtonAsHighlighted*/, const bool /*shouldDrawButtonAsDown*/) override
-    {
-        juce::Rectangle<float> tickBounds(x, y, w, h);
-
-        if (ticked)
-        {
-            g.setColour(component.findColour(juce::ToggleButton::tickColourId));
-            g.fillRect(tickBounds);
-        }
-        else
-        {
-            g.setColour(component.findColour(juce::ToggleButton::tickDisabledColourId));
-            g.drawRect(tickBounds, 2.0f);
-        }
-    }
-
-private:
-    juce::Font bauFont;
-    juce::Typeface::Ptr bauTypeface;
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NewLookAndFeel)
-};
+/*
+  ==============================================================================
+
+    NewLookAndFeel.h
+    Created: 14 Jan 2024 7:07:33am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "KnobAtlas.h"
+
+//==============================================================================
+/*
+*/
+class NewLookAndFeel  : public juce::LookAndFeel_V4
+{
+public:
+    NewLookAndFeel()
+    {
+        bauTypeface = juce::Typeface::createSystemTypefaceFor(BinaryData::typoround_bold_otf, BinaryData::typoround_bold_otfSize);
+        bauFont = juce::Font(bauTypeface);
+
+        setColour(juce::Slider::rotarySliderFillColourId, juce::Colours::darkred);
+        setColour(juce::Slider::rotarySliderOutlineColourId, juce::Colours::green);
+        setColour(juce::Slider::thumbColourId, juce::Colours::yellow);
+    }
+
+    ~NewLookAndFeel() override {}
+
+    juce::Font getCustomFont()
+    {
+        return bauFont;
+    }
+
+    /* the static editor artwork, rendered once per size and display scale and shared by all editors.
+       a few entries are kept so editors on screens with different scales don't keep evicting each other */
+    const juce::Image& getEditorBackground(const int width, const int height, const float scale)
+    {
+        for (auto& b : editorBackgrounds)
+        {
+            if (b.image.isValid() && b.width == width && b.height == height && b.scale == scale)
+                return b.image;
+        }
+
+        EditorBackground_t& b = editorBackgrounds[nextEditorBackground];
+        nextEditorBackground = (nextEditorBackground + 1) % numEditorBackgrounds;
+
+        b.width = width;
+        b.height = height;
+        b.scale = scale;
+        b.image = juce::Image(juce::Image::RGB, juce::jmax(1, juce::roundToInt(width * scale)),
+                                                juce::jmax(1, juce::roundToInt(height * scale)), false);
+
+        juce::Graphics g(b.image);
+        g.addTransform(juce::AffineTransform::scale(scale));
+        drawEditorBackground(g, width, height);
+
+        return b.image;
+    }
+
+    void drawEditorBackground(juce::Graphics& g, const int width, const int height)
+    {
+        g.fillAll (juce::Colours::darkblue);
+
+        g.setColour(juce::Colours::gold);
+        g.fillRect(0, 200, 400, 400);
+        g.setColour(juce::Colours::darkred);
+        g.fillRect(0, 400, 200, 200);
+
+        g.setFont(bauFont.withHeight(30.f));
+
+        g.setColour(juce::Colours::darkred.darker(0.4f).withAlpha(0.8f));
+        g.drawText("SUB_DOMINANT", width - 200, height - 110, 192, 42, juce::Justification::bottomRight, false);
+        g.setColour(juce::Colours::red.darker(0.4f));
+        g.drawText("SUB_DOMINANT", width - 200, height - 110, 190, 40, juce::Justification::bottomRight, false);
+
+        g.setColour(juce::Colours::green.withAlpha(0.8f));
+        g.drawText("OCTAVE  FUZZ", width - 200, height - 80, 192, 42, juce::Justification::bottomRight, false);
+        g.setColour(juce::Colours::limegreen);
+        g.drawText("OCTAVE  FUZZ", width - 200, height - 80, 190, 40, juce::Justification::bottomRight, false);
+
+        g.setColour(juce::Colours::gold.withAlpha(0.4f));
+        g.drawText("by  _astriid_", width - 200, height - 50, 192, 42, juce::Justification::bottomRight, false);
+        g.setColour(juce::Colours::yellow);
+        g.drawText("by  _astriid_", width - 200, height - 50, 190, 40, juce::Justification::bottomRight, false);
+    }
+
+    juce::Font getLabelFont(juce::Label& label) override
+    {
+        const float height = label.getFont().getHeight();
+        return bauFont.withHeight(height);
+    }
+
+
+    void drawRotarySlider(juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+        const float rotaryStartAngle, const float rotaryEndAngle, juce::Slider& slider) override
+    {
+        const KnobAtlas::KnobStyle_t style = { rotaryStartAngle, rotaryEndAngle,
+                                               slider.findColour(juce::Slider::rotarySliderFillColourId),
+                                               slider.findColour(juce::Slider::rotarySliderOutlineColourId),
+                                               slider.findColour(juce::Slider::thumbColourId) };
+
+        knobAtlas.draw(g, x, y, width, height, sliderPos, style);
+    }
+
+    void drawToggleButton(juce::Graphics& g, juce::ToggleButton& button,
+        bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
+    {
+        auto fontSize = (float)button.getHeight()   ;
+        auto tickWidth = fontSize * 1.1f;
+
+        drawTickBox(g, button, 4.0f, ((float)button.getHeight() - tickWidth) * 0.5f,
+            tickWidth, tickWidth,
+            button.getToggleState(),
+            button.isEnabled(),
+            shouldDrawButtonAsHighlighted,
+            shouldDrawButtonAsDown);
+
+        g.setColour(button.findColour(juce::ToggleButton::textColourId));
+        g.setFont(bauFont.withHeight(fontSize));
+
+        if (!button.isEnabled())
+            g.setOpacity(0.5f);
+
+        g.drawFittedText(button.getButtonText(),
+            button.getLocalBounds().withTrimmedLeft(juce::roundToInt(tickWidth) + 10)
+            .withTrimmedRight(2),
+            juce::Justification::centredLeft, 10);
+    }
+
+    void drawTickBox(juce::Graphics& g, juce::Component& component, float x, float y, float w, float h, const bool ticked,
+        const bool /*isEnabled*/, const bool /*shouldDrawButtonAsHighlighted*/, const bool /*shouldDrawButtonAsDown*/) override
+    {
+        juce::Rectangle<float> tickBounds(x, y, w, h);
+
+        if (ticked)
+        {
+            g.setColour(component.findColour(juce::ToggleButton::tickColourId));
+            g.fillRect(tickBounds);
+        }
+        else
+        {
+            g.setColour(component.findColour(juce::ToggleButton::tickDisabledColourId));
+            g.drawRect(tickBounds, 2.0f);
+        }
+    }
+
+private:
+    juce::Font bauFont;
+    juce::Typeface::Ptr bauTypeface;
+    KnobAtlas knobAtlas;
+
+    typedef struct EditorBackground_t
+    {
+    public:
+        int width = 0, height = 0;
+        float scale = 0.f;
+        juce::Image image;
+    } EditorBackground_t;
+
+    static constexpr int numEditorBackgrounds = 4;
+
+    EditorBackground_t editorBackgrounds[numEditorBackgrounds];
+    int nextEditorBackground = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NewLookAndFeel)
+};
@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    NoiseGate.h
+    Created: 19 Oct 2026 3:02:18pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "PortableMath.h"
+
+/*
+ * gate keyed from the dry input: opens above the threshold, only closes once the level has
+ * dropped below threshold - hysteresis and stayed there for the hold time. the detector and
+ * the gain multiply are flat passes over the block, the only recursive part is the one-pole
+ * gain smoother, and nothing on the per-sample path divides.
+ *
+ * with lookahead on, the audio is delayed against the key so the gate is already open when
+ * a transient arrives, the delay has to be reported to the host as latency
+ */
+class NoiseGate
+{
+public:
+    NoiseGate() {};
+    ~NoiseGate() {};
+
+    void prepare(const double newSampleRate, const int maxLookahead)
+    {
+        sampleRate = newSampleRate;
+
+        delayL.assign((size_t) maxLookahead + 1, 0.f);
+        delayR.assign((size_t) maxLookahead + 1, 0.f);
+        writePos = 0;
+
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(delayL.begin(), delayL.end(), 0.f);
+        std::fill(delayR.begin(), delayR.end(), 0.f);
+
+        gain = 0.f;
+        holdLeft = 0;
+        open = false;
+    }
+
+    void setup(const float thresholdDb, const float hysteresisDb, const float attackMs, const float releaseMs,
+               const bool portable = false)
+    {
+        openLevel  = (float) CoeffMath::pow(10.0, thresholdDb * 0.05, portable);
+        closeLevel = (float) CoeffMath::pow(10.0, (thresholdDb - hysteresisDb) * 0.05, portable);
+
+        attack  = (float) (1.0 - CoeffMath::exp(-1.0 / (sampleRate * attackMs * 0.001), portable));
+        release = (float) (1.0 - CoeffMath::exp(-1.0 / (sampleRate * releaseMs * 0.001), portable));
+
+        holdSamples = (int) (sampleRate * 0.003);
+    }
+
+    void setLookahead(const int numSamples)
+    {
+        lookahead = std::min(numSamples, (int) delayL.size() - 1);
+    }
+
+    /*
+     * a closed gate's release would otherwise crawl through the denormals for good. called at the end
+     * of a grid sub-block like the engine's flushDenormals(), so it doesn't depend on the host's blocks
+     */
+    void flushDenormals()
+    {
+        if (gain < 1e-15f) gain = 0.f;
+    }
+
+    /* keyL/keyR is the dry input, outL/outR is gated (and delayed by the lookahead) in place */
+    void processBlock(const float* keyL, const float* keyR, float* outL, float* outR, const int numSamples)
+    {
+        for (int start = 0; start < numSamples; start += maxChunk)
+        {
+            const int n = std::min(maxChunk, numSamples - start);
+
+            processChunk(keyL + start, keyR + start, outL + start, outR + start, n);
+        }
+    }
+
+private:
+    static constexpr int maxChunk = 256;
+
+    void processChunk(const float* keyL, const float* keyR, float* outL, float* outR, const int numSamples)
+    {
+        float level[maxChunk], env[maxChunk];
+        unsigned char above[maxChunk], held[maxChunk];
+
+        for (int i = 0; i < numSamples; i++)
+            level[i] = std::max(std::abs(keyL[i]), std::abs(keyR[i]));
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            above[i] = level[i] > openLevel;
+            held[i]  = level[i] > closeLevel;
+        }
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            if (above[i] || (open && held[i]))
+            {
+                open = open || above[i];
+                holdLeft = holdSamples;
+            }
+            else if (open && --holdLeft <= 0)
+            {
+                open = false;
+            }
+
+            gain += ((open ? 1.f : 0.f) - gain) * (open ? attack : release);
+            env[i] = gain;
+        }
+
+        if (lookahead > 0) delayAudio(outL, outR, numSamples);
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            outL[i] *= env[i];
+            outR[i] *= env[i];
+        }
+    }
+
+    void delayAudio(float* outL, float* outR, const int numSamples)
+    {
+        const int size = (int) delayL.size();
+
+        for (int i = 0; i < numSamples; i++)
+        {
+            int readPos = writePos - lookahead;
+
+            if (readPos < 0) readPos += size;
+
+            delayL[(size_t) writePos] = outL[i];
+            delayR[(size_t) writePos] = outR[i];
+
+            outL[i] = delayL[(size_t) readPos];
+            outR[i] = delayR[(size_t) readPos];
+
+            if (++writePos == size) writePos = 0;
+        }
+    }
+
+    std::vector<float> delayL, delayR;
+    int writePos = 0, lookahead = 0;
+
+    double sampleRate = 44100.0;
+
+    float openLevel = 0.01f, closeLevel = 0.01f;
+    float attack = 1.f, release = 1.f;
+    int holdSamples = 128, holdLeft = 0;
+
+    float gain = 0.f;
+    bool open = false;
+};
@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    Params.h
+    Created: 19 Oct 2026 9:12:04am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstring>
+
+/* 
+ * flat index of every sound-shaping parameter, so a full set of values can be
+ * passed around as a plain float array (program snapshots, state setup, etc.)
+ */
+namespace Params
+{
+    enum Index
+    {
+        normVolume = 0,
+        domVolume,
+        sub1Volume,
+        sub2Volume,
+        filterAmount,
+        glitchAmount,
+        lineInst,
+        gainAmount,
+        blendAmount,
+        masterVolume,
+        sub3Volume,
+        sub4Volume,
+        envGlitchDepth,
+        envFilterDepth,
+        lfoGlitchDepth,
+        lfoFilterDepth,
+        lfoRate,
+        lfoSync,
+        gateThreshold,
+        gateHysteresis,
+        gateAttack,
+        gateRelease,
+        bandMode,
+        lowCrossover,
+        highCrossover,
+        fuzzLow,
+        fuzzMid,
+        fuzzHigh,
+
+        numParams
+    };
+
+    static const char* const ids[numParams] = { "NORM VOLUME", "DOM VOLUME", "SUB1 VOLUME", "SUB2 VOLUME",
+                                                "FILTER AMOUNT", "SUB GLITCH AMOUNT", "LINE/INST",
+                                                "GAIN AMOUNT", "BLEND AMOUNT", "MASTER VOLUME",
+                                                "SUB3 VOLUME", "SUB4 VOLUME",
+                                                "ENV GLITCH DEPTH", "ENV FILTER DEPTH",
+                                                "LFO GLITCH DEPTH", "LFO FILTER DEPTH", "LFO RATE", "LFO SYNC",
+                                                "GATE THRESHOLD", "GATE HYSTERESIS", "GATE ATTACK", "GATE RELEASE",
+                                                "BAND MODE", "LOW CROSSOVER", "HIGH CROSSOVER",
+                                                "FUZZ LOW", "FUZZ MID", "FUZZ HIGH" };
+
+    /*
+     * plain value range and default of each, for anything that sets parameters without going through
+     * the plugin's layout (the C library in Core/). has to match createParameters() in the processor
+     */
+    typedef struct Range_t
+    {
+    public:
+
+        float min, max, def;
+
+    } Range_t;
+
+    static const Range_t ranges[numParams] = { { 0.f, 1.f, 0.5f }, { 0.f, 1.f, 0.5f }, { 0.f, 1.f, 0.5f }, { 0.f, 1.f, 0.5f },
+                                               { 0.f, 1.f, 1.f }, { 0.f, 1.f, 0.01f }, { 0.f, 1.f, 1.f },
+                                               { 0.f, 1.f, 0.5f }, { 0.f, 1.f, 1.f }, { 0.f, 1.f, 0.5f },
+                                               { 0.f, 1.f, 0.f }, { 0.f, 1.f, 0.f },
+                                               { -1.f, 1.f, 0.f }, { -1.f, 1.f, 0.f },
+                                               { -1.f, 1.f, 0.f }, { -1.f, 1.f, 0.f }, { 0.05f, 20.f, 1.f }, { 0.f, 6.f, 0.f },
+                                               { -90.f, 0.f, -40.f }, { 0.f, 20.f, 3.f }, { 0.05f, 50.f, 0.1f }, { 5.f, 1000.f, 60.f },
+                                               { 0.f, 2.f, 0.f }, { 40.f, 1000.f, 250.f }, { 800.f, 8000.f, 2500.f },
+                                               { 0.f, 1.f, 0.f }, { 0.f, 1.f, 1.f }, { 0.f, 1.f, 1.f } };
+
+    /* SUB1..SUB4, tap n of the CD4024 counter */
+    constexpr int numSubOctaves = 4;
+
+    static const Index subVolume[numSubOctaves] = { sub1Volume, sub2Volume, sub3Volume, sub4Volume };
+
+    /* GATE THRESHOLD..GATE RELEASE sit next to each other, the gate's pow/exp setup only reruns when one of them moved */
+    constexpr int firstGateParam = gateThreshold;
+    constexpr int numGateParams = gateRelease - gateThreshold + 1;
+
+    inline bool gateChanged(const float* values, const float* previous)
+    {
+        return std::memcmp(values + firstGateParam, previous + firstGateParam, numGateParams * sizeof(float)) != 0;
+    }
+
+    /* LFO SYNC choices, LFO cycle length in beats (0 = free running at LFO RATE) */
+    constexpr int numLfoSyncs = 7;
+
+    static const char* const lfoSyncNames[numLfoSyncs] = { "Off", "2/1", "1/1", "1/2", "1/4", "1/8", "1/16" };
+    static const float lfoSyncBeats[numLfoSyncs] = { 0.f, 8.f, 4.f, 2.f, 1.f, 0.5f, 0.25f };
+
+    /* BAND MODE choices, index + 1 = number of bands (2 band splits at LOW CROSSOVER only) */
+    constexpr int numBandModes = 3;
+
+    static const char* const bandModeNames[numBandModes] = { "Full", "2 Band", "3 Band" };
+}
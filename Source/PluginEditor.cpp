@@ -1,202 +1,497 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin editor.
-
-  ==============================================================================
-*/
-
-#include "PluginProcessor.h"
-#include "PluginEditor.h"
-
-//==============================================================================
-SubdominantAudioProcessorEditor::SubdominantAudioProcessorEditor (SubdominantAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
-{
-    setLookAndFeel(&newLookAndFeel);
-
-    setRepaintsOnMouseActivity(false);
-
-    for (int i = 0; i < 4; i++)
-    {
-        const juce::Colour colour = i < 3 ? juce::Colours::blue : juce::Colours::limegreen;
-
-        initRotarySlider(&squareWaveVolSlider[i], &squareWaveVolLabel[i], squareWaveName[i], colour);
-
-        squareWaveVolAttachment[i] = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-            (audioProcessor.getAPVTS(), squareWaveAttachName[i], squareWaveVolSlider[i]);
-    }
-
-    initRotarySlider(&filterSlider, &filterLabel, "FLTR", juce::Colours::limegreen);
-    filterAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-        (audioProcessor.getAPVTS(), "FILTER AMOUNT", filterSlider);
-
-    initRotarySlider(&clipSlider, &clipLabel, "GAIN", juce::Colours::limegreen);
-    clipAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-        (audioProcessor.getAPVTS(), "GAIN AMOUNT", clipSlider);
-
-    initRotarySlider(&blendSlider, &blendLabel, "BLEND", juce::Colours::limegreen);
-    blendAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-        (audioProcessor.getAPVTS(), "BLEND AMOUNT", blendSlider);
-
-    initRotarySlider(&masterVolSlider, &masterVolLabel, "VOLUME", juce::Colours::limegreen);
-    masterVolAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-        (audioProcessor.getAPVTS(), "MASTER VOLUME", masterVolSlider);
-
-    initHrzntlSlider(&inSubOctLPFSlider, &inSubOctLPFLabel, "SUB OCT GLITCH");
-    inSubOctLPFAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
-        (audioProcessor.getAPVTS(), "SUB GLITCH AMOUNT", inSubOctLPFSlider);
-
-    initRadioButtons(&instButton, "INST", 1001);
-    initRadioButtons(&lineButton, "LINE", 1001);
-    instButton.onClick = [&] { audioProcessor.setLineInstState(0); };
-    lineButton.onClick = [&] { audioProcessor.setLineInstState(1); };
-
-    setSize (600, 600);
-}
-
-SubdominantAudioProcessorEditor::~SubdominantAudioProcessorEditor()
-{
-    setLookAndFeel(nullptr);
-}
-
-//==============================================================================
-void SubdominantAudioProcessorEditor::paint (juce::Graphics& g)
-{
-    bool lineInstState = (bool) audioProcessor.getLineInstState();
-
-    g.fillAll (juce::Colours::darkblue);
-
-    if (lineInstState != lineButton.getToggleState() || lineInstState == instButton.getToggleState())
-    {
-        lineButton.setToggleState(lineInstState, juce::dontSendNotification);
-        instButton.setToggleState(!lineInstState, juce::dontSendNotification);
-    }
-
-    g.setColour(juce::Colours::gold);
-    g.fillRect(0, 200, 400, 400);
-    g.setColour(juce::Colours::darkred);
-    g.fillRect(0, 400, 200, 200);
-
-    g.setFont(newLookAndFeel.getCustomFont().withHeight(30.f));
-
-    g.setColour(juce::Colours::darkred.darker(0.4f).withAlpha(0.8f));
-    g.drawText("SUB_DOMINANT", getWidth() - 200, getHeight() - 110, 192, 42, juce::Justification::bottomRight, false);
-    g.setColour(juce::Colours::red.darker(0.4f));
-    g.drawText("SUB_DOMINANT", getWidth() - 200, getHeight() - 110, 190, 40, juce::Justification::bottomRight, false);
-
-    g.setColour(juce::Colours::green.withAlpha(0.8f));
-    g.drawText("OCTAVE  FUZZ", getWidth() - 200, getHeight() - 80, 192, 42, juce::Justification::bottomRight, false);
-    g.setColour(juce::Colours::limegreen);
-    g.drawText("OCTAVE  FUZZ", getWidth() - 200, getHeight() - 80, 190, 40, juce::Justification::bottomRight, false);
-
-    g.setColour(juce::Colours::gold.withAlpha(0.4f));
-    g.drawText("by  _astriid_", getWidth() - 200, getHeight() - 50, 192, 42, juce::Justification::bottomRight, false);
-    g.setColour(juce::Colours::yellow);
-    g.drawText("by  _astriid_", getWidth() - 200, getHeight() - 50, 190, 40, juce::Justification::bottomRight, false);
-}
-
-void SubdominantAudioProcessorEditor::resized()
-{
-    const float slider_x = 0.03f;
-
-    clipSlider.setBoundsRelative(slider_x, 0.1f, 0.2f, 0.2f);
-    filterSlider.setBoundsRelative(slider_x + 0.2f, 0.1f, 0.2f, 0.2f);
-    squareWaveVolSlider[3].setBoundsRelative(slider_x + 0.4f, 0.1f, 0.2f, 0.2f);
-
-    for (int i = 0; i < 3; i++)
-        squareWaveVolSlider[i].setBoundsRelative(slider_x + (i * 0.2f), 0.4f, 0.2f, 0.2f);
-
-    masterVolSlider.setBoundsRelative(slider_x + 0.7f, 0.1f, 0.2f, 0.2f);
-    blendSlider.setBoundsRelative(slider_x + 0.7f, 0.4f, 0.2f, 0.2f);
-    
-    inSubOctLPFSlider.setBoundsRelative(0.02f, 0.94f, 0.19f, 0.05f);
-
-    lineButton.setBoundsRelative(0.35f, 0.95f, 0.1f, 0.03f);
-    instButton.setBoundsRelative(0.47f, 0.95f, 0.1f, 0.03f);
-}
-
-void SubdominantAudioProcessorEditor::initRotarySlider(juce::Slider* s, juce::Label* l, const juce::String& name, const juce::Colour& colour)
-{
-    const juce::Font labelFont = l == nullptr ? 0 : l->getFont().boldened().withHeight(24.f);
-    
-    if (s == nullptr) return;
-
-    addAndMakeVisible(*s);
-    s->setScrollWheelEnabled(false);
-    s->setRepaintsOnMouseActivity(false);
-    s->setMouseCursor(juce::MouseCursor::PointingHandCursor);
-    
-    s->setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalVerticalDrag);
-    s->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-
-    if (l == nullptr) return;
-
-    l->setFont(labelFont);
-    l->setJustificationType(juce::Justification::centredTop);
-    l->attachToComponent(s, false);
-    l->setColour(juce::Label::textColourId, colour);
-
-    if (name.isEmpty()) return;
-
-    l->setText(name, juce::dontSendNotification);
-}
-
-void SubdominantAudioProcessorEditor::initHrzntlSlider(juce::Slider* s, juce::Label* l, const juce::String& name)
-{
-    const juce::Font labelFont = l == nullptr ? 0 : l->getFont().boldened().withHeight(24.f);
-
-    if (s == nullptr) return;
-
-    addAndMakeVisible(*s);
-    s->setScrollWheelEnabled(false);
-    s->setRepaintsOnMouseActivity(false);
-    s->setMouseCursor(juce::MouseCursor::PointingHandCursor);
-
-    s->setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
-    s->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
-
-    s->setColour(juce::Slider::ColourIds::trackColourId, juce::Colours::blue.darker(0.4f));
-    s->setColour(juce::Slider::ColourIds::backgroundColourId, juce::Colours::darkblue.darker(0.2f));
-    s->setColour(juce::Slider::ColourIds::thumbColourId, juce::Colours::yellow);
-
-    if (l == nullptr) return;
-
-    l->setFont(16.f);
-    l->setJustificationType(juce::Justification::centredBottom);
-    l->attachToComponent(s, false);
-    l->setColour(juce::Label::textColourId, juce::Colours::yellow);
-
-    if (name.isEmpty()) return;
-
-    l->setText(name, juce::dontSendNotification);
-}
-
-void SubdominantAudioProcessorEditor::initRadioButtons(juce::ToggleButton* b, const juce::String& name, const int group)
-{
-    const juce::Font buttonFont = newLookAndFeel.getCustomFont().withHeight(24.f);
-
-    if (b == nullptr) return;
-
-    addAndMakeVisible(*b);
-    b->setRadioGroupId(group, juce::NotificationType::dontSendNotification);
-    b->setMouseCursor(juce::MouseCursor::PointingHandCursor);
-
-    b->setColour(juce::ToggleButton::tickColourId, juce::Colours::blue);
-    b->setColour(juce::ToggleButton::textColourId, juce::Colours::blue);
-    b->setColour(juce::ToggleButton::tickDisabledColourId, juce::Colours::blue);
-
-    if (name.isEmpty()) return;
-
-    b->setButtonText(name);
-}
-
-void SubdominantAudioProcessorEditor::parameterChanged(const juce::String& parameterID, float newValue)
-{
-    if (parameterID.containsIgnoreCase("LINE/INST"))
-    {
-        const bool on = (bool) newValue;
-        lineButton.setToggleState(on, juce::dontSendNotification);
-        instButton.setToggleState(!on, juce::dontSendNotification);
-    }
-}
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+//==============================================================================
+SubdominantAudioProcessorEditor::SubdominantAudioProcessorEditor (SubdominantAudioProcessor& p)
+    : AudioProcessorEditor (&p), audioProcessor (p), scopeView (p)
+{
+    setLookAndFeel(newLookAndFeel.get());
+
+    setRepaintsOnMouseActivity(false);
+    setOpaque(true);
+
+    for (int i = 0; i < numSquareWaves; i++)
+    {
+        const juce::Colour colour = i != 3 ? juce::Colours::blue : juce::Colours::limegreen;
+
+        initRotarySlider(&squareWaveVolSlider[i], &squareWaveVolLabel[i], squareWaveName[i], colour);
+
+        squareWaveVolAttachment[i] = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+            (audioProcessor.getAPVTS(), squareWaveAttachName[i], squareWaveVolSlider[i]);
+    }
+
+    initRotarySlider(&filterSlider, &filterLabel, "FLTR", juce::Colours::limegreen);
+    filterAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+        (audioProcessor.getAPVTS(), "FILTER AMOUNT", filterSlider);
+
+    initRotarySlider(&clipSlider, &clipLabel, "GAIN", juce::Colours::limegreen);
+    clipAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+        (audioProcessor.getAPVTS(), "GAIN AMOUNT", clipSlider);
+
+    initRotarySlider(&blendSlider, &blendLabel, "BLEND", juce::Colours::limegreen);
+    blendAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+        (audioProcessor.getAPVTS(), "BLEND AMOUNT", blendSlider);
+
+    initRotarySlider(&masterVolSlider, &masterVolLabel, "VOLUME", juce::Colours::limegreen);
+    masterVolAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+        (audioProcessor.getAPVTS(), "MASTER VOLUME", masterVolSlider);
+
+    initHrzntlSlider(&inSubOctLPFSlider, &inSubOctLPFLabel, "SUB OCT GLITCH");
+    inSubOctLPFAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+        (audioProcessor.getAPVTS(), "SUB GLITCH AMOUNT", inSubOctLPFSlider);
+
+    initRadioButtons(&instButton, "INST", 1001);
+    initRadioButtons(&lineButton, "LINE", 1001);
+    instButton.onClick = [&] { audioProcessor.setLineInstState(0); };
+    lineButton.onClick = [&] { audioProcessor.setLineInstState(1); };
+
+    initProgramBox();
+    initScope();
+    initCab();
+    initExtras();
+
+    syncLineInstButtons();
+    audioProcessor.getAPVTS().addParameterListener("LINE/INST", this);
+
+    /* notifications only raise flags, the timer coalesces them into one targeted update per tick */
+    startTimerHz(30);
+
+    setSize (panelSize, panelSize);
+}
+
+SubdominantAudioProcessorEditor::~SubdominantAudioProcessorEditor()
+{
+    audioProcessor.getAPVTS().removeParameterListener("LINE/INST", this);
+    stopTimer();
+    setLookAndFeel(nullptr);
+}
+
+//==============================================================================
+void SubdominantAudioProcessorEditor::paint (juce::Graphics& g)
+{
+    /* only the clipped region gets blitted, the artwork is shared by every open editor */
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const juce::Image& background = newLookAndFeel->getEditorBackground(getWidth(), panelSize, scale);
+
+    g.drawImageTransformed(background, juce::AffineTransform::scale(1.f / scale));
+
+    /* no artwork under the MORE section, just the panel's blue */
+    if (extrasPanel.isVisible())
+    {
+        g.setColour(juce::Colours::darkblue.darker(0.6f));
+        g.fillRect(extrasPanel.getBounds());
+    }
+}
+
+void SubdominantAudioProcessorEditor::resized()
+{
+    /* everything but the scope lives in the fixed size panel on top */
+    const juce::Rectangle<int> panel = getLocalBounds().removeFromTop(panelSize);
+    const auto place = [&panel] (juce::Component& c, const float x, const float y, const float w, const float h)
+    {
+        c.setBounds(panel.getProportion(juce::Rectangle<float>(x, y, w, h)));
+    };
+
+    const float slider_x = 0.03f;
+
+    place(clipSlider, slider_x, 0.1f, 0.2f, 0.2f);
+    place(filterSlider, slider_x + 0.2f, 0.1f, 0.2f, 0.2f);
+    place(squareWaveVolSlider[3], slider_x + 0.4f, 0.1f, 0.2f, 0.2f);
+
+    for (int i = 0; i < 3; i++)
+        place(squareWaveVolSlider[i], slider_x + (i * 0.2f), 0.4f, 0.2f, 0.2f);
+
+    /* SUB4/SUB3 sit under SUB2/SUB1 */
+    for (int i = 4; i < numSquareWaves; i++)
+        place(squareWaveVolSlider[i], slider_x + ((i - 4) * 0.2f), 0.68f, 0.2f, 0.2f);
+
+    place(masterVolSlider, slider_x + 0.7f, 0.1f, 0.2f, 0.2f);
+    place(blendSlider, slider_x + 0.7f, 0.4f, 0.2f, 0.2f);
+    
+    place(inSubOctLPFSlider, 0.02f, 0.94f, 0.19f, 0.05f);
+
+    place(lineButton, 0.35f, 0.95f, 0.1f, 0.03f);
+    place(instButton, 0.47f, 0.95f, 0.1f, 0.03f);
+
+    place(programBox, 0.03f, 0.01f, 0.3f, 0.04f);
+    place(storeButton, 0.35f, 0.01f, 0.1f, 0.04f);
+    place(scopeButton, 0.47f, 0.01f, 0.1f, 0.04f);
+    place(cabButton, 0.59f, 0.01f, 0.1f, 0.04f);
+    place(moreButton, 0.71f, 0.01f, 0.1f, 0.04f);
+
+    /* MORE: columns of short sliders, each under its label */
+    extrasPanel.setBounds(0, panelSize, getWidth(), extrasHeight);
+
+    const juce::Rectangle<int> extras = extrasPanel.getLocalBounds();
+    const auto placeExtra = [&extras] (juce::Component& c, const int column, const int row, const float h)
+    {
+        c.setBounds(extras.getProportion(juce::Rectangle<float>(0.03f + column * 0.33f, 0.1f + row * 0.15f, 0.28f, h)));
+    };
+
+    placeExtra(lfoSyncBox, 0, 0, 0.09f);
+    placeExtra(extraSlider[4], 0, 1, 0.07f);
+
+    for (int i = 0; i < 4; i++)
+        placeExtra(extraSlider[i], 0, 2 + i, 0.07f);
+
+    /* the gate in the middle column, in Params order */
+    for (int i = 0; i < Params::numGateParams; i++)
+        placeExtra(extraSlider[5 + i], 1, i, 0.07f);
+
+    /* the band split on the right, the fuzz band switches split the column's width three ways */
+    placeExtra(bandModeBox, 2, 0, 0.09f);
+    placeExtra(extraSlider[9], 2, 1, 0.07f);
+    placeExtra(extraSlider[10], 2, 2, 0.07f);
+
+    for (int i = 0; i < numFuzzBands; i++)
+        fuzzButton[i].setBounds(extras.getProportion(juce::Rectangle<float>(0.69f + i * 0.095f, 0.58f, 0.085f, 0.09f)));
+
+    scopeView.setBounds(getLocalBounds().withTrimmedTop(panelSize + (extrasPanel.isVisible() ? extrasHeight : 0)));
+}
+
+void SubdominantAudioProcessorEditor::syncLineInstButtons()
+{
+    const bool lineInstState = audioProcessor.getLineInstState();
+
+    /* setToggleState repaints the button, so only touch it on an actual change */
+    if (lineInstState != lineButton.getToggleState() || lineInstState == instButton.getToggleState())
+    {
+        lineButton.setToggleState(lineInstState, juce::dontSendNotification);
+        instButton.setToggleState(!lineInstState, juce::dontSendNotification);
+    }
+}
+
+void SubdominantAudioProcessorEditor::syncProgramBox()
+{
+    if (programsVersion != audioProcessor.getProgramsVersion())
+    {
+        refreshProgramBox();
+        return;
+    }
+
+    if (programBox.getSelectedItemIndex() != audioProcessor.getCurrentProgram())
+        programBox.setSelectedItemIndex(audioProcessor.getCurrentProgram(), juce::dontSendNotification);
+}
+
+void SubdominantAudioProcessorEditor::syncCabButton()
+{
+    const bool loaded = audioProcessor.hasCab();
+
+    if (loaded != cabButton.getToggleState())
+        cabButton.setToggleState(loaded, juce::dontSendNotification);
+}
+
+void SubdominantAudioProcessorEditor::timerCallback()
+{
+    if (lineInstChanged.exchange(false))
+        syncLineInstButtons();
+
+    syncProgramBox();
+    syncCabButton();
+}
+
+void SubdominantAudioProcessorEditor::initRotarySlider(juce::Slider* s, juce::Label* l, const juce::String& name, const juce::Colour& colour)
+{
+    const juce::Font labelFont = l == nullptr ? 0 : l->getFont().boldened().withHeight(24.f);
+    
+    if (s == nullptr) return;
+
+    addAndMakeVisible(*s);
+    s->setScrollWheelEnabled(false);
+    s->setRepaintsOnMouseActivity(false);
+    s->setMouseCursor(juce::MouseCursor::PointingHandCursor);
+    s->setBufferedToImage(true);
+    
+    s->setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalVerticalDrag);
+    s->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
+
+    if (l == nullptr) return;
+
+    l->setFont(labelFont);
+    l->setJustificationType(juce::Justification::centredTop);
+    l->attachToComponent(s, false);
+    l->setColour(juce::Label::textColourId, colour);
+
+    if (name.isEmpty()) return;
+
+    l->setText(name, juce::dontSendNotification);
+}
+
+void SubdominantAudioProcessorEditor::initHrzntlSlider(juce::Slider* s, juce::Label* l, const juce::String& name)
+{
+    const juce::Font labelFont = l == nullptr ? 0 : l->getFont().boldened().withHeight(24.f);
+
+    if (s == nullptr) return;
+
+    addAndMakeVisible(*s);
+    s->setScrollWheelEnabled(false);
+    s->setRepaintsOnMouseActivity(false);
+    s->setMouseCursor(juce::MouseCursor::PointingHandCursor);
+
+    s->setBufferedToImage(true);
+
+    s->setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
+    s->setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
+
+    s->setColour(juce::Slider::ColourIds::trackColourId, juce::Colours::blue.darker(0.4f));
+    s->setColour(juce::Slider::ColourIds::backgroundColourId, juce::Colours::darkblue.darker(0.2f));
+    s->setColour(juce::Slider::ColourIds::thumbColourId, juce::Colours::yellow);
+
+    if (l == nullptr) return;
+
+    l->setFont(16.f);
+    l->setJustificationType(juce::Justification::centredBottom);
+    l->attachToComponent(s, false);
+    l->setColour(juce::Label::textColourId, juce::Colours::yellow);
+
+    if (name.isEmpty()) return;
+
+    l->setText(name, juce::dontSendNotification);
+}
+
+void SubdominantAudioProcessorEditor::initRadioButtons(juce::ToggleButton* b, const juce::String& name, const int group)
+{
+    const juce::Font buttonFont = newLookAndFeel->getCustomFont().withHeight(24.f);
+
+    if (b == nullptr) return;
+
+    addAndMakeVisible(*b);
+    b->setRadioGroupId(group, juce::NotificationType::dontSendNotification);
+    b->setMouseCursor(juce::MouseCursor::PointingHandCursor);
+
+    b->setColour(juce::ToggleButton::tickColourId, juce::Colours::blue);
+    b->setColour(juce::ToggleButton::textColourId, juce::Colours::blue);
+    b->setColour(juce::ToggleButton::tickDisabledColourId, juce::Colours::blue);
+
+    if (name.isEmpty()) return;
+
+    b->setButtonText(name);
+}
+
+void SubdominantAudioProcessorEditor::initProgramBox()
+{
+    addAndMakeVisible(programBox);
+    programBox.setMouseCursor(juce::MouseCursor::PointingHandCursor);
+
+    programBox.setColour(juce::ComboBox::backgroundColourId, juce::Colours::darkblue.darker(0.2f));
+    programBox.setColour(juce::ComboBox::outlineColourId, juce::Colours::blue);
+    programBox.setColour(juce::ComboBox::textColourId, juce::Colours::yellow);
+    programBox.setColour(juce::ComboBox::arrowColourId, juce::Colours::yellow);
+
+    refreshProgramBox();
+
+    programBox.onChange = [&]
+    {
+        const int index = programBox.getSelectedItemIndex();
+
+        if (index >= 0 && index != audioProcessor.getCurrentProgram())
+            audioProcessor.setCurrentProgram(index);
+    };
+
+    addAndMakeVisible(storeButton);
+    storeButton.setMouseCursor(juce::MouseCursor::PointingHandCursor);
+    storeButton.setButtonText("STORE");
+
+    storeButton.setColour(juce::TextButton::buttonColourId, juce::Colours::darkblue.darker(0.2f));
+    storeButton.setColour(juce::TextButton::textColourOffId, juce::Colours::yellow);
+
+    /* factory programs are read-only, storing from one of them goes to the first user slot */
+    storeButton.onClick = [&]
+    {
+        const int current = audioProcessor.getCurrentProgram();
+        const int index = audioProcessor.isUserProgram(current) ? current : PresetBank::numFactoryPrograms;
+
+        audioProcessor.storeUserProgram(index, {});
+        refreshProgramBox();
+    };
+}
+
+void SubdominantAudioProcessorEditor::initScope()
+{
+    /* the scope hangs off the bottom of the panel, the audio thread only feeds it while it's open */
+    addChildComponent(scopeView);
+
+    initToggleButton(&scopeButton, "SCOPE");
+    addAndMakeVisible(scopeButton);
+
+    scopeButton.onClick = [&]
+    {
+        scopeView.setVisible(scopeButton.getToggleState());
+        updateSize();
+    };
+}
+
+void SubdominantAudioProcessorEditor::initCab()
+{
+    addAndMakeVisible(cabButton);
+    cabButton.setMouseCursor(juce::MouseCursor::PointingHandCursor);
+    cabButton.setButtonText("CAB");
+
+    cabButton.setColour(juce::TextButton::buttonColourId, juce::Colours::darkblue.darker(0.2f));
+    cabButton.setColour(juce::TextButton::buttonOnColourId, juce::Colours::blue);
+    cabButton.setColour(juce::TextButton::textColourOffId, juce::Colours::yellow);
+    cabButton.setColour(juce::TextButton::textColourOnId, juce::Colours::yellow);
+
+    syncCabButton();
+
+    /* straight to the file dialog with nothing loaded, otherwise a menu to swap or remove the IR */
+    cabButton.onClick = [&]
+    {
+        if (!audioProcessor.hasCab())
+        {
+            chooseCab();
+            return;
+        }
+
+        juce::PopupMenu menu;
+        menu.addSectionHeader(audioProcessor.getCabName());
+        menu.addItem(1, "Load IR...");
+        menu.addItem(2, "Remove IR");
+
+        menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(&cabButton),
+                           [editor = juce::Component::SafePointer<SubdominantAudioProcessorEditor>(this)] (int result)
+        {
+            if (editor == nullptr) return;
+
+            if (result == 1) editor->chooseCab();
+            if (result == 2) editor->audioProcessor.clearCab();
+
+            editor->syncCabButton();
+        });
+    };
+}
+
+void SubdominantAudioProcessorEditor::initExtras()
+{
+    addChildComponent(extrasPanel);
+
+    initToggleButton(&moreButton, "MORE");
+    addAndMakeVisible(moreButton);
+
+    moreButton.onClick = [&]
+    {
+        extrasPanel.setVisible(moreButton.getToggleState());
+        updateSize();
+    };
+
+    for (int i = 0; i < numExtraSliders; i++)
+    {
+        initHrzntlSlider(&extraSlider[i], &extraLabel[i], extraName[i]);
+        extrasPanel.addAndMakeVisible(extraSlider[i]);
+
+        extraAttachment[i] = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>
+            (audioProcessor.getAPVTS(), Params::ids[extraParam[i]], extraSlider[i]);
+    }
+
+    /* the attachments pick the item by index, the box has to list the choices in the parameter's order */
+    initChoiceBox(&lfoSyncBox, &lfoSyncLabel, "LFO SYNC", juce::StringArray(Params::lfoSyncNames, Params::numLfoSyncs));
+    lfoSyncAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>
+        (audioProcessor.getAPVTS(), Params::ids[Params::lfoSync], lfoSyncBox);
+
+    initChoiceBox(&bandModeBox, &bandModeLabel, "BAND MODE", juce::StringArray(Params::bandModeNames, Params::numBandModes));
+    bandModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>
+        (audioProcessor.getAPVTS(), Params::ids[Params::bandMode], bandModeBox);
+
+    for (int i = 0; i < numFuzzBands; i++)
+    {
+        initToggleButton(&fuzzButton[i], fuzzName[i]);
+        extrasPanel.addAndMakeVisible(fuzzButton[i]);
+
+        fuzzAttachment[i] = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>
+            (audioProcessor.getAPVTS(), Params::ids[fuzzParam[i]], fuzzButton[i]);
+    }
+
+    fuzzLabel.setFont(16.f);
+    fuzzLabel.setJustificationType(juce::Justification::centredBottom);
+    fuzzLabel.attachToComponent(&fuzzButton[1], false);
+    fuzzLabel.setColour(juce::Label::textColourId, juce::Colours::yellow);
+    fuzzLabel.setText("FUZZ", juce::dontSendNotification);
+}
+
+void SubdominantAudioProcessorEditor::initChoiceBox(juce::ComboBox* b, juce::Label* l, const juce::String& name, const juce::StringArray& choices)
+{
+    if (b == nullptr) return;
+
+    extrasPanel.addAndMakeVisible(*b);
+    b->setMouseCursor(juce::MouseCursor::PointingHandCursor);
+    b->addItemList(choices, 1);
+
+    b->setColour(juce::ComboBox::backgroundColourId, juce::Colours::darkblue.darker(0.2f));
+    b->setColour(juce::ComboBox::outlineColourId, juce::Colours::blue);
+    b->setColour(juce::ComboBox::textColourId, juce::Colours::yellow);
+    b->setColour(juce::ComboBox::arrowColourId, juce::Colours::yellow);
+
+    if (l == nullptr) return;
+
+    l->setFont(16.f);
+    l->setJustificationType(juce::Justification::centredBottom);
+    l->attachToComponent(b, false);
+    l->setColour(juce::Label::textColourId, juce::Colours::yellow);
+    l->setText(name, juce::dontSendNotification);
+}
+
+/* the look of the buttons along the top, latching */
+void SubdominantAudioProcessorEditor::initToggleButton(juce::TextButton* b, const juce::String& name)
+{
+    if (b == nullptr) return;
+
+    b->setMouseCursor(juce::MouseCursor::PointingHandCursor);
+    b->setButtonText(name);
+    b->setClickingTogglesState(true);
+
+    b->setColour(juce::TextButton::buttonColourId, juce::Colours::darkblue.darker(0.2f));
+    b->setColour(juce::TextButton::buttonOnColourId, juce::Colours::blue);
+    b->setColour(juce::TextButton::textColourOffId, juce::Colours::yellow);
+    b->setColour(juce::TextButton::textColourOnId, juce::Colours::yellow);
+}
+
+/* the panel, then MORE if it's open, then the scope if it's open */
+void SubdominantAudioProcessorEditor::updateSize()
+{
+    setSize(panelSize, panelSize + (extrasPanel.isVisible() ? extrasHeight : 0) + (scopeView.isVisible() ? scopeHeight : 0));
+}
+
+void SubdominantAudioProcessorEditor::chooseCab()
+{
+    cabChooser = std::make_unique<juce::FileChooser>("Load cab IR", juce::File(), "*.wav;*.aif;*.aiff;*.flac");
+
+    cabChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles,
+                            [this] (const juce::FileChooser& chooser)
+    {
+        const juce::File file = chooser.getResult();
+
+        if (file.existsAsFile()) audioProcessor.loadCab(file);
+
+        syncCabButton();
+    });
+}
+
+void SubdominantAudioProcessorEditor::refreshProgramBox()
+{
+    programsVersion = audioProcessor.getProgramsVersion();
+    programBox.clear(juce::dontSendNotification);
+
+    for (int i = 0; i < audioProcessor.getNumPrograms(); i++)
+    {
+        if (i == PresetBank::numFactoryPrograms) programBox.addSeparator();
+
+        programBox.addItem(audioProcessor.getProgramName(i), i + 1);
+    }
+
+    programBox.setSelectedItemIndex(audioProcessor.getCurrentProgram(), juce::dontSendNotification);
+}
+
+/* can arrive on the audio thread during automation, so nothing here touches a component */
+void SubdominantAudioProcessorEditor::parameterChanged(const juce::String& parameterID, float /*newValue*/)
+{
+    if (parameterID == "LINE/INST")
+        lineInstChanged.store(true);
+}
@@ -1,59 +1,128 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin editor.
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "PluginProcessor.h"
-#include "NewLookAndFeel.h"
-
-//==============================================================================
-/**
-*/
-class SubdominantAudioProcessorEditor  : public juce::AudioProcessorEditor,
-                                         public juce::AudioProcessorValueTreeState::Listener
-{
-public:
-    SubdominantAudioProcessorEditor (SubdominantAudioProcessor&);
-    ~SubdominantAudioProcessorEditor() override;
-
-    //==============================================================================
-    void paint (juce::Graphics&) override;
-    void resized() override;
-
-private:
-    void initRotarySlider(juce::Slider*, juce::Label*, const juce::String&, const juce::Colour&);
-    void initHrzntlSlider(juce::Slider*, juce::Label*, const juce::String&);
-    void initRadioButtons(juce::ToggleButton*, const juce::String&, const int);
-
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
-
-    juce::ToggleButton instButton, lineButton;
-
-    juce::Slider squareWaveVolSlider[4];
-    juce::Slider filterSlider, inSubOctLPFSlider, clipSlider, 
-                 blendSlider, masterVolSlider;
-
-    juce::Label squareWaveVolLabel[4];
-    juce::Label filterLabel, inSubOctLPFLabel, clipLabel, 
-                blendLabel, masterVolLabel;
-
-    juce::String squareWaveName[4] = { "SUB2", "SUB1", "DOM", "NORM" };
-    juce::String squareWaveAttachName[4] = { "SUB2 VOLUME","SUB1 VOLUME",
-                                             "DOM VOLUME", "NORM VOLUME", };
-
-    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> squareWaveVolAttachment[4], filterAttachment,
-                                                                          inSubOctLPFAttachment, clipAttachment, 
-                                                                          blendAttachment, masterVolAttachment;
-
-    NewLookAndFeel newLookAndFeel;
-
-    SubdominantAudioProcessor& audioProcessor;
-
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SubdominantAudioProcessorEditor)
-};
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "NewLookAndFeel.h"
+#include "ScopeView.h"
+
+//==============================================================================
+/**
+*/
+class SubdominantAudioProcessorEditor  : public juce::AudioProcessorEditor,
+                                         public juce::AudioProcessorValueTreeState::Listener,
+                                         private juce::Timer
+{
+public:
+    SubdominantAudioProcessorEditor (SubdominantAudioProcessor&);
+    ~SubdominantAudioProcessorEditor() override;
+
+    //==============================================================================
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+private:
+    void initRotarySlider(juce::Slider*, juce::Label*, const juce::String&, const juce::Colour&);
+    void initHrzntlSlider(juce::Slider*, juce::Label*, const juce::String&);
+    void initRadioButtons(juce::ToggleButton*, const juce::String&, const int);
+    void initProgramBox();
+    void refreshProgramBox();
+    void initChoiceBox(juce::ComboBox*, juce::Label*, const juce::String&, const juce::StringArray&);
+    void initToggleButton(juce::TextButton*, const juce::String&);
+    void initScope();
+    void initCab();
+    void initExtras();
+    void chooseCab();
+    void updateSize();
+
+    void syncLineInstButtons();
+    void syncProgramBox();
+    void syncCabButton();
+    void timerCallback() override;
+
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+
+    juce::ToggleButton instButton, lineButton;
+
+    juce::ComboBox programBox;
+    juce::TextButton storeButton, scopeButton, cabButton, moreButton;
+
+    /* kept alive while the dialog is open */
+    std::unique_ptr<juce::FileChooser> cabChooser;
+
+    /* set from whichever thread the parameter changes on, consumed by the timer */
+    std::atomic<bool> lineInstChanged { true };
+    int programsVersion = -1;
+
+    static constexpr int numSquareWaves = 6;
+    static constexpr int panelSize = 600, scopeHeight = 200, extrasHeight = 250;
+
+    juce::Slider squareWaveVolSlider[numSquareWaves];
+    juce::Slider filterSlider, inSubOctLPFSlider, clipSlider, 
+                 blendSlider, masterVolSlider;
+
+    juce::Label squareWaveVolLabel[numSquareWaves];
+    juce::Label filterLabel, inSubOctLPFLabel, clipLabel, 
+                blendLabel, masterVolLabel;
+
+    juce::String squareWaveName[numSquareWaves] = { "SUB2", "SUB1", "DOM", "NORM", "SUB4", "SUB3" };
+    juce::String squareWaveAttachName[numSquareWaves] = { "SUB2 VOLUME","SUB1 VOLUME",
+                                                          "DOM VOLUME", "NORM VOLUME",
+                                                          "SUB4 VOLUME", "SUB3 VOLUME" };
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> squareWaveVolAttachment[numSquareWaves], filterAttachment,
+                                                                          inSubOctLPFAttachment, clipAttachment, 
+                                                                          blendAttachment, masterVolAttachment;
+
+    /*
+     * MORE opens a section under the panel for everything the pedal's face has no room for: the
+     * envelope and LFO depths, the LFO speed, the noise gate and the band split.
+     * the scope goes under it when both are open
+     */
+    static constexpr int numExtraSliders = 11;
+    static constexpr int numFuzzBands = 3;
+
+    juce::Component extrasPanel;
+
+    juce::Slider extraSlider[numExtraSliders];
+    juce::Label extraLabel[numExtraSliders];
+
+    juce::String extraName[numExtraSliders] = { "ENV > GLITCH", "ENV > FILTER", "LFO > GLITCH", "LFO > FILTER", "LFO RATE",
+                                                "GATE THRESHOLD", "GATE HYSTERESIS", "GATE ATTACK", "GATE RELEASE",
+                                                "LOW XOVER", "HIGH XOVER" };
+    Params::Index extraParam[numExtraSliders] = { Params::envGlitchDepth, Params::envFilterDepth,
+                                                  Params::lfoGlitchDepth, Params::lfoFilterDepth, Params::lfoRate,
+                                                  Params::gateThreshold, Params::gateHysteresis,
+                                                  Params::gateAttack, Params::gateRelease,
+                                                  Params::lowCrossover, Params::highCrossover };
+
+    juce::ComboBox lfoSyncBox, bandModeBox;
+    juce::Label lfoSyncLabel, bandModeLabel;
+
+    /* which bands the fuzz runs on, the label sits over the middle one */
+    juce::TextButton fuzzButton[numFuzzBands];
+    juce::Label fuzzLabel;
+
+    juce::String fuzzName[numFuzzBands] = { "LOW", "MID", "HIGH" };
+    Params::Index fuzzParam[numFuzzBands] = { Params::fuzzLow, Params::fuzzMid, Params::fuzzHigh };
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> extraAttachment[numExtraSliders];
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfoSyncAttachment, bandModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> fuzzAttachment[numFuzzBands];
+
+    /* one look and feel, typeface and artwork cache for every editor in the process */
+    juce::SharedResourcePointer<NewLookAndFeel> newLookAndFeel;
+
+    SubdominantAudioProcessor& audioProcessor;
+
+    ScopeView scopeView;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SubdominantAudioProcessorEditor)
+};
@@ -1,447 +1,1175 @@
-BLE/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin processor.
-
-  ==============================================================================
-*/
-
-#include "PluginProcessor.h"
-#include "PluginEditor.h"
-
-//==============================================================================
-SubdominantAudioProcessor::SubdominantAudioProcessor()
-#ifndef JucePlugin_PreferredChannelConfigurations
-     : AudioProcessor (BusesProperties()
-                     #if ! JucePlugin_IsMidiEffect
-                      #if ! JucePlugin_IsSynth
-                       .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
-                      #endif
-                       .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
-                     #endif
-                       ), APVTS(*this, nullptr, "Parameters", createParameters())
-#endif
-{
-    APVTS.state.addListener(this);
-
-    clearOnePoleFilterState(&rectLPF);
-    clearOnePoleFilterState(&filterLPF);
-    clearTwoPoleFilterState(&inSubOctLPF);
-    setupOnePoleFilter(getSampleRate(), 20000., &filterLPF);
-    setupTwoPoleFilter(getSampleRate(), 159., 0.660225, &inSubOctLPF);
-}
-
-SubdominantAudioProcessor::~SubdominantAudioProcessor()
-{
-}
-
-//==============================================================================
-const juce::String SubdominantAudioProcessor::getName() const
-{
-    return JucePlugin_Name;
-}
-
-bool SubdominantAudioProcessor::acceptsMidi() const
-{
-   #if JucePlugin_WantsMidiInput
-    return true;
-   #else
-    return false;
-   #endif
-}
-
-bool SubdominantAudioProcessor::producesMidi() const
-{
-   #if JucePlugin_ProducesMidiOutput
-    return true;
-   #else
-    return false;
-   #endif
-}
-
-bool SubdominantAudioProcessor::isMidiEffect() const
-{
-   #if JucePlugin_IsMidiEffect
-    return true;
-   #else
-    return false;
-   #endif
-}
-
-double SubdominantAudioProcessor::getTailLengthSeconds() const
-{
-    return 0.0;
-}
-
-int SubdominantAudioProcessor::getNumPrograms()
-{
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
-}
-
-int SubdominantAudioProcessor::getCurrentProgram()
-{
-    return 0;
-}
-
-void SubdominantAudioProcessor::setCurrentProgram (int /*index*/)
-{
-}
-
-const juce::String SubdominantAudioProcessor::getProgramName (int /*index*/)
-{
-    return {};
-}
-
-void SubdominantAudioProcessor::changeProgramName (int /*index*/, const juce::String& /*newName*/)
-{
-}
-
-//==============================================================================
-void SubdominantAudioProcessor::prepareToPlay (double sampleRate, int /*samplesPerBlock*/)
-{
-    setupOnePoleFilter(sampleRate, 1591., &rectLPF);
-}
-
-void SubdominantAudioProcessor::releaseResources()
-{
-    // When playback stops, you can use this as an opportunity to free up any
-    // spare memory, etc.
-}
-
-#ifndef JucePlugin_PreferredChannelConfigurations
-bool SubdominantAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
-{
-  #if JucePlugin_IsMidiEffect
-    juce::ignoreUnused (layouts);
-    return true;
-  #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
-        return false;
-
-    // This checks if the input layout matches the output layout
-   #if ! JucePlugin_IsSynth
-    if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
-        return false;
-   #endif
-
-    return true;
-  #endif
-}
-#endif
-
-void SubdominantAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& /*midiMessages*/)
-{
-    juce::ScopedNoDenormals noDenormals;
-    auto totalNumInputChannels  = getTotalNumInputChannels();
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
-
-    const float* inL = buffer.getReadPointer(0);
-    const float* inR = totalNumInputChannels > 1 ? buffer.getReadPointer(1) : nullptr;
-
-    float* outL = buffer.getWritePointer(0);
-    float* outR = totalNumInputChannels > 1 ? buffer.getWritePointer(1) : nullptr;
-
-    int numSamples = buffer.getNumSamples();
-
-    updateParams();
-
-    while (--numSamples >= 0)
-    {
-        const float sampL = *inL++;
-        const float sampR = inR == nullptr ? sampL : *inR++;
-
-        float filtered[2] = { 0.f, 0.f }, out[2] = { 0.f, 0.f };
-
-        muteCounter = std::abs(sampL) <= 0.01f && std::abs(sampR) <= 0.01f ? muteCounter + 1.f : 0.f;
-
-        inputGain(&sampL, &sampR, &lm386);
-        
-        fullWaveRect(&sampL, &sampR, &rectifier);
-
-        twoPoleLPFilter(&inSubOctLPF, &lm386.left, &lm386.right, &filtered[0], &filtered[1]);
-
-        cd4024one[0].incPulseCounter(&filtered[0]);
-        cd4024one[1].incPulseCounter(&filtered[1]);
-
-        subOctOne.left  = cd4024one[0].generatePulseWave();
-        subOctOne.right = cd4024one[1].generatePulseWave();
-
-        cd4024two[0].incPulseCounter(&subOctOne.left);
-        cd4024two[1].incPulseCounter(&subOctOne.right);
-
-        subOctOne.left  *= subOctOne.volume;
-        subOctOne.right *= subOctOne.volume;
-
-        subOctTwo.left  = cd4024two[0].generatePulseWave();
-        subOctTwo.right = cd4024two[1].generatePulseWave();
-
-        subOctTwo.left  *= subOctTwo.volume;
-        subOctTwo.right *= subOctTwo.volume;
-
-        mixWaves();
-
-        onePoleLPFilter(&filterLPF, &mix.left, &mix.right, &out[0], &out[1]);
-
-        out[0] = (out[0] * blend) + (sampL * std::abs(blend - 1.f));
-        out[1] = (out[1] * blend) + (sampR * std::abs(blend - 1.f));
-
-        if (outR == nullptr)
-        {
-            *outL++ = rampVolume((out[0] + out[1]) * 0.5f * masterVol, muteCounter);
-        }
-        else
-        {
-            *outL++ = rampVolume(out[0] * masterVol, muteCounter);
-            *outR++ = rampVolume(out[1] * masterVol, muteCounter);
-        }
-    }
-}
-
-//==============================================================================
-bool SubdominantAudioProcessor::hasEditor() const
-{
-    return true; // (change this to false if you choose to not supply an editor)
-}
-
-juce::AudioProcessorEditor* SubdominantAudioProcessor::createEditor()
-{
-    return new SubdominantAudioProcessorEditor (*this);
-}
-
-//==============================================================================
-void SubdominantAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
-{
-    juce::ValueTree state = APVTS.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
-}
-
-void SubdominantAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
-{
-    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
-
-    if (xmlState.get() != nullptr)
-        if (xmlState->hasTagName(APVTS.state.getType()))
-        {
-            APVTS.replaceState(juce::ValueTree::fromXml(*xmlState));
-            clearTwoPoleFilterState(&inSubOctLPF);
-            clearOnePoleFilterState(&filterLPF);
-            paramsUpdated = true;
-            updateParams();
-        }
-}
-
-/* 1-pole RC low-pass/high-pass filter, based on:
-** https://github.com/8bitbubsy/pt2-clone/blob/master/src/pt2_rcfilters.c
-** https://www.musicdsp.org/en/latest/Filters/116-one-pole-lp-and-hp.html
-*/
-
-void SubdominantAudioProcessor::clearOnePoleFilterState(OnePoleFilter_t* f)
-{
-    f->tmpL = f->tmpR = 0.0;
-    f->val = -1.0;
-}
-
-void SubdominantAudioProcessor::setupOnePoleFilter(const double audioRate, const double cutOff, OnePoleFilter_t* f)
-{
-    const double a = cutOff < audioRate / 2.0 ? 2.0 - std::cos((twoPi * cutOff) / audioRate) :
-                             2.0 - std::cos((twoPi * ((audioRate / 2.0) - 1E-4)) / audioRate);
-
-    const double b = a - std::sqrt((a * a) - 1.0);
-
-    f->a1 = 1.0 - b;
-    f->a2 = b;
-}
-
-void SubdominantAudioProcessor::onePoleLPFilter(OnePoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR)
-{
-    f->tmpL = (*inL * f->a1) + (f->tmpL * f->a2);
-    *outL = (float)f->tmpL;
-
-    f->tmpR = (*inR * f->a1) + (f->tmpR * f->a2);
-    *outR = (float)f->tmpR;
-}
-
-/* 2-pole RC low-pass filter with Q factor, based on:
-** https://github.com/8bitbubsy/pt2-clone/blob/master/src/pt2_rcfilters.c
-** https://www.musicdsp.org/en/latest/Filters/38-lp-and-hp-filter.html
-*/
-
-void SubdominantAudioProcessor::clearTwoPoleFilterState(TwoPoleFilter_t* f)
-{
-    f->tmpL[0] = f->tmpL[1] = f->tmpL[2] = f->tmpL[3] = 0.0;
-    f->tmpR[0] = f->tmpR[1] = f->tmpR[2] = f->tmpR[3] = 0.0;
-
-    f->val = -1.f;
-}
-
-void SubdominantAudioProcessor::setupTwoPoleFilter(const double audioRate, const double cutOff, const double qFactor, TwoPoleFilter_t* f)
-{
-    const double a = cutOff < audioRate / 2.0 ? 1.0 / std::tan((pi * cutOff) / audioRate) : 
-                              1.0 / std::tan((pi * ((audioRate / 2.0) - 1E-4)) / audioRate);
-
-    const double b = 1.0 / qFactor;
-
-    f->a1 = 1.0 / (1.0 + b * a + a * a);
-    f->a2 = 2.0 * f->a1;
-    f->b1 = 2.0 * (1.0 - a * a) * f->a1;
-    f->b2 = (1.0 - b * a + a * a) * f->a1;
-}
-
-void SubdominantAudioProcessor::twoPoleLPFilter(TwoPoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR)
-{
-    const double LOut = (*inL * f->a1) + (f->tmpL[0] * f->a2) + (f->tmpL[1] * f->a1) - (f->tmpL[2] * f->b1) - (f->tmpL[3] * f->b2);
-    const double ROut = (*inR * f->a1) + (f->tmpR[0] * f->a2) + (f->tmpR[1] * f->a1) - (f->tmpR[2] * f->b1) - (f->tmpR[3] * f->b2);
-
-    // shift states
-
-    f->tmpL[1] = f->tmpL[0];
-    f->tmpL[0] = *inL;
-    f->tmpL[3] = f->tmpL[2];
-    f->tmpL[2] = LOut;
-
-    f->tmpR[1] = f->tmpR[0];
-    f->tmpR[0] = *inR;
-    f->tmpR[3] = f->tmpR[2];
-    f->tmpR[2] = ROut;
-
-    // set output
-
-    *outL = (float)LOut;
-    *outR = (float)ROut;
-}
-
-void SubdominantAudioProcessor::inputGain(const float* inL, const float* inR, squarewave_t* out) const
-{
-    /* total output gain of 200, 10:1 pad for "inst level" */
-    float gain[2] = { lineInstState ? *inL * 200.f : *inL * 20.f, lineInstState ? *inR * 200.f : *inR * 20.f };
-
-    /* output is already harshly squared off even without accounting for output gain*/
-    out->left  = gain[0] > 1.f ? 1.f : gain[0] < -1.f ? -1.f : gain[0];
-    out->right = gain[1] > 1.f ? 1.f : gain[1] < -1.f ? -1.f : gain[1];
-}
-
-void SubdominantAudioProcessor::fullWaveRect(const float* inL, const float* inR, squarewave_t* out) const
-{
-    /* invert phase of negative amplitude, applying gain/clipping */
-    float rectify[2] = { std::abs(*inL * 20.f) > 1.f ? 2.f : std::abs(*inL * 20.f),
-                         std::abs(*inR * 20.f) > 1.f ? 2.f : std::abs(*inR * 20.f) };
-
-    /* re-center back to +/- 1.0 range */
-    out->left  = rectify[0] == 0.f ? 0.0f : (rectify[0] - 1.f) * out->volume;
-    out->right = rectify[1] == 0.f ? 0.0f : (rectify[1] - 1.f) * out->volume;
-}
-
-void SubdominantAudioProcessor::mixWaves()
-{
-    mix.right = ((lm386.right * lm386.volume * 0.3f) + (rectifier.right * 0.3f) + (subOctOne.right * 0.2f + subOctTwo.right * 0.2f)) * (10.f * mix.volume);
-    mix.left  = ((lm386.left  * lm386.volume * 0.3f) + (rectifier.left  * 0.3f) + (subOctOne.left  * 0.2f + subOctTwo.left  * 0.2f)) * (10.f * mix.volume);
-
-    mix.left  = mix.left  > 1.f ? 1.f : mix.left < -1.f ? -1.f : mix.left;
-    mix.right = mix.right > 1.f ? 1.f : mix.right< -1.f ? -1.f : mix.right;
-}
-
-float SubdominantAudioProcessor::rampVolume(const float input, const float counter)
-{
-    const float counterMin = 128.f;
-
-    if (counter < counterMin) return input;
-
-    return input * (counterMin / counter);
-}
-
-void SubdominantAudioProcessor::updateParams()
-{
-    double glitchval = 0.f;
-    double filterval = 0.f;
-
-    if (!paramsUpdated) return;
-
-    glitchval = (double) APVTS.getRawParameterValue("SUB GLITCH AMOUNT")->load();
-    filterval = (double) APVTS.getRawParameterValue("FILTER AMOUNT")->load();
-
-    if (glitchval != inSubOctLPF.val || inSubOctLPF.val < 0.f)
-    {
-        clearTwoPoleFilterState(&inSubOctLPF);
-        inSubOctLPF.val = glitchval;
-        
-        /*
-         * logarithmic frequency sweep from 159hz - 20khz based on:
-         *   https://stackoverflow.com/questions/32320028/convert-linear-audio-frequency-distribution-to-logarithmic-perceptual-distributi 
-         */
-
-        glitchval = 159. * pow(20000. / 159., inSubOctLPF.val / 1.);
-
-        setupTwoPoleFilter(getSampleRate(), glitchval, 0.660225, &inSubOctLPF);
-    }
-
-    if (filterval != filterLPF.val || filterLPF.val < 0.f)
-    {
-        clearOnePoleFilterState(&filterLPF);
-        filterLPF.val = filterval;
-
-        /*
-         * logarithmic frequency sweep from 14.5hz - 20khz based on:
-         *   https://stackoverflow.com/questions/32320028/convert-lineaaudio-frequency-distribution-to-logarithmic-perceptual-distributi
-         */
-
-        filterval = 1446.8 * pow(20000. / 1446.8, filterLPF.val / 1.);
-
-        setupOnePoleFilter(getSampleRate(), filterval, &filterLPF);
-    }
-
-    lm386.volume = APVTS.getRawParameterValue("NORM VOLUME")->load();
-    rectifier.volume = APVTS.getRawParameterValue("DOM VOLUME")->load();
-    subOctOne.volume = APVTS.getRawParameterValue("SUB1 VOLUME")->load();
-    subOctTwo.volume = APVTS.getRawParameterValue("SUB2 VOLUME")->load();
-
-    lineInstState = (int)APVTS.getRawParameterValue("LINE/INST")->load();
-
-    mix.volume = APVTS.getRawParameterValue("GAIN AMOUNT")->load();
-    blend = APVTS.getRawParameterValue("BLEND AMOUNT")->load();
-    masterVol = APVTS.getRawParameterValue("MASTER VOLUME")->load();
-
-    paramsUpdated = false;
-}
-
-juce::AudioProcessorValueTreeState::ParameterLayout SubdominantAudioProcessor::createParameters()
-{
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"NORM VOLUME", 1 }, "Norm Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"DOM VOLUME", 1 },  "Dom Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f),  0.5f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB1 VOLUME", 1 }, "Sub1 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB2 VOLUME", 1 }, "Sub2 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"FILTER AMOUNT", 1 }, "Filter Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 1.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB GLITCH AMOUNT", 1 }, "Sub Glitch Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.01f));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterInt>(juce::ParameterID{ "LINE/INST", 1 }, "Line/Inst", 0, 1, 1));
-
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GAIN AMOUNT", 1 }, "Gain Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"BLEND AMOUNT", 1 }, "Blend Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 1.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{ "MASTER VOLUME", 1 }, "Master Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
-
-
-    return { parameters.begin(), parameters.end() };
-}
-
-void SubdominantAudioProcessor::valueTreePropertyChanged(juce::ValueTree& /*treeWhosePropertyHasChanged*/, const juce::Identifier& /*property*/)
-{
-    paramsUpdated = true;
-}
-
-//==============================================================================
-// This creates new instances of the plugin..
-juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
-{
-    return new SubdominantAudioProcessor();
-}
+BLE/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin processor.
+
+  ==============================================================================
+*/
+
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+//==============================================================================
+SubdominantAudioProcessor::SubdominantAudioProcessor()
+#ifndef JucePlugin_PreferredChannelConfigurations
+     : AudioProcessor (BusesProperties()
+                     #if ! JucePlugin_IsMidiEffect
+                      #if ! JucePlugin_IsSynth
+                       .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                      #endif
+                       .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
+                     #endif
+                       ), APVTS(*this, nullptr, "Parameters", createParameters())
+#endif
+{
+    APVTS.state.addListener(this);
+
+    lineInstParam = APVTS.getRawParameterValue("LINE/INST");
+    decimateParam = APVTS.getRawParameterValue("DECIMATE HIGH RATES");
+    lookaheadParam = APVTS.getRawParameterValue("GATE LOOKAHEAD");
+    deterministicParam = APVTS.getRawParameterValue("DETERMINISTIC");
+    captureParam = APVTS.getRawParameterValue("SESSION CAPTURE");
+
+    for (int i = 0; i < Params::numParams; i++)
+    {
+        paramObjects[i] = APVTS.getParameter(Params::ids[i]);
+        paramValues[i] = APVTS.getRawParameterValue(Params::ids[i]);
+
+        /* the C library goes by Params::ranges, the layout and that table can't be allowed to drift apart */
+        jassert(paramObjects[i]->getNormalisableRange().start == Params::ranges[i].min
+             && paramObjects[i]->getNormalisableRange().end == Params::ranges[i].max
+             && std::abs(getParamDefault(i) - Params::ranges[i].def) < 0.01f);
+    }
+
+    for (int i = 0; i < PresetBank::numPrograms; i++)
+    {
+        const PresetBank::FactoryProgram_t& preset = PresetBank::factory[i < PresetBank::numFactoryPrograms ? i : 0];
+
+        programs[i].name = i < PresetBank::numFactoryPrograms ? juce::String(preset.name) : 
+                                                                "User " + juce::String(i - PresetBank::numFactoryPrograms + 1);
+
+        for (int j = 0; j < Params::numParams; j++)
+            programs[i].values[j] = j < PresetBank::numFactoryValues ? preset.values[j] : getParamDefault(j);
+    }
+
+    /*
+     * no sample rate yet, so nothing gets set up here: hosts construct every plugin during scans and
+     * sessions construct hundreds at load, all the coefficient work waits for prepareToPlay(). so do
+     * the timer and the telemetry slot, an instance that's never prepared never needs either
+     */
+    activeState = new DSPState_t();
+    spareState = new DSPState_t();
+}
+
+SubdominantAudioProcessor::~SubdominantAudioProcessor()
+{
+    APVTS.state.removeListener(this);
+    stopTimer();
+    capture.stop();
+
+    /* waits for a load that's still running */
+    cabLoader.reset();
+
+    delete pendingCab.exchange(nullptr);
+    delete retiredCab.exchange(nullptr);
+    delete activeCab;
+    delete fadeCab;
+
+    delete pendingState.exchange(nullptr);
+    delete retiredState.exchange(nullptr);
+    delete fadeState;
+    delete spareState;
+    delete activeState;
+}
+
+//==============================================================================
+const juce::String SubdominantAudioProcessor::getName() const
+{
+    return JucePlugin_Name;
+}
+
+bool SubdominantAudioProcessor::acceptsMidi() const
+{
+   #if JucePlugin_WantsMidiInput
+    return true;
+   #else
+    return false;
+   #endif
+}
+
+bool SubdominantAudioProcessor::producesMidi() const
+{
+   #if JucePlugin_ProducesMidiOutput
+    return true;
+   #else
+    return false;
+   #endif
+}
+
+bool SubdominantAudioProcessor::isMidiEffect() const
+{
+   #if JucePlugin_IsMidiEffect
+    return true;
+   #else
+    return false;
+   #endif
+}
+
+double SubdominantAudioProcessor::getTailLengthSeconds() const
+{
+    return 0.0;
+}
+
+int SubdominantAudioProcessor::getNumPrograms()
+{
+    return PresetBank::numPrograms;
+}
+
+int SubdominantAudioProcessor::getCurrentProgram()
+{
+    return currentProgram.load();
+}
+
+void SubdominantAudioProcessor::setCurrentProgram (int index)
+{
+    if (!juce::isPositiveAndBelow(index, PresetBank::numPrograms)) return;
+
+    currentProgram.store(index);
+    requestedProgram.store(index);
+
+    if (capture.isRecording()) capture.captureProgram(index);
+
+    /* the engine switches on its own at the next block, parameters are pushed to the host afterwards */
+    programChangePending.store(true);
+
+    if (!isTimerRunning()) startTimerHz(30);
+}
+
+const juce::String SubdominantAudioProcessor::getProgramName (int index)
+{
+    if (!juce::isPositiveAndBelow(index, PresetBank::numPrograms)) return {};
+
+    return programs[index].name;
+}
+
+void SubdominantAudioProcessor::changeProgramName (int index, const juce::String& newName)
+{
+    if (!isUserProgram(index) || newName.isEmpty()) return;
+
+    storeUserProgram(index, newName);
+}
+
+void SubdominantAudioProcessor::storeUserProgram(const int index, const juce::String& name)
+{
+    if (!isUserProgram(index)) return;
+
+    Program_t& program = programs[index];
+
+    if (name.isNotEmpty()) program.name = name;
+
+    readParams(program.values);
+    buildProgramState(index);
+
+    juce::ValueTree bank = APVTS.state.getOrCreateChildWithName("USERPROGRAMS", nullptr);
+    juce::ValueTree entry = bank.getChildWithProperty("index", index);
+    juce::StringArray values;
+
+    if (!entry.isValid())
+    {
+        entry = juce::ValueTree("PROGRAM");
+        bank.appendChild(entry, nullptr);
+    }
+
+    for (int i = 0; i < Params::numParams; i++)
+        values.add(juce::String(program.values[i]));
+
+    entry.setProperty("index", index, nullptr);
+    entry.setProperty("name", program.name, nullptr);
+    entry.setProperty("values", values.joinIntoString(" "), nullptr);
+
+    currentProgram.store(index);
+    programsVersion.fetch_add(1);
+    APVTS.state.setProperty("PROGRAM", index, nullptr);
+
+    updateHostDisplay(ChangeDetails().withProgramChanged(true));
+}
+
+void SubdominantAudioProcessor::loadUserPrograms()
+{
+    const juce::ValueTree bank = APVTS.state.getChildWithName("USERPROGRAMS");
+
+    for (int i = PresetBank::numFactoryPrograms; i < PresetBank::numPrograms; i++)
+    {
+        const juce::ValueTree entry = bank.getChildWithProperty("index", i);
+        const juce::StringArray values = juce::StringArray::fromTokens(entry.getProperty("values").toString(), false);
+
+        programs[i].name = entry.getProperty("name", "User " + juce::String(i - PresetBank::numFactoryPrograms + 1)).toString();
+
+        for (int j = 0; j < Params::numParams; j++)
+            programs[i].values[j] = j < values.size() ? values[j].getFloatValue() : getParamDefault(j);
+    }
+
+    currentProgram.store(juce::jlimit(0, PresetBank::numPrograms - 1, (int) APVTS.state.getProperty("PROGRAM", 0)));
+    programsVersion.fetch_add(1);
+}
+
+void SubdominantAudioProcessor::buildProgramStates()
+{
+    for (int i = 0; i < PresetBank::numPrograms; i++)
+        buildProgramState(i);
+}
+
+void SubdominantAudioProcessor::buildProgramState(const int index)
+{
+    DSPState_t s = DSPState_t();
+    float values[Params::numParams];
+
+    /* snap to what the parameters will actually hold, so the host echo doesn't re-trigger a filter setup */
+    for (int i = 0; i < Params::numParams; i++)
+        values[i] = paramObjects[i]->convertFrom0to1(paramObjects[i]->convertTo0to1(programs[index].values[i]));
+
+    /* held across the build as well as the copy, the engine's tables can't change under it (see createState()) */
+    const juce::SpinLock::ScopedLockType lock(bankLock);
+
+    if (engine.getSampleRate() <= 0.0) return;
+
+    engine.resetState(&s);
+    engine.applyParams(&s, values);
+
+    programStates[index] = s;
+}
+
+void SubdominantAudioProcessor::timerCallback()
+{
+    if (programChangePending.exchange(false)) notifyProgramChanged();
+
+    if (capture.isRecording() && captureParam->load() < 0.5f) capture.stop();
+}
+
+void SubdominantAudioProcessor::notifyProgramChanged()
+{
+    const int index = currentProgram.load();
+
+    for (int i = 0; i < Params::numParams; i++)
+        paramObjects[i]->setValueNotifyingHost(paramObjects[i]->convertTo0to1(programs[index].values[i]));
+
+    APVTS.state.setProperty("PROGRAM", index, nullptr);
+
+    updateHostDisplay(ChangeDetails().withProgramChanged(true));
+}
+
+//==============================================================================
+void SubdominantAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
+{
+    /* audio thread is stopped here, so any state still in flight can be folded straight in */
+    DSPState_t* next = pendingState.exchange(nullptr);
+
+    if (next != nullptr)
+    {
+        delete activeState;
+        activeState = next;
+    }
+
+    if (fadeState != nullptr) finishFade();
+    reclaimRetiredState();
+
+    if (cabFadeSamplesLeft > 0) finishCabFade();
+
+    if (CabConvolver* cab = pendingCab.exchange(nullptr))
+    {
+        delete activeCab;
+        activeCab = cab;
+    }
+
+    reclaimRetiredCab();
+
+    portableMath = deterministicParam->load() > 0.5f;
+    wasPlaying = false;
+
+    /* halve the rate until the next halving would drop below 88.2khz */
+    decimateHighRates = decimateRequested = decimateParam->load() > 0.5f;
+    decimationStages = 0;
+
+    while (decimateHighRates && decimationStages < Halfband::maxStages && sampleRate / (2 << decimationStages) >= 88000.0)
+        decimationStages++;
+
+    engineRate = sampleRate / (1 << decimationStages);
+    resamplerLatency = decimationStages > 0 ? Halfband::latency(decimationStages) : 0;
+
+    /* the message thread builds states from the engine's tables too (setStateInformation(), user programs) */
+    {
+        const juce::SpinLock::ScopedLockType lock(bankLock);
+        engine.prepare(engineRate, decimationStages, portableMath);
+    }
+
+    decimator.prepare(decimationStages);
+    std::fill(&dryDelay[0][0], &dryDelay[0][0] + 2 * dryDelaySize, 0.f);
+    dryWritePos = 0;
+
+    /* room for the 5ms lookahead, whether it's on or not */
+    gate.prepare(sampleRate, juce::roundToInt(sampleRate * 0.005));
+    updateLookahead();
+
+    /* this is a reset too, one the host asked for before it doesn't need doing again */
+    resetRequested.store(false);
+
+    engine.resetState(activeState);
+    activeState->upsampler.prepare(decimationStages);
+    updateParams(activeState);
+
+    /* hosts call this again on every transport start or buffer size change, the rate rarely moves */
+    if (engineRate != preparedRate || portableMath != preparedPortable)
+    {
+        buildProgramStates();
+
+        preparedRate = engineRate;
+        preparedPortable = portableMath;
+    }
+
+    /* the cab runs at the host rate, an IR set up for another rate or math mode gets loaded again */
+    if (activeCab != nullptr) activeCab->reset();
+
+    if (APVTS.state.hasProperty("CABIR") ? activeCab == nullptr || activeCab->getSampleRate() != sampleRate
+                                               || activeCab->isPortable() != portableMath :
+                                           activeCab != nullptr && activeCab->isActive())
+        startCabLoad();
+
+    /* ~10ms crossfade whenever a new state is swapped in */
+    fadeLength = juce::jmax(1, juce::roundToInt(sampleRate * 0.01));
+    fadeRotCos = (float) CoeffMath::cos((pi * 0.5) / fadeLength, portableMath);
+    fadeRotSin = (float) CoeffMath::sin((pi * 0.5) / fadeLength, portableMath);
+    fadeSamplesLeft = 0;
+
+    subBlockPos = 0;
+
+    /*
+     * one scope frame per sub-block, or per few of them at high rates, ~1.5kHz whatever the host rate: the
+     * voices are read where the render leaves them, nothing in the engine runs any differently for the
+     * scope and the feed stays under 1% (Tools/Bench scope). a span of the view holds a few cycles of SUB2
+     * under a low E, the spectrum goes up to ~750hz, where the fundamentals and the sub-octaves are, in
+     * bins under 1.5hz wide
+     */
+    scopeDecimation = subBlockSize * juce::jmax(1, juce::roundToInt(sampleRate / (subBlockSize * 1500.0)));
+    scopeMixScale = 0.5f / (float) scopeDecimation;
+    scopeRate.store(sampleRate / scopeDecimation);
+    scopePhase = 0;
+    scopeMix = 0.f;
+
+    /* a capture always starts on a freshly prepared processor, that's what the replay starts from too */
+    capture.stop();
+
+    if (captureParam->load() > 0.5f) startCapture(sampleRate, samplesPerBlock);
+
+    /* MIDI program changes and the capture switch are picked up from here on */
+    if (!isTimerRunning()) startTimerHz(30);
+
+    telemetry.claim();
+    telemetry.setFormat(sampleRate, engineRate, samplesPerBlock);
+}
+
+void SubdominantAudioProcessor::releaseResources()
+{
+    // When playback stops, you can use this as an opportunity to free up any
+    // spare memory, etc.
+    capture.stop();
+    telemetry.setReleased();
+}
+
+void SubdominantAudioProcessor::reset()
+{
+    if (capture.isRecording()) capture.captureReset();
+
+    /*
+     * hosts call this on the audio thread too, so nothing gets built or freed here: the audio thread
+     * clears the spare state at the next grid line and fades into it, like a program switch. before
+     * the first prepareToPlay() there's nothing running to reset
+     */
+    if (engineRate > 0.0)
+        resetRequested.store(true);
+}
+
+#ifndef JucePlugin_PreferredChannelConfigurations
+bool SubdominantAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
+{
+  #if JucePlugin_IsMidiEffect
+    juce::ignoreUnused (layouts);
+    return true;
+  #else
+    // This is the place where you check if the layout is supported.
+    // In this template code we only support mono or stereo.
+    // Some plugin hosts, such as certain GarageBand versions, will only
+    // load plugins that support stereo bus layouts.
+    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
+     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+        return false;
+
+    // This checks if the input layout matches the output layout
+   #if ! JucePlugin_IsSynth
+    if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
+        return false;
+   #endif
+
+    return true;
+  #endif
+}
+#endif
+
+void SubdominantAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ScopedNoDenormals noDenormals;
+    const bool capturing = capture.isRecording();
+    const juce::int64 startTicks = juce::Time::getHighResolutionTicks();
+
+    auto totalNumInputChannels  = getTotalNumInputChannels();
+    auto totalNumOutputChannels = getTotalNumOutputChannels();
+    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+        buffer.clear (i, 0, buffer.getNumSamples());
+
+    const float* inL = buffer.getReadPointer(0);
+    const float* inR = totalNumInputChannels > 1 ? buffer.getReadPointer(1) : nullptr;
+
+    float* outL = buffer.getWritePointer(0);
+    float* outR = totalNumInputChannels > 1 ? buffer.getWritePointer(1) : nullptr;
+
+    const int numSamples = buffer.getNumSamples();
+
+    gate.setLookahead(lookaheadSamples.load());
+
+    transportBpm = 0.0;
+    transportPpq = 0.0;
+    transportPlaying = false;
+
+    if (juce::AudioPlayHead* playHead = getPlayHead())
+    {
+        if (const juce::Optional<juce::AudioPlayHead::PositionInfo> position = playHead->getPosition())
+        {
+            transportBpm = position->getBpm().orFallback(0.0);
+            transportPpq = position->getPpqPosition().orFallback(0.0);
+            transportPlaying = position->getIsPlaying();
+        }
+    }
+
+    /* captured as the host handed it over, the replay goes through the same clean up */
+    if (capturing)
+        capture.captureBlock(buffer, juce::jmin(2, totalNumInputChannels), midiMessages, transportBpm, transportPpq,
+                             transportPlaying, getParameters());
+
+    /* a NaN or inf from upstream would stick in every filter state for good, it never gets that far */
+    for (int ch = 0; ch < juce::jmin(2, totalNumInputChannels); ch++)
+        SubdominantEngine::sanitizeInput(buffer.getWritePointer(ch), numSamples);
+
+    /* silence in and silence out is a block the host could have skipped, the monitor counts those as idle */
+    const bool silentInput = buffer.getMagnitude(0, numSamples) < TelemetryFormat::silence;
+
+    /* deterministic mode only locks the phase when the transport starts, from there the LFO runs sample by sample */
+    const bool lockPhase = transportPlaying && !(portableMath && wasPlaying);
+    wasPlaying = transportPlaying;
+
+    if (lockPhase)
+    {
+        engine.lockLfoPhase(activeState, transportBpm, transportPpq);
+
+        if (fadeState != nullptr) engine.lockLfoPhase(fadeState, transportBpm, transportPpq);
+    }
+
+    const bool scopeOn = scopeActive.load(std::memory_order_acquire);
+
+    if (scopeOn) beginScope();
+
+    juce::MidiBufferIterator midiIt = midiMessages.cbegin();
+
+    /*
+     * sub-blocks sit on a grid of subBlockSize samples counted from prepareToPlay(), not from the
+     * start of the host block: program changes and state swaps are only picked up on grid lines, so
+     * they come out the same whatever buffer size the host runs at. parameters are read on grid lines
+     * too, but they only move between host blocks, see beginSubBlock()
+     */
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int chunk = juce::jmin(subBlockSize - subBlockPos, numSamples - pos);
+
+        if (subBlockPos == 0)
+        {
+            for (; midiIt != midiMessages.cend() && (*midiIt).samplePosition <= pos; ++midiIt)
+                handleMidi((*midiIt).getMessage());
+
+            beginSubBlock();
+        }
+
+        const float* chunkL = inL + pos;
+        const float* chunkR = inR == nullptr ? chunkL : inR + pos;
+
+        /* full rate the engine and the dry side both take the input as it is */
+        const float* engineL = chunkL;
+        const float* engineR = chunkR;
+        const float* dryL = chunkL;
+        const float* dryR = chunkR;
+        int numEngineSamples = chunk;
+
+        if (decimationStages > 0)
+        {
+            numEngineSamples = decimator.process(chunkL, chunkR, blockBuf.decimated[0], blockBuf.decimated[1], chunk);
+            delayDry(chunkL, chunkR, chunk);
+
+            engineL = blockBuf.decimated[0];
+            engineR = blockBuf.decimated[1];
+            dryL = blockBuf.dry[0];
+            dryR = blockBuf.dry[1];
+        }
+
+        float* out[2] = { blockBuf.out[0], blockBuf.out[1] };
+        float* dryOut[2] = { blockBuf.dryOut[0], blockBuf.dryOut[1] };
+
+        /* the outgoing state goes first, so the scratch buffers are left holding the active state's voices for the scope */
+        if (fadeState != nullptr)
+            engine.renderChunk(fadeState, engineL, engineR, numEngineSamples, dryL, dryR, blockBuf.fade[0], blockBuf.fade[1],
+                               blockBuf.fadeDry[0], blockBuf.fadeDry[1], chunk);
+
+        engine.renderChunk(activeState, engineL, engineR, numEngineSamples, dryL, dryR, out[0], out[1], dryOut[0], dryOut[1], chunk);
+
+        if (fadeState != nullptr)
+        {
+            const float* fade[2] = { blockBuf.fade[0], blockBuf.fade[1] };
+            const float* fadeDry[2] = { blockBuf.fadeDry[0], blockBuf.fadeDry[1] };
+
+            for (int i = 0; i < chunk && fadeSamplesLeft > 0; i++, fadeSamplesLeft--)
+            {
+                out[0][i] = (out[0][i] * fadeIn) + (fade[0][i] * fadeOut);
+                out[1][i] = (out[1][i] * fadeIn) + (fade[1][i] * fadeOut);
+
+                dryOut[0][i] = (dryOut[0][i] * fadeIn) + (fadeDry[0][i] * fadeOut);
+                dryOut[1][i] = (dryOut[1][i] * fadeIn) + (fadeDry[1][i] * fadeOut);
+
+                const float rotOut = (fadeOut * fadeRotCos) - (fadeIn * fadeRotSin);
+                fadeIn = (fadeIn * fadeRotCos) + (fadeOut * fadeRotSin);
+                fadeOut = rotOut;
+            }
+
+            if (fadeSamplesLeft <= 0) finishFade();
+        }
+
+        /* one cab for whatever mix of states is sounding, faded over from the last one after a swap */
+        if (cabFadeSamplesLeft > 0)
+        {
+            float* cabFade[2] = { blockBuf.cabFade[0], blockBuf.cabFade[1] };
+
+            std::copy(out[0], out[0] + chunk, cabFade[0]);
+            std::copy(out[1], out[1] + chunk, cabFade[1]);
+
+            if (fadeCab != nullptr && fadeCab->isActive())
+                fadeCab->process(cabFade[0], cabFade[1], chunk);
+        }
+
+        if (activeCab != nullptr && activeCab->isActive())
+            activeCab->process(out[0], out[1], chunk);
+
+        if (cabFadeSamplesLeft > 0)
+        {
+            const float* cabFade[2] = { blockBuf.cabFade[0], blockBuf.cabFade[1] };
+
+            for (int i = 0; i < chunk && cabFadeSamplesLeft > 0; i++, cabFadeSamplesLeft--)
+            {
+                out[0][i] = (out[0][i] * cabFadeIn) + (cabFade[0][i] * cabFadeOut);
+                out[1][i] = (out[1][i] * cabFadeIn) + (cabFade[1][i] * cabFadeOut);
+
+                const float rotOut = (cabFadeOut * fadeRotCos) - (cabFadeIn * fadeRotSin);
+                cabFadeIn = (cabFadeIn * fadeRotCos) + (cabFadeOut * fadeRotSin);
+                cabFadeOut = rotOut;
+            }
+
+            if (cabFadeSamplesLeft <= 0) finishCabFade();
+        }
+
+        /* then the dry side goes back in */
+
+        for (int i = 0; i < chunk; i++)
+        {
+            out[0][i] += dryOut[0][i];
+            out[1][i] += dryOut[1][i];
+        }
+
+        gate.processBlock(dryL, dryR, out[0], out[1], chunk);
+
+        if (scopeOn) pushScope(out[0], out[1], chunk, numEngineSamples);
+
+        if (outR == nullptr)
+        {
+            for (int i = 0; i < chunk; i++)
+                outL[pos + i] = (out[0][i] + out[1][i]) * 0.5f;
+        }
+        else
+        {
+            std::copy(out[0], out[0] + chunk, outL + pos);
+            std::copy(out[1], out[1] + chunk, outR + pos);
+        }
+
+        subBlockPos = (subBlockPos + chunk) % subBlockSize;
+        pos += chunk;
+
+        if (subBlockPos == 0)
+        {
+            engine.flushDenormals(activeState);
+
+            if (fadeState != nullptr) engine.flushDenormals(fadeState);
+
+            gate.flushDenormals();
+        }
+    }
+
+    /* whatever comes after the last grid line in this block lands on the first one of the next */
+    for (; midiIt != midiMessages.cend(); ++midiIt)
+        handleMidi((*midiIt).getMessage());
+
+    if (scopeOn) endScope();
+
+    if (capturing)
+        capture.captureTiming(juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1000.0);
+
+    telemetry.endBlock(startTicks, numSamples, silentInput && buffer.getMagnitude(0, numSamples) < TelemetryFormat::silence,
+                       getQuality());
+}
+
+uint32_t SubdominantAudioProcessor::getQuality() const
+{
+    uint32_t quality = (uint32_t) decimationStages & TelemetryFormat::stagesMask;
+
+    quality |= ((uint32_t) activeState->numBands << TelemetryFormat::bandsShift) & TelemetryFormat::bandsMask;
+
+    if (portableMath) quality |= TelemetryFormat::portableFlag;
+    if (activeCab != nullptr && activeCab->isActive()) quality |= TelemetryFormat::cabFlag;
+    if (lookaheadSamples.load(std::memory_order_relaxed) > 0) quality |= TelemetryFormat::lookaheadFlag;
+
+    return quality;
+}
+
+void SubdominantAudioProcessor::handleMidi(const juce::MidiMessage& message)
+{
+    if (message.isProgramChange() && message.getProgramChangeNumber() < PresetBank::numPrograms)
+    {
+        currentProgram.store(message.getProgramChangeNumber());
+        requestedProgram.store(message.getProgramChangeNumber());
+        programChangePending.store(true);
+    }
+}
+
+void SubdominantAudioProcessor::beginSubBlock()
+{
+    float values[Params::numParams];
+
+    acquirePendingState();
+    acquireProgram();
+    acquireReset();
+    acquirePendingCab();
+
+    /*
+     * one atomic load per parameter every few dozen samples, the DSP state is only touched when something
+     * moved. the host only hands values over between its blocks, so automation is quantised to the host
+     * block: a change lands on the first grid line of the block it came with and holds for the rest of it.
+     * nothing is ramped across the block's grid lines, and automation isn't sample accurate, a render with
+     * automation in it only matches one at another buffer size where the changes fall on both sets of
+     * block boundaries
+     */
+    readParams(values);
+
+    if (std::memcmp(values, lastParams, sizeof(values)) != 0)
+    {
+        engine.applyParams(activeState, values);
+
+        if (Params::gateChanged(values, lastParams)) updateGate(values);
+
+        std::copy(values, values + Params::numParams, lastParams);
+    }
+
+    /* the LFO speed lands on the grid too, or a rate change would wait for the next host block */
+    engine.updateLfo(activeState, transportBpm);
+
+    if (fadeState != nullptr) engine.updateLfo(fadeState, transportBpm);
+}
+
+void SubdominantAudioProcessor::delayDry(const float* inL, const float* inR, const int numSamples)
+{
+    for (int i = 0; i < numSamples; i++)
+    {
+        int readPos = dryWritePos - resamplerLatency;
+
+        if (readPos < 0) readPos += dryDelaySize;
+
+        dryDelay[0][dryWritePos] = inL[i];
+        dryDelay[1][dryWritePos] = inR[i];
+
+        blockBuf.dry[0][i] = dryDelay[0][readPos];
+        blockBuf.dry[1][i] = dryDelay[1][readPos];
+
+        if (++dryWritePos == dryDelaySize) dryWritePos = 0;
+    }
+}
+
+/* everything the ring has room for, the editor only drains it between blocks anyway */
+void SubdominantAudioProcessor::beginScope()
+{
+    scopeFifo.prepareToWrite(scopeFifoSize, scopeStart1, scopeSize1, scopeStart2, scopeSize2);
+    scopeWritten = 0;
+
+    /* frames end on grid lines, and the phase only moves while the scope is open: a reopened one starts over on the grid */
+    if (scopePhase % subBlockSize != subBlockPos)
+    {
+        scopePhase = subBlockPos;
+        scopeMix = 0.f;
+    }
+}
+
+/*
+ * a frame at the end of every scopeDecimation samples, which is always the end of a sub-block: the left
+ * channel voices of the active state as they go into the mix, where the render leaves them (the scratch
+ * buffers' last sample and the counters' taps), and the final output averaged over the frame. in decimated
+ * mode a chunk too short to finish a group has no voice samples, the voices are held from the last frame
+ * then. if the editor falls behind and the ring fills up, frames get dropped rather than waiting
+ */
+void SubdominantAudioProcessor::pushScope(const float* outL, const float* outR, const int numSamples, const int numVoiceSamples)
+{
+    constexpr int lanes = (int) FloatLanes::SIMDNumElements;
+
+    /* four lanes wide, a running sum through every sample would be one long dependency chain */
+    FloatLanes sum = FloatLanes::expand(0.f);
+    int i = 0;
+
+    for (; i + lanes <= numSamples; i += lanes)
+        sum = sum + (FloatLanes::fromRawArray(outL + i) + FloatLanes::fromRawArray(outR + i));
+
+    float mix = scopeMix + sum.sum();
+
+    for (; i < numSamples; i++)
+        mix += outL[i] + outR[i];
+
+    if ((scopePhase += numSamples) < scopeDecimation)
+    {
+        scopeMix = mix;
+        return;
+    }
+
+    /* built up in registers and stored once, reading back a frame stored a field at a time stalls the load */
+    ScopeFrame_t frame = scopeVoices;
+
+    if (numVoiceSamples > 0)
+    {
+        const SubdominantEngine::BlockBuffers_t& b = engine.getBuffers();
+        const DSPState_t* s = activeState;
+        const int v = numVoiceSamples - 1;
+
+        frame.norm = b.lm386[0][v] * s->lm386.volume;
+        frame.dom  = b.rectifier[0][v];
+        frame.sub1 = s->cd4024[0].generatePulseWave(1) * s->subOctGain[0] * 5.f;
+        frame.sub2 = s->cd4024[0].generatePulseWave(2) * s->subOctGain[1] * 5.f;
+    }
+
+    frame.mix = mix * scopeMixScale;
+    scopeVoices = frame;
+
+    if (scopeWritten < scopeSize1 + scopeSize2)
+    {
+        scopeBuffer[scopeWritten < scopeSize1 ? scopeStart1 + scopeWritten : scopeStart2 + scopeWritten - scopeSize1] = frame;
+        scopeWritten++;
+    }
+
+    scopePhase = 0;
+    scopeMix = 0.f;
+}
+
+void SubdominantAudioProcessor::endScope()
+{
+    scopeFifo.finishedWrite(scopeWritten);
+}
+
+void SubdominantAudioProcessor::setScopeActive(const bool active)
+{
+    /* the buffer is in place before the audio thread can see the flag, and it's never freed before the processor */
+    if (active && scopeBuffer == nullptr)
+        scopeBuffer.reset(new ScopeFrame_t[scopeFifoSize]);
+
+    scopeActive.store(active, std::memory_order_release);
+}
+
+int SubdominantAudioProcessor::readScope(ScopeFrame_t* dest, const int maxFrames)
+{
+    if (scopeBuffer == nullptr) return 0;
+
+    const juce::AbstractFifo::ScopedRead read = scopeFifo.read(juce::jmin(maxFrames, scopeFifo.getNumReady()));
+
+    if (read.blockSize1 > 0) std::copy(scopeBuffer.get() + read.startIndex1, scopeBuffer.get() + read.startIndex1 + read.blockSize1, dest);
+    if (read.blockSize2 > 0) std::copy(scopeBuffer.get() + read.startIndex2, scopeBuffer.get() + read.startIndex2 + read.blockSize2, dest + read.blockSize1);
+
+    return read.blockSize1 + read.blockSize2;
+}
+
+//==============================================================================
+bool SubdominantAudioProcessor::hasEditor() const
+{
+    return true; // (change this to false if you choose to not supply an editor)
+}
+
+juce::AudioProcessorEditor* SubdominantAudioProcessor::createEditor()
+{
+    return new SubdominantAudioProcessorEditor (*this);
+}
+
+//==============================================================================
+void SubdominantAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
+{
+    juce::ValueTree state = APVTS.copyState();
+    std::unique_ptr<juce::XmlElement> xml(state.createXml());
+    copyXmlToBinary(*xml, destData);
+}
+
+void SubdominantAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
+{
+    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+
+    if (capture.isRecording()) capture.captureState(data, sizeInBytes);
+
+    if (xmlState.get() != nullptr)
+        if (xmlState->hasTagName(APVTS.state.getType()))
+        {
+            APVTS.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+            loadUserPrograms();
+            startCabLoad();
+
+            /* on session load this runs before prepareToPlay(), which sets everything up from the restored state */
+            if (engineRate > 0.0)
+            {
+                for (int i = PresetBank::numFactoryPrograms; i < PresetBank::numPrograms; i++)
+                    buildProgramState(i);
+
+                if (DSPState_t* s = createState()) publishState(s);
+            }
+        }
+}
+
+void SubdominantAudioProcessor::updateTrackProperties (const TrackProperties& properties)
+{
+    /* the track name is the only thing that tells two instances apart in the monitor */
+    telemetry.setName(properties.name);
+}
+
+SubdominantAudioProcessor::DSPState_t* SubdominantAudioProcessor::createState()
+{
+    std::unique_ptr<DSPState_t> s(new DSPState_t());
+    float values[Params::numParams];
+
+    readParams(values);
+
+    /* a host preparing on another thread could be swapping the engine's tables out from under this */
+    const juce::SpinLock::ScopedLockType lock(bankLock);
+
+    if (engine.getSampleRate() <= 0.0) return nullptr;
+
+    engine.resetState(s.get());
+    engine.applyParams(s.get(), values);
+
+    return s.release();
+}
+
+void SubdominantAudioProcessor::publishState(DSPState_t* s)
+{
+    reclaimRetiredState();
+
+    /* a state the audio thread never got around to picking up is superseded, free it here */
+    delete pendingState.exchange(s);
+}
+
+void SubdominantAudioProcessor::reclaimRetiredState()
+{
+    delete retiredState.exchange(nullptr);
+}
+
+void SubdominantAudioProcessor::acquirePendingState()
+{
+    /* one swap at a time: let the current fade finish and the last retired state be freed first */
+    if (fadeState != nullptr || retiredState.load() != nullptr) return;
+
+    DSPState_t* next = pendingState.exchange(nullptr);
+
+    if (next == nullptr) return;
+
+    startFade(next);
+}
+
+void SubdominantAudioProcessor::acquireProgram()
+{
+    int index = requestedProgram.load();
+
+    if (index < 0 || fadeState != nullptr || spareState == nullptr) return;
+
+    /* never wait on the message thread, if it's rebuilding a program just try again next block */
+    const juce::SpinLock::ScopedTryLockType lock(bankLock);
+
+    if (!lock.isLocked() || !requestedProgram.compare_exchange_strong(index, -1)) return;
+
+    *spareState = programStates[index];
+
+    DSPState_t* next = spareState;
+    spareState = nullptr;
+
+    startFade(next);
+}
+
+void SubdominantAudioProcessor::acquireReset()
+{
+    float values[Params::numParams];
+
+    /* a fade still running has the spare state, the request waits for it like a program switch does */
+    if (fadeState != nullptr || spareState == nullptr || !resetRequested.exchange(false)) return;
+
+    readParams(values);
+
+    engine.resetState(spareState);
+    engine.applyParams(spareState, values);
+
+    DSPState_t* next = spareState;
+    spareState = nullptr;
+
+    startFade(next);
+}
+
+void SubdominantAudioProcessor::loadCab(const juce::File& file)
+{
+    APVTS.state.setProperty("CABIR", file.getFullPathName(), nullptr);
+    startCabLoad();
+}
+
+void SubdominantAudioProcessor::clearCab()
+{
+    APVTS.state.removeProperty("CABIR", nullptr);
+    startCabLoad();
+}
+
+void SubdominantAudioProcessor::startCapture(const double sampleRate, const int samplesPerBlock)
+{
+    juce::StringArray ids;
+    juce::MemoryBlock state;
+
+    for (juce::AudioProcessorParameter* param : getParameters())
+        if (const juce::RangedAudioParameter* ranged = dynamic_cast<juce::RangedAudioParameter*>(param))
+            ids.add(ranged->getParameterID());
+
+    getStateInformation(state);
+
+    const juce::File file = SessionCapture::getCaptureFolder()
+                                .getChildFile(juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".sdcap")
+                                .getNonexistentSibling();
+
+    capture.start(file, sampleRate, samplesPerBlock, juce::jmin(2, getTotalNumInputChannels()), ids, state);
+}
+
+juce::String SubdominantAudioProcessor::getCabName() const
+{
+    const juce::String path = APVTS.state.getProperty("CABIR").toString();
+
+    return path.isEmpty() ? juce::String() : juce::File(path).getFileNameWithoutExtension();
+}
+
+void SubdominantAudioProcessor::startCabLoad()
+{
+    const juce::String path = APVTS.state.getProperty("CABIR").toString();
+    const double sampleRate = getSampleRate();
+    const bool portable = portableMath;
+
+    /* prepareToPlay() comes back here once there's a rate to set the IR up for */
+    if (sampleRate <= 0.0) return;
+
+    /* nothing was ever loaded, so there's nothing in flight a clear could race with */
+    if (path.isEmpty() && cabLoader == nullptr)
+    {
+        publishCab(new CabConvolver(nullptr));
+        return;
+    }
+
+    if (cabLoader == nullptr) cabLoader = std::make_unique<juce::ThreadPool>(1);
+
+    /*
+     * one loader thread, so loads finish in the order they were asked for and the last one wins.
+     * clears go through it too, or a load still running could publish its cab after the clear
+     */
+    cabLoader->addJob([this, path, sampleRate, portable]
+    {
+        publishCab(new CabConvolver(path.isEmpty() ? nullptr : CabConvolver::loadImpulse(juce::File(path), sampleRate, portable)));
+    });
+}
+
+void SubdominantAudioProcessor::publishCab(CabConvolver* cab)
+{
+    reclaimRetiredCab();
+
+    delete pendingCab.exchange(cab);
+}
+
+void SubdominantAudioProcessor::reclaimRetiredCab()
+{
+    delete retiredCab.exchange(nullptr);
+}
+
+/*
+ * the old cab keeps running next to the new one for fadeLength samples, through the same rotation
+ * as the state crossfade, so an IR change or a clear doesn't click. a cab that comes in while one
+ * is still fading waits for it
+ */
+void SubdominantAudioProcessor::acquirePendingCab()
+{
+    if (retiredCab.load() != nullptr || cabFadeSamplesLeft > 0) return;
+
+    CabConvolver* next = pendingCab.exchange(nullptr);
+
+    if (next == nullptr) return;
+
+    fadeCab = activeCab;
+    activeCab = next;
+
+    cabFadeIn = 0.f;
+    cabFadeOut = 1.f;
+    cabFadeSamplesLeft = fadeLength;
+}
+
+void SubdominantAudioProcessor::finishCabFade()
+{
+    retiredCab.store(fadeCab);
+
+    fadeCab = nullptr;
+    cabFadeSamplesLeft = 0;
+}
+
+void SubdominantAudioProcessor::startFade(DSPState_t* next)
+{
+    /* swaps only happen on the sub-block grid, which every group of the decimator lines up with */
+    next->upsampler.prepare(decimationStages);
+
+    fadeState = activeState;
+    activeState = next;
+
+    fadeIn = 0.f;
+    fadeOut = 1.f;
+    fadeSamplesLeft = fadeLength;
+}
+
+void SubdominantAudioProcessor::finishFade()
+{
+    /* program switches borrow the spare state, give it back first before retiring anything */
+    if (spareState == nullptr)
+        spareState = fadeState;
+    else
+        retiredState.store(fadeState);
+
+    fadeState = nullptr;
+}
+float SubdominantAudioProcessor::getParamDefault(const int index)
+{
+    return paramObjects[index]->convertFrom0to1(paramObjects[index]->getDefaultValue());
+}
+
+void SubdominantAudioProcessor::readParams(float* values)
+{
+    for (int i = 0; i < Params::numParams; i++)
+        values[i] = paramValues[i]->load();
+}
+
+void SubdominantAudioProcessor::updateParams(DSPState_t* s)
+{
+    float values[Params::numParams];
+
+    readParams(values);
+    engine.applyParams(s, values);
+    updateGate(values);
+
+    std::copy(values, values + Params::numParams, lastParams);
+}
+
+void SubdominantAudioProcessor::updateGate(const float* values)
+{
+    gate.setup(values[Params::gateThreshold], values[Params::gateHysteresis],
+               values[Params::gateAttack], values[Params::gateRelease], portableMath);
+}
+
+void SubdominantAudioProcessor::updateLookahead()
+{
+    const bool on = lookaheadParam->load() > 0.5f;
+    const int lookahead = on ? juce::roundToInt(getSampleRate() * 0.005) : 0;
+
+    lookaheadSamples.store(lookahead);
+
+    if (getLatencySamples() != lookahead + resamplerLatency) setLatencySamples(lookahead + resamplerLatency);
+}
+
+juce::AudioProcessorValueTreeState::ParameterLayout SubdominantAudioProcessor::createParameters()
+{
+    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
+
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"NORM VOLUME", 1 }, "Norm Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"DOM VOLUME", 1 },  "Dom Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f),  0.5f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB1 VOLUME", 1 }, "Sub1 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB2 VOLUME", 1 }, "Sub2 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB3 VOLUME", 1 }, "Sub3 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.0f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB4 VOLUME", 1 }, "Sub4 Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.0f));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"FILTER AMOUNT", 1 }, "Filter Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 1.0f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"SUB GLITCH AMOUNT", 1 }, "Sub Glitch Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.01f));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterInt>(juce::ParameterID{ "LINE/INST", 1 }, "Line/Inst", 0, 1, 1));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GAIN AMOUNT", 1 }, "Gain Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"BLEND AMOUNT", 1 }, "Blend Amount", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 1.0f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{ "MASTER VOLUME", 1 }, "Master Volume", juce::NormalisableRange<float>(0.f, 1.f, 0.01f), 0.5f));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"ENV GLITCH DEPTH", 1 }, "Env Glitch Depth", juce::NormalisableRange<float>(-1.f, 1.f, 0.01f), 0.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"ENV FILTER DEPTH", 1 }, "Env Filter Depth", juce::NormalisableRange<float>(-1.f, 1.f, 0.01f), 0.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"LFO GLITCH DEPTH", 1 }, "LFO Glitch Depth", juce::NormalisableRange<float>(-1.f, 1.f, 0.01f), 0.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"LFO FILTER DEPTH", 1 }, "LFO Filter Depth", juce::NormalisableRange<float>(-1.f, 1.f, 0.01f), 0.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"LFO RATE", 1 }, "LFO Rate", juce::NormalisableRange<float>(0.05f, 20.f, 0.01f, 0.3f), 1.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{"LFO SYNC", 1 }, "LFO Sync", juce::StringArray(Params::lfoSyncNames, Params::numLfoSyncs), 0));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GATE THRESHOLD", 1 }, "Gate Threshold", juce::NormalisableRange<float>(-90.f, 0.f, 0.1f), -40.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GATE HYSTERESIS", 1 }, "Gate Hysteresis", juce::NormalisableRange<float>(0.f, 20.f, 0.1f), 3.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GATE ATTACK", 1 }, "Gate Attack", juce::NormalisableRange<float>(0.05f, 50.f, 0.01f, 0.3f), 0.1f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"GATE RELEASE", 1 }, "Gate Release", juce::NormalisableRange<float>(5.f, 1000.f, 0.1f, 0.3f), 60.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterChoice>(juce::ParameterID{"BAND MODE", 1 }, "Band Mode", juce::StringArray(Params::bandModeNames, Params::numBandModes), 0));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"LOW CROSSOVER", 1 }, "Low Crossover", juce::NormalisableRange<float>(40.f, 1000.f, 1.f, 0.4f), 250.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID{"HIGH CROSSOVER", 1 }, "High Crossover", juce::NormalisableRange<float>(800.f, 8000.f, 1.f, 0.4f), 2500.f));
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"FUZZ LOW", 1 }, "Fuzz Low", false));
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"FUZZ MID", 1 }, "Fuzz Mid", true));
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"FUZZ HIGH", 1 }, "Fuzz High", true));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"GATE LOOKAHEAD", 1 }, "Gate Lookahead", false,
+                                                                    juce::AudioParameterBoolAttributes().withAutomatable(false)));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"DETERMINISTIC", 1 }, "Deterministic Render", false,
+                                                                    juce::AudioParameterBoolAttributes().withAutomatable(false)));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"DECIMATE HIGH RATES", 1 }, "Decimate High Rates", false,
+                                                                    juce::AudioParameterBoolAttributes().withAutomatable(false)));
+
+    parameters.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID{"SESSION CAPTURE", 1 }, "Session Capture", false,
+                                                                    juce::AudioParameterBoolAttributes().withAutomatable(false)));
+
+
+    return { parameters.begin(), parameters.end() };
+}
+
+void SubdominantAudioProcessor::valueTreePropertyChanged(juce::ValueTree& /*treeWhosePropertyHasChanged*/, const juce::Identifier& /*property*/)
+{
+    /* lookahead changes the reported latency, so it's not automatable and only ever lands here */
+    updateLookahead();
+
+    /* so does decimation, but it needs a new prepareToPlay(), which hosts do when told the latency moved */
+    const bool decimate = decimateParam->load() > 0.5f;
+
+    if (decimate != decimateRequested)
+    {
+        decimateRequested = decimate;
+        updateHostDisplay(ChangeDetails().withLatencyChanged(true));
+    }
+}
+
+//==============================================================================
+// This creates new instances of the plugin..
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new SubdominantAudioProcessor();
+}
@@ -1,140 +1,339 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin processor.
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "PulseGen.h"
-
-//==============================================================================
-/**
-*/
-
-constexpr double pi = juce::MathConstants<double>::pi;
-constexpr double twoPi = juce::MathConstants<double>::twoPi;
-
-class SubdominantAudioProcessor  : public juce::AudioProcessor,
-                                   public juce::ValueTree::Listener
-{
-public:
-    //==============================================================================
-    SubdominantAudioProcessor();
-    ~SubdominantAudioProcessor() override;
-
-    //==============================================================================
-    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
-    void releaseResources() override;
-
-   #ifndef JucePlugin_PreferredChannelConfigurations
-    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
-   #endif
-
-    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
-
-    //==============================================================================
-    juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override;
-
-    //==============================================================================
-    const juce::String getName() const override;
-
-    bool acceptsMidi() const override;
-    bool producesMidi() const override;
-    bool isMidiEffect() const override;
-    double getTailLengthSeconds() const override;
-
-    //==============================================================================
-    int getNumPrograms() override;
-    int getCurrentProgram() override;
-    void setCurrentProgram (int index) override;
-    const juce::String getProgramName (int index) override;
-    void changeProgramName (int index, const juce::String& newName) override;
-
-    //==============================================================================
-    void getStateInformation (juce::MemoryBlock& destData) override;
-    void setStateInformation (const void* data, int sizeInBytes) override;
-
-    juce::AudioProcessorValueTreeState& getAPVTS() { return APVTS; }
-
-    void setLineInstState(const float state)
-    {
-        APVTS.getParameter("LINE/INST")->beginChangeGesture();
-        APVTS.getParameterAsValue("LINE/INST").setValue(state);
-        APVTS.getParameter("LINE/INST")->endChangeGesture();
-    }
-
-    int& getLineInstState() { return lineInstState; }
-
-private:
-    typedef struct SquareWave
-    {
-        float left;
-        float right;
-        float volume;
-    } squarewave_t;
-
-    typedef struct OnePoleFilter_t
-    {
-    public:
-
-        double tmpL, tmpR, a1, a2, val;
-
-    } OnePoleFilter_t;
-
-    typedef struct  TwoPoleFilter_t
-    {
-    public:
-
-        double tmpL[4], tmpR[4], a1, a2, b1, b2, val;
-
-    } TwoPoleFilter_t;
-
-    void clearOnePoleFilterState(OnePoleFilter_t* f);
-    void setupOnePoleFilter(const double audioRate, const double cutOff, OnePoleFilter_t* f);
-    void onePoleLPFilter(OnePoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR);
-
-    void clearTwoPoleFilterState(TwoPoleFilter_t* f);
-    void setupTwoPoleFilter(const double audioRate, const double cutOff, const double qFactor, TwoPoleFilter_t* f);
-    void twoPoleLPFilter(TwoPoleFilter_t* f, const float* inL, const float* inR, float* outL, float* outR);
-
-    void inputGain(const float* inL, const float* inR, squarewave_t* out)const;
-    void fullWaveRect(const float* inL, const float* inR, squarewave_t* out) const;
-
-    void mixWaves();
-    float rampVolume(const float input, const float counter);
-
-    squarewave_t lm386 = { 0.f, 0.f, 0.5f };
-
-    squarewave_t subOctOne = { 0.f, 0.f, 0.5f },
-                 subOctTwo = { 0.f, 0.f, 0.5f };
-
-    squarewave_t rectifier = { 0.f, 0.f, 0.5f };
-    squarewave_t mix  = { 0.f, 0.f, 0.5f };
-
-    OnePoleFilter_t rectLPF, filterLPF;
-    TwoPoleFilter_t inSubOctLPF;
-
-    int lineInstState = 1;
-
-    float filterAmount = 0.5f, muteCounter = 0.f;;
-    float masterVol = 0.5f, blend = 0.f;
-
-    PulseGen cd4024one[2], cd4024two[2];
-
-    bool paramsUpdated = true;
-    juce::AudioProcessorValueTreeState APVTS;
-
-    void updateParams();
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameters();
-    void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged,
-                                    const juce::Identifier& property) override;
-
-
-    //==============================================================================
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SubdominantAudioProcessor)
-};
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin processor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Engine.h"
+#include "PresetBank.h"
+#include "NoiseGate.h"
+#include "CabConvolver.h"
+#include "SessionCapture.h"
+#include "Telemetry.h"
+
+//==============================================================================
+/**
+*/
+
+class SubdominantAudioProcessor  : public juce::AudioProcessor,
+                                   public juce::ValueTree::Listener,
+                                   private juce::Timer
+{
+public:
+    //==============================================================================
+    SubdominantAudioProcessor();
+    ~SubdominantAudioProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+    void reset() override;
+
+   #ifndef JucePlugin_PreferredChannelConfigurations
+    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
+   #endif
+
+    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override;
+
+    //==============================================================================
+    const juce::String getName() const override;
+
+    bool acceptsMidi() const override;
+    bool producesMidi() const override;
+    bool isMidiEffect() const override;
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    int getNumPrograms() override;
+    int getCurrentProgram() override;
+    void setCurrentProgram (int index) override;
+    const juce::String getProgramName (int index) override;
+    void changeProgramName (int index, const juce::String& newName) override;
+
+    bool isUserProgram(const int index) const { return index >= PresetBank::numFactoryPrograms && index < PresetBank::numPrograms; }
+    void storeUserProgram(const int index, const juce::String& name);
+
+    //==============================================================================
+    void getStateInformation (juce::MemoryBlock& destData) override;
+    void setStateInformation (const void* data, int sizeInBytes) override;
+
+    void updateTrackProperties (const TrackProperties& properties) override;
+
+    juce::AudioProcessorValueTreeState& getAPVTS() { return APVTS; }
+
+    void setLineInstState(const float state)
+    {
+        APVTS.getParameter("LINE/INST")->beginChangeGesture();
+        APVTS.getParameterAsValue("LINE/INST").setValue(state);
+        APVTS.getParameter("LINE/INST")->endChangeGesture();
+    }
+
+    /*
+     * editor-visible state, all lock-free reads the editor polls from its timer. programsVersion bumps
+     * whenever a program name or the bank contents change, so the program list is only rebuilt then
+     */
+    bool getLineInstState() const { return lineInstParam->load() >= 0.5f; }
+    int getProgramsVersion() const { return programsVersion.load(); }
+
+    /*
+     * scope feed: while the editor's scope is showing, the audio thread pushes one frame every
+     * scopeDecimation samples into a wait-free single producer/single consumer ring, the editor
+     * drains it from its timer. with the scope hidden what's left is one acquire load of the flag per
+     * block and nothing is pushed (Tools/Bench scope)
+     */
+    typedef struct ScopeFrame_t
+    {
+    public:
+
+        float mix, norm, dom, sub1, sub2;
+
+    } ScopeFrame_t;
+
+    /* ~170ms at the scope rate, five of the editor's timer ticks, and small enough that the ring stays in cache */
+    static constexpr int scopeFifoSize = 256;
+
+    void setScopeActive(const bool active);
+    int readScope(ScopeFrame_t* dest, const int maxFrames);
+    double getScopeRate() const { return scopeRate.load(); }
+
+    /*
+     * cab IR after the tone filter, on the wet side only. the file path is saved with the state,
+     * loading and FFT setup happen on a background thread and the result is swapped in at the
+     * next sub-block, no IR loaded = no cab
+     */
+    void loadCab(const juce::File& file);
+    void clearCab();
+    bool hasCab() const { return APVTS.state.hasProperty("CABIR"); }
+    juce::String getCabName() const;
+
+    /*
+     * the parameter values the active state was last set up with, audio thread only: Tools/RTCheck
+     * reads them between blocks to see automation get through to the render
+     */
+    const float* getAppliedParams() const { return lastParams; }
+
+    /* true while an IR is still being read in, so an offline render (Tools/Replay) can wait for it */
+    bool isCabLoading() const { return cabLoader != nullptr && cabLoader->getNumJobs() > 0; }
+
+private:
+    static constexpr size_t cacheLine = SubdominantEngine::cacheLine;
+
+    static constexpr int subBlockSize = SubdominantEngine::subBlockSize;
+    static constexpr int blockChunk = SubdominantEngine::blockChunk;
+
+    typedef SubdominantEngine::DSPState_t DSPState_t;
+
+    /* the render path itself, see Engine.h. everything in here is about feeding it states */
+    SubdominantEngine engine;
+
+    /*
+     * host blocks are rendered in fixed sub-blocks of subBlockSize samples, the engine's scratch
+     * buffers plus these, small enough that a sub-block's whole working set stays in L1
+     */
+    typedef struct BlockBuffers_t
+    {
+    public:
+
+        float out[2][blockChunk], fade[2][blockChunk];
+
+        /* dry side of BLEND AMOUNT, kept apart until the wet side has been through the cab */
+        float dryOut[2][blockChunk], fadeDry[2][blockChunk];
+
+        /* decimated mode: the input at the engine rate and the delayed dry */
+        float decimated[2][blockChunk], dry[2][blockChunk];
+
+        /* the wet side through the outgoing cab while a new one fades in */
+        float cabFade[2][blockChunk];
+
+    } BlockBuffers_t;
+
+    alignas(cacheLine) BlockBuffers_t blockBuf;
+
+    void handleMidi(const juce::MidiMessage& message);
+    void beginSubBlock();
+
+    /* position inside the current sub-block, and the values the active state was last set up with */
+    int subBlockPos = 0;
+    float lastParams[Params::numParams];
+
+    double transportBpm = 0.0, transportPpq = 0.0;
+    bool transportPlaying = false;
+
+    /* the ring is claimed once per block and the frames written straight into it */
+    void beginScope();
+    void pushScope(const float* outL, const float* outR, const int numSamples, const int numVoiceSamples);
+    void endScope();
+
+    /* only allocated the first time the scope opens, most instances never need it */
+    juce::AbstractFifo scopeFifo { scopeFifoSize };
+    std::unique_ptr<ScopeFrame_t[]> scopeBuffer;
+
+    alignas(cacheLine) std::atomic<bool> scopeActive { false };
+    std::atomic<double> scopeRate { 44100.0 };
+    int scopeDecimation = 1, scopePhase = 0;
+    float scopeMix = 0.f, scopeMixScale = 1.f;
+    ScopeFrame_t scopeVoices {};
+    int scopeStart1 = 0, scopeSize1 = 0, scopeStart2 = 0, scopeSize2 = 0, scopeWritten = 0;
+
+    /* runs after the state crossfade, on the final output, keyed from the dry input */
+    NoiseGate gate;
+    alignas(cacheLine) std::atomic<int> lookaheadSamples { 0 };
+
+    void updateGate(const float* values);
+    void updateLookahead();
+
+    double preparedRate = 0.0;
+
+    /*
+     * decimated mode: at 176.4khz and up the engine runs at the host rate halved until it's down to
+     * 88.2/96khz, through the halfband chains in Halfband.h. the dry side of BLEND AMOUNT stays at the
+     * host rate, delayed to line up with the resampled wet, and the delay is reported as latency.
+     * engineRate is what every state, filter table and LFO is set up for, the host rate otherwise
+     */
+    void delayDry(const float* inL, const float* inR, const int numSamples);
+
+    bool decimateHighRates = false, decimateRequested = false;
+    int decimationStages = 0, resamplerLatency = 0;
+    double engineRate = 0.0;
+
+    HalfbandDecimatorChain decimator;
+
+    static constexpr int dryDelaySize = Halfband::latency(Halfband::maxStages) + 1;
+    float dryDelay[2][dryDelaySize];
+    int dryWritePos = 0;
+
+    /*
+     * deterministic render mode: every coefficient goes through PortableMath instead of the platform's
+     * libm, the cab's FFTs through PortableFFT instead of juce::dsp::FFT, and the LFO only locks to the
+     * host position when the transport starts, so renders come out bit identical on any CPU and at any
+     * buffer size, automation aside (it moves with the host's blocks, see beginSubBlock()). picked up in
+     * prepareToPlay(), which hosts call before every offline render
+     */
+    bool portableMath = false, preparedPortable = false;
+    bool wasPlaying = false;
+
+    typedef struct Program_t
+    {
+    public:
+
+        juce::String name;
+        float values[Params::numParams];
+
+    } Program_t;
+
+    /*
+     * the message thread never touches the state the audio thread is running: it builds a new one
+     * and publishes it through pendingState, the audio thread picks it up at the next block boundary
+     * and crossfades out of the old one, then hands the old one back through retiredState to be freed.
+     * states are built under bankLock, which prepareToPlay() holds while the engine's tables change,
+     * so createState() gives nullptr before the first prepare
+     */
+    DSPState_t* createState();
+    void publishState(DSPState_t* s);
+    void reclaimRetiredState();
+    void acquirePendingState();
+    void startFade(DSPState_t* next);
+    void finishFade();
+
+    /* audio thread only: the running states and the crossfade between them */
+    alignas(cacheLine) DSPState_t* activeState = nullptr;
+    DSPState_t* fadeState = nullptr;
+    DSPState_t* spareState = nullptr;
+
+    /* equal-power crossfade, gains are stepped around the quarter circle by a fixed rotation */
+    float fadeIn = 1.f, fadeOut = 0.f, fadeRotCos = 1.f, fadeRotSin = 0.f;
+    int fadeLength = 480, fadeSamplesLeft = 0;
+
+    alignas(cacheLine) std::atomic<DSPState_t*> pendingState { nullptr };
+    alignas(cacheLine) std::atomic<DSPState_t*> retiredState { nullptr };
+
+    /* cab convolvers go through the same hand-off as the states, an empty one means bypassed */
+    void startCabLoad();
+    void publishCab(CabConvolver* cab);
+    void reclaimRetiredCab();
+    void acquirePendingCab();
+    void finishCabFade();
+
+    /* only created the first time an IR gets loaded */
+    std::unique_ptr<juce::ThreadPool> cabLoader;
+
+    /*
+     * SESSION CAPTURE records every block from the next prepareToPlay() on, for Tools/Replay. switching
+     * it off stops the file straight away, switching it on waits for the host to prepare again
+     */
+    void startCapture(const double sampleRate, const int samplesPerBlock);
+
+    SessionCapture capture;
+
+    /* this instance's slot in the process' telemetry segment, read by Tools/Monitor */
+    TelemetrySlot telemetry;
+    uint32_t getQuality() const;
+
+    /* audio thread only: the running cab, and the one fading out after a swap (nullptr = no cab either way) */
+    CabConvolver* activeCab = nullptr;
+    CabConvolver* fadeCab = nullptr;
+
+    float cabFadeIn = 1.f, cabFadeOut = 0.f;
+    int cabFadeSamplesLeft = 0;
+
+    alignas(cacheLine) std::atomic<CabConvolver*> pendingCab { nullptr };
+    alignas(cacheLine) std::atomic<CabConvolver*> retiredCab { nullptr };
+
+    /*
+     * program bank: every program keeps a ready-to-run DSPState_t with its coefficients already set up,
+     * so a switch on the audio thread is just a copy into the spare state followed by a crossfade
+     */
+    void buildProgramStates();
+    void buildProgramState(const int index);
+    void loadUserPrograms();
+    void acquireProgram();
+    void acquireReset();
+    void timerCallback() override;
+    void notifyProgramChanged();
+
+    Program_t programs[PresetBank::numPrograms];
+    DSPState_t programStates[PresetBank::numPrograms];
+
+    alignas(cacheLine) juce::SpinLock bankLock;
+    alignas(cacheLine) std::atomic<int> requestedProgram { -1 };
+    alignas(cacheLine) std::atomic<bool> resetRequested { false };
+    alignas(cacheLine) std::atomic<int> currentProgram { 0 }, programsVersion { 0 };
+
+    /*
+     * set wherever the program changes, picked up by the timer on the message thread: posting a
+     * message from the audio thread can lock or allocate inside the OS queue, a store can't
+     */
+    alignas(cacheLine) std::atomic<bool> programChangePending { false };
+
+    juce::AudioProcessorValueTreeState APVTS;
+
+    std::atomic<float>* lineInstParam = nullptr;
+    std::atomic<float>* decimateParam = nullptr;
+    std::atomic<float>* lookaheadParam = nullptr;
+    std::atomic<float>* deterministicParam = nullptr;
+    std::atomic<float>* captureParam = nullptr;
+
+    /* looked up once in the constructor, the string lookups are not cheap enough for every block or program */
+    juce::RangedAudioParameter* paramObjects[Params::numParams];
+    std::atomic<float>* paramValues[Params::numParams];
+
+    float getParamDefault(const int index);
+    void readParams(float* values);
+    void updateParams(DSPState_t* s);
+    juce::AudioProcessorValueTreeState::ParameterLayout createParameters();
+    void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyHasChanged,
+                                    const juce::Identifier& property) override;
+
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SubdominantAudioProcessor)
+};
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    PortableFFT.h
+    Created: 20 Oct 2026 2:04:51pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "PortableMath.h"
+
+/*
+ * plain radix-2 FFT for the cab in the deterministic render mode. juce::dsp::FFT hands the work to
+ * vDSP, IPP or FFTW wherever one of them is around, and each rounds differently. this one always does
+ * the same butterflies in the same order, with twiddles from PortableMath, so it gives the same bits
+ * everywhere. same packing as juce's real-only transforms, so the convolver can use either: bins
+ * 0..size/2 as interleaved re/im pairs, the inverse scaled by 1/size.
+ *
+ * the real transforms go through a full size complex one, twice the work a packed real FFT would need,
+ * which at the cab's 256 points is still a few microseconds per partition
+ */
+template <int order>
+class PortableFFT
+{
+public:
+    static constexpr int size = 1 << order;
+
+    PortableFFT()
+    {
+        constexpr double twoPi = 6.283185307179586476925;
+
+        for (int k = 0; k < size / 2; k++)
+        {
+            twiddleRe[k] = (float) PortableMath::cos((twoPi * k) / size);
+            twiddleIm[k] = (float) -PortableMath::sin((twoPi * k) / size);
+        }
+
+        for (int i = 0; i < size; i++)
+        {
+            int r = 0;
+
+            for (int bit = 0; bit < order; bit++)
+                r |= ((i >> bit) & 1) << (order - 1 - bit);
+
+            reversed[i] = r;
+        }
+    }
+
+    /* data holds size * 2 floats, the first size of them the real input */
+    void performRealOnlyForwardTransform(float* data)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            re[reversed[i]] = data[i];
+            im[reversed[i]] = 0.f;
+        }
+
+        butterflies(false);
+
+        for (int k = 0; k <= size / 2; k++)
+        {
+            data[2 * k] = re[k];
+            data[2 * k + 1] = im[k];
+        }
+    }
+
+    /* bins 0..size/2 in, the other half is their mirror image, size real samples out */
+    void performRealOnlyInverseTransform(float* data)
+    {
+        for (int k = 0; k < size; k++)
+        {
+            const int bin = k <= size / 2 ? k : size - k;
+
+            re[reversed[k]] = data[2 * bin];
+            im[reversed[k]] = k <= size / 2 ? data[2 * bin + 1] : -data[2 * bin + 1];
+        }
+
+        butterflies(true);
+
+        for (int i = 0; i < size; i++)
+            data[i] = re[i] * (1.f / size);
+    }
+
+private:
+    /* in place on re/im, already in bit reversed order */
+    void butterflies(const bool inverse)
+    {
+        for (int half = 1; half < size; half *= 2)
+        {
+            const int step = size / (2 * half);
+
+            for (int start = 0; start < size; start += 2 * half)
+            {
+                for (int j = 0; j < half; j++)
+                {
+                    const float wr = twiddleRe[j * step];
+                    const float wi = inverse ? -twiddleIm[j * step] : twiddleIm[j * step];
+
+                    const int a = start + j;
+                    const int b = a + half;
+
+                    const float tr = (re[b] * wr) - (im[b] * wi);
+                    const float ti = (re[b] * wi) + (im[b] * wr);
+
+                    re[b] = re[a] - tr;
+                    im[b] = im[a] - ti;
+                    re[a] = re[a] + tr;
+                    im[a] = im[a] + ti;
+                }
+            }
+        }
+    }
+
+    float twiddleRe[size / 2], twiddleIm[size / 2];
+    float re[size], im[size];
+    int reversed[size];
+};
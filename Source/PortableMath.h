@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    PortableMath.h
+    Created: 19 Oct 2026 5:21:07pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+
+/* fused multiply-adds round differently from a separate multiply and add, keep them out of here */
+#if defined (_MSC_VER)
+ #pragma fp_contract (off)
+#elif defined (__clang__)
+ #pragma STDC FP_CONTRACT OFF
+#endif
+
+/*
+ * exp/log/pow/sin/cos/tan for the deterministic render mode. the libm versions differ between
+ * platforms and even between CPUs (glibc picks FMA variants at load time), these only use
+ * + - * /, exact scaling by powers of two and comparisons, all evaluated in a fixed order, so
+ * IEEE 754 gives the same bits everywhere. exp, log, sin, cos and tan are within a few ulp of
+ * libm, pow loses more the bigger exponent * log(base) gets (about 20 ulp at the bottom of the
+ * gate's range), which is still far more than the coefficient setup needs. Core/Tests checks
+ * those bounds. none of this is meant for the per-sample path
+ */
+namespace PortableMath
+{
+    constexpr double ln2Hi = 6.93147180369123816490e-01;
+    constexpr double ln2Lo = 1.90821492927058770002e-10;
+    constexpr double invLn2 = 1.44269504088896338700e+00;
+
+    constexpr double pio2Hi = 1.57079632673412561417e+00;
+    constexpr double pio2Lo = 6.07710050650619224932e-11;
+    constexpr double invPio2 = 6.36619772367581382433e-01;
+
+    /* round to nearest without depending on the current rounding mode */
+    inline double roundHalfAway(const double x)
+    {
+        return x >= 0.0 ? std::floor(x + 0.5) : -std::floor(-x + 0.5);
+    }
+
+    inline double exp(const double x)
+    {
+        if (x > 709.0) return HUGE_VAL;
+        if (x < -745.0) return 0.0;
+
+        /* x = k * ln2 + r, |r| <= ln2 / 2 */
+        const double k = roundHalfAway(x * invLn2);
+        const double r = (x - k * ln2Hi) - k * ln2Lo;
+
+        /* taylor series to r^14 / 14!, below 1e-17 over the reduced range */
+        double p = 1.0 / 87178291200.0;
+
+        p = p * r + 1.0 / 6227020800.0;
+        p = p * r + 1.0 / 479001600.0;
+        p = p * r + 1.0 / 39916800.0;
+        p = p * r + 1.0 / 3628800.0;
+        p = p * r + 1.0 / 362880.0;
+        p = p * r + 1.0 / 40320.0;
+        p = p * r + 1.0 / 5040.0;
+        p = p * r + 1.0 / 720.0;
+        p = p * r + 1.0 / 120.0;
+        p = p * r + 1.0 / 24.0;
+        p = p * r + 1.0 / 6.0;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+
+        return std::ldexp(p, (int) k);
+    }
+
+    inline double log(const double x)
+    {
+        if (!(x > 0.0)) return x == 0.0 ? -HUGE_VAL : NAN;
+
+        /* x = m * 2^e with m in [sqrt(0.5), sqrt(2)) */
+        int e = 0;
+        double m = std::frexp(x, &e);
+
+        if (m < 0.70710678118654752440)
+        {
+            m *= 2.0;
+            e -= 1;
+        }
+
+        /* log(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.172 */
+        const double s = (m - 1.0) / (m + 1.0);
+        const double s2 = s * s;
+
+        double p = 1.0 / 23.0;
+
+        p = p * s2 + 1.0 / 21.0;
+        p = p * s2 + 1.0 / 19.0;
+        p = p * s2 + 1.0 / 17.0;
+        p = p * s2 + 1.0 / 15.0;
+        p = p * s2 + 1.0 / 13.0;
+        p = p * s2 + 1.0 / 11.0;
+        p = p * s2 + 1.0 / 9.0;
+        p = p * s2 + 1.0 / 7.0;
+        p = p * s2 + 1.0 / 5.0;
+        p = p * s2 + 1.0 / 3.0;
+        p = p * s2 + 1.0;
+
+        return (e * ln2Hi) + ((2.0 * s * p) + (e * ln2Lo));
+    }
+
+    inline double pow(const double base, const double exponent)
+    {
+        if (exponent == 0.0) return 1.0;
+        if (base == 0.0) return exponent > 0.0 ? 0.0 : HUGE_VAL;
+
+        /* only ever called with positive bases here */
+        return exp(exponent * log(base));
+    }
+
+    /* sin and cos of the reduced argument, |r| <= pi / 4 */
+    inline double sinReduced(const double r)
+    {
+        const double r2 = r * r;
+        double p = -1.0 / 121645100408832000.0;
+
+        p = p * r2 + 1.0 / 355687428096000.0;
+        p = p * r2 - 1.0 / 1307674368000.0;
+        p = p * r2 + 1.0 / 6227020800.0;
+        p = p * r2 - 1.0 / 39916800.0;
+        p = p * r2 + 1.0 / 362880.0;
+        p = p * r2 - 1.0 / 5040.0;
+        p = p * r2 + 1.0 / 120.0;
+        p = p * r2 - 1.0 / 6.0;
+
+        return r + (r * r2 * p);
+    }
+
+    inline double cosReduced(const double r)
+    {
+        const double r2 = r * r;
+        double p = 1.0 / 6402373705728000.0;
+
+        p = p * r2 - 1.0 / 20922789888000.0;
+        p = p * r2 + 1.0 / 87178291200.0;
+        p = p * r2 - 1.0 / 479001600.0;
+        p = p * r2 + 1.0 / 3628800.0;
+        p = p * r2 - 1.0 / 40320.0;
+        p = p * r2 + 1.0 / 720.0;
+        p = p * r2 - 1.0 / 24.0;
+        p = p * r2 + 0.5;
+
+        return 1.0 - (r2 * p);
+    }
+
+    /* x = k * pi/2 + r, good for the few hundred radians the filter setup can ask for */
+    inline double reduce(const double x, int* quadrant)
+    {
+        const double k = roundHalfAway(x * invPio2);
+
+        *quadrant = ((int) std::fmod(k, 4.0) + 4) & 3;
+
+        return (x - k * pio2Hi) - k * pio2Lo;
+    }
+
+    inline double sin(const double x)
+    {
+        int q = 0;
+        const double r = reduce(x, &q);
+
+        switch (q)
+        {
+            case 0:  return  sinReduced(r);
+            case 1:  return  cosReduced(r);
+            case 2:  return -sinReduced(r);
+            default: return -cosReduced(r);
+        }
+    }
+
+    inline double cos(const double x)
+    {
+        int q = 0;
+        const double r = reduce(x, &q);
+
+        switch (q)
+        {
+            case 0:  return  cosReduced(r);
+            case 1:  return -sinReduced(r);
+            case 2:  return -cosReduced(r);
+            default: return  sinReduced(r);
+        }
+    }
+
+    inline double tan(const double x)
+    {
+        int q = 0;
+        const double r = reduce(x, &q);
+
+        return (q & 1) ? -cosReduced(r) / sinReduced(r) : sinReduced(r) / cosReduced(r);
+    }
+}
+
+/*
+ * the switch between the platform's libm (fast, default) and the portable versions above,
+ * picked once per setup call rather than per sample
+ */
+namespace CoeffMath
+{
+    inline double exp(const double x, const bool portable) { return portable ? PortableMath::exp(x) : std::exp(x); }
+    inline double pow(const double b, const double e, const bool portable) { return portable ? PortableMath::pow(b, e) : std::pow(b, e); }
+    inline double sin(const double x, const bool portable) { return portable ? PortableMath::sin(x) : std::sin(x); }
+    inline double cos(const double x, const bool portable) { return portable ? PortableMath::cos(x) : std::cos(x); }
+    inline double tan(const double x, const bool portable) { return portable ? PortableMath::tan(x) : std::tan(x); }
+}
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+    Created: 19 Oct 2026 9:40:51am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Params.h"
+
+namespace PresetBank
+{
+    typedef struct FactoryProgram_t
+    {
+        const char* name;
+        float values[Params::numParams];
+
+    } FactoryProgram_t;
+
+    /*
+     * rows cover the first numFactoryValues parameters, any left off the end of a row (modulation)
+     * start at 0 or their minimum. everything past numFactoryValues (gate, bands) is left at its default
+     */
+    constexpr int numFactoryValues = Params::lfoSync + 1;
+
+    /*  NORM  DOM   SUB1  SUB2  FLTR  GLTCH LINE  GAIN  BLEND VOL   SUB3  SUB4 */
+    static const FactoryProgram_t factory[] =
+    {
+        { "Init",          { 0.5f, 0.5f, 0.5f, 0.5f, 1.0f, 0.01f, 1.f, 0.5f, 1.0f, 0.5f, 0.0f, 0.0f } },
+        { "Octave Down",   { 0.3f, 0.0f, 0.8f, 0.2f, 0.6f, 0.0f,  1.f, 0.4f, 1.0f, 0.5f, 0.0f, 0.0f } },
+        { "Two Down",      { 0.2f, 0.0f, 0.3f, 0.9f, 0.5f, 0.0f,  1.f, 0.4f, 1.0f, 0.5f, 0.0f, 0.0f } },
+        { "Octave Up",     { 0.3f, 0.9f, 0.0f, 0.0f, 0.8f, 0.01f, 1.f, 0.6f, 1.0f, 0.4f, 0.0f, 0.0f } },
+        { "Glitch Storm",  { 0.4f, 0.3f, 0.7f, 0.7f, 1.0f, 0.6f,  1.f, 0.8f, 1.0f, 0.4f, 0.0f, 0.0f } },
+        { "Bass Blend",    { 0.2f, 0.1f, 0.4f, 0.6f, 0.4f, 0.0f,  0.f, 0.5f, 0.5f, 0.6f, 0.0f, 0.0f } },
+        { "Dark Sub",      { 0.1f, 0.0f, 0.5f, 0.9f, 0.2f, 0.0f,  1.f, 0.3f, 1.0f, 0.6f, 0.4f, 0.0f } },
+        { "Sub Cascade",   { 0.2f, 0.0f, 0.5f, 0.5f, 0.5f, 0.0f,  1.f, 0.5f, 1.0f, 0.5f, 0.5f, 0.4f } },
+        { "Full Stack",    { 0.7f, 0.7f, 0.7f, 0.7f, 0.9f, 0.2f,  1.f, 0.7f, 1.0f, 0.4f, 0.0f, 0.0f } },
+
+        /*  ...           ENV GLTCH ENV FLTR LFO GLTCH LFO FLTR RATE  SYNC */
+        { "Auto Wah Sub",  { 0.3f, 0.2f, 0.6f, 0.4f, 0.2f, 0.0f,  1.f, 0.5f, 1.0f, 0.5f, 0.0f, 0.0f,
+                             0.0f,     0.7f,     0.0f,     0.0f,     1.0f, 0.f } },
+        { "Glitch Sweep",  { 0.3f, 0.3f, 0.6f, 0.6f, 0.8f, 0.1f,  1.f, 0.6f, 1.0f, 0.4f, 0.2f, 0.0f,
+                             0.0f,     0.0f,     0.3f,     0.0f,     1.0f, 4.f } },
+    };
+
+    constexpr int numFactoryPrograms = (int) (sizeof(factory) / sizeof(factory[0]));
+    constexpr int numUserPrograms = 8;
+    constexpr int numPrograms = numFactoryPrograms + numUserPrograms;
+}
@@ -1,44 +1,165 @@
-/*
-  ==============================================================================
-
-    PulseGen.h
-    Created: 12 Jan 2024 10:15:50pm
-    Author:  _astriid_
-
-  ==============================================================================
-*/
-
-#pragma once
-
-class PulseGen
-{
-public:
-    PulseGen() {};
-    ~PulseGen() {};
-
-    void incPulseCounter(const float* samp)
-    {
-        if ((*samp >= 0) == (lastSamp >= 0) || (lastSamp == 0.f && *samp == 0.f))
-        {
-            lastSamp = *samp;
-            return;
-        }
-
-        counter ^= 1;
-
-        if (counter) state ^= 1;
-
-        lastSamp = *samp;
-    }
-
-    float generatePulseWave() const
-    {
-        return lastSamp != 0.f ? state ? 1.f : -1.f : 0.f;
-    }
-
-private:
-    int counter = 0;
-    int state = 1;
-
-    float lastSamp = 0.f;
-};
+/*
+  ==============================================================================
+
+    PulseGen.h
+    Created: 12 Jan 2024 10:15:50pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * CD4024 style chain of dividers: tap 1 flips on every second zero crossing of the input, tap n on
+ * every second edge of tap n - 1, so tap n is the square n octaves below the input (tap 1 = /2,
+ * tap 2 = /4, ...) and adding octaves costs nothing per sample.
+ *
+ * every tap is silent wherever the input sits exactly on zero, and the next tap is clocked by what
+ * the one before it outputs, silence included (silence reads as positive, like the input). that's
+ * how the old cascade of single-stage dividers behaved, so taps 1 and 2 match the old SUB1/SUB2
+ * for any input. with no exact zeros in the input it's a plain ripple counter. all taps start
+ * high, the phase the old cascade started in
+ */
+class PulseGen
+{
+public:
+    static constexpr int numStages = 7;
+
+    PulseGen() {};
+    ~PulseGen() {};
+
+    void incPulseCounter(const float* samp)
+    {
+        if (changesTaps(lastSamp, *samp)) clock(lastSamp, *samp);
+
+        lastSamp = *samp;
+    }
+
+    float generatePulseWave(const int tap) const
+    {
+        /* the sign comes out of the bit, the taps flip too often for a branch on them to be guessed right */
+        const float sign = (float) ((int) ((taps >> tap) & 1u) * 2 - 1);
+
+        return lastSamp != 0.f ? sign : 0.f;
+    }
+
+    /*
+     * block version of incPulseCounter()/generatePulseWave(), writing the sum of taps 1..numTaps
+     * scaled by tapGains[0..numTaps - 1]: sign changes and the edges of exact zero runs are found
+     * with flat compare passes over the whole block, then the constant runs between them are filled
+     * in, so the dividers and the tap sum only get touched there. generatePulseWave() gives single
+     * taps as they stand at the last sample
+     */
+    void processBlock(const float* in, float* out, const float* tapGains, const int numTaps, const int numSamples)
+    {
+        for (int start = 0; start < numSamples; start += maxChunk)
+            processChunk(in + start, out + start, tapGains, numTaps, std::min(maxChunk, numSamples - start));
+    }
+
+private:
+    static constexpr int maxChunk = 256;
+
+    /* nothing downstream can move unless the input changes sign or goes into or out of exact zero */
+    static bool changesTaps(const float prev, const float next)
+    {
+        return ((next >= 0.f) != (prev >= 0.f)) || ((next == 0.f) != (prev == 0.f));
+    }
+
+    /*
+     * one step of the whole chain, prev -> next on the input. each divider is clocked by any sign
+     * change of what drives it: the input for tap 1, the tap before it as it sounds for the rest
+     */
+    void clock(const float prev, const float next)
+    {
+        const uint32_t oldTaps = taps;
+
+        bool wasLow = !(prev >= 0.f);
+        bool isLow = !(next >= 0.f);
+
+        for (int n = 1; n <= numStages; n++)
+        {
+            const uint32_t bit = 1u << n;
+
+            if (wasLow != isLow)
+            {
+                halfCycles ^= bit;
+
+                if (halfCycles & bit) taps ^= bit;
+            }
+
+            wasLow = prev != 0.f && (oldTaps & bit) == 0;
+            isLow = next != 0.f && (taps & bit) == 0;
+        }
+    }
+
+    float sumTaps(const float* tapGains, const int numTaps) const
+    {
+        float sum = 0.f;
+
+        for (int tap = 1; tap <= numTaps; tap++)
+            sum += (taps >> tap) & 1u ? tapGains[tap - 1] : -tapGains[tap - 1];
+
+        return sum;
+    }
+
+    void processChunk(const float* in, float* out, const float* tapGains, const int numTaps, const int numSamples)
+    {
+        /* padded so the crossing scan can always read whole 8 byte words */
+        alignas(8) unsigned char flip[maxChunk + 8];
+        unsigned char sign[maxChunk];
+
+        float level = sumTaps(tapGains, numTaps);
+        int spanStart = 0;
+
+        if (numSamples <= 0) return;
+
+        /* same tests as changesTaps(), bit 0 = negative, bit 1 = exactly zero */
+        for (int i = 0; i < numSamples; i++)
+            sign[i] = (unsigned char) ((in[i] >= 0.f ? 0 : 1) | (in[i] == 0.f ? 2 : 0));
+
+        flip[0] = sign[0] ^ (unsigned char) ((lastSamp >= 0.f ? 0 : 1) | (lastSamp == 0.f ? 2 : 0));
+
+        for (int i = 1; i < numSamples; i++)
+            flip[i] = sign[i] ^ sign[i - 1];
+
+        std::memset(flip + numSamples, 0, 8);
+
+        for (int i = 0; i < numSamples; i += 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, flip + i, 8);
+
+            /* no crossings anywhere in these 8 samples */
+            if (word == 0) continue;
+
+            for (int j = i; j < i + 8 && j < numSamples; j++)
+            {
+                if (!flip[j]) continue;
+
+                std::fill(out + spanStart, out + j, level);
+                spanStart = j;
+
+                clock(j == 0 ? lastSamp : in[j - 1], in[j]);
+                level = sumTaps(tapGains, numTaps);
+            }
+        }
+
+        std::fill(out + spanStart, out + numSamples, level);
+
+        /* generatePulseWave() is silent wherever the input sits exactly on zero */
+        for (int i = 0; i < numSamples; i++)
+            out[i] = in[i] != 0.f ? out[i] : 0.f;
+
+        lastSamp = in[numSamples - 1];
+    }
+
+    /* bit n: tap n's output and its divider's half cycle, tap n flips every second time the latter does */
+    uint32_t taps = ~0u, halfCycles = 0u;
+
+    float lastSamp = 0.f;
+};
@@ -0,0 +1,203 @@
+/*
+  ==============================================================================
+
+    ScopeView.cpp
+    Created: 19 Oct 2026 4:02:19pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "ScopeView.h"
+
+namespace
+{
+    enum { traceMix, traceNorm, traceDom, traceSub1, traceSub2 };
+
+    const char* const traceNames[] = { "MIX", "NORM", "DOM", "SUB1", "SUB2" };
+
+    const juce::Colour traceColours[] = { juce::Colours::yellow, juce::Colours::limegreen, juce::Colours::limegreen,
+                                          juce::Colours::blue.brighter(0.4f), juce::Colours::blue.brighter(0.4f) };
+
+    /* the slowest voice that's actually sounding makes for the steadiest picture */
+    const int triggerOrder[] = { traceSub2, traceSub1, traceNorm, traceDom, traceMix };
+
+    constexpr float spectrumFloor = -90.f;
+    constexpr float spectrumDecay = 3.f;
+    constexpr float spectrumLowFreq = 20.f;
+}
+
+ScopeView::ScopeView(SubdominantAudioProcessor& p) : audioProcessor(p)
+{
+    setOpaque(true);
+
+    for (auto& trace : history)
+        std::fill(trace, trace + historySize, 0.f);
+
+    std::fill(spectrum, spectrum + fftSize / 2, spectrumFloor);
+}
+
+ScopeView::~ScopeView()
+{
+    stopTimer();
+    audioProcessor.setScopeActive(false);
+}
+
+void ScopeView::visibilityChanged()
+{
+    if (isVisible())
+    {
+        /* throw away whatever was left in the ring from the last time the scope was open */
+        while (audioProcessor.readScope(readBuffer, SubdominantAudioProcessor::scopeFifoSize) > 0) {}
+
+        audioProcessor.setScopeActive(true);
+        startTimerHz(frameRate);
+    }
+    else
+    {
+        audioProcessor.setScopeActive(false);
+        stopTimer();
+    }
+}
+
+void ScopeView::timerCallback()
+{
+    const int numFrames = audioProcessor.readScope(readBuffer, SubdominantAudioProcessor::scopeFifoSize);
+
+    /* nothing new (transport stopped, host not processing), nothing to redraw */
+    if (numFrames == 0) return;
+
+    for (int i = 0; i < numFrames; i++)
+    {
+        const SubdominantAudioProcessor::ScopeFrame_t& f = readBuffer[i];
+
+        history[traceMix][historyPos]  = f.mix;
+        history[traceNorm][historyPos] = f.norm;
+        history[traceDom][historyPos]  = f.dom;
+        history[traceSub1][historyPos] = f.sub1;
+        history[traceSub2][historyPos] = f.sub2;
+
+        historyPos = (historyPos + 1) % historySize;
+    }
+
+    updateSpectrum();
+    repaint();
+}
+
+void ScopeView::updateSpectrum()
+{
+    /* hann window gain is 0.5, so a full scale sine comes out at fftSize / 4 */
+    const float norm = 4.f / (float) fftSize;
+
+    for (int i = 0; i < fftSize; i++)
+        fftData[i] = history[traceMix][(historyPos + historySize - fftSize + i) % historySize];
+
+    std::fill(fftData + fftSize, fftData + fftSize * 2, 0.f);
+
+    window.multiplyWithWindowingTable(fftData, (size_t) fftSize);
+    fft.performFrequencyOnlyForwardTransform(fftData);
+
+    /* peaks show straight away and fall back at a fixed rate, so the display doesn't flicker */
+    for (int i = 0; i < fftSize / 2; i++)
+    {
+        const float db = juce::Decibels::gainToDecibels(fftData[i] * norm, spectrumFloor);
+        spectrum[i] = juce::jmax(db, spectrum[i] - spectrumDecay);
+    }
+}
+
+void ScopeView::paint(juce::Graphics& g)
+{
+    juce::Rectangle<float> area = getLocalBounds().toFloat().reduced(4.f);
+
+    g.fillAll(juce::Colours::darkblue.darker(0.6f));
+
+    paintScope(g, area.removeFromLeft(area.getWidth() * 0.6f).reduced(2.f));
+    paintSpectrum(g, area.reduced(2.f));
+}
+
+void ScopeView::paintScope(juce::Graphics& g, const juce::Rectangle<float>& area)
+{
+    const int width = juce::jmax(1, (int) area.getWidth());
+    const float laneHeight = area.getHeight() / (float) numTraces;
+
+    /* newest rising zero crossing that still leaves a whole span after it, oldest frame is at historyPos */
+    int start = historySize - scopeSpan;
+
+    for (const int trace : triggerOrder)
+    {
+        const float* h = history[trace];
+        int found = -1;
+
+        for (int k = historySize - scopeSpan; k > 0 && found < 0; k--)
+        {
+            if (h[(historyPos + k - 1) % historySize] < 0.f && h[(historyPos + k) % historySize] >= 0.f)
+                found = k;
+        }
+
+        if (found >= 0)
+        {
+            start = found;
+            break;
+        }
+    }
+
+    g.setColour(juce::Colours::blue.darker(0.4f));
+    g.drawRect(area, 1.f);
+
+    g.setFont(12.f);
+
+    for (int trace = 0; trace < numTraces; trace++)
+    {
+        const juce::Rectangle<float> lane = area.withY(area.getY() + laneHeight * trace).withHeight(laneHeight).reduced(0.f, 2.f);
+        const float* h = history[trace];
+
+        juce::Path p;
+
+        for (int x = 0; x < width; x++)
+        {
+            const int k = start + (x * scopeSpan) / width;
+            const float v = juce::jlimit(-1.f, 1.f, h[(historyPos + k) % historySize]);
+            const float y = lane.getCentreY() - v * lane.getHeight() * 0.5f;
+
+            if (x == 0) p.startNewSubPath(lane.getX(), y);
+            else        p.lineTo(lane.getX() + (float) x, y);
+        }
+
+        g.setColour(traceColours[trace]);
+        g.strokePath(p, juce::PathStrokeType(1.f));
+
+        g.setColour(traceColours[trace].withAlpha(0.7f));
+        g.drawText(traceNames[trace], lane.reduced(4.f, 0.f), juce::Justification::topLeft, false);
+    }
+}
+
+void ScopeView::paintSpectrum(juce::Graphics& g, const juce::Rectangle<float>& area)
+{
+    const float nyquist = (float) audioProcessor.getScopeRate() * 0.5f;
+    const float binWidth = nyquist / (float) (fftSize / 2);
+    const float logRange = std::log(nyquist / spectrumLowFreq);
+
+    g.setColour(juce::Colours::blue.darker(0.4f));
+    g.drawRect(area, 1.f);
+
+    juce::Path p;
+    bool started = false;
+
+    for (int i = 1; i < fftSize / 2; i++)
+    {
+        const float freq = binWidth * (float) i;
+
+        if (freq < spectrumLowFreq) continue;
+
+        const float x = area.getX() + area.getWidth() * (std::log(freq / spectrumLowFreq) / logRange);
+        const float y = juce::jmap(spectrum[i], spectrumFloor, 0.f, area.getBottom(), area.getY());
+
+        if (!started) p.startNewSubPath(x, y);
+        else          p.lineTo(x, y);
+
+        started = true;
+    }
+
+    g.setColour(juce::Colours::limegreen);
+    g.strokePath(p, juce::PathStrokeType(1.f));
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    ScopeView.h
+    Created: 19 Oct 2026 4:02:19pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+/*
+ * oscilloscope of the mix and the NORM/DOM/SUB1/SUB2 voices, next to a spectrum of the mix.
+ * the processor only feeds it while it's showing, everything else (history, FFT, drawing)
+ * happens here on the message thread at a capped frame rate
+ */
+class ScopeView : public juce::Component,
+                  private juce::Timer
+{
+public:
+    ScopeView(SubdominantAudioProcessor&);
+    ~ScopeView() override;
+
+    void paint(juce::Graphics&) override;
+    void visibilityChanged() override;
+
+private:
+    void timerCallback() override;
+    void updateSpectrum();
+
+    void paintScope(juce::Graphics& g, const juce::Rectangle<float>& area);
+    void paintSpectrum(juce::Graphics& g, const juce::Rectangle<float>& area);
+
+    static constexpr int frameRate = 30;
+
+    static constexpr int numTraces = 5;
+    static constexpr int fftOrder = 10;
+    static constexpr int fftSize = 1 << fftOrder;
+
+    /* frames kept for drawing, and how many of them the scope shows after the trigger point (~170ms) */
+    static constexpr int historySize = fftSize * 2;
+    static constexpr int scopeSpan = fftSize / 4;
+
+    SubdominantAudioProcessor& audioProcessor;
+
+    SubdominantAudioProcessor::ScopeFrame_t readBuffer[SubdominantAudioProcessor::scopeFifoSize];
+
+    float history[numTraces][historySize];
+    int historyPos = 0;
+
+    juce::dsp::FFT fft { fftOrder };
+    juce::dsp::WindowingFunction<float> window { (size_t) fftSize, juce::dsp::WindowingFunction<float>::hann };
+
+    float fftData[fftSize * 2];
+    float spectrum[fftSize / 2];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ScopeView)
+};
@@ -0,0 +1,350 @@
+/*
+  ==============================================================================
+
+    SessionCapture.cpp
+    Created: 19 Oct 2026 8:14:37pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "SessionCapture.h"
+
+SessionCapture::SessionCapture() : juce::Thread("SubDominant capture")
+{
+}
+
+SessionCapture::~SessionCapture()
+{
+    stop();
+}
+
+juce::File SessionCapture::getCaptureFolder()
+{
+    return juce::File::getSpecialLocation(juce::File::userDocumentsDirectory).getChildFile("SubDominant Captures");
+}
+
+bool SessionCapture::start(const juce::File& file, const double sampleRate, const int blockSize, const int numChannels,
+                           const juce::StringArray& parameterIds, const juce::MemoryBlock& state)
+{
+    stop();
+
+    file.getParentDirectory().createDirectory();
+    stream = std::make_unique<juce::FileOutputStream>(file);
+
+    if (!stream->openedOk())
+    {
+        stream.reset();
+        return false;
+    }
+
+    stream->setPosition(0);
+    stream->truncate();
+
+    stream->write(CaptureFormat::magic, sizeof(CaptureFormat::magic));
+    stream->write(&CaptureFormat::version, sizeof(CaptureFormat::version));
+    stream->write(&sampleRate, sizeof(sampleRate));
+    stream->write(&blockSize, sizeof(blockSize));
+    stream->write(&numChannels, sizeof(numChannels));
+
+    const int numParameters = parameterIds.size();
+    stream->write(&numParameters, sizeof(numParameters));
+
+    for (const juce::String& id : parameterIds)
+    {
+        const int length = (int) id.getNumBytesAsUTF8();
+
+        stream->write(&length, sizeof(length));
+        stream->write(id.toRawUTF8(), (size_t) length);
+    }
+
+    const int stateSize = (int) state.getSize();
+    stream->write(&stateSize, sizeof(stateSize));
+    stream->write(state.getData(), state.getSize());
+
+    /* a few seconds of input, the writer only has to keep up on average */
+    const int ringSize = juce::jmax(1 << 22, (int) (sampleRate * 4.0) * numChannels * (int) sizeof(float) + blockSize * numChannels * 8);
+
+    ring.allocate((size_t) ringSize, true);
+    fifo = std::make_unique<juce::AbstractFifo>(ringSize);
+
+    /* NaN never compares equal, so the first block carries every parameter */
+    lastValues.assign((size_t) numParameters, std::numeric_limits<float>::quiet_NaN());
+    changed.clear();
+    changed.reserve((size_t) numParameters);
+
+    blockIndex = firstDropped = 0;
+    numDropped = 0;
+    lastBlockWritten = false;
+
+    blocksCaptured.store(0);
+    pendingProgram.store(noCall);
+    pendingReset.store(noCall);
+
+    {
+        const juce::ScopedLock lock(stateLock);
+        pendingStates.clear();
+    }
+
+    recording.store(true);
+    startThread();
+
+    return true;
+}
+
+void SessionCapture::stop()
+{
+    recording.store(false);
+
+    if (stream == nullptr) return;
+
+    stopThread(4000);
+
+    /* the writer's gone, whatever's left in the ring gets written from here */
+    drain();
+    writePendingStates(std::numeric_limits<juce::uint64>::max());
+
+    stream->flush();
+    stream.reset();
+}
+
+void SessionCapture::captureState(const void* data, const int sizeInBytes)
+{
+    const juce::ScopedLock lock(stateLock);
+
+    /* the block first: a program numbered after this state can then only be written before the same block or a later one */
+    const juce::uint64 beforeBlock = blocksCaptured.load();
+    const uint32_t call = nextHostCall.fetch_add(1);
+
+    pendingStates.push_back({ beforeBlock, call, juce::MemoryBlock(data, (size_t) sizeInBytes) });
+}
+
+void SessionCapture::captureBlock(const juce::AudioBuffer<float>& buffer, const int numChannels, const juce::MidiBuffer& midi,
+                                  const double bpm, const double ppq, const bool playing,
+                                  const juce::Array<juce::AudioProcessorParameter*>& parameters)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int numParameters = juce::jmin(parameters.size(), (int) lastValues.size());
+
+    lastBlockWritten = false;
+
+    /* host calls that happened since the last block land in front of this one, lower call number first */
+    const juce::uint64 program = pendingProgram.exchange(noCall);
+    const juce::uint64 reset = pendingReset.exchange(noCall);
+
+    writeHostCall(program < reset ? CaptureFormat::program : CaptureFormat::reset, juce::jmin(program, reset));
+    writeHostCall(program < reset ? CaptureFormat::reset : CaptureFormat::program, juce::jmax(program, reset));
+
+    if (numDropped > 0)
+    {
+        if (!beginRecord(CaptureFormat::dropped, 12))
+        {
+            blocksCaptured.store(++blockIndex);
+            return;
+        }
+
+        write(firstDropped);
+        write(numDropped);
+        endRecord();
+
+        numDropped = 0;
+    }
+
+    changed.clear();
+
+    for (int i = 0; i < numParameters; i++)
+        if (parameters.getUnchecked(i)->getValue() != lastValues[(size_t) i])
+            changed.push_back(i);
+
+    int numEvents = 0, midiBytes = 0;
+
+    for (const juce::MidiMessageMetadata event : midi)
+    {
+        numEvents++;
+        midiBytes += 8 + ((event.numBytes + 3) & ~3);
+    }
+
+    const int payload = 8 + 4 + 4 + 8 + 8 + 4
+                      + 4 + (int) changed.size() * 8
+                      + 4 + midiBytes
+                      + numChannels * numSamples * (int) sizeof(float);
+
+    if (beginRecord(CaptureFormat::block, payload))
+    {
+        write(blockIndex);
+        write((juce::int32) numSamples);
+        write((juce::int32) numChannels);
+        write(bpm);
+        write(ppq);
+        write((juce::int32) (playing ? 1 : 0));
+
+        write((juce::int32) changed.size());
+
+        for (const int index : changed)
+        {
+            const float value = parameters.getUnchecked(index)->getValue();
+
+            write((juce::int32) index);
+            write(value);
+
+            lastValues[(size_t) index] = value;
+        }
+
+        write((juce::int32) numEvents);
+
+        for (const juce::MidiMessageMetadata event : midi)
+        {
+            const juce::uint8 padding[4] = {};
+
+            write((juce::int32) event.samplePosition);
+            write((juce::int32) event.numBytes);
+            write(event.data, event.numBytes);
+            write(padding, ((event.numBytes + 3) & ~3) - event.numBytes);
+        }
+
+        for (int ch = 0; ch < numChannels; ch++)
+            write(buffer.getReadPointer(ch), numSamples * (int) sizeof(float));
+
+        endRecord();
+        lastBlockWritten = true;
+    }
+
+    blocksCaptured.store(++blockIndex);
+}
+
+void SessionCapture::writeHostCall(const uint32_t type, const juce::uint64 call)
+{
+    if (call == noCall) return;
+
+    const bool isProgram = type == CaptureFormat::program;
+
+    if (!beginRecord(type, isProgram ? 16 : 12)) return;
+
+    write(blockIndex);
+    if (isProgram) write((juce::int32) (uint32_t) call);
+    write((uint32_t) (call >> 32));
+    endRecord();
+}
+
+void SessionCapture::captureTiming(const double ms)
+{
+    /* a missing timing doesn't break the replay, so it's left out quietly rather than counted as a drop */
+    if (!lastBlockWritten || fifo->getFreeSpace() < 8 + 16) return;
+
+    beginRecord(CaptureFormat::timing, 16);
+    write(blockIndex - 1);
+    write(ms);
+    endRecord();
+}
+
+bool SessionCapture::beginRecord(const uint32_t type, const int payloadSize)
+{
+    recordSize = 8 + payloadSize;
+
+    if (fifo->getFreeSpace() < recordSize)
+    {
+        if (numDropped++ == 0) firstDropped = blockIndex;
+        return false;
+    }
+
+    fifo->prepareToWrite(recordSize, start1, size1, start2, size2);
+    recordPos = 0;
+
+    write(type);
+    write((uint32_t) payloadSize);
+
+    return true;
+}
+
+void SessionCapture::write(const void* data, const int size)
+{
+    const char* src = static_cast<const char*>(data);
+    const int first = juce::jlimit(0, size, size1 - recordPos);
+
+    if (first > 0) std::memcpy(ring.get() + start1 + recordPos, src, (size_t) first);
+    if (size > first) std::memcpy(ring.get() + start2 + (recordPos + first - size1), src + first, (size_t) (size - first));
+
+    recordPos += size;
+}
+
+void SessionCapture::endRecord()
+{
+    /* only now does the writer get to see any of it */
+    fifo->finishedWrite(recordSize);
+}
+
+void SessionCapture::run()
+{
+    while (!threadShouldExit())
+    {
+        drain();
+        wait(20);
+    }
+}
+
+void SessionCapture::drain()
+{
+    while (fifo->getNumReady() >= 8)
+    {
+        uint32_t header[2];
+        int s1, n1, s2, n2;
+
+        /* records are only ever published whole, once the header is there the rest is too */
+        fifo->prepareToRead(8, s1, n1, s2, n2);
+        std::memcpy(header, ring.get() + s1, (size_t) n1);
+        if (n2 > 0) std::memcpy(reinterpret_cast<char*>(header) + n1, ring.get() + s2, (size_t) n2);
+
+        const int total = 8 + (int) header[1];
+        scratch.resize((size_t) total);
+
+        {
+            const juce::AbstractFifo::ScopedRead read = fifo->read(total);
+
+            std::memcpy(scratch.data(), ring.get() + read.startIndex1, (size_t) read.blockSize1);
+            if (read.blockSize2 > 0) std::memcpy(scratch.data() + read.blockSize1, ring.get() + read.startIndex2, (size_t) read.blockSize2);
+        }
+
+        /* states go in front of the block they arrived before, or the first program or reset made after them */
+        juce::uint64 index;
+        std::memcpy(&index, scratch.data() + 8, sizeof(index));
+
+        if (header[0] == CaptureFormat::block)
+        {
+            writePendingStates(index);
+        }
+        else if (header[0] == CaptureFormat::program || header[0] == CaptureFormat::reset)
+        {
+            uint32_t call;
+            std::memcpy(&call, scratch.data() + total - sizeof(call), sizeof(call));
+
+            writePendingStates(index, call);
+        }
+
+        stream->write(scratch.data(), (size_t) total);
+    }
+}
+
+void SessionCapture::writePendingStates(const juce::uint64 beforeBlock, const uint32_t beforeCall)
+{
+    const juce::ScopedLock lock(stateLock);
+
+    /* in call order, so the first one that has to wait holds back every one after it too */
+    size_t numWritten = 0;
+
+    for (const PendingState_t& pending : pendingStates)
+    {
+        if (pending.beforeBlock > beforeBlock || pending.call >= beforeCall) break;
+
+        const uint32_t type = CaptureFormat::state;
+        const uint32_t size = (uint32_t) (sizeof(juce::uint64) + pending.data.getSize());
+
+        stream->write(&type, sizeof(type));
+        stream->write(&size, sizeof(size));
+        stream->write(&pending.beforeBlock, sizeof(pending.beforeBlock));
+        stream->write(pending.data.getData(), pending.data.getSize());
+
+        numWritten++;
+    }
+
+    pendingStates.erase(pendingStates.begin(), pendingStates.begin() + (std::ptrdiff_t) numWritten);
+}
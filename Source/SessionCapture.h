@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    SessionCapture.h
+    Created: 19 Oct 2026 8:14:37pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/*
+ * capture file layout, everything native endian:
+ *
+ *   header:  magic, version, double sample rate, int32 block size, int32 input channels,
+ *            int32 parameter count + each ID (int32 length, utf8), int32 state size + the state
+ *   records: uint32 type, uint32 payload size, payload
+ *
+ * block indices count processBlock() calls from the prepareToPlay() the capture started at. state,
+ * program and reset records are in the order the host made the calls, however many of them came
+ * in between two blocks and from whichever threads
+ */
+namespace CaptureFormat
+{
+    constexpr char magic[4] = { 'S', 'D', 'C', 'P' };
+    constexpr uint32_t version = 2;
+
+    enum Record : uint32_t
+    {
+        /* uint64 index, int32 samples, int32 channels, double bpm, double ppq, int32 playing,
+           int32 changed parameters + (int32 index, float normalised value) each,
+           int32 midi events + (int32 position, int32 size, bytes padded to 4) each,
+           then the input audio, one channel after the other */
+        block = 'B',
+
+        /* uint64 index, double ms the session's processBlock() took */
+        timing = 'T',
+
+        /* uint64 index of the block it arrived before, then the state as the host passed it */
+        state = 'S',
+
+        /* uint64 index, int32 program the host switched to, uint32 host call number */
+        program = 'G',
+
+        /* uint64 index, uint32 host call number */
+        reset = 'R',
+
+        /* uint64 index of the first lost block, uint32 number lost, the replay stops being exact there */
+        dropped = 'D'
+    };
+}
+
+/*
+ * opt-in recording of everything that reaches processBlock(), so a session that went wrong in the
+ * field can be fed back into a fresh processor by Tools/Replay. the audio thread only copies into a
+ * ring allocated up front, a background thread drains it to disk. if the disk falls behind, whole
+ * blocks are dropped and the gap is written down, the audio thread never waits on it.
+ *
+ * a capture runs from one prepareToPlay() to the next (or to releaseResources()), which is what
+ * lets the replay come out bit for bit: it starts from a freshly prepared processor as well
+ */
+class SessionCapture : private juce::Thread
+{
+public:
+    SessionCapture();
+    ~SessionCapture() override;
+
+    /* audio stopped, opens the file and writes the header */
+    bool start(const juce::File& file, const double sampleRate, const int blockSize, const int numChannels,
+               const juce::StringArray& parameterIds, const juce::MemoryBlock& state);
+    void stop();
+
+    bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+
+    static juce::File getCaptureFolder();
+
+    /* audio thread */
+    void captureBlock(const juce::AudioBuffer<float>& buffer, const int numChannels, const juce::MidiBuffer& midi,
+                      const double bpm, const double ppq, const bool playing,
+                      const juce::Array<juce::AudioProcessorParameter*>& parameters);
+    void captureTiming(const double ms);
+
+    /*
+     * host calls that can come in on any thread, the audio thread writes them out ahead of the next block.
+     * only the last program switch and the last reset before a block are kept, an earlier one of the
+     * same kind would only be undone by it
+     */
+    void captureProgram(const int index) { pendingProgram.store(pack(nextHostCall.fetch_add(1), (uint32_t) index)); }
+    void captureReset() { pendingReset.store(pack(nextHostCall.fetch_add(1), 0)); }
+
+    /* message thread */
+    void captureState(const void* data, const int sizeInBytes);
+
+private:
+    void run() override;
+    void drain();
+    void writeHostCall(const uint32_t type, const juce::uint64 call);
+    void writePendingStates(const juce::uint64 beforeBlock, const uint32_t beforeCall = std::numeric_limits<uint32_t>::max());
+
+    /* host call number on top, the program under it, so a pending call is swapped out in one go. no call sorts last */
+    static constexpr juce::uint64 noCall = std::numeric_limits<juce::uint64>::max();
+    static juce::uint64 pack(const uint32_t call, const uint32_t value) { return ((juce::uint64) call << 32) | value; }
+
+    bool beginRecord(const uint32_t type, const int payloadSize);
+    void write(const void* data, const int size);
+    void endRecord();
+
+    template <typename T>
+    void write(const T value) { write(&value, (int) sizeof(T)); }
+
+    std::unique_ptr<juce::FileOutputStream> stream;
+
+    /* written by the audio thread, drained by the writer */
+    std::unique_ptr<juce::AbstractFifo> fifo;
+    juce::HeapBlock<char> ring;
+
+    int start1 = 0, size1 = 0, start2 = 0, size2 = 0, recordSize = 0, recordPos = 0;
+
+    /* audio thread only: the values as of the last block, and which of them moved */
+    std::vector<float> lastValues;
+    std::vector<int> changed;
+
+    juce::uint64 blockIndex = 0, firstDropped = 0;
+    uint32_t numDropped = 0;
+    bool lastBlockWritten = false;
+
+    alignas(64) std::atomic<bool> recording { false };
+    alignas(64) std::atomic<juce::uint64> blocksCaptured { 0 };
+    alignas(64) std::atomic<juce::uint64> pendingProgram { noCall }, pendingReset { noCall };
+
+    /* one count across states, programs and resets, which is what puts them in order in the file */
+    alignas(64) std::atomic<uint32_t> nextHostCall { 0 };
+
+    /*
+     * state restores from the message thread, waiting for the writer to put them in front of the right
+     * block, program or reset. numbered under the lock, so the list is always in call order and the
+     * writer never finds a program that came after a state it hasn't been handed yet
+     */
+    typedef struct PendingState_t
+    {
+    public:
+
+        juce::uint64 beforeBlock;
+        uint32_t call;
+        juce::MemoryBlock data;
+
+    } PendingState_t;
+
+    juce::CriticalSection stateLock;
+    std::vector<PendingState_t> pendingStates;
+
+    /* writer thread only */
+    std::vector<char> scratch;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SessionCapture)
+};
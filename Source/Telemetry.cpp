@@ -0,0 +1,168 @@
+/*
+  ==============================================================================
+
+    Telemetry.cpp
+    Created: 19 Oct 2026 9:37:51pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Telemetry.h"
+
+#if JUCE_WINDOWS
+ #include <process.h>
+#else
+ #include <unistd.h>
+#endif
+
+static juce::int64 getProcessId()
+{
+   #if JUCE_WINDOWS
+    return (juce::int64) _getpid();
+   #else
+    return (juce::int64) getpid();
+   #endif
+}
+
+TelemetrySegment::TelemetrySegment() : lock(TelemetryFormat::getLockName(getProcessId()))
+{
+    const juce::int64 processId = getProcessId();
+
+    locked = lock.enter(0);
+
+    if (!locked) return;
+
+    const juce::File folder = TelemetryFormat::getSegmentFolder();
+    folder.createDirectory();
+
+    file = folder.getChildFile(juce::String(processId) + ".sdtm");
+
+    /* a file under our id is left over from a process that had it before us */
+    if (!file.replaceWithData(juce::MemoryBlock(TelemetryFormat::segmentSize, true).getData(), TelemetryFormat::segmentSize))
+        return;
+
+    mapping = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readWrite, false);
+
+    if (mapping->getData() == nullptr || mapping->getSize() < TelemetryFormat::segmentSize)
+    {
+        mapping.reset();
+        file.deleteFile();
+        return;
+    }
+
+    header = static_cast<TelemetryFormat::Header_t*>(mapping->getData());
+
+    header->version = TelemetryFormat::version;
+    header->numSlots = (uint32_t) TelemetryFormat::maxSlots;
+    header->slotSize = (uint32_t) sizeof(TelemetryFormat::Slot_t);
+    header->processId = processId;
+    header->ticksPerSecond = juce::Time::getHighResolutionTicksPerSecond();
+
+    juce::File::getSpecialLocation(juce::File::hostApplicationPath).getFileName().copyToUTF8(header->host, sizeof(header->host));
+
+    /* the magic goes in last, a monitor that finds it can trust the rest of the header */
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, TelemetryFormat::magic, sizeof(header->magic));
+}
+
+TelemetrySegment::~TelemetrySegment()
+{
+    if (mapping != nullptr)
+    {
+        header = nullptr;
+        mapping.reset();
+        file.deleteFile();
+    }
+
+    if (locked) lock.exit();
+}
+
+std::shared_ptr<TelemetrySegment> TelemetrySegment::get()
+{
+    /* only a weak reference here, the segment goes away with the last instance using it */
+    static juce::CriticalSection segmentLock;
+    static std::weak_ptr<TelemetrySegment> current;
+
+    const juce::ScopedLock scopedLock(segmentLock);
+
+    std::shared_ptr<TelemetrySegment> segment = current.lock();
+
+    if (segment == nullptr)
+    {
+        segment = std::make_shared<TelemetrySegment>();
+        current = segment;
+    }
+
+    return segment;
+}
+
+TelemetryFormat::Slot_t* TelemetrySegment::claimSlot()
+{
+    if (header == nullptr) return nullptr;
+
+    TelemetryFormat::Slot_t* const slots = TelemetryFormat::getSlots(header);
+
+    for (int i = 0; i < TelemetryFormat::maxSlots; i++)
+    {
+        TelemetryFormat::Slot_t* const slot = slots + i;
+        uint32_t expected = TelemetryFormat::unused;
+
+        if (!slot->status.compare_exchange_strong(expected, TelemetryFormat::created)) continue;
+
+        /* whatever the previous owner left behind is cleared before anyone can mistake it for ours */
+        slot->nameVersion.store(slot->nameVersion.load() + 1);
+        std::memset(slot->name, 0, sizeof(slot->name));
+        slot->nameVersion.store(slot->nameVersion.load() + 1);
+
+        for (std::atomic<juce::uint64>* counter : { &slot->blocks, &slot->samples, &slot->cpuNanos, &slot->maxNanos,
+                                                    &slot->overruns, &slot->idleBlocks, &slot->idleNanos })
+            counter->store(0);
+
+        slot->sampleRate.store(0.0);
+        slot->engineRate.store(0.0);
+        slot->blockSize.store(0);
+        slot->quality.store(0);
+        slot->idle.store(0);
+        slot->lastBlockTicks.store(0);
+
+        slot->generation.fetch_add(1);
+
+        uint32_t used = header->slotsUsed.load();
+        while (used < (uint32_t) i + 1 && !header->slotsUsed.compare_exchange_weak(used, (uint32_t) i + 1)) {}
+
+        return slot;
+    }
+
+    return nullptr;
+}
+
+void TelemetrySegment::releaseSlot(TelemetryFormat::Slot_t* slot)
+{
+    slot->status.store(TelemetryFormat::unused);
+}
+
+void TelemetrySlot::claim()
+{
+    if (segment != nullptr) return;
+
+    segment = TelemetrySegment::get();
+    slot = segment->claimSlot();
+
+    if (name.isNotEmpty()) setName(name);
+}
+
+void TelemetrySlot::setName(const juce::String& newName)
+{
+    name = newName;
+
+    if (slot == nullptr) return;
+
+    slot->nameVersion.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memset(slot->name, 0, sizeof(slot->name));
+    name.copyToUTF8(slot->name, sizeof(slot->name) - 1);
+
+    slot->nameVersion.fetch_add(1, std::memory_order_release);
+}
@@ -0,0 +1,217 @@
+/*
+  ==============================================================================
+
+    Telemetry.h
+    Created: 19 Oct 2026 9:37:51pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/*
+ * one segment per host process, a memory mapped file every prepared instance in the process gets a slot in
+ * and Tools/Monitor maps from outside. the slots are plain lock-free atomics, each written by its
+ * own instance only, so nothing on either side ever waits. counters only ever go up, the monitor
+ * works out rates from the difference between two reads
+ *
+ * the segment lives in /dev/shm on linux, so it never touches the disk there. everywhere else it's
+ * a small file in the user's application data folder, the OS writes it back lazily at most
+ */
+namespace TelemetryFormat
+{
+    constexpr char magic[4] = { 'S', 'D', 'T', 'M' };
+    constexpr uint32_t version = 1;
+    constexpr int maxSlots = 1024;
+
+    enum Status : uint32_t
+    {
+        unused = 0,
+
+        /* claimed, the format isn't in yet */
+        created,
+
+        /* between prepareToPlay() and releaseResources(), the monitor calls it asleep once blocks stop arriving */
+        running,
+
+        released
+    };
+
+    /* quality word: decimation stages, number of bands and what's switched on */
+    constexpr uint32_t stagesMask = 0x0f;
+    constexpr int bandsShift = 4;
+    constexpr uint32_t bandsMask = 0x30;
+    constexpr uint32_t portableFlag = 0x100;
+    constexpr uint32_t cabFlag = 0x200;
+    constexpr uint32_t lookaheadFlag = 0x400;
+
+    /* peak level below which a block counts as silent, in and out (-120dB) */
+    constexpr float silence = 1.0e-6f;
+
+    static_assert(std::atomic<juce::uint64>::is_always_lock_free && std::atomic<double>::is_always_lock_free,
+                  "the slots are shared between processes, the atomics in them can't hide a lock");
+
+    typedef struct alignas(64) Slot_t
+    {
+    public:
+
+        /* claimed with a compare and swap, generation bumps on every claim so a reused slot isn't read as the old one */
+        std::atomic<uint32_t> status, generation;
+
+        /* odd while the name is being rewritten */
+        std::atomic<uint32_t> nameVersion;
+        char name[52];
+
+        std::atomic<double> sampleRate, engineRate;
+        std::atomic<int32_t> blockSize;
+        std::atomic<uint32_t> quality, idle;
+
+        /* totals since the slot was claimed, nanoseconds of processBlock() time */
+        std::atomic<juce::uint64> blocks, samples, cpuNanos, maxNanos, overruns, idleBlocks, idleNanos;
+
+        /* high resolution ticks at the end of the last block, 0 before the first */
+        std::atomic<juce::int64> lastBlockTicks;
+
+    } Slot_t;
+
+    typedef struct alignas(64) Header_t
+    {
+    public:
+
+        char magic[4];
+        uint32_t version, numSlots, slotSize;
+        juce::int64 processId, ticksPerSecond;
+        char host[64];
+
+        /* one past the highest slot ever claimed, the monitor doesn't need to look further */
+        std::atomic<uint32_t> slotsUsed;
+
+    } Header_t;
+
+    constexpr size_t segmentSize = sizeof(Header_t) + sizeof(Slot_t) * maxSlots;
+
+    inline Slot_t* getSlots(void* segment) { return reinterpret_cast<Slot_t*>(static_cast<char*>(segment) + sizeof(Header_t)); }
+
+    inline juce::File getSegmentFolder()
+    {
+       #if JUCE_LINUX
+        if (juce::File("/dev/shm").isDirectory()) return juce::File("/dev/shm/SubDominant Telemetry");
+       #endif
+
+        return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory).getChildFile("SubDominant")
+                                                                                       .getChildFile("Telemetry");
+    }
+
+    /* held by the process for as long as its segment exists, so a file left behind by a crash can be told apart */
+    inline juce::String getLockName(const juce::int64 processId) { return "SubDominantTelemetry_" + juce::String(processId); }
+}
+
+/* the process' mapping, shared by every instance in it and gone with the last one */
+class TelemetrySegment
+{
+public:
+    TelemetrySegment();
+    ~TelemetrySegment();
+
+    static std::shared_ptr<TelemetrySegment> get();
+
+    /* nullptr if the segment couldn't be mapped or every slot is taken, telemetry is just off then */
+    TelemetryFormat::Slot_t* claimSlot();
+    void releaseSlot(TelemetryFormat::Slot_t* slot);
+
+private:
+    juce::File file;
+    juce::InterProcessLock lock;
+    bool locked = false;
+    std::unique_ptr<juce::MemoryMappedFile> mapping;
+    TelemetryFormat::Header_t* header = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE (TelemetrySegment)
+};
+
+/*
+ * one instance's slot. everything but setName() is for the audio thread and only does relaxed stores,
+ * the monitor doesn't need the fields to line up with each other, only to be reasonably fresh
+ */
+class TelemetrySlot
+{
+public:
+    TelemetrySlot() {};
+
+    ~TelemetrySlot()
+    {
+        if (slot != nullptr) segment->releaseSlot(slot);
+    }
+
+    /*
+     * from the first prepareToPlay() on, later calls do nothing. the first claim in a process maps the
+     * segment, so an instance a host only constructs for a scan never touches a file or a lock
+     */
+    void claim();
+
+    void setFormat(const double sampleRate, const double engineRate, const int blockSize)
+    {
+        if (slot == nullptr) return;
+
+        slot->sampleRate.store(sampleRate, std::memory_order_relaxed);
+        slot->engineRate.store(engineRate, std::memory_order_relaxed);
+        slot->blockSize.store(blockSize, std::memory_order_relaxed);
+        slot->status.store(TelemetryFormat::running, std::memory_order_release);
+
+        /* a block lasts numSamples * this many nanoseconds, past that the host is late */
+        nanosPerSample = 1.0e9 / sampleRate;
+    }
+
+    void setReleased()
+    {
+        if (slot != nullptr) slot->status.store(TelemetryFormat::released, std::memory_order_release);
+    }
+
+    void setName(const juce::String& newName);
+
+    void endBlock(const juce::int64 startTicks, const int numSamples, const bool idle, const uint32_t quality)
+    {
+        if (slot == nullptr) return;
+
+        const juce::int64 endTicks = juce::Time::getHighResolutionTicks();
+        const juce::uint64 nanos = (juce::uint64) ((double) (endTicks - startTicks) * nanosPerTick);
+
+        add(slot->blocks, 1);
+        add(slot->samples, (juce::uint64) numSamples);
+        add(slot->cpuNanos, nanos);
+
+        if (nanos > slot->maxNanos.load(std::memory_order_relaxed)) slot->maxNanos.store(nanos, std::memory_order_relaxed);
+        if ((double) nanos > numSamples * nanosPerSample) add(slot->overruns, 1);
+
+        if (idle)
+        {
+            add(slot->idleBlocks, 1);
+            add(slot->idleNanos, nanos);
+        }
+
+        slot->idle.store(idle ? 1 : 0, std::memory_order_relaxed);
+        slot->quality.store(quality, std::memory_order_relaxed);
+        slot->lastBlockTicks.store(endTicks, std::memory_order_relaxed);
+    }
+
+private:
+    /* one writer per slot, a load and a store is all a counter needs */
+    static void add(std::atomic<juce::uint64>& counter, const juce::uint64 amount)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::shared_ptr<TelemetrySegment> segment;
+    TelemetryFormat::Slot_t* slot = nullptr;
+
+    /* a track name can arrive before the slot is claimed, it's written in then */
+    juce::String name;
+
+    double nanosPerTick = 1.0e9 / (double) juce::Time::getHighResolutionTicksPerSecond();
+    double nanosPerSample = 1.0e9 / 44100.0;
+
+    JUCE_DECLARE_NON_COPYABLE (TelemetrySlot)
+};
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    Bench.h
+    Created: 20 Oct 2026 3:12:37pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/*
+ * the numbers behind the performance claims in Source/, one bench per file. every bench registers
+ * itself with SD_BENCH, prints a table and fills in its part of the JSON report Main.cpp writes
+ */
+namespace Bench
+{
+    typedef struct Settings_t
+    {
+    public:
+
+        double sampleRate = 48000.0;
+        double seconds = 10.0;
+
+    } Settings_t;
+
+    int add(const char* name, juce::var (*run)(const Settings_t&));
+
+    /* the process's resident set as the OS counts it, 0 where it can't be read */
+    size_t residentBytes();
+
+    /* a set of timings in microseconds, summed up the way a real-time budget cares about */
+    typedef struct Timings_t
+    {
+    public:
+
+        std::vector<double> micros;
+
+        void reserve(const size_t n) { micros.reserve(n); }
+        void add(const juce::int64 startTicks, const juce::int64 endTicks)
+        {
+            micros.push_back(juce::Time::highResolutionTicksToSeconds(endTicks - startTicks) * 1e6);
+        }
+
+        double mean() const
+        {
+            double sum = 0.0;
+
+            for (const double t : micros)
+                sum += t;
+
+            return micros.empty() ? 0.0 : sum / (double) micros.size();
+        }
+
+        double percentile(const double p) const
+        {
+            if (micros.empty()) return 0.0;
+
+            std::vector<double> sorted = micros;
+            std::sort(sorted.begin(), sorted.end());
+
+            return sorted[(size_t) juce::jlimit(0, (int) sorted.size() - 1, (int) (p * 0.01 * (double) sorted.size()))];
+        }
+
+        double worst() const { return micros.empty() ? 0.0 : *std::max_element(micros.begin(), micros.end()); }
+
+        /* mean, 99.9th percentile and worst, plus all three as a share of the time the audio lasts */
+        juce::var toVar(const double budgetMicros) const
+        {
+            juce::DynamicObject::Ptr o = new juce::DynamicObject();
+
+            o->setProperty("count", (int) micros.size());
+            o->setProperty("meanMicros", mean());
+            o->setProperty("p999Micros", percentile(99.9));
+            o->setProperty("worstMicros", worst());
+            o->setProperty("budgetMicros", budgetMicros);
+            o->setProperty("meanBudget", mean() / budgetMicros);
+            o->setProperty("p999Budget", percentile(99.9) / budgetMicros);
+
+            return juce::var(o.get());
+        }
+
+    } Timings_t;
+
+    /*
+     * one table row: label, mean / 99.9% / worst in us, then the mean and the 99.9% as a share of the
+     * budget. the tail is whatever the OS does to the thread too, on a loaded machine trust the mean
+     */
+    inline void printRow(const juce::String& label, const Timings_t& t, const double budgetMicros)
+    {
+        std::cout << "  " << label.paddedRight(' ', 36) << juce::String(t.mean(), 2).paddedLeft(' ', 10)
+                  << juce::String(t.percentile(99.9), 2).paddedLeft(' ', 10) << juce::String(t.worst(), 2).paddedLeft(' ', 10)
+                  << (juce::String(100.0 * t.mean() / budgetMicros, 2) + "%").paddedLeft(' ', 10)
+                  << (juce::String(100.0 * t.percentile(99.9) / budgetMicros, 2) + "%").paddedLeft(' ', 10) << std::endl;
+    }
+
+    inline void printHeader(const juce::String& title)
+    {
+        std::cout << std::endl << title << std::endl
+                  << "  " << juce::String().paddedRight(' ', 36) << juce::String("mean us").paddedLeft(' ', 10)
+                  << juce::String("99.9% us").paddedLeft(' ', 10) << juce::String("worst us").paddedLeft(' ', 10)
+                  << juce::String("mean").paddedLeft(' ', 10) << juce::String("99.9%").paddedLeft(' ', 10) << std::endl;
+    }
+
+    /* the same every run, the benches must not depend on juce::Random's seed */
+    inline void fillNoise(float* dest, const int numSamples, const juce::int64 seed)
+    {
+        juce::Random random(seed);
+
+        for (int i = 0; i < numSamples; i++)
+            dest[i] = random.nextFloat() * 2.f - 1.f;
+    }
+}
+
+#define SD_BENCH(name) \
+    static juce::var name(const Bench::Settings_t&); \
+    static const int name##Registered = Bench::add(#name, name); \
+    static juce::var name(const Bench::Settings_t& settings)
@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    CabBench.cpp
+    Created: 20 Oct 2026 3:40:02pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+#include "../../../Source/CabConvolver.h"
+
+/*
+ * the cab's per-block budget: CabConvolver::process() timed call by call at the processor's sub-block
+ * size and at a few host block sizes, for IRs of 100ms to the 1s cap, with juce::dsp::FFT and with
+ * PortableFFT (deterministic mode). the spectrum multiplies are spread over the samples between
+ * partition boundaries, so a call that runs the FFTs should only cost those on top of the others
+ */
+namespace
+{
+    /* decaying noise, a stand-in for a real cab that costs exactly what a real one of that length does */
+    std::shared_ptr<CabImpulse_t> makeImpulse(const double sampleRate, const double seconds, const bool portable)
+    {
+        const int length = juce::jmax(1, (int) (sampleRate * seconds));
+        juce::AudioBuffer<float> ir(2, length);
+
+        for (int ch = 0; ch < 2; ch++)
+        {
+            float* h = ir.getWritePointer(ch);
+            Bench::fillNoise(h, length, 17 + ch);
+
+            for (int i = 0; i < length; i++)
+                h[i] *= (float) std::exp(-6.0 * i / length);
+        }
+
+        return CabConvolver::prepareImpulse(ir, sampleRate, portable, 0);
+    }
+
+    /* every call, and apart from that the ones that reach a partition boundary and run the FFTs */
+    Bench::Timings_t timeCalls(CabConvolver& cab, const int blockSize, const double sampleRate, const double seconds,
+                               Bench::Timings_t* boundaries = nullptr)
+    {
+        const int numBlocks = juce::jmax(1, (int) (sampleRate * seconds) / blockSize);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        Bench::Timings_t timings;
+
+        timings.reserve((size_t) numBlocks);
+
+        for (int b = 0; b < numBlocks; b++)
+        {
+            Bench::fillNoise(buffer.getWritePointer(0), blockSize, b);
+            Bench::fillNoise(buffer.getWritePointer(1), blockSize, b + 1);
+
+            const juce::int64 start = juce::Time::getHighResolutionTicks();
+            cab.process(buffer.getWritePointer(0), buffer.getWritePointer(1), blockSize);
+            const juce::int64 end = juce::Time::getHighResolutionTicks();
+
+            timings.add(start, end);
+
+            const juce::int64 pos = (juce::int64) b * blockSize;
+
+            if (boundaries != nullptr && (pos + blockSize) / CabConvolver::partitionSize > pos / CabConvolver::partitionSize)
+                boundaries->add(start, end);
+        }
+
+        return timings;
+    }
+}
+
+SD_BENCH(cab)
+{
+    const double rate = settings.sampleRate;
+    const double irSeconds[] = { 0.1, 0.5, 1.0 };
+    const int blockSizes[] = { 32, 128, 512 };
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    for (const bool portable : { false, true })
+    {
+        juce::DynamicObject::Ptr mode = new juce::DynamicObject();
+
+        Bench::printHeader(juce::String("cab, ") + (portable ? "PortableFFT" : "juce::dsp::FFT") + ", both channels, per process() call");
+
+        for (const double seconds : irSeconds)
+        {
+            const juce::int64 loadStart = juce::Time::getHighResolutionTicks();
+            std::shared_ptr<CabImpulse_t> impulse = makeImpulse(rate, seconds, portable);
+            const double loadMs = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - loadStart) * 1000.0;
+
+            juce::DynamicObject::Ptr ir = new juce::DynamicObject();
+            ir->setProperty("partitions", impulse->numPartitions);
+            ir->setProperty("prepareMs", loadMs);
+
+            for (const int blockSize : blockSizes)
+            {
+                CabConvolver cab(impulse);
+
+                /* one pass to get everything into the caches, the timed one after it from the first partition on */
+                timeCalls(cab, blockSize, rate, 0.5);
+                cab.reset();
+
+                Bench::Timings_t boundaries;
+                const Bench::Timings_t timings = timeCalls(cab, blockSize, rate, settings.seconds, &boundaries);
+                const double budget = blockSize / rate * 1e6;
+                const juce::String label = juce::String(seconds * 1000.0, 0) + "ms IR, " + juce::String(blockSize) + " samples";
+
+                Bench::printRow(label, timings, budget);
+                ir->setProperty("block" + juce::String(blockSize), timings.toVar(budget));
+
+                /* below the partition size only some calls run the FFTs, those are the ones the budget has to cover */
+                if (blockSize < CabConvolver::partitionSize)
+                {
+                    Bench::printRow(label + ", FFT calls", boundaries, budget);
+                    ir->setProperty("block" + juce::String(blockSize) + "Boundaries", boundaries.toVar(budget));
+                }
+            }
+
+            mode->setProperty("ir" + juce::String(juce::roundToInt(seconds * 1000.0)) + "ms", juce::var(ir.get()));
+        }
+
+        result->setProperty(portable ? "portableFFT" : "juceFFT", juce::var(mode.get()));
+    }
+
+    return juce::var(result.get());
+}
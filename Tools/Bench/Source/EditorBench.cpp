@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    EditorBench.cpp
+    Created: 21 Oct 2026 12:21:40am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * what opening an editor costs in time and resident memory, the way a session with many instances
+ * opens them: the first one builds the shared look and feel (font parse, background), every one
+ * after it should only pay for its own components. for scale, what each editor paid on its own
+ * before the look and feel was shared: one parse of the embedded font
+ */
+namespace
+{
+    constexpr int numEditors = 50;
+
+    double millisSince(const juce::int64 startTicks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks) * 1000.0;
+    }
+
+    /* resident growth since before, in MB. memory handed back can make it shrink, that counts as none */
+    double grownMb(const size_t before)
+    {
+        const size_t now = Bench::residentBytes();
+        return now > before ? (double) (now - before) / (1024.0 * 1024.0) : 0.0;
+    }
+}
+
+SD_BENCH(editors)
+{
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    /* what NewLookAndFeel's constructor does, once per editor before it was shared */
+    {
+        constexpr int numParses = 20;
+        std::vector<juce::Typeface::Ptr> typefaces;
+
+        const size_t before = Bench::residentBytes();
+        const juce::int64 start = juce::Time::getHighResolutionTicks();
+
+        for (int i = 0; i < numParses; i++)
+            typefaces.push_back(juce::Typeface::createSystemTypefaceFor(BinaryData::typoround_bold_otf, BinaryData::typoround_bold_otfSize));
+
+        const double parseMs = millisSince(start) / numParses;
+        const double parseMb = grownMb(before) / numParses;
+
+        std::cout << std::endl << "font parse, per editor before sharing: " << juce::String(parseMs, 3) << " ms, "
+                  << juce::String(parseMb, 3) << " MB resident" << std::endl;
+
+        result->setProperty("fontParseMs", parseMs);
+        result->setProperty("fontParseMb", parseMb);
+    }
+
+    /* the processors first, so their share of the memory isn't counted against the editors */
+    std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+
+    for (int i = 0; i < numEditors; i++)
+    {
+        processors.emplace_back(createPluginFilter());
+        processors.back()->setPlayConfigDetails(2, 2, settings.sampleRate, 256);
+        processors.back()->prepareToPlay(settings.sampleRate, 256);
+    }
+
+    std::vector<std::unique_ptr<juce::AudioProcessorEditor>> editors;
+    juce::Array<juce::var> opens;
+    double firstMs = 0.0, firstMb = 0.0, restMs = 0.0;
+    size_t afterFirst = 0;
+
+    const size_t baseline = Bench::residentBytes();
+
+    for (int i = 0; i < numEditors; i++)
+    {
+        const size_t before = Bench::residentBytes();
+        const juce::int64 start = juce::Time::getHighResolutionTicks();
+
+        /* opened and painted once, as a host does before it shows anything */
+        editors.emplace_back(processors[(size_t) i]->createEditorIfNeeded());
+
+        juce::Image canvas(juce::Image::ARGB, editors.back()->getWidth(), editors.back()->getHeight(), true);
+        juce::Graphics g(canvas);
+        editors.back()->paintEntireComponent(g, true);
+
+        const double ms = millisSince(start);
+
+        if (i == 0)
+        {
+            firstMs = ms;
+            firstMb = grownMb(before);
+            afterFirst = Bench::residentBytes();
+        }
+        else
+        {
+            restMs += ms / (numEditors - 1);
+        }
+
+        opens.add(ms);
+    }
+
+    const double restMb = grownMb(afterFirst) / (numEditors - 1);
+    const double allMb = grownMb(baseline);
+
+    editors.clear();
+
+    const double closedMb = grownMb(baseline);
+
+    std::cout << "editor open and first paint, " << numEditors << " editors" << std::endl
+              << "  first      " << juce::String(firstMs, 3).paddedLeft(' ', 9) << " ms " << juce::String(firstMb, 3).paddedLeft(' ', 9) << " MB" << std::endl
+              << "  each after " << juce::String(restMs, 3).paddedLeft(' ', 9) << " ms " << juce::String(restMb, 3).paddedLeft(' ', 9) << " MB" << std::endl
+              << "  all open " << juce::String(allMb, 2) << " MB over the processors, " << juce::String(closedMb, 2)
+              << " MB left after closing them" << std::endl;
+
+    result->setProperty("editors", numEditors);
+    result->setProperty("firstOpenMs", firstMs);
+    result->setProperty("firstOpenMb", firstMb);
+    result->setProperty("laterOpenMs", restMs);
+    result->setProperty("laterOpenMb", restMb);
+    result->setProperty("allOpenMb", allMb);
+    result->setProperty("afterCloseMb", closedMb);
+    result->setProperty("openMs", opens);
+
+    return juce::var(result.get());
+}
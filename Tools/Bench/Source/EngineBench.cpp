@@ -0,0 +1,402 @@
+/*
+  ==============================================================================
+
+    EngineBench.cpp
+    Created: 20 Oct 2026 11:02:19pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+#include "../../../Source/Engine.h"
+#include "../../../Source/PortableFFT.h"
+
+/*
+ * the engine on its own, driven the way processBlock() drives it (sub-block grid, decimator in
+ * front, no gate or cab):
+ *
+ *   instances      cost per sample of one instance as more of them share the core, round robin a
+ *                  host block at a time, the way a session with many tracks runs them
+ *   decimation     full rate against decimated mode at the high host rates, in CPU and in what it
+ *                  does to the spectrum of the wet signal, octave by octave
+ *   bands          full band against the 2 and 3 band splits, fuzzing every band and just the one
+ */
+namespace
+{
+    constexpr int blockChunk = SubdominantEngine::blockChunk;
+
+    /* one engine, its state and its decimator, as one processor instance holds them */
+    typedef struct Voice_t
+    {
+    public:
+
+        SubdominantEngine engine;
+        SubdominantEngine::DSPState_t state;
+        HalfbandDecimatorChain decimator;
+
+        float params[Params::numParams];
+        float decimated[2][blockChunk], out[2][blockChunk], dryOut[2][blockChunk];
+
+        Voice_t()
+        {
+            for (int i = 0; i < Params::numParams; i++)
+                params[i] = Params::ranges[i].def;
+        }
+
+        void prepare(const double hostRate, const int stages)
+        {
+            engine.prepare(hostRate / (1 << stages), stages, false);
+            decimator.prepare(stages);
+
+            engine.resetState(&state);
+            state.upsampler.prepare(stages);
+            engine.applyParams(&state, params);
+        }
+
+        /* numSamples on the grid, a multiple of blockChunk */
+        void process(const float* inL, const float* inR, float* outL, float* outR, const int numSamples)
+        {
+            const int stages = engine.getDecimationStages();
+
+            for (int pos = 0; pos < numSamples; pos += blockChunk)
+            {
+                const float* engineL = inL + pos;
+                const float* engineR = inR + pos;
+                int numEngineSamples = blockChunk;
+
+                if (stages > 0)
+                {
+                    numEngineSamples = decimator.process(inL + pos, inR + pos, decimated[0], decimated[1], blockChunk);
+                    engineL = decimated[0];
+                    engineR = decimated[1];
+                }
+
+                engine.updateLfo(&state, 0.0);
+                engine.renderChunk(&state, engineL, engineR, numEngineSamples, inL + pos, inR + pos, out[0], out[1],
+                                   dryOut[0], dryOut[1], blockChunk);
+
+                for (int i = 0; i < blockChunk; i++)
+                {
+                    outL[pos + i] = out[0][i] + dryOut[0][i];
+                    outR[pos + i] = out[1][i] + dryOut[1][i];
+                }
+
+                engine.flushDenormals(&state);
+            }
+        }
+
+    } Voice_t;
+
+    /* a plucked low E with eight harmonics, again every second, so the counters and the gate side both move */
+    void fillPluck(float* dest, const int numSamples, const double sampleRate)
+    {
+        for (int i = 0; i < numSamples; i++)
+        {
+            const double t = std::fmod(i / sampleRate, 1.0);
+            double x = 0.0;
+
+            for (int k = 1; k <= 8; k++)
+                x += std::sin(2.0 * 3.141592653589793 * 82.41 * k * t) / k;
+
+            dest[i] = (float) (0.4 * x * std::exp(-3.0 * t));
+        }
+    }
+
+    /* numBlocks host blocks of blockSize through voice, every call timed */
+    Bench::Timings_t timeVoice(Voice_t& voice, const float* in, const int inLength, const int blockSize, const int numBlocks,
+                               std::vector<float>* keep = nullptr)
+    {
+        std::vector<float> outL((size_t) blockSize), outR((size_t) blockSize);
+        Bench::Timings_t timings;
+
+        timings.reserve((size_t) numBlocks);
+
+        for (int b = 0; b < numBlocks; b++)
+        {
+            const float* block = in + ((juce::int64) b * blockSize) % (inLength - blockSize + 1);
+
+            const juce::int64 start = juce::Time::getHighResolutionTicks();
+            voice.process(block, block, outL.data(), outR.data(), blockSize);
+            timings.add(start, juce::Time::getHighResolutionTicks());
+
+            if (keep != nullptr) keep->insert(keep->end(), outL.begin(), outL.end());
+        }
+
+        return timings;
+    }
+
+    /*
+     * hann windowed, half overlapped power spectrum of x, summed into octave bands around 31.5hz to
+     * 16khz and one above 22khz, in dB
+     */
+    std::vector<double> octaveLevels(const std::vector<float>& x, const double sampleRate)
+    {
+        constexpr int order = 14;
+        constexpr int size = 1 << order;
+        static const double centres[] = { 31.5, 63.0, 125.0, 250.0, 500.0, 1000.0, 2000.0, 4000.0, 8000.0, 16000.0 };
+
+        std::unique_ptr<PortableFFT<order>> fft = std::make_unique<PortableFFT<order>>();
+        std::vector<float> frame((size_t) size * 2);
+        std::vector<double> power((size_t) size / 2 + 1, 0.0);
+
+        for (size_t start = 0; start + size <= x.size(); start += size / 2)
+        {
+            for (int i = 0; i < size; i++)
+                frame[(size_t) i] = x[start + (size_t) i] * (float) (0.5 - 0.5 * std::cos(2.0 * 3.141592653589793 * i / size));
+
+            fft->performRealOnlyForwardTransform(frame.data());
+
+            for (int k = 0; k <= size / 2; k++)
+                power[(size_t) k] += (double) frame[(size_t) k * 2] * frame[(size_t) k * 2] + (double) frame[(size_t) k * 2 + 1] * frame[(size_t) k * 2 + 1];
+        }
+
+        std::vector<double> levels;
+
+        for (const double centre : centres)
+        {
+            double sum = 1e-30;
+
+            for (int k = 1; k <= size / 2; k++)
+            {
+                const double f = k * sampleRate / size;
+
+                if (f >= centre / std::sqrt(2.0) && f < centre * std::sqrt(2.0)) sum += power[(size_t) k];
+            }
+
+            levels.push_back(10.0 * std::log10(sum));
+        }
+
+        double ultrasonic = 1e-30;
+
+        for (int k = 1; k <= size / 2; k++)
+            if (k * sampleRate / size >= 22000.0) ultrasonic += power[(size_t) k];
+
+        levels.push_back(10.0 * std::log10(ultrasonic));
+
+        return levels;
+    }
+}
+
+SD_BENCH(instances)
+{
+    constexpr int blockSize = 256;
+    const int counts[] = { 1, 4, 16, 64, 256 };
+    const double rate = settings.sampleRate;
+
+    std::vector<float> in((size_t) rate);
+    fillPluck(in.data(), (int) in.size(), rate);
+
+    std::vector<float> outL((size_t) blockSize), outR((size_t) blockSize);
+    juce::Array<juce::var> rows;
+
+    Bench::printHeader("instances at " + juce::String(rate, 0) + "hz, " + juce::String(blockSize) + " sample blocks round robin, "
+                       "per instance per block (DSPState_t " + juce::String((int) sizeof(SubdominantEngine::DSPState_t)) + " bytes, "
+                       "engine " + juce::String((int) sizeof(SubdominantEngine)) + ")");
+
+    for (const int count : counts)
+    {
+        std::vector<std::unique_ptr<Voice_t>> voices;
+
+        for (int v = 0; v < count; v++)
+        {
+            voices.push_back(std::make_unique<Voice_t>());
+            voices.back()->prepare(rate, 0);
+        }
+
+        /* the same amount of audio in total whatever the count, but at least a few blocks each */
+        const int rounds = juce::jmax(8, (int) (settings.seconds * rate / blockSize) / count);
+        Bench::Timings_t timings;
+
+        timings.reserve((size_t) rounds * (size_t) count);
+
+        for (int r = 0; r < rounds; r++)
+        {
+            const float* block = in.data() + ((juce::int64) r * blockSize) % ((juce::int64) in.size() - blockSize);
+
+            for (std::unique_ptr<Voice_t>& voice : voices)
+            {
+                const juce::int64 start = juce::Time::getHighResolutionTicks();
+                voice->process(block, block, outL.data(), outR.data(), blockSize);
+                timings.add(start, juce::Time::getHighResolutionTicks());
+            }
+        }
+
+        const double budget = blockSize / rate * 1e6;
+
+        Bench::printRow(juce::String(count) + " instances", timings, budget);
+
+        juce::var row = timings.toVar(budget);
+
+        if (juce::DynamicObject* o = row.getDynamicObject()) o->setProperty("instances", count);
+
+        rows.add(row);
+    }
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    result->setProperty("stateBytes", (int) sizeof(SubdominantEngine::DSPState_t));
+    result->setProperty("engineBytes", (int) sizeof(SubdominantEngine));
+    result->setProperty("rows", rows);
+
+    return juce::var(result.get());
+}
+
+SD_BENCH(decimation)
+{
+    constexpr int blockSize = 512;
+    const double rates[] = { 176400.0, 192000.0, 384000.0 };
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    for (const double rate : rates)
+    {
+        int stages = 0;
+
+        /* how prepareToPlay() picks them */
+        while (stages < Halfband::maxStages && rate / (2 << stages) >= 88000.0)
+            stages++;
+
+        const int inLength = (int) (rate * 4.0);
+        const int numBlocks = juce::jmax(8, (int) (juce::jmin(settings.seconds, 4.0) * rate) / blockSize);
+        std::vector<float> in((size_t) inLength), fullOut, decimatedOut;
+
+        fillPluck(in.data(), inLength, rate);
+
+        /* the wet side only, blend and master at full, the dry side would be the same in both */
+        Voice_t full, decimated;
+
+        full.params[Params::blendAmount] = decimated.params[Params::blendAmount] = 1.f;
+        full.params[Params::masterVolume] = decimated.params[Params::masterVolume] = 1.f;
+
+        full.prepare(rate, 0);
+        decimated.prepare(rate, stages);
+
+        /* a block of one, then the same block of the other, so drift in the clock or the load hits both alike */
+        Bench::Timings_t fullTimings, decimatedTimings;
+
+        for (int b = 0; b < numBlocks; b++)
+        {
+            const float* block = in.data() + ((juce::int64) b * blockSize) % (inLength - blockSize + 1);
+
+            const Bench::Timings_t fullBlock = timeVoice(full, block, blockSize, blockSize, 1, &fullOut);
+            const Bench::Timings_t decimatedBlock = timeVoice(decimated, block, blockSize, blockSize, 1, &decimatedOut);
+
+            fullTimings.micros.push_back(fullBlock.micros[0]);
+            decimatedTimings.micros.push_back(decimatedBlock.micros[0]);
+        }
+
+        const double budget = blockSize / rate * 1e6;
+
+        Bench::printHeader(juce::String(rate / 1000.0, 1) + "khz, " + juce::String(blockSize) + " sample blocks, decimated runs the engine at "
+                           + juce::String(rate / (1 << stages) / 1000.0, 1) + "khz");
+        Bench::printRow("full rate", fullTimings, budget);
+        Bench::printRow("decimated", decimatedTimings, budget);
+
+        /* lined up for the resampler's delay before comparing */
+        const int latency = Halfband::latency(stages);
+
+        decimatedOut.erase(decimatedOut.begin(), decimatedOut.begin() + juce::jmin(latency, (int) decimatedOut.size()));
+        fullOut.resize(decimatedOut.size());
+
+        const std::vector<double> fullLevels = octaveLevels(fullOut, rate);
+        const std::vector<double> decimatedLevels = octaveLevels(decimatedOut, rate);
+        const char* const bandNames[] = { "31.5", "63", "125", "250", "500", "1k", "2k", "4k", "8k", "16k", ">22k" };
+
+        std::cout << "  CPU saved " << juce::String(100.0 * (1.0 - decimatedTimings.mean() / fullTimings.mean()), 1) << "%" << std::endl
+                  << "  octave band, dB    full  decimated   difference" << std::endl;
+
+        juce::Array<juce::var> bands;
+        double worstAudible = 0.0;
+
+        for (size_t b = 0; b < fullLevels.size(); b++)
+        {
+            const double difference = decimatedLevels[b] - fullLevels[b];
+
+            std::cout << "  " << juce::String(bandNames[b]).paddedRight(' ', 10) << juce::String(fullLevels[b] - fullLevels[5], 1).paddedLeft(' ', 12)
+                      << juce::String(decimatedLevels[b] - fullLevels[5], 1).paddedLeft(' ', 11) << juce::String(difference, 2).paddedLeft(' ', 13)
+                      << std::endl;
+
+            if (b + 1 < fullLevels.size()) worstAudible = juce::jmax(worstAudible, std::abs(difference));
+
+            juce::DynamicObject::Ptr band = new juce::DynamicObject();
+
+            band->setProperty("band", bandNames[b]);
+            band->setProperty("fullDb", fullLevels[b]);
+            band->setProperty("decimatedDb", decimatedLevels[b]);
+
+            bands.add(juce::var(band.get()));
+        }
+
+        std::cout << "  worst octave up to 16k " << juce::String(worstAudible, 2) << " dB" << std::endl;
+
+        juce::DynamicObject::Ptr row = new juce::DynamicObject();
+
+        row->setProperty("stages", stages);
+        row->setProperty("full", fullTimings.toVar(budget));
+        row->setProperty("decimated", decimatedTimings.toVar(budget));
+        row->setProperty("octaves", bands);
+        row->setProperty("worstAudibleDb", worstAudible);
+
+        result->setProperty(juce::String(rate, 0), juce::var(row.get()));
+    }
+
+    return juce::var(result.get());
+}
+
+SD_BENCH(bands)
+{
+    constexpr int blockSize = 256;
+    const double rate = settings.sampleRate;
+    const int numBlocks = juce::jmax(8, (int) (settings.seconds * rate) / blockSize);
+
+    /* band mode, low/mid/high fuzzed */
+    typedef struct Setup_t
+    {
+    public:
+
+        const char* name;
+        float mode, low, mid, high;
+
+    } Setup_t;
+
+    const Setup_t setups[] = { { "full band", 0.f, 0.f, 1.f, 1.f },
+                               { "2 band, both fuzzed", 1.f, 1.f, 1.f, 1.f },
+                               { "2 band, high fuzzed", 1.f, 0.f, 1.f, 1.f },
+                               { "3 band, all fuzzed", 2.f, 1.f, 1.f, 1.f },
+                               { "3 band, mid fuzzed", 2.f, 0.f, 1.f, 0.f } };
+
+    std::vector<float> in((size_t) rate);
+    fillPluck(in.data(), (int) in.size(), rate);
+
+    const double budget = blockSize / rate * 1e6;
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+    double fullMean = 0.0;
+
+    Bench::printHeader("band modes at " + juce::String(rate, 0) + "hz, " + juce::String(blockSize) + " sample blocks");
+
+    for (const Setup_t& setup : setups)
+    {
+        Voice_t voice;
+
+        voice.params[Params::bandMode] = setup.mode;
+        voice.params[Params::fuzzLow] = setup.low;
+        voice.params[Params::fuzzMid] = setup.mid;
+        voice.params[Params::fuzzHigh] = setup.high;
+        voice.prepare(rate, 0);
+
+        const Bench::Timings_t timings = timeVoice(voice, in.data(), (int) in.size(), blockSize, numBlocks);
+
+        if (fullMean == 0.0) fullMean = timings.mean();
+
+        Bench::printRow(setup.name, timings, budget);
+
+        juce::var row = timings.toVar(budget);
+
+        if (juce::DynamicObject* o = row.getDynamicObject()) o->setProperty("againstFullBand", timings.mean() / fullMean);
+
+        result->setProperty(setup.name, row);
+    }
+
+    return juce::var(result.get());
+}
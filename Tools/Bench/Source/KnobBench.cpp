@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    KnobBench.cpp
+    Created: 20 Oct 2026 10:14:33pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+#include "../../../Source/KnobAtlas.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * what a repaint costs with every parameter automated, at 1x and 2x, against a 60fps frame: the nine
+ * knobs alone drawn as vectors (KnobAtlas::renderKnob) and from the atlas, then the whole editor
+ * painted after every parameter moved. the atlas rows include rendering each frame the first time
+ * it's hit. also what the atlas takes up, after the run and with every frame of a strip rendered
+ */
+namespace
+{
+    constexpr int numKnobs = 9;
+    constexpr int knobSize = 120;
+    constexpr double frameMicros = 1e6 / 60.0;
+
+    /* NewLookAndFeel's colours and juce::Slider's default rotary range */
+    const KnobAtlas::KnobStyle_t style = { juce::MathConstants<float>::pi * 1.2f, juce::MathConstants<float>::pi * 2.8f,
+                                           juce::Colours::darkred, juce::Colours::green, juce::Colours::yellow };
+
+    /* the nine knobs on a 3x3 grid, at new positions every frame */
+    Bench::Timings_t timeKnobs(const bool atlas, KnobAtlas& knobs, const float scale, const int numFrames)
+    {
+        juce::Image canvas(juce::Image::ARGB, juce::roundToInt(600 * scale), juce::roundToInt(600 * scale), true);
+        juce::Graphics g(canvas);
+        juce::Random random(5);
+        Bench::Timings_t timings;
+
+        g.addTransform(juce::AffineTransform::scale(scale));
+        timings.reserve((size_t) numFrames);
+
+        for (int frame = 0; frame < numFrames; frame++)
+        {
+            float positions[numKnobs];
+
+            for (float& pos : positions)
+                pos = random.nextFloat();
+
+            const juce::int64 start = juce::Time::getHighResolutionTicks();
+
+            for (int k = 0; k < numKnobs; k++)
+            {
+                const int x = 40 + (k % 3) * 180, y = 40 + (k / 3) * 180;
+
+                if (atlas) knobs.draw(g, x, y, knobSize, knobSize, positions[k], style);
+                else KnobAtlas::renderKnob(g, (float) x, (float) y, (float) knobSize, (float) knobSize, positions[k], style);
+            }
+
+            timings.add(start, juce::Time::getHighResolutionTicks());
+        }
+
+        return timings;
+    }
+
+    /* every automatable parameter moved from the message thread the way a host's automation does, then one full paint */
+    Bench::Timings_t timeEditor(juce::AudioProcessor& processor, juce::AudioProcessorEditor& editor, const float scale, const int numFrames)
+    {
+        juce::Image canvas(juce::Image::ARGB, juce::roundToInt(editor.getWidth() * scale), juce::roundToInt(editor.getHeight() * scale), true);
+        juce::Graphics g(canvas);
+        juce::Random random(6);
+        Bench::Timings_t timings;
+
+        g.addTransform(juce::AffineTransform::scale(scale));
+        timings.reserve((size_t) numFrames);
+
+        for (int frame = 0; frame < numFrames; frame++)
+        {
+            for (juce::AudioProcessorParameter* param : processor.getParameters())
+                if (param->isAutomatable()) param->setValueNotifyingHost(random.nextFloat());
+
+            const juce::int64 start = juce::Time::getHighResolutionTicks();
+            editor.paintEntireComponent(g, true);
+            timings.add(start, juce::Time::getHighResolutionTicks());
+        }
+
+        return timings;
+    }
+}
+
+SD_BENCH(knobAtlas)
+{
+    const int numFrames = juce::jmax(1, (int) (settings.seconds * 60.0));
+
+    std::unique_ptr<juce::AudioProcessor> processor(createPluginFilter());
+    std::unique_ptr<juce::AudioProcessorEditor> editor(processor->createEditorIfNeeded());
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    for (const float scale : { 1.f, 2.f })
+    {
+        const juce::String at = " @" + juce::String((int) scale) + "x";
+        KnobAtlas knobs, fullStrip;
+
+        Bench::printHeader("repaint with every parameter automated" + at + ", against a 60fps frame");
+
+        const Bench::Timings_t vector = timeKnobs(false, knobs, scale, numFrames);
+        const Bench::Timings_t atlas = timeKnobs(true, knobs, scale, numFrames);
+        const Bench::Timings_t whole = timeEditor(*processor, *editor, scale, numFrames);
+
+        Bench::printRow("9 knobs, vector", vector, frameMicros);
+        Bench::printRow("9 knobs, atlas", atlas, frameMicros);
+        Bench::printRow("whole editor", whole, frameMicros);
+
+        /* every pointer position of one knob size and colour set */
+        {
+            juce::Image canvas(juce::Image::ARGB, juce::roundToInt(knobSize * scale), juce::roundToInt(knobSize * scale), true);
+            juce::Graphics g(canvas);
+
+            g.addTransform(juce::AffineTransform::scale(scale));
+
+            for (int frame = 0; frame < KnobAtlas::numFrames; frame++)
+                fullStrip.draw(g, 0, 0, knobSize, knobSize, (float) frame / (float) (KnobAtlas::numFrames - 1), style);
+        }
+
+        std::cout << "  atlas after the run " << juce::String((double) knobs.getNumBytes() / 1e6, 2) << " MB, a full strip "
+                  << juce::String((double) fullStrip.getNumBytes() / 1e6, 2) << " MB" << std::endl;
+
+        juce::DynamicObject::Ptr row = new juce::DynamicObject();
+
+        row->setProperty("vectorKnobs", vector.toVar(frameMicros));
+        row->setProperty("atlasKnobs", atlas.toVar(frameMicros));
+        row->setProperty("editor", whole.toVar(frameMicros));
+        row->setProperty("atlasBytes", (juce::int64) knobs.getNumBytes());
+        row->setProperty("fullStripBytes", (juce::int64) fullStrip.getNumBytes());
+
+        result->setProperty(juce::String((int) scale) + "x", juce::var(row.get()));
+    }
+
+    editor.reset();
+
+    return juce::var(result.get());
+}
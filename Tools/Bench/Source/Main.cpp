@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 3:12:37pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+
+#if JUCE_WINDOWS
+ #include <windows.h>
+ #include <psapi.h>
+ #pragma comment(lib, "psapi.lib")
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#elif JUCE_LINUX
+ #include <unistd.h>
+#endif
+
+/*
+ * runs the benches named on the command line, or all of them, and writes what they measured as JSON
+ * next to the tables if asked to. build it as Release, the numbers from a debug build mean nothing
+ *
+ *   Bench [name ...] [--rate=hz] [--seconds=N] [--json=report.json] [--list]
+ */
+namespace
+{
+    typedef struct Entry_t
+    {
+    public:
+
+        const char* name;
+        juce::var (*run)(const Bench::Settings_t&);
+
+    } Entry_t;
+
+    /* filled by static initialisers, so it has to exist before the first of them runs */
+    std::vector<Entry_t>& getBenches()
+    {
+        static std::vector<Entry_t> benches;
+        return benches;
+    }
+}
+
+int Bench::add(const char* name, juce::var (*run)(const Settings_t&))
+{
+    getBenches().push_back({ name, run });
+    return (int) getBenches().size();
+}
+
+size_t Bench::residentBytes()
+{
+   #if JUCE_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters {};
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return (size_t) counters.WorkingSetSize;
+   #elif JUCE_MAC
+    mach_task_basic_info_data_t info {};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) == KERN_SUCCESS)
+        return (size_t) info.resident_size;
+   #elif JUCE_LINUX
+    /* statm: total program size, then resident, in pages */
+    const juce::StringArray fields = juce::StringArray::fromTokens(juce::File("/proc/self/statm").loadFileAsString(), false);
+
+    if (fields.size() > 1)
+        return (size_t) fields[1].getLargeIntValue() * (size_t) sysconf(_SC_PAGESIZE);
+   #endif
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI init;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::cout << "usage: Bench [name ...] [--rate=hz] [--seconds=N] [--json=report.json] [--list]" << std::endl;
+        return 0;
+    }
+
+    if (args.containsOption("--list"))
+    {
+        for (const Entry_t& bench : getBenches())
+            std::cout << bench.name << std::endl;
+
+        return 0;
+    }
+
+    Bench::Settings_t settings;
+
+    if (args.containsOption("--rate")) settings.sampleRate = juce::jlimit(8000.0, 384000.0, args.getValueForOption("--rate").getDoubleValue());
+    if (args.containsOption("--seconds")) settings.seconds = juce::jlimit(0.1, 3600.0, args.getValueForOption("--seconds").getDoubleValue());
+
+    juce::StringArray selected;
+
+    for (const juce::ArgumentList::Argument& arg : args.arguments)
+        if (!arg.isLongOption() && !arg.isShortOption())
+            selected.add(arg.text);
+
+    juce::DynamicObject::Ptr report = new juce::DynamicObject();
+
+    report->setProperty("sampleRate", settings.sampleRate);
+    report->setProperty("seconds", settings.seconds);
+    report->setProperty("build", juce::SystemStats::getJUCEVersion());
+    report->setProperty("cpu", juce::SystemStats::getCpuModel());
+
+    for (const Entry_t& bench : getBenches())
+        if (selected.isEmpty() || selected.contains(bench.name))
+            report->setProperty(bench.name, bench.run(settings));
+
+    if (args.containsOption("--json"))
+    {
+        const juce::File file = args.getFileForOption("--json");
+
+        if (!file.replaceWithText(juce::JSON::toString(juce::var(report.get()))))
+        {
+            std::cerr << "can't write " << file.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
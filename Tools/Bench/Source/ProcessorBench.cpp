@@ -0,0 +1,198 @@
+/*
+  ==============================================================================
+
+    ProcessorBench.cpp
+    Created: 21 Oct 2026 1:07:55am
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include "Bench.h"
+#include "../../../Source/PluginProcessor.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * the whole processor, through processBlock() the way a host calls it:
+ *
+ *   scope          processBlock() with the editor's scope feed on against the same processor with it
+ *                  off, in short runs each way. the feed should cost under 1% of the block, off all
+ *                  that's left of it is the flag load and the branches on it
+ *   instantiation  construct, prepareToPlay() and destroy, each timed, the way a host scan runs
+ *                  through them, against a target for the three together. a second prepare at the
+ *                  same rate (a transport start) and one at a new rate, and the resident memory of
+ *                  an idle prepared instance
+ */
+namespace
+{
+    /* a scan through a few hundred plugins shouldn't notice ours */
+    constexpr double instantiationTargetMs = 1.0;
+
+    /* the same noise every run, well above the gate so every stage has something to do */
+    void fillBlock(juce::AudioBuffer<float>& buffer, const int block)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ch++)
+        {
+            Bench::fillNoise(buffer.getWritePointer(ch), buffer.getNumSamples(), block * 2 + ch);
+            buffer.applyGain(ch, 0, buffer.getNumSamples(), 0.5f);
+        }
+    }
+}
+
+SD_BENCH(scope)
+{
+    constexpr int blockSize = 256;
+    const double rate = settings.sampleRate;
+    const int numBlocks = juce::jmax(8, (int) (settings.seconds * rate) / blockSize);
+
+    std::unique_ptr<juce::AudioProcessor> plugin(createPluginFilter());
+    SubdominantAudioProcessor* processor = dynamic_cast<SubdominantAudioProcessor*>(plugin.get());
+
+    jassert(processor != nullptr);
+
+    processor->setPlayConfigDetails(2, 2, rate, blockSize);
+    processor->prepareToPlay(rate, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    std::vector<SubdominantAudioProcessor::ScopeFrame_t> frames(SubdominantAudioProcessor::scopeFifoSize);
+
+    /*
+     * short runs each way, with the ring drained after every block as the editor's timer would. a run
+     * long enough that the branch predictors settle into it (flipping the feed every block would have
+     * them guessing wrong on every branch it adds, which no session ever does), short enough that the
+     * two sides see the same clock and the same neighbours, and the first couple of blocks of every
+     * run left out
+     */
+    constexpr int runLength = 16, settleBlocks = 2;
+
+    Bench::Timings_t offTimings, onTimings;
+
+    for (int b = 0; b < numBlocks * 2; b++)
+    {
+        const bool on = ((b / runLength) & 1) != 0;
+
+        processor->setScopeActive(on);
+        fillBlock(buffer, b);
+
+        const juce::int64 start = juce::Time::getHighResolutionTicks();
+        processor->processBlock(buffer, midi);
+        const juce::int64 end = juce::Time::getHighResolutionTicks();
+
+        if (b % runLength >= settleBlocks)
+            (on ? onTimings : offTimings).add(start, end);
+
+        processor->readScope(frames.data(), (int) frames.size());
+    }
+
+    processor->releaseResources();
+
+    /*
+     * the difference is a fraction of a microsecond, well inside how much the machine moves around. the
+     * lower quartiles are the blocks nothing else got in the way of, held against each other
+     */
+    const double budget = blockSize / rate * 1e6;
+    const double overhead = onTimings.percentile(25.0) / offTimings.percentile(25.0) - 1.0;
+
+    Bench::printHeader("scope feed at " + juce::String(rate, 0) + "hz, " + juce::String(blockSize) + " sample blocks, per processBlock()");
+    Bench::printRow("scope off", offTimings, budget);
+    Bench::printRow("scope on", onTimings, budget);
+
+    std::cout << "  feed costs " << juce::String(100.0 * overhead, 2) << "% of processBlock(), lower quartile on against"
+              << " lower quartile off, target 1%" << std::endl;
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    result->setProperty("off", offTimings.toVar(budget));
+    result->setProperty("on", onTimings.toVar(budget));
+    result->setProperty("overhead", overhead);
+
+    return juce::var(result.get());
+}
+
+SD_BENCH(instantiation)
+{
+    constexpr int blockSize = 512;
+    constexpr int numIdle = 100;
+    const double rate = settings.sampleRate;
+    const int numRounds = juce::jlimit(20, 2000, (int) (settings.seconds * 50.0));
+
+    Bench::Timings_t construct, prepare, samePrepare, newPrepare, destroy, total;
+
+    /* one instance alive at a time, as a scan has them */
+    for (int r = 0; r < numRounds; r++)
+    {
+        const juce::int64 start = juce::Time::getHighResolutionTicks();
+        std::unique_ptr<juce::AudioProcessor> processor(createPluginFilter());
+        const juce::int64 constructed = juce::Time::getHighResolutionTicks();
+
+        processor->setPlayConfigDetails(2, 2, rate, blockSize);
+        processor->prepareToPlay(rate, blockSize);
+
+        const juce::int64 prepared = juce::Time::getHighResolutionTicks();
+
+        /* not part of the scan, and out of its total: what a transport start and a rate change cost afterwards */
+        processor->prepareToPlay(rate, blockSize);
+
+        const juce::int64 preparedAgain = juce::Time::getHighResolutionTicks();
+
+        processor->prepareToPlay(rate * 2.0, blockSize);
+
+        const juce::int64 reprepared = juce::Time::getHighResolutionTicks();
+
+        processor.reset();
+
+        const juce::int64 destroyed = juce::Time::getHighResolutionTicks();
+
+        construct.add(start, constructed);
+        prepare.add(constructed, prepared);
+        samePrepare.add(prepared, preparedAgain);
+        newPrepare.add(preparedAgain, reprepared);
+        destroy.add(reprepared, destroyed);
+
+        total.micros.push_back(construct.micros.back() + prepare.micros.back() + destroy.micros.back());
+    }
+
+    const double budget = instantiationTargetMs * 1000.0;
+
+    Bench::printHeader("instantiation, " + juce::String(numRounds) + " instances one after the other, against a "
+                       + juce::String(instantiationTargetMs, 1) + "ms target for construct + prepare + destroy");
+    Bench::printRow("construct", construct, budget);
+    Bench::printRow("prepareToPlay()", prepare, budget);
+    Bench::printRow("destroy", destroy, budget);
+    Bench::printRow("construct + prepare + destroy", total, budget);
+    Bench::printRow("prepareToPlay() again, same rate", samePrepare, budget);
+    Bench::printRow("prepareToPlay() at a new rate", newPrepare, budget);
+
+    /* idle: constructed and prepared, no editor, nothing processed */
+    std::vector<std::unique_ptr<juce::AudioProcessor>> idle;
+    const size_t before = Bench::residentBytes();
+
+    for (int i = 0; i < numIdle; i++)
+    {
+        idle.emplace_back(createPluginFilter());
+        idle.back()->setPlayConfigDetails(2, 2, rate, blockSize);
+        idle.back()->prepareToPlay(rate, blockSize);
+    }
+
+    const size_t after = Bench::residentBytes();
+    const double idleKb = after > before ? (double) (after - before) / 1024.0 / numIdle : 0.0;
+
+    idle.clear();
+
+    std::cout << "  resident memory per idle instance " << juce::String(idleKb, 1) << " KB, over " << numIdle << " of them" << std::endl;
+
+    juce::DynamicObject::Ptr result = new juce::DynamicObject();
+
+    result->setProperty("targetMs", instantiationTargetMs);
+    result->setProperty("construct", construct.toVar(budget));
+    result->setProperty("prepare", prepare.toVar(budget));
+    result->setProperty("destroy", destroy.toVar(budget));
+    result->setProperty("total", total.toVar(budget));
+    result->setProperty("samePrepare", samePrepare.toVar(budget));
+    result->setProperty("newPrepare", newPrepare.toVar(budget));
+    result->setProperty("idleKb", idleKb);
+
+    return juce::var(result.get());
+}
@@ -0,0 +1,426 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 9:26:51pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../Bench/Source/Bench.h"
+#include "../../RTCheck/Source/Hooks.h"
+
+/*
+ * loads the built plugin the way a host does, through the VST3 format, and times what a user waits
+ * for: loading the module, creating an instance, prepareToPlay(), saving and restoring the state,
+ * releasing and deleting it again. once per run, the first run also processes N seconds of audio at
+ * each block size on an audio thread of its own, armed with RTCheck's hooks, so every allocation,
+ * free, lock and blocking call in there is reported with the stack it came from (Hooks.h has the list)
+ *
+ *   Host SubDominant.vst3 [--runs=N] [--seconds=N] [--rate=hz] [--blocks=32,64,...] [--json=report.json]
+ *
+ * for the release build before it goes anywhere, automation and the editor are RTCheck's job against
+ * the source. the hooks only see into the plugin's binary on Linux: elsewhere a plugin doesn't go
+ * through this program's operator new, and the report says so. exits 1 if the plugin didn't load,
+ * came back from a restore with a different state, put out anything but finite samples, or anything
+ * was caught on the audio thread
+ */
+namespace
+{
+    typedef struct Settings_t
+    {
+    public:
+
+        double sampleRate = 48000.0;
+        double seconds = 10.0;
+        int runs = 5;
+        juce::Array<int> blockSizes { 32, 64, 256, 1024 };
+
+    } Settings_t;
+
+    void pump(const int ms)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(ms);
+    }
+
+    /* a transport that's always rolling at 120bpm, so the LFO sync paths run too */
+    class RollingPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+
+            info.setBpm(120.0);
+            info.setIsPlaying(true);
+            info.setTimeInSamples(samples.load());
+            info.setPpqPosition((double) samples.load() / sampleRate * 2.0);
+
+            return info;
+        }
+
+        double sampleRate = 48000.0;
+        std::atomic<juce::int64> samples { 0 };
+    };
+
+    /* as fast as it goes, one block size, a tone bursting in and out of quiet noise */
+    class AudioThread : public juce::Thread
+    {
+    public:
+        AudioThread(juce::AudioPluginInstance& instance, RollingPlayHead& head, const int size, const juce::int64 blocks)
+            : juce::Thread("Host audio"), plugin(instance), playHead(head), blockSize(size), numBlocks(blocks),
+              buffer(juce::jmax(2, instance.getTotalNumInputChannels(), instance.getTotalNumOutputChannels()), size)
+        {
+            timings.reserve((size_t) numBlocks);
+            midi.ensureSize(256);
+        }
+
+        ~AudioThread() override
+        {
+            stopThread(-1);
+        }
+
+        void run() override
+        {
+            juce::Random random(1);
+
+            for (juce::int64 b = 0; b < numBlocks && !threadShouldExit(); b++)
+            {
+                fillInput(random);
+
+                const juce::int64 start = juce::Time::getHighResolutionTicks();
+
+                Hooks::arm();
+                plugin.processBlock(buffer, midi);
+                Hooks::disarm();
+
+                timings.add(start, juce::Time::getHighResolutionTicks());
+
+                for (int ch = 0; ch < plugin.getTotalNumOutputChannels(); ch++)
+                    for (int i = 0; i < blockSize; i++)
+                        nonFinite += std::isfinite(buffer.getSample(ch, i)) ? 0 : 1;
+
+                midi.clear();
+                playHead.samples.fetch_add(blockSize);
+            }
+        }
+
+        Bench::Timings_t timings;
+        juce::int64 nonFinite = 0;
+
+    private:
+        void fillInput(juce::Random& random)
+        {
+            for (int i = 0; i < blockSize; i++)
+            {
+                const float burst = (phase / 24000) % 2 == 0 ? 0.5f : 0.f;
+                const float x = burst * (float) std::sin(phase * 0.0143) + 0.001f * (random.nextFloat() - 0.5f);
+
+                for (int ch = 0; ch < buffer.getNumChannels(); ch++)
+                    buffer.setSample(ch, i, x);
+
+                phase++;
+            }
+        }
+
+        juce::AudioPluginInstance& plugin;
+        RollingPlayHead& playHead;
+        const int blockSize;
+        const juce::int64 numBlocks;
+
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+        juce::int64 phase = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (AudioThread)
+    };
+
+    /* everything in the bundle, the binary and whatever resources went in with it */
+    juce::int64 getBundleSize(const juce::File& bundle)
+    {
+        if (!bundle.isDirectory()) return bundle.getSize();
+
+        juce::int64 bytes = 0;
+
+        for (const juce::File& file : bundle.findChildFiles(juce::File::findFiles, true))
+            bytes += file.getSize();
+
+        return bytes;
+    }
+
+    void randomiseParameters(juce::AudioPluginInstance& instance, juce::Random& random)
+    {
+        for (juce::AudioProcessorParameter* param : instance.getParameters())
+            if (param->isAutomatable()) param->setValue(random.nextFloat());
+    }
+
+    /* a whole lifecycle phase, median and worst, the budget columns mean nothing here */
+    void printPhase(const juce::String& label, const Bench::Timings_t& t)
+    {
+        std::cout << "  " << label.paddedRight(' ', 36) << juce::String(t.percentile(50.0) * 0.001, 3).paddedLeft(' ', 10)
+                  << juce::String(t.worst() * 0.001, 3).paddedLeft(' ', 10) << std::endl;
+    }
+
+    juce::var phaseToVar(const Bench::Timings_t& t)
+    {
+        juce::DynamicObject::Ptr o = new juce::DynamicObject();
+
+        o->setProperty("count", (int) t.micros.size());
+        o->setProperty("medianMicros", t.percentile(50.0));
+        o->setProperty("worstMicros", t.worst());
+
+        return juce::var(o.get());
+    }
+
+    juce::var describeSites()
+    {
+        juce::Array<juce::var> sites;
+
+        for (int i = 0; i < Hooks::getNumSites(); i++)
+        {
+            const Hooks::Site_t& site = Hooks::getSite(i);
+            juce::DynamicObject::Ptr entry = new juce::DynamicObject();
+            juce::Array<juce::var> stack;
+
+            for (const std::string& frame : Hooks::describe(site))
+                stack.add(juce::String(frame));
+
+            entry->setProperty("kind", Hooks::getKindName(site.kind));
+            entry->setProperty("blockSize", site.scenario);
+            entry->setProperty("count", site.count);
+            entry->setProperty("stack", stack);
+
+            sites.add(juce::var(entry.get()));
+        }
+
+        return sites;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI init;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h") || args.size() < 1 || args[0].isOption())
+    {
+        std::cout << "usage: Host SubDominant.vst3 [--runs=N] [--seconds=N] [--rate=hz] [--blocks=32,64,...] [--json=report.json]" << std::endl;
+        return 0;
+    }
+
+    Settings_t settings;
+
+    if (args.containsOption("--rate")) settings.sampleRate = juce::jlimit(22050.0, 384000.0, args.getValueForOption("--rate").getDoubleValue());
+    if (args.containsOption("--seconds")) settings.seconds = juce::jlimit(0.1, 3600.0, args.getValueForOption("--seconds").getDoubleValue());
+    if (args.containsOption("--runs")) settings.runs = juce::jlimit(1, 1000, args.getValueForOption("--runs").getIntValue());
+
+    if (args.containsOption("--blocks"))
+    {
+        settings.blockSizes.clear();
+
+        for (const juce::String& size : juce::StringArray::fromTokens(args.getValueForOption("--blocks"), ",", ""))
+            settings.blockSizes.addIfNotAlreadyThere(juce::jlimit(1, 8192, size.getIntValue()));
+    }
+
+    const juce::File bundle = args[0].resolveAsFile();
+
+    if (!bundle.exists())
+    {
+        std::cerr << "can't find " << bundle.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    const int maxBlockSize = juce::jmax(512, *std::max_element(settings.blockSizes.begin(), settings.blockSizes.end()));
+
+    /* the site table only keeps the pointer, these stay put until the report's written */
+    std::vector<std::string> scenarios;
+
+    for (const int size : settings.blockSizes)
+        scenarios.push_back(std::to_string(size));
+
+    juce::AudioPluginFormatManager formatManager;
+    formatManager.addFormat(new juce::VST3PluginFormat());
+
+    juce::AudioPluginFormat& format = *formatManager.getFormat(0);
+    juce::OwnedArray<juce::PluginDescription> types;
+
+    /* the first dlopen, the plugin's static initialisers and its factory, and what the format scans */
+    const juce::int64 scanStart = juce::Time::getHighResolutionTicks();
+    format.findAllTypesForFile(types, bundle.getFullPathName());
+    const double scanMicros = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - scanStart) * 1e6;
+
+    if (types.isEmpty())
+    {
+        std::cerr << "no VST3 plugin in " << bundle.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    const juce::PluginDescription description = *types[0];
+
+    Bench::Timings_t instantiate, prepare, getState, setState, release, destroy;
+    juce::Array<juce::var> processing;
+    juce::MemoryBlock saved, restored;
+    juce::Random random(3);
+    RollingPlayHead playHead;
+    bool stateRoundTrips = true, failed = false;
+    juce::int64 nonFinite = 0;
+
+    playHead.sampleRate = settings.sampleRate;
+
+    std::cout << description.name << " " << description.version << ", " << getBundleSize(bundle) << " bytes, scanned in "
+              << juce::String(scanMicros * 0.001, 3) << " ms" << std::endl;
+
+    Bench::printHeader("processing, " + juce::String(settings.seconds) + " s at " + juce::String(settings.sampleRate) + " Hz");
+
+    for (int run = 0; run < settings.runs && !failed; run++)
+    {
+        juce::String error;
+
+        const juce::int64 createStart = juce::Time::getHighResolutionTicks();
+        std::unique_ptr<juce::AudioPluginInstance> instance = formatManager.createPluginInstance(description, settings.sampleRate,
+                                                                                                  maxBlockSize, error);
+        instantiate.add(createStart, juce::Time::getHighResolutionTicks());
+
+        if (instance == nullptr)
+        {
+            std::cerr << "can't create an instance: " << error << std::endl;
+            failed = true;
+            break;
+        }
+
+        instance->enableAllBuses();
+        instance->setPlayHead(&playHead);
+
+        for (int i = 0; i < settings.blockSizes.size(); i++)
+        {
+            const int blockSize = settings.blockSizes[i];
+
+            const juce::int64 prepareStart = juce::Time::getHighResolutionTicks();
+            instance->prepareToPlay(settings.sampleRate, blockSize);
+            prepare.add(prepareStart, juce::Time::getHighResolutionTicks());
+
+            /* the audio itself once, a lifecycle timing wants the runs, processing doesn't */
+            if (run == 0)
+            {
+                AudioThread audio(*instance, playHead, blockSize, (juce::int64) (settings.seconds * settings.sampleRate / blockSize));
+                const double budget = blockSize / settings.sampleRate * 1e6;
+
+                Hooks::setScenario(scenarios[(size_t) i].c_str());
+
+                audio.startThread();
+
+                while (audio.isThreadRunning())
+                    pump(10);
+
+                Bench::printRow(juce::String(blockSize) + " samples", audio.timings, budget);
+
+                juce::var row = audio.timings.toVar(budget);
+                row.getDynamicObject()->setProperty("blockSize", blockSize);
+                row.getDynamicObject()->setProperty("nonFinite", audio.nonFinite);
+                processing.add(row);
+
+                nonFinite += audio.nonFinite;
+            }
+
+            if (i < settings.blockSizes.size() - 1) instance->releaseResources();
+        }
+
+        /* a state that isn't all defaults, then scrambled, so the restore has something to put back */
+        randomiseParameters(*instance, random);
+        pump(20);
+
+        const juce::int64 getStart = juce::Time::getHighResolutionTicks();
+        instance->getStateInformation(saved);
+        getState.add(getStart, juce::Time::getHighResolutionTicks());
+
+        randomiseParameters(*instance, random);
+        pump(20);
+
+        const juce::int64 setStart = juce::Time::getHighResolutionTicks();
+        instance->setStateInformation(saved.getData(), (int) saved.getSize());
+        setState.add(setStart, juce::Time::getHighResolutionTicks());
+
+        pump(20);
+        instance->getStateInformation(restored);
+
+        stateRoundTrips = stateRoundTrips && restored == saved;
+
+        const juce::int64 releaseStart = juce::Time::getHighResolutionTicks();
+        instance->releaseResources();
+        release.add(releaseStart, juce::Time::getHighResolutionTicks());
+
+        const juce::int64 destroyStart = juce::Time::getHighResolutionTicks();
+        instance.reset();
+        destroy.add(destroyStart, juce::Time::getHighResolutionTicks());
+
+        pump(20);
+    }
+
+    std::cout << std::endl << "lifecycle, " << settings.runs << " runs" << std::endl
+              << "  " << juce::String().paddedRight(' ', 36) << juce::String("median ms").paddedLeft(' ', 10)
+              << juce::String("worst ms").paddedLeft(' ', 10) << std::endl;
+
+    printPhase("createPluginInstance", instantiate);
+    printPhase("prepareToPlay", prepare);
+    printPhase("getStateInformation", getState);
+    printPhase("setStateInformation", setState);
+    printPhase("releaseResources", release);
+    printPhase("delete", destroy);
+
+    const juce::var sites = describeSites();
+
+    for (const juce::var& site : *sites.getArray())
+    {
+        std::cout << std::endl << site["kind"].toString() << " x" << site["count"].toString() << " at " << site["blockSize"].toString()
+                  << " samples" << std::endl;
+
+        for (const juce::var& frame : *site["stack"].getArray())
+            std::cout << "    " << frame.toString() << std::endl;
+    }
+
+    std::cout << std::endl << Hooks::getNumSites() << " call sites on the audio thread"
+              << (Hooks::catchesMallocAndLocks() ? "" : " (this program's new and delete only, the plugin's aren't seen)") << std::endl
+              << "state " << (stateRoundTrips ? "round trips" : "comes back different") << ", " << nonFinite << " non-finite samples" << std::endl;
+
+    if (args.containsOption("--json"))
+    {
+        juce::DynamicObject::Ptr report = new juce::DynamicObject();
+        juce::DynamicObject::Ptr lifecycle = new juce::DynamicObject();
+
+        lifecycle->setProperty("createPluginInstance", phaseToVar(instantiate));
+        lifecycle->setProperty("prepareToPlay", phaseToVar(prepare));
+        lifecycle->setProperty("getStateInformation", phaseToVar(getState));
+        lifecycle->setProperty("setStateInformation", phaseToVar(setState));
+        lifecycle->setProperty("releaseResources", phaseToVar(release));
+        lifecycle->setProperty("delete", phaseToVar(destroy));
+
+        report->setProperty("plugin", bundle.getFullPathName());
+        report->setProperty("name", description.name);
+        report->setProperty("version", description.version);
+        report->setProperty("bundleBytes", getBundleSize(bundle));
+        report->setProperty("sampleRate", settings.sampleRate);
+        report->setProperty("seconds", settings.seconds);
+        report->setProperty("runs", settings.runs);
+        report->setProperty("loaded", !failed);
+        report->setProperty("scanMicros", scanMicros);
+        report->setProperty("lifecycle", juce::var(lifecycle.get()));
+        report->setProperty("processing", processing);
+        report->setProperty("stateRoundTrips", stateRoundTrips);
+        report->setProperty("nonFinite", nonFinite);
+        report->setProperty("catchesPluginAllocations", Hooks::catchesMallocAndLocks());
+        report->setProperty("sites", sites);
+        report->setProperty("dropped", Hooks::getNumDropped());
+
+        const juce::File file = args.getFileForOption("--json");
+
+        if (!file.replaceWithText(juce::JSON::toString(juce::var(report.get()))))
+        {
+            std::cerr << "can't write " << file.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    return failed || !stateRoundTrips || nonFinite > 0 || Hooks::getNumSites() > 0 ? 1 : 0;
+}
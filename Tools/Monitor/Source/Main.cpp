@@ -0,0 +1,407 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 19 Oct 2026 10:05:22pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/Telemetry.h"
+
+/*
+ * live view of every SubDominant instance running on this machine, read straight from the telemetry
+ * segments the host processes map (Source/Telemetry.h), nothing goes over the network. instances are
+ * listed most expensive first, with how much of their time goes into blocks of silence, and a total
+ * per host process underneath
+ *
+ *   Monitor [--interval=ms] [--top=N] [--once]
+ */
+namespace
+{
+    typedef struct Reading_t
+    {
+    public:
+
+        uint32_t status = 0, generation = 0, quality = 0, idle = 0;
+        juce::String name;
+
+        double sampleRate = 0.0;
+        int blockSize = 0;
+
+        juce::uint64 blocks = 0, samples = 0, cpuNanos = 0, maxNanos = 0, overruns = 0, idleBlocks = 0, idleNanos = 0;
+        juce::int64 lastBlockTicks = 0;
+
+    } Reading_t;
+
+    /* one instance over the last interval */
+    typedef struct Row_t
+    {
+    public:
+
+        juce::int64 processId = 0;
+        int slot = 0;
+        Reading_t now;
+
+        double cpuPercent = 0.0, idleCpuPercent = 0.0, avgMicros = 0.0, idlePercent = 0.0;
+        juce::uint64 overruns = 0;
+        juce::String state;
+
+    } Row_t;
+
+    class Segment
+    {
+    public:
+        Segment(const juce::File& segmentFile) : file(segmentFile)
+        {
+            mapping = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly, false);
+
+            if (mapping->getData() == nullptr || mapping->getSize() < TelemetryFormat::segmentSize) return;
+
+            const TelemetryFormat::Header_t* h = static_cast<const TelemetryFormat::Header_t*>(mapping->getData());
+
+            if (std::memcmp(h->magic, TelemetryFormat::magic, sizeof(h->magic)) != 0 || h->version != TelemetryFormat::version
+                || h->slotSize != sizeof(TelemetryFormat::Slot_t) || h->numSlots != (uint32_t) TelemetryFormat::maxSlots)
+                return;
+
+            header = h;
+            processId = h->processId;
+            host = juce::String::fromUTF8(h->host, (int) strnlen(h->host, sizeof(h->host)));
+        }
+
+        bool isValid() const { return header != nullptr; }
+
+        /* the owning process holds the lock for as long as the segment is alive, if we get it the owner is gone */
+        bool isOrphaned() const
+        {
+            juce::InterProcessLock lock(TelemetryFormat::getLockName(processId));
+
+            if (!lock.enter(0)) return false;
+
+            lock.exit();
+            return true;
+        }
+
+        int getNumSlots() const { return (int) juce::jmin(header->slotsUsed.load(), (uint32_t) TelemetryFormat::maxSlots); }
+
+        bool read(const int index, Reading_t& r) const
+        {
+            const TelemetryFormat::Slot_t* slot = TelemetryFormat::getSlots(const_cast<void*>(mapping->getData())) + index;
+
+            r.status = slot->status.load(std::memory_order_acquire);
+
+            if (r.status == TelemetryFormat::unused) return false;
+
+            r.generation = slot->generation.load(std::memory_order_relaxed);
+            r.quality = slot->quality.load(std::memory_order_relaxed);
+            r.idle = slot->idle.load(std::memory_order_relaxed);
+            r.sampleRate = slot->sampleRate.load(std::memory_order_relaxed);
+            r.blockSize = slot->blockSize.load(std::memory_order_relaxed);
+            r.blocks = slot->blocks.load(std::memory_order_relaxed);
+            r.samples = slot->samples.load(std::memory_order_relaxed);
+            r.cpuNanos = slot->cpuNanos.load(std::memory_order_relaxed);
+            r.maxNanos = slot->maxNanos.load(std::memory_order_relaxed);
+            r.overruns = slot->overruns.load(std::memory_order_relaxed);
+            r.idleBlocks = slot->idleBlocks.load(std::memory_order_relaxed);
+            r.idleNanos = slot->idleNanos.load(std::memory_order_relaxed);
+            r.lastBlockTicks = slot->lastBlockTicks.load(std::memory_order_relaxed);
+
+            /* the name can be mid rewrite, try again until it holds still */
+            for (int attempt = 0; attempt < 8; attempt++)
+            {
+                const uint32_t before = slot->nameVersion.load(std::memory_order_acquire);
+                char name[sizeof(slot->name)];
+
+                std::memcpy(name, slot->name, sizeof(name));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if ((before & 1) == 0 && slot->nameVersion.load(std::memory_order_relaxed) == before)
+                {
+                    r.name = juce::String::fromUTF8(name, (int) strnlen(name, sizeof(name)));
+                    break;
+                }
+            }
+
+            return true;
+        }
+
+        juce::File file;
+        juce::int64 processId = 0;
+        juce::String host;
+
+    private:
+        std::unique_ptr<juce::MemoryMappedFile> mapping;
+        const TelemetryFormat::Header_t* header = nullptr;
+    };
+
+    juce::String describeQuality(const uint32_t quality)
+    {
+        const int stages = (int) (quality & TelemetryFormat::stagesMask);
+        const int bands = (int) ((quality & TelemetryFormat::bandsMask) >> TelemetryFormat::bandsShift);
+
+        juce::String text = stages > 0 ? "/" + juce::String(1 << stages) : "full";
+
+        if (bands > 1) text << " " << bands << "B";
+        if (quality & TelemetryFormat::portableFlag) text << " det";
+        if (quality & TelemetryFormat::cabFlag) text << " cab";
+        if (quality & TelemetryFormat::lookaheadFlag) text << " la";
+
+        return text;
+    }
+
+    juce::String column(const juce::String& text, const int width, const bool right = false)
+    {
+        const juce::String clipped = text.substring(0, width);
+
+        return right ? clipped.paddedLeft(' ', width) : clipped.paddedRight(' ', width);
+    }
+
+    juce::String percent(const double value)
+    {
+        return juce::String(value, 1) + "%";
+    }
+
+    class Monitor
+    {
+    public:
+        /* picks up segments of processes that started since the last look, and drops the ones that ended */
+        void scan()
+        {
+            const juce::File folder = TelemetryFormat::getSegmentFolder();
+
+            /* a host can't delete its file on exit while we have it mapped on windows, the lock tells us it's gone anyway */
+            for (int i = segments.size(); --i >= 0;)
+            {
+                if (segments[i]->file.existsAsFile() && !segments[i]->isOrphaned()) continue;
+
+                const juce::File file = segments[i]->file;
+
+                segments.remove(i);
+                file.deleteFile();
+            }
+
+            for (const juce::File& file : folder.findChildFiles(juce::File::findFiles, false, "*.sdtm"))
+            {
+                bool known = false;
+
+                for (const Segment* segment : segments)
+                    known = known || segment->file == file;
+
+                if (known) continue;
+
+                std::unique_ptr<Segment> segment = std::make_unique<Segment>(file);
+
+                if (!segment->isValid()) continue;
+
+                /* left behind by a host that crashed */
+                if (segment->isOrphaned())
+                {
+                    segment.reset();
+                    file.deleteFile();
+                    continue;
+                }
+
+                segments.add(segment.release());
+            }
+        }
+
+        void sample()
+        {
+            const juce::int64 nowTicks = juce::Time::getHighResolutionTicks();
+            const double elapsedNanos = lastTicks > 0 ? juce::Time::highResolutionTicksToSeconds(nowTicks - lastTicks) * 1.0e9 : 0.0;
+
+            std::map<std::pair<juce::int64, int>, Reading_t> readings;
+            rows.clear();
+
+            for (const Segment* segment : segments)
+            {
+                for (int i = 0; i < segment->getNumSlots(); i++)
+                {
+                    Row_t row;
+
+                    if (!segment->read(i, row.now)) continue;
+
+                    row.processId = segment->processId;
+                    row.slot = i;
+
+                    /* a slot handed to a new instance since the last look starts again from nothing */
+                    Reading_t before;
+                    const auto previous = last.find({ row.processId, i });
+
+                    if (previous != last.end() && previous->second.generation == row.now.generation)
+                        before = previous->second;
+
+                    const double cpu = (double) (row.now.cpuNanos - before.cpuNanos);
+                    const double blocks = (double) (row.now.blocks - before.blocks);
+
+                    if (elapsedNanos > 0.0)
+                    {
+                        row.cpuPercent = cpu / elapsedNanos * 100.0;
+                        row.idleCpuPercent = (double) (row.now.idleNanos - before.idleNanos) / elapsedNanos * 100.0;
+                    }
+
+                    row.avgMicros = blocks > 0.0 ? cpu / blocks * 0.001 : 0.0;
+                    row.idlePercent = blocks > 0.0 ? (double) (row.now.idleBlocks - before.idleBlocks) / blocks * 100.0 : 0.0;
+                    row.overruns = row.now.overruns - before.overruns;
+                    row.state = describeState(row.now, nowTicks);
+
+                    readings[{ row.processId, i }] = row.now;
+                    rows.push_back(row);
+                }
+            }
+
+            std::sort(rows.begin(), rows.end(), [](const Row_t& a, const Row_t& b) { return a.cpuPercent > b.cpuPercent; });
+
+            last = std::move(readings);
+            lastTicks = nowTicks;
+        }
+
+        void print(const int top) const
+        {
+            std::cout << column("PID", 8) << column("HOST", 14) << column("SLOT", 5) << column("TRACK", 20)
+                      << column("RATE", 7, true) << "  " << column("QUALITY", 16) << column("CPU", 7, true)
+                      << column("AVG us", 9, true) << column("MAX us", 9, true) << column("LATE", 9, true)
+                      << column("IDLE", 8, true) << "  " << "STATE" << std::endl;
+
+            for (int i = 0; i < juce::jmin(top, (int) rows.size()); i++)
+            {
+                const Row_t& row = rows[(size_t) i];
+
+                std::cout << column(juce::String(row.processId), 8) << column(getHost(row.processId), 14)
+                          << column(juce::String(row.slot), 5) << column(row.now.name.isEmpty() ? "-" : row.now.name, 20)
+                          << column(row.now.sampleRate > 0.0 ? juce::String(row.now.sampleRate * 0.001, 1) + "k" : "-", 7, true)
+                          << "  " << column(describeQuality(row.now.quality), 16) << column(percent(row.cpuPercent), 7, true)
+                          << column(juce::String(row.avgMicros, 1), 9, true)
+                          << column(juce::String((double) row.now.maxNanos * 0.001, 1), 9, true)
+                          << column(juce::String((juce::int64) row.overruns) + "/" + juce::String((juce::int64) row.now.overruns), 9, true)
+                          << column(percent(row.idlePercent), 8, true) << "  " << row.state << std::endl;
+            }
+
+            if ((int) rows.size() > top)
+                std::cout << "... " << (int) rows.size() - top << " more" << std::endl;
+
+            /*
+             * per process, and for everything: CPU is processBlock() time against wall time over the interval,
+             * so 100% is one core. "on silence" is the part of it spent rendering silence into silence
+             */
+            std::cout << std::endl << column("PID", 8) << column("HOST", 14) << column("INSTANCES", 11, true)
+                      << column("CPU", 9, true) << column("ON SILENCE", 12, true) << column("ASLEEP", 8, true)
+                      << column("LATE", 8, true) << std::endl;
+
+            double totalCpu = 0.0, totalIdle = 0.0;
+            int totalInstances = 0, totalAsleep = 0;
+            juce::uint64 totalLate = 0;
+
+            for (const Segment* segment : segments)
+            {
+                double cpu = 0.0, idle = 0.0;
+                int instances = 0, asleep = 0;
+                juce::uint64 late = 0;
+
+                for (const Row_t& row : rows)
+                {
+                    if (row.processId != segment->processId) continue;
+
+                    instances++;
+                    cpu += row.cpuPercent;
+                    idle += row.idleCpuPercent;
+                    late += row.overruns;
+                    asleep += row.state == "asleep" ? 1 : 0;
+                }
+
+                std::cout << column(juce::String(segment->processId), 8) << column(segment->host, 14)
+                          << column(juce::String(instances), 11, true) << column(percent(cpu), 9, true)
+                          << column(percent(idle), 12, true) << column(juce::String(asleep), 8, true)
+                          << column(juce::String((juce::int64) late), 8, true) << std::endl;
+
+                totalCpu += cpu;
+                totalIdle += idle;
+                totalInstances += instances;
+                totalAsleep += asleep;
+                totalLate += late;
+            }
+
+            std::cout << column("all", 22) << column(juce::String(totalInstances), 11, true) << column(percent(totalCpu), 9, true)
+                      << column(percent(totalIdle), 12, true) << column(juce::String(totalAsleep), 8, true)
+                      << column(juce::String((juce::int64) totalLate), 8, true) << std::endl;
+        }
+
+    private:
+        juce::String getHost(const juce::int64 processId) const
+        {
+            for (const Segment* segment : segments)
+                if (segment->processId == processId) return segment->host;
+
+            return {};
+        }
+
+        /* asleep: prepared, but the host hasn't asked for a block in a while (hosts that suspend plugins on silence) */
+        static juce::String describeState(const Reading_t& r, const juce::int64 nowTicks)
+        {
+            switch (r.status)
+            {
+                case TelemetryFormat::created: return "new";
+                case TelemetryFormat::released: return "released";
+                default: break;
+            }
+
+            const double blockSeconds = r.sampleRate > 0.0 ? r.blockSize / r.sampleRate : 0.0;
+            const double sinceLast = juce::Time::highResolutionTicksToSeconds(nowTicks - r.lastBlockTicks);
+
+            if (r.lastBlockTicks == 0 || sinceLast > juce::jmax(0.25, blockSeconds * 8.0)) return "asleep";
+
+            return r.idle != 0 ? "idle" : "running";
+        }
+
+        juce::OwnedArray<Segment> segments;
+        std::vector<Row_t> rows;
+
+        std::map<std::pair<juce::int64, int>, Reading_t> last;
+        juce::int64 lastTicks = 0;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::cout << "usage: Monitor [--interval=ms] [--top=N] [--once]" << std::endl;
+        return 0;
+    }
+
+    const juce::String intervalOption = args.getValueForOption("--interval");
+    const juce::String topOption = args.getValueForOption("--top");
+
+    const int interval = intervalOption.isEmpty() ? 1000 : juce::jmax(100, intervalOption.getIntValue());
+    const int top = topOption.isEmpty() ? 40 : juce::jmax(1, topOption.getIntValue());
+    const bool once = args.containsOption("--once");
+
+    Monitor monitor;
+
+    /* the first read only sets the baseline, every figure is a difference between two */
+    monitor.scan();
+    monitor.sample();
+
+    for (;;)
+    {
+        juce::Thread::sleep(interval);
+
+        monitor.scan();
+        monitor.sample();
+
+        if (!once) std::cout << "\x1b[H\x1b[2J";
+
+        std::cout << "SubDominant instances, " << juce::String(interval) << "ms  (" << TelemetryFormat::getSegmentFolder().getFullPathName()
+                  << ")" << std::endl << std::endl;
+
+        monitor.print(top);
+
+        if (once) return 0;
+
+        std::cout << std::flush;
+    }
+}
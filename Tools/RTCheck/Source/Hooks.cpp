@@ -0,0 +1,457 @@
+/*
+  ==============================================================================
+
+    Hooks.cpp
+    Created: 20 Oct 2026 5:02:18pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+/* glibc's fortified open() and read() are inline wrappers in its headers, they'd clash with the interposers below */
+#undef _FORTIFY_SOURCE
+
+#include "Hooks.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__) || defined(__APPLE__)
+ #include <cxxabi.h>
+ #include <execinfo.h>
+#elif defined(_WIN32)
+ #include <windows.h>
+#endif
+
+#if defined(__linux__)
+ #include <cerrno>
+ #include <cstdarg>
+ #include <dlfcn.h>
+ #include <fcntl.h>
+ #include <pthread.h>
+ #include <semaphore.h>
+ #include <time.h>
+ #include <unistd.h>
+#endif
+
+namespace
+{
+    /* constant initialised, so they're safe to read from the allocator before main() */
+    thread_local bool armed = false;
+    thread_local bool recording = false;
+
+    std::atomic_flag tableLock = ATOMIC_FLAG_INIT;
+    std::atomic<const char*> scenario { "" };
+
+    Hooks::Site_t sites[Hooks::maxSites];
+    int numSites = 0;
+    long long numDropped = 0;
+
+    int captureStack(void** frames)
+    {
+       #if defined(__linux__) || defined(__APPLE__)
+        return backtrace(frames, Hooks::maxFrames);
+       #elif defined(_WIN32)
+        return (int) CaptureStackBackTrace(0, (DWORD) Hooks::maxFrames, frames, nullptr);
+       #else
+        return 0;
+       #endif
+    }
+
+    void record(const Hooks::Kind kind)
+    {
+        /* the unwinder and the table lock can end up back in here, only the outermost call counts */
+        if (!armed || recording) return;
+
+        recording = true;
+
+        void* frames[Hooks::maxFrames];
+        const int numFrames = captureStack(frames);
+        const char* const current = scenario.load();
+
+        while (tableLock.test_and_set(std::memory_order_acquire)) {}
+
+        int i = 0;
+
+        while (i < numSites && !(sites[i].kind == kind && sites[i].scenario == current && sites[i].numFrames == numFrames
+                                 && std::memcmp(sites[i].frames, frames, sizeof(void*) * (size_t) numFrames) == 0))
+            i++;
+
+        if (i < numSites)
+        {
+            sites[i].count++;
+        }
+        else if (numSites < Hooks::maxSites)
+        {
+            Hooks::Site_t& site = sites[numSites++];
+
+            site.kind = kind;
+            site.scenario = current;
+            site.count = 1;
+            site.numFrames = numFrames;
+            std::memcpy(site.frames, frames, sizeof(void*) * (size_t) numFrames);
+        }
+        else
+        {
+            numDropped++;
+        }
+
+        tableLock.clear(std::memory_order_release);
+
+        recording = false;
+    }
+
+    /* the unwinder loads and allocates the first time it runs, get that over with before anyone arms */
+    const int warmUp = []
+    {
+        void* frames[Hooks::maxFrames];
+        return captureStack(frames);
+    }();
+}
+
+void Hooks::arm() { armed = true; }
+void Hooks::disarm() { armed = false; }
+
+void Hooks::setScenario(const char* name) { scenario.store(name); }
+
+int Hooks::getNumSites() { return numSites; }
+const Hooks::Site_t& Hooks::getSite(const int index) { return sites[index]; }
+long long Hooks::getNumDropped() { return numDropped; }
+
+std::vector<std::string> Hooks::describe(const Site_t& site)
+{
+    std::vector<std::string> lines;
+
+   #if defined(__linux__) || defined(__APPLE__)
+    char** symbols = backtrace_symbols(site.frames, site.numFrames);
+
+    for (int i = 0; i < site.numFrames; i++)
+    {
+        std::string line = symbols != nullptr ? symbols[i] : "?";
+
+        /* "binary(_ZN...+0x1c) [0x...]" on Linux, "3 binary 0x... _ZN... + 28" on macOS */
+        const size_t start = line.find("_Z");
+        const size_t end = start == std::string::npos ? start : line.find_first_of("+ )", start);
+
+        if (start != std::string::npos)
+        {
+            int status = 0;
+            char* name = abi::__cxa_demangle(line.substr(start, end - start).c_str(), nullptr, nullptr, &status);
+
+            if (status == 0 && name != nullptr) line = line.substr(0, start) + name + line.substr(end);
+
+            std::free(name);
+        }
+
+        lines.push_back(line);
+    }
+
+    std::free(symbols);
+   #else
+    for (int i = 0; i < site.numFrames; i++)
+    {
+        char address[32];
+        std::snprintf(address, sizeof(address), "%p", site.frames[i]);
+        lines.push_back(address);
+    }
+   #endif
+
+    return lines;
+}
+
+const char* Hooks::getKindName(const Kind kind)
+{
+    static const char* const names[numKinds] = { "allocation", "free", "lock", "blocking" };
+
+    return names[kind];
+}
+
+bool Hooks::catchesMallocAndLocks()
+{
+   #if defined(__linux__)
+    return true;
+   #else
+    return false;
+   #endif
+}
+
+#if defined(__linux__)
+
+namespace
+{
+    /*
+     * where the interposed pthread, sleep and I/O calls go on to, libc's own definitions. looked up
+     * here, before main(), because dlsym() allocates: looked up on first use, the first call on an
+     * armed thread would report an allocation of RTCheck's own
+     */
+    enum Forward
+    {
+        mutexLock = 0,
+        mutexTrylock,
+        mutexTimedlock,
+        rwlockRdlock,
+        rwlockWrlock,
+        rwlockTryrdlock,
+        rwlockTrywrlock,
+        rwlockTimedrdlock,
+        rwlockTimedwrlock,
+        condWait,
+        condTimedwait,
+        semWait,
+        semTimedwait,
+        nanoSleep,
+        clockNanosleep,
+        uSleep,
+        fileRead,
+        fileWrite,
+        fileOpen,
+        numForwards
+    };
+
+    const char* const forwardNames[numForwards] =
+    {
+        "pthread_mutex_lock", "pthread_mutex_trylock", "pthread_mutex_timedlock",
+        "pthread_rwlock_rdlock", "pthread_rwlock_wrlock", "pthread_rwlock_tryrdlock", "pthread_rwlock_trywrlock",
+        "pthread_rwlock_timedrdlock", "pthread_rwlock_timedwrlock",
+        "pthread_cond_wait", "pthread_cond_timedwait", "sem_wait", "sem_timedwait",
+        "nanosleep", "clock_nanosleep", "usleep", "read", "write", "open"
+    };
+
+    std::atomic<void*> forwards[numForwards];
+
+    /* another static initialiser can get here before the table's filled in, that one looks it up itself */
+    template <typename Function>
+    Function forward(const Forward f)
+    {
+        void* next = forwards[f].load(std::memory_order_relaxed);
+
+        if (next == nullptr)
+        {
+            next = dlsym(RTLD_NEXT, forwardNames[f]);
+            forwards[f].store(next, std::memory_order_relaxed);
+        }
+
+        return (Function) next;
+    }
+
+    const bool forwardsFound = []
+    {
+        for (int f = 0; f < numForwards; f++)
+            forward<void*>((Forward) f);
+
+        return true;
+    }();
+}
+
+/*
+ * glibc keeps its allocator under these names as well, forwarding to them needs no dlsym() (which
+ * allocates itself). operator new and delete end up here through libstdc++, they aren't replaced
+ */
+extern "C"
+{
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+    void* __libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void* ptr);
+
+    void* malloc(size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        return __libc_realloc(ptr, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        return __libc_memalign(alignment, size);
+    }
+
+    void* memalign(size_t alignment, size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** ptr, size_t alignment, size_t size) noexcept
+    {
+        record(Hooks::allocation);
+        *ptr = __libc_memalign(alignment, size);
+        return *ptr != nullptr ? 0 : ENOMEM;
+    }
+
+    void free(void* ptr) noexcept
+    {
+        if (ptr != nullptr) record(Hooks::release);
+        __libc_free(ptr);
+    }
+
+    /* juce::CriticalSection, juce::WaitableEvent, std::mutex, anything that locks through pthreads */
+    int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_mutex_t*)>(mutexLock)(mutex);
+    }
+
+    /* a try can't block, but it still means sharing a lock with a thread that can hold it for as long as it likes */
+    int pthread_mutex_trylock(pthread_mutex_t* mutex) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_mutex_t*)>(mutexTrylock)(mutex);
+    }
+
+    int pthread_mutex_timedlock(pthread_mutex_t* mutex, const struct timespec* timeout) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_mutex_t*, const struct timespec*)>(mutexTimedlock)(mutex, timeout);
+    }
+
+    /* std::shared_mutex, juce::ReadWriteLock's pthread side */
+    int pthread_rwlock_rdlock(pthread_rwlock_t* rwlock) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*)>(rwlockRdlock)(rwlock);
+    }
+
+    int pthread_rwlock_wrlock(pthread_rwlock_t* rwlock) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*)>(rwlockWrlock)(rwlock);
+    }
+
+    int pthread_rwlock_tryrdlock(pthread_rwlock_t* rwlock) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*)>(rwlockTryrdlock)(rwlock);
+    }
+
+    int pthread_rwlock_trywrlock(pthread_rwlock_t* rwlock) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*)>(rwlockTrywrlock)(rwlock);
+    }
+
+    int pthread_rwlock_timedrdlock(pthread_rwlock_t* rwlock, const struct timespec* timeout) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*, const struct timespec*)>(rwlockTimedrdlock)(rwlock, timeout);
+    }
+
+    int pthread_rwlock_timedwrlock(pthread_rwlock_t* rwlock, const struct timespec* timeout) noexcept
+    {
+        record(Hooks::lock);
+        return forward<int (*)(pthread_rwlock_t*, const struct timespec*)>(rwlockTimedwrlock)(rwlock, timeout);
+    }
+
+    /* std::condition_variable, juce::WaitableEvent::wait() */
+    int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(pthread_cond_t*, pthread_mutex_t*)>(condWait)(cond, mutex);
+    }
+
+    int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex, const struct timespec* timeout)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(pthread_cond_t*, pthread_mutex_t*, const struct timespec*)>(condTimedwait)(cond, mutex, timeout);
+    }
+
+    int sem_wait(sem_t* sem)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(sem_t*)>(semWait)(sem);
+    }
+
+    int sem_timedwait(sem_t* sem, const struct timespec* timeout)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(sem_t*, const struct timespec*)>(semTimedwait)(sem, timeout);
+    }
+
+    /* juce::Thread::sleep(), std::this_thread::sleep_for() and sleep_until() */
+    int nanosleep(const struct timespec* duration, struct timespec* remaining)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(const struct timespec*, struct timespec*)>(nanoSleep)(duration, remaining);
+    }
+
+    int clock_nanosleep(clockid_t clock, int flags, const struct timespec* duration, struct timespec* remaining)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(clockid_t, int, const struct timespec*, struct timespec*)>(clockNanosleep)(clock, flags, duration, remaining);
+    }
+
+    int usleep(useconds_t micros)
+    {
+        record(Hooks::blocking);
+        return forward<int (*)(useconds_t)>(uSleep)(micros);
+    }
+
+    /* file and pipe I/O, the capture file and the console included */
+    ssize_t read(int fd, void* buffer, size_t size)
+    {
+        record(Hooks::blocking);
+        return forward<ssize_t (*)(int, void*, size_t)>(fileRead)(fd, buffer, size);
+    }
+
+    ssize_t write(int fd, const void* buffer, size_t size)
+    {
+        record(Hooks::blocking);
+        return forward<ssize_t (*)(int, const void*, size_t)>(fileWrite)(fd, buffer, size);
+    }
+
+    int open(const char* path, int flags, ...)
+    {
+        mode_t mode = 0;
+
+        if ((flags & O_CREAT) != 0 || (flags & O_TMPFILE) == O_TMPFILE)
+        {
+            va_list args;
+            va_start(args, flags);
+            mode = (mode_t) va_arg(args, int);
+            va_end(args);
+        }
+
+        record(Hooks::blocking);
+        return forward<int (*)(const char*, int, ...)>(fileOpen)(path, flags, mode);
+    }
+}
+
+#else
+
+void* operator new(std::size_t size)
+{
+    record(Hooks::allocation);
+
+    if (void* ptr = std::malloc(size > 0 ? size : 1)) return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr) record(Hooks::release);
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+#endif
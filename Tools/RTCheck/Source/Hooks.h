@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    Hooks.h
+    Created: 20 Oct 2026 5:02:18pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*
+ * what RTCheck catches the audio thread doing. on Linux these are interposed: the executable's
+ * definitions come before libc's, so no LD_PRELOAD is needed and whatever C code or system library
+ * the plugin calls into is caught too
+ *
+ *   allocation, free  malloc and its relatives, free
+ *   lock              pthread mutexes (lock, trylock, timedlock) and rwlocks, every variant
+ *   blocking          condition variable and semaphore waits, nanosleep, clock_nanosleep, usleep,
+ *                     read, write and open
+ *
+ * calls libc makes to itself don't go through the interposers, so fopen() or printf() are only
+ * caught by the allocations they make, and syscalls made directly (futex, the raw syscall())
+ * aren't caught at all. elsewhere only operator new and delete are replaced. nothing is recorded
+ * until a thread arms itself, and recording never allocates: call sites go into a fixed table,
+ * their stacks only get names after the run
+ *
+ * no JUCE in here, this file defines the allocator the rest of the program runs on
+ */
+namespace Hooks
+{
+    enum Kind
+    {
+        allocation = 0,
+        release,
+        lock,
+        blocking,
+        numKinds
+    };
+
+    static constexpr int maxFrames = 48;
+    static constexpr int maxSites = 512;
+
+    /* one distinct call stack, per kind and scenario, and how often the audio thread went through it */
+    typedef struct Site_t
+    {
+    public:
+
+        Kind kind;
+        const char* scenario;
+        long long count;
+
+        int numFrames;
+        void* frames[maxFrames];
+
+    } Site_t;
+
+    /* only the calling thread, and only until it disarms */
+    void arm();
+    void disarm();
+
+    /* stored with every site found from here on, a string literal: only the pointer is kept */
+    void setScenario(const char* name);
+
+    /* read these once the armed thread has stopped */
+    int getNumSites();
+    const Site_t& getSite(const int index);
+    long long getNumDropped();
+
+    /* one line per frame, demangled where the platform gives names. allocates, so never while armed */
+    std::vector<std::string> describe(const Site_t& site);
+
+    const char* getKindName(const Kind kind);
+
+    /* false where only operator new and delete are hooked, and no locks or blocking calls are caught */
+    bool catchesMallocAndLocks();
+}
@@ -0,0 +1,425 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 5:02:18pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+#include "Hooks.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * runs the processor on an audio thread of its own, paced like a real one, while the message thread
+ * does what hosts and users do to it, and reports every allocation, free, lock and blocking call the
+ * audio thread makes inside processBlock() and reset(), with the call stack it came from (Hooks.h)
+ *
+ *   RTCheck [scenario ...] [--seconds=N] [--rate=hz] [--block=N] [--cab=ir.wav] [--json=report.json]
+ *
+ *   automation   random automation and MIDI program changes from the audio thread, random block sizes
+ *   programs     program switches from the message thread
+ *   state        state saves and restores from the message thread, resets from the audio thread
+ *   editor       the editor opened, painted, scope on and off, and closed again
+ *   cab          IRs loaded and cleared (a generated one without --cab)
+ *
+ * only the plugin's side is armed: setting a parameter from automation is the host's call, the
+ * processor's reaction to it happens in processBlock(). exits 1 if anything was caught, or if the
+ * automation never got through to the values the processor runs on
+ */
+namespace
+{
+    typedef struct Settings_t
+    {
+    public:
+
+        double sampleRate = 48000.0;
+        int blockSize = 256;
+        double seconds = 3.0;
+
+    } Settings_t;
+
+    void pump(const int ms)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(ms);
+    }
+
+    /* a transport that's always rolling at 120bpm, so the LFO sync paths run too */
+    class RollingPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        juce::Optional<PositionInfo> getPosition() const override
+        {
+            PositionInfo info;
+
+            info.setBpm(120.0);
+            info.setIsPlaying(true);
+            info.setTimeInSamples(samples.load());
+            info.setPpqPosition((double) samples.load() / sampleRate * 2.0);
+
+            return info;
+        }
+
+        double sampleRate = 48000.0;
+        std::atomic<juce::int64> samples { 0 };
+    };
+
+    class AudioThread : public juce::Thread
+    {
+    public:
+        AudioThread(SubdominantAudioProcessor& processor, const Settings_t& checkSettings)
+            : juce::Thread("RTCheck audio"), plugin(processor), settings(checkSettings),
+              buffer(2, checkSettings.blockSize)
+        {
+            for (juce::AudioProcessorParameter* param : plugin.getParameters())
+                if (juce::RangedAudioParameter* ranged = dynamic_cast<juce::RangedAudioParameter*>(param))
+                    if (ranged->isAutomatable() && ranged->getParameterID() != "SESSION CAPTURE")
+                        automatable.add(ranged);
+
+            playHead.sampleRate = settings.sampleRate;
+            plugin.setPlayHead(&playHead);
+
+            midi.ensureSize(4096);
+        }
+
+        ~AudioThread() override
+        {
+            stopThread(-1);
+            plugin.setPlayHead(nullptr);
+        }
+
+        /* what the audio thread does on top of processing, set before the thread starts */
+        bool automate = false, resets = false;
+        juce::int64 numBlocks = 0;
+
+        /* blocks after which the processor was running on different parameter values than before */
+        juce::int64 numParamChanges = 0;
+
+        void run() override
+        {
+            juce::Random random(1);
+            const auto period = std::chrono::duration<double>(settings.blockSize / settings.sampleRate);
+            auto deadline = std::chrono::steady_clock::now();
+
+            float applied[Params::numParams];
+            std::copy(plugin.getAppliedParams(), plugin.getAppliedParams() + Params::numParams, applied);
+
+            while (!threadShouldExit())
+            {
+                const int numSamples = automate ? 1 + random.nextInt(settings.blockSize) : settings.blockSize;
+                juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), 2, numSamples);
+
+                fillInput(block, random);
+                midi.clear();
+
+                /*
+                 * the host's half of automation, outside the armed part: the new value and the listener
+                 * call that takes it into the APVTS, which is what the processor reads
+                 */
+                if (automate)
+                {
+                    for (int i = random.nextInt(4); i > 0; i--)
+                    {
+                        juce::RangedAudioParameter* param = automatable[random.nextInt(automatable.size())];
+                        const float value = random.nextFloat();
+
+                        param->setValue(value);
+                        param->sendValueChangedMessageToListeners(value);
+                    }
+
+                    if (random.nextInt(200) == 0)
+                        midi.addEvent(juce::MidiMessage::programChange(1, random.nextInt(plugin.getNumPrograms())), 0);
+                }
+
+                const bool reset = resets && random.nextInt(100) == 0;
+
+                Hooks::arm();
+
+                if (reset) plugin.reset();
+
+                plugin.processBlock(block, midi);
+
+                Hooks::disarm();
+
+                if (!std::equal(applied, applied + Params::numParams, plugin.getAppliedParams()))
+                {
+                    std::copy(plugin.getAppliedParams(), plugin.getAppliedParams() + Params::numParams, applied);
+                    numParamChanges++;
+                }
+
+                playHead.samples.fetch_add(numSamples);
+                numBlocks++;
+
+                /* real time pacing, so the message thread's work lands in the middle of the blocks */
+                deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period * ((double) numSamples / settings.blockSize));
+                std::this_thread::sleep_until(deadline);
+            }
+        }
+
+    private:
+        /* a tone bursting in and out of noise, so the gate, the counters and the filters all move */
+        void fillInput(juce::AudioBuffer<float>& block, juce::Random& random)
+        {
+            for (int i = 0; i < block.getNumSamples(); i++)
+            {
+                const float burst = (phase / 24000) % 2 == 0 ? 0.5f : 0.f;
+                const float x = burst * (float) std::sin(phase * 0.0143) + 0.001f * (random.nextFloat() - 0.5f);
+
+                block.setSample(0, i, x);
+                block.setSample(1, i, x);
+                phase++;
+            }
+        }
+
+        SubdominantAudioProcessor& plugin;
+        const Settings_t& settings;
+
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+        juce::Array<juce::RangedAudioParameter*> automatable;
+        RollingPlayHead playHead;
+        juce::int64 phase = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (AudioThread)
+    };
+
+    /* half a second of decaying noise, written once for the cab scenario */
+    juce::File writeImpulse(const double sampleRate)
+    {
+        const juce::File file = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("RTCheck-ir.wav");
+        juce::AudioBuffer<float> ir(2, (int) (sampleRate * 0.5));
+        juce::Random random(7);
+
+        for (int ch = 0; ch < 2; ch++)
+            for (int i = 0; i < ir.getNumSamples(); i++)
+                ir.setSample(ch, i, (random.nextFloat() * 2.f - 1.f) * (float) std::exp(-8.0 * i / ir.getNumSamples()));
+
+        file.deleteFile();
+
+        std::unique_ptr<juce::OutputStream> out(file.createOutputStream());
+        std::unique_ptr<juce::AudioFormatWriter> writer;
+
+        if (out != nullptr)
+            writer.reset(juce::WavAudioFormat().createWriterFor(out.get(), sampleRate, 2, 24, {}, 0));
+
+        if (writer == nullptr) return {};
+
+        out.release();
+        writer->writeFromAudioSampleBuffer(ir, 0, ir.getNumSamples());
+
+        return file;
+    }
+
+    juce::TextButton* findButton(juce::Component& parent, const juce::String& text)
+    {
+        for (juce::Component* child : parent.getChildren())
+            if (juce::TextButton* button = dynamic_cast<juce::TextButton*>(child))
+                if (button->getButtonText() == text) return button;
+
+        return nullptr;
+    }
+
+    /* the message thread's side of each scenario, until the time is up */
+    void runScenario(const juce::String& name, SubdominantAudioProcessor& plugin, const juce::File& impulse, const double seconds)
+    {
+        const juce::uint32 end = juce::Time::getMillisecondCounter() + (juce::uint32) (seconds * 1000.0);
+        juce::Random random(2);
+
+        while (juce::Time::getMillisecondCounter() < end)
+        {
+            if (name == "programs")
+            {
+                plugin.setCurrentProgram(random.nextInt(plugin.getNumPrograms()));
+                pump(40);
+            }
+            else if (name == "state")
+            {
+                juce::MemoryBlock state;
+
+                for (juce::AudioProcessorParameter* param : plugin.getParameters())
+                    if (param->isAutomatable() && random.nextBool()) param->setValueNotifyingHost(random.nextFloat());
+
+                plugin.getStateInformation(state);
+                plugin.setStateInformation(state.getData(), (int) state.getSize());
+                pump(25);
+            }
+            else if (name == "editor")
+            {
+                std::unique_ptr<juce::AudioProcessorEditor> editor(plugin.createEditorIfNeeded());
+
+                if (editor == nullptr) return;
+
+                juce::TextButton* scope = findButton(*editor, "SCOPE");
+
+                for (int i = 0; i < 8; i++)
+                {
+                    if (scope != nullptr && i % 4 == 1) scope->triggerClick();
+
+                    editor->createComponentSnapshot(editor->getLocalBounds());
+                    pump(30);
+                }
+
+                editor.reset();
+                pump(20);
+            }
+            else if (name == "cab")
+            {
+                if (impulse != juce::File()) plugin.loadCab(impulse);
+
+                pump(150);
+                plugin.clearCab();
+                pump(50);
+            }
+            else
+            {
+                pump(50);
+            }
+        }
+
+        /* loads still running finish before the audio thread stops, so their swap is checked too */
+        while (plugin.isCabLoading()) pump(10);
+
+        pump(50);
+    }
+
+    juce::var describeSites()
+    {
+        juce::Array<juce::var> sites;
+
+        for (int i = 0; i < Hooks::getNumSites(); i++)
+        {
+            const Hooks::Site_t& site = Hooks::getSite(i);
+            juce::DynamicObject::Ptr entry = new juce::DynamicObject();
+            juce::Array<juce::var> stack;
+
+            for (const std::string& frame : Hooks::describe(site))
+                stack.add(juce::String(frame));
+
+            entry->setProperty("kind", Hooks::getKindName(site.kind));
+            entry->setProperty("scenario", site.scenario);
+            entry->setProperty("count", site.count);
+            entry->setProperty("stack", stack);
+
+            sites.add(juce::var(entry.get()));
+        }
+
+        return sites;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI init;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::cout << "usage: RTCheck [scenario ...] [--seconds=N] [--rate=hz] [--block=N] [--cab=ir.wav] [--json=report.json]" << std::endl
+                  << "scenarios: automation programs state editor cab" << std::endl;
+        return 0;
+    }
+
+    /* kept for as long as the sites are: the table only stores the pointer */
+    static const char* const scenarios[] = { "automation", "programs", "state", "editor", "cab" };
+
+    Settings_t settings;
+
+    if (args.containsOption("--rate")) settings.sampleRate = juce::jlimit(22050.0, 384000.0, args.getValueForOption("--rate").getDoubleValue());
+    if (args.containsOption("--block")) settings.blockSize = juce::jlimit(1, 8192, args.getValueForOption("--block").getIntValue());
+    if (args.containsOption("--seconds")) settings.seconds = juce::jlimit(0.5, 3600.0, args.getValueForOption("--seconds").getDoubleValue());
+
+    juce::StringArray selected;
+
+    for (const juce::ArgumentList::Argument& arg : args.arguments)
+        if (!arg.isLongOption() && !arg.isShortOption())
+            selected.add(arg.text);
+
+    const juce::File impulse = args.containsOption("--cab") ? args.getFileForOption("--cab") : writeImpulse(settings.sampleRate);
+
+    std::unique_ptr<juce::AudioProcessor> processor(createPluginFilter());
+    SubdominantAudioProcessor& plugin = *dynamic_cast<SubdominantAudioProcessor*>(processor.get());
+
+    processor->setPlayConfigDetails(2, 2, settings.sampleRate, settings.blockSize);
+
+    juce::DynamicObject::Ptr report = new juce::DynamicObject();
+    juce::DynamicObject::Ptr blocks = new juce::DynamicObject();
+
+    report->setProperty("sampleRate", settings.sampleRate);
+    report->setProperty("blockSize", settings.blockSize);
+    report->setProperty("seconds", settings.seconds);
+    report->setProperty("catchesMallocAndLocks", Hooks::catchesMallocAndLocks());
+
+    bool automationMissed = false;
+
+    for (const char* scenario : scenarios)
+    {
+        if (!selected.isEmpty() && !selected.contains(scenario)) continue;
+
+        /* not real-time safe and not meant to be, nothing's armed yet */
+        processor->prepareToPlay(settings.sampleRate, settings.blockSize);
+
+        AudioThread audio(plugin, settings);
+
+        audio.automate = juce::String(scenario) == "automation";
+        audio.resets = juce::String(scenario) == "state";
+
+        Hooks::setScenario(scenario);
+
+        audio.startThread();
+        runScenario(scenario, plugin, impulse, settings.seconds);
+        audio.stopThread(-1);
+
+        std::cout << scenario << ": " << audio.numBlocks << " blocks" << std::endl;
+        blocks->setProperty(scenario, audio.numBlocks);
+
+        /* automation that never reached the render would leave the parameter paths unchecked and pass anyway */
+        if (audio.automate)
+        {
+            std::cout << "  parameters changed after " << audio.numParamChanges << " of them" << std::endl;
+            report->setProperty("automatedBlocks", audio.numParamChanges);
+
+            if (audio.numParamChanges == 0) automationMissed = true;
+        }
+
+        processor->releaseResources();
+    }
+
+    processor.reset();
+
+    const juce::var sites = describeSites();
+
+    report->setProperty("blocks", juce::var(blocks.get()));
+    report->setProperty("sites", sites);
+    report->setProperty("dropped", Hooks::getNumDropped());
+
+    for (const juce::var& site : *sites.getArray())
+    {
+        std::cout << std::endl << site["kind"].toString() << " x" << site["count"].toString() << " during " << site["scenario"].toString() << std::endl;
+
+        for (const juce::var& frame : *site["stack"].getArray())
+            std::cout << "    " << frame.toString() << std::endl;
+    }
+
+    std::cout << std::endl << Hooks::getNumSites() << " call sites on the audio thread" << (Hooks::catchesMallocAndLocks() ? "" : " (new and delete only, no locks or blocking calls)")
+              << std::endl;
+
+    if (args.containsOption("--json"))
+    {
+        const juce::File file = args.getFileForOption("--json");
+
+        if (!file.replaceWithText(juce::JSON::toString(juce::var(report.get()))))
+        {
+            std::cerr << "can't write " << file.getFullPathName() << std::endl;
+            return 1;
+        }
+    }
+
+    if (automationMissed)
+        std::cout << "automation never reached the processor's parameters" << std::endl;
+
+    return Hooks::getNumSites() > 0 || automationMissed ? 1 : 0;
+}
@@ -0,0 +1,439 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 19 Oct 2026 8:52:10pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * feeds a SESSION CAPTURE file back through a freshly prepared processor: same block sizes, same
+ * input, same parameter values, transport, MIDI, state restores, program switches and resets, in
+ * the same order. the processor is built from the plugin sources, so it runs under a profiler with
+ * full symbols, and --out renders the result for comparing two builds sample for sample
+ *
+ *   Replay <capture.sdcap> [--repeat=N] [--out=render.wav] [--spikes=N]
+ */
+namespace
+{
+    class ReplayPlayHead : public juce::AudioPlayHead
+    {
+    public:
+        juce::Optional<PositionInfo> getPosition() const override { return info; }
+
+        PositionInfo info;
+    };
+
+    typedef struct Capture_t
+    {
+    public:
+
+        double sampleRate = 0.0;
+        int blockSize = 0, numChannels = 0;
+
+        juce::StringArray parameterIds;
+        juce::MemoryBlock state;
+
+    } Capture_t;
+
+    typedef struct PassStats_t
+    {
+    public:
+
+        double sampleRate = 0.0;
+        juce::int64 numSamples = 0;
+        juce::uint64 numBlocks = 0, numDropped = 0;
+
+        /* per block, indexed by capture block index, < 0 where there's nothing */
+        std::vector<double> replayMs, sessionMs;
+
+    } PassStats_t;
+
+    template <typename T>
+    bool read(juce::InputStream& in, T& value)
+    {
+        return in.read(&value, (int) sizeof(T)) == (int) sizeof(T);
+    }
+
+    void pump(const int ms)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(ms);
+    }
+
+    bool readHeader(juce::InputStream& in, Capture_t& capture, juce::String& error)
+    {
+        char magic[4];
+        uint32_t version = 0;
+
+        if (in.read(magic, 4) != 4 || std::memcmp(magic, CaptureFormat::magic, 4) != 0)
+        {
+            error = "not a capture file";
+            return false;
+        }
+
+        if (!read(in, version) || version != CaptureFormat::version)
+        {
+            error = "capture format version " + juce::String(version) + ", this replay reads " + juce::String(CaptureFormat::version);
+            return false;
+        }
+
+        int numParameters = 0, stateSize = 0;
+
+        if (!read(in, capture.sampleRate) || !read(in, capture.blockSize) || !read(in, capture.numChannels) || !read(in, numParameters))
+        {
+            error = "truncated header";
+            return false;
+        }
+
+        for (int i = 0; i < numParameters; i++)
+        {
+            int length = 0;
+            juce::MemoryBlock id;
+
+            if (!read(in, length) || length < 0 || in.readIntoMemoryBlock(id, length) != (size_t) length)
+            {
+                error = "truncated parameter list";
+                return false;
+            }
+
+            capture.parameterIds.add(id.toString());
+        }
+
+        if (!read(in, stateSize) || stateSize < 0 || in.readIntoMemoryBlock(capture.state, stateSize) != (size_t) stateSize)
+        {
+            error = "truncated state";
+            return false;
+        }
+
+        return true;
+    }
+
+    /* a restored state brings SESSION CAPTURE back with it, the replay never records itself */
+    void restoreState(SubdominantAudioProcessor& processor, const void* data, const int size, juce::AudioProcessorParameter* captureParam)
+    {
+        processor.setStateInformation(data, size);
+
+        if (captureParam != nullptr) captureParam->setValueNotifyingHost(0.f);
+
+        pump(50);
+
+        /* the session had its IR in by the time it mattered, or it wouldn't be in the capture */
+        while (processor.isCabLoading())
+            pump(10);
+    }
+
+    bool replay(const juce::File& file, juce::AudioFormatWriter* writer, PassStats_t& stats, juce::String& error)
+    {
+        juce::FileInputStream fileStream(file);
+
+        if (!fileStream.openedOk())
+        {
+            error = "can't open " + file.getFullPathName();
+            return false;
+        }
+
+        juce::BufferedInputStream in(fileStream, 1 << 16);
+        Capture_t capture;
+
+        if (!readHeader(in, capture, error)) return false;
+
+        stats.sampleRate = capture.sampleRate;
+
+        std::unique_ptr<juce::AudioProcessor> plugin(createPluginFilter());
+        SubdominantAudioProcessor& processor = *static_cast<SubdominantAudioProcessor*>(plugin.get());
+
+        /* capture order to the processor's own parameters, matched by ID so a newer build can still play an older file */
+        std::vector<juce::AudioProcessorParameter*> params((size_t) capture.parameterIds.size(), nullptr);
+        juce::AudioProcessorParameter* captureParam = nullptr;
+
+        for (juce::AudioProcessorParameter* param : processor.getParameters())
+        {
+            const juce::RangedAudioParameter* ranged = dynamic_cast<juce::RangedAudioParameter*>(param);
+
+            if (ranged == nullptr) continue;
+
+            if (ranged->getParameterID() == "SESSION CAPTURE")
+            {
+                captureParam = param;
+                continue;
+            }
+
+            const int index = capture.parameterIds.indexOf(ranged->getParameterID());
+
+            if (index >= 0) params[(size_t) index] = param;
+        }
+
+        ReplayPlayHead playHead;
+
+        restoreState(processor, capture.state.getData(), (int) capture.state.getSize(), captureParam);
+
+        processor.setPlayConfigDetails(capture.numChannels, capture.numChannels, capture.sampleRate, capture.blockSize);
+        processor.setPlayHead(&playHead);
+        processor.prepareToPlay(capture.sampleRate, capture.blockSize);
+
+        while (processor.isCabLoading())
+            pump(10);
+
+        juce::AudioBuffer<float> buffer(juce::jmax(1, capture.numChannels), juce::jmax(1, capture.blockSize));
+        juce::MidiBuffer midi;
+        juce::MemoryBlock payload;
+
+        uint32_t type = 0, size = 0;
+
+        while (read(in, type) && read(in, size))
+        {
+            /* readIntoMemoryBlock() appends */
+            payload.reset();
+
+            if (in.readIntoMemoryBlock(payload, (ssize_t) size) != (size_t) size)
+            {
+                error = "capture ends in the middle of a record, replayed up to there";
+                break;
+            }
+
+            juce::MemoryInputStream record(payload, false);
+            juce::uint64 index = 0;
+
+            read(record, index);
+
+            if (type == CaptureFormat::state)
+            {
+                restoreState(processor, static_cast<const char*>(payload.getData()) + sizeof(index),
+                             (int) (size - sizeof(index)), captureParam);
+            }
+            else if (type == CaptureFormat::program)
+            {
+                juce::int32 program = 0;
+
+                read(record, program);
+                processor.setCurrentProgram(program);
+            }
+            else if (type == CaptureFormat::reset)
+            {
+                processor.reset();
+            }
+            else if (type == CaptureFormat::dropped)
+            {
+                uint32_t numLost = 0;
+
+                read(record, numLost);
+                stats.numDropped += numLost;
+            }
+            else if (type == CaptureFormat::timing)
+            {
+                double ms = 0.0;
+
+                read(record, ms);
+
+                if (index >= stats.sessionMs.size()) stats.sessionMs.resize((size_t) index + 1, -1.0);
+                stats.sessionMs[(size_t) index] = ms;
+            }
+            else if (type == CaptureFormat::block)
+            {
+                juce::int32 numSamples = 0, numChannels = 0, playing = 0, numChanged = 0, numEvents = 0;
+                double bpm = 0.0, ppq = 0.0;
+                bool pumpNeeded = false;
+
+                read(record, numSamples);
+                read(record, numChannels);
+                read(record, bpm);
+                read(record, ppq);
+                read(record, playing);
+                read(record, numChanged);
+
+                for (int i = 0; i < numChanged; i++)
+                {
+                    juce::int32 param = 0;
+                    float value = 0.f;
+
+                    read(record, param);
+                    read(record, value);
+
+                    juce::AudioProcessorParameter* target = juce::isPositiveAndBelow(param, (int) params.size()) ? params[(size_t) param] : nullptr;
+
+                    if (target == nullptr || target->getValue() == value) continue;
+
+                    target->setValueNotifyingHost(value);
+
+                    /* the non-automatable ones act through the state tree, which only catches up on the message thread */
+                    pumpNeeded = pumpNeeded || !target->isAutomatable();
+                }
+
+                if (pumpNeeded) pump(200);
+
+                midi.clear();
+                read(record, numEvents);
+
+                for (int i = 0; i < numEvents; i++)
+                {
+                    juce::int32 position = 0, numBytes = 0;
+
+                    read(record, position);
+                    read(record, numBytes);
+
+                    const int padded = (numBytes + 3) & ~3;
+                    juce::HeapBlock<juce::uint8> bytes((size_t) juce::jmax(4, padded), true);
+
+                    record.read(bytes.get(), padded);
+                    midi.addEvent(bytes.get(), numBytes, position);
+                }
+
+                buffer.setSize(juce::jmax(1, capture.numChannels), numSamples, false, false, true);
+                buffer.clear();
+
+                for (int ch = 0; ch < juce::jmin(numChannels, buffer.getNumChannels()); ch++)
+                    record.read(buffer.getWritePointer(ch), numSamples * (int) sizeof(float));
+
+                playHead.info.setBpm(bpm > 0.0 ? juce::Optional<double>(bpm) : juce::nullopt);
+                playHead.info.setPpqPosition(ppq);
+                playHead.info.setIsPlaying(playing != 0);
+
+                const juce::int64 start = juce::Time::getHighResolutionTicks();
+                processor.processBlock(buffer, midi);
+                const double ms = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start) * 1000.0;
+
+                if (index >= stats.replayMs.size()) stats.replayMs.resize((size_t) index + 1, -1.0);
+                stats.replayMs[(size_t) index] = ms;
+
+                stats.numBlocks++;
+                stats.numSamples += numSamples;
+
+                if (writer != nullptr) writer->writeFromAudioSampleBuffer(buffer, 0, numSamples);
+            }
+        }
+
+        processor.releaseResources();
+
+        return true;
+    }
+
+    double sum(const std::vector<double>& ms)
+    {
+        double total = 0.0;
+
+        for (const double t : ms)
+            total += juce::jmax(0.0, t);
+
+        return total;
+    }
+
+    void report(const PassStats_t& stats, const int pass, const int spikes)
+    {
+        const double audioMs = stats.sampleRate > 0.0 ? (double) stats.numSamples * 1000.0 / stats.sampleRate : 0.0;
+        const double replayTotal = sum(stats.replayMs);
+
+        std::vector<double> sorted;
+
+        for (const double t : stats.replayMs)
+            if (t >= 0.0) sorted.push_back(t);
+
+        std::sort(sorted.begin(), sorted.end());
+
+        const double p99 = sorted.empty() ? 0.0 : sorted[(sorted.size() * 99) / 100];
+        const double worst = sorted.empty() ? 0.0 : sorted.back();
+
+        std::cout << "pass " << pass << ": " << stats.numBlocks << " blocks, " << juce::String(audioMs / 1000.0, 2)
+                  << " s of audio in " << juce::String(replayTotal, 2) << " ms ("
+                  << juce::String(replayTotal > 0.0 ? audioMs / replayTotal : 0.0, 1) << "x realtime), per block mean "
+                  << juce::String(sorted.empty() ? 0.0 : replayTotal / (double) sorted.size(), 4) << " / p99 "
+                  << juce::String(p99, 4) << " / max " << juce::String(worst, 4) << " ms" << std::endl;
+
+        if (stats.numDropped > 0)
+            std::cout << "  " << stats.numDropped << " blocks were lost while capturing, output is only exact up to the first gap" << std::endl;
+
+        if (pass > 1 || spikes <= 0 || stats.sessionMs.empty()) return;
+
+        /* the blocks that hurt in the session, next to what they cost now */
+        std::vector<size_t> order;
+
+        for (size_t i = 0; i < stats.sessionMs.size(); i++)
+            if (stats.sessionMs[i] >= 0.0) order.push_back(i);
+
+        std::sort(order.begin(), order.end(), [&stats](const size_t a, const size_t b) { return stats.sessionMs[a] > stats.sessionMs[b]; });
+
+        std::cout << "  session total " << juce::String(sum(stats.sessionMs), 2) << " ms, slowest blocks (session / replay ms):" << std::endl;
+
+        for (size_t i = 0; i < juce::jmin(order.size(), (size_t) spikes); i++)
+        {
+            const size_t block = order[i];
+            const double replayed = block < stats.replayMs.size() ? stats.replayMs[block] : -1.0;
+
+            std::cout << "    #" << block << "  " << juce::String(stats.sessionMs[block], 4) << " / "
+                      << (replayed >= 0.0 ? juce::String(replayed, 4) : juce::String("-")) << std::endl;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI init;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.size() < 1 || args.containsOption("--help|-h"))
+    {
+        std::cout << "usage: Replay <capture.sdcap> [--repeat=N] [--out=render.wav] [--spikes=N]" << std::endl;
+        return args.size() < 1 ? 1 : 0;
+    }
+
+    const juce::File file = args[0].resolveAsFile();
+    const int repeat = juce::jmax(1, args.getValueForOption("--repeat").getIntValue());
+    const juce::String spikesOption = args.getValueForOption("--spikes");
+    const int spikes = spikesOption.isEmpty() ? 10 : spikesOption.getIntValue();
+
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+
+    if (args.containsOption("--out"))
+    {
+        juce::FileInputStream in(file);
+        Capture_t capture;
+        juce::String error;
+
+        if (!in.openedOk() || !readHeader(in, capture, error))
+        {
+            std::cerr << file.getFullPathName() << ": " << (error.isEmpty() ? "can't open" : error) << std::endl;
+            return 1;
+        }
+
+        const juce::File outFile = args.getFileForOption("--out");
+        outFile.deleteFile();
+
+        std::unique_ptr<juce::OutputStream> out(outFile.createOutputStream());
+
+        /* 32 bit float, so a difference between two renders is a real one */
+        if (out != nullptr)
+            writer.reset(juce::WavAudioFormat().createWriterFor(out.get(), capture.sampleRate, (unsigned int) capture.numChannels, 32, {}, 0));
+
+        if (writer == nullptr)
+        {
+            std::cerr << "can't write " << outFile.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        out.release();
+    }
+
+    for (int pass = 1; pass <= repeat; pass++)
+    {
+        PassStats_t stats;
+        juce::String error;
+
+        /* only the first pass gets rendered, the rest are there for the profiler */
+        const bool ok = replay(file, pass == 1 ? writer.get() : nullptr, stats, error);
+
+        if (!error.isEmpty()) std::cerr << file.getFullPathName() << ": " << error << std::endl;
+        if (!ok) return 1;
+
+        if (pass == 1) writer.reset();
+
+        report(stats, pass, spikes);
+    }
+
+    return 0;
+}
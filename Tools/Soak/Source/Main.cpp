@@ -0,0 +1,594 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 6:10:44pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+ #include <xmmintrin.h>
+#endif
+
+#include "../../../Core/Source/SubdominantCore.h"
+
+/*
+ * the engine left running for a simulated day or more, through everything a host and a broken plugin
+ * upstream can throw at it: blocks of 0 samples and up, random automation, stretches of digital
+ * silence and of input too quiet to be heard, NaN and inf in the input, sample rate and channel
+ * changes, transport jumps and resets. it runs as fast as the CPU allows, with flush-to-zero and
+ * denormals-are-zero off, the way a host that overrides ScopedNoDenormals leaves the thread
+ *
+ *   - every output sample has to be finite and none may be subnormal
+ *   - a twin engine gets the same input with the non-finite samples already zeroed: from the block
+ *     with the injection on the two have to give the same bits, so nothing outlives that block
+ *   - what age costs: at the end of every window of audio time the long-running engine and a fresh
+ *     one with the same settings are timed block for block on the same input, so the machine's load
+ *     and the parameters' own cost cancel out
+ *   - silent input against signal, window by window, which is where a denormal slow path shows up
+ *
+ *   Soak [--hours=24] [--window=minutes] [--seed=N] [--max-block=N] [--drift=ratio] [--no-twin] [--json=report.json]
+ *
+ * exits 1 if any check failed. build it as Release, the timings from a debug build mean nothing.
+ *
+ * what this doesn't cover: it runs the engine through the C library, so nothing that only the plugin's
+ * processor does is soaked. that's the halfband decimation at 176.4khz and up (DECIMATE HIGH RATES),
+ * the cab convolver and its swap crossfade, and the state crossfade for program switches, state
+ * restores and resets. Tools/RTCheck drives those for real time safety, for seconds rather than
+ * hours and without checking the output, and Core/Tests pins the halfband kernels' bits. a long run
+ * of those paths still needs a processor-level soak
+ */
+namespace
+{
+    typedef struct Settings_t
+    {
+    public:
+
+        double hours = 24.0;
+        double windowMinutes = 60.0;
+        uint64_t seed = 1;
+        int maxBlock = 1024;
+        double maxDrift = 1.5;
+        bool twin = true;
+        std::string json;
+
+    } Settings_t;
+
+    /* one window of audio time, everything the checks and the report need */
+    typedef struct Window_t
+    {
+    public:
+
+        double startHours = 0.0;
+        int64_t blocks = 0, emptyBlocks = 0, samples = 0;
+        int64_t silentSamples = 0, signalSamples = 0;
+        double nanos = 0.0, silentNanos = 0.0, signalNanos = 0.0, worstNanosPerSample = 0.0, age = 0.0;
+        int64_t injections = 0, nonFinite = 0, subnormal = 0, mismatches = 0, rateChanges = 0, resets = 0;
+
+        double nanosPerSample() const { return samples > 0 ? nanos / (double) samples : 0.0; }
+        double silentNanosPerSample() const { return silentSamples > 0 ? silentNanos / (double) silentSamples : 0.0; }
+        double signalNanosPerSample() const { return signalSamples > 0 ? signalNanos / (double) signalSamples : 0.0; }
+
+        /* the cost of silence against the cost of signal, 0 if there wasn't some of both */
+        double silenceRatio() const
+        {
+            return silentSamples > 0 && signalSamples > 0 && signalNanosPerSample() > 0.0 ? silentNanosPerSample() / signalNanosPerSample() : 0.0;
+        }
+
+    } Window_t;
+
+    /* a stretch of input: a plucked tone, noise, digital silence, or a tone far below anything audible */
+    typedef struct Segment_t
+    {
+    public:
+
+        enum Kind { tone = 0, noise, silence, whisper, numKinds };
+
+        Kind kind = silence;
+        int64_t samplesLeft = 0;
+        double phase = 0.0, increment = 0.0, level = 0.0, decay = 1.0, envelope = 0.0;
+
+    } Segment_t;
+
+    static constexpr int maxBlockSize = 8192;
+    static constexpr double sampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+
+    /* the host is expected to leave these on, the ones that don't are what this is about */
+    void disableFlushToZero()
+    {
+       #if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_setcsr(_mm_getcsr() & ~0x8040u);
+       #elif defined(__aarch64__) && !defined(_MSC_VER)
+        uint64_t fpcr;
+        asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+        asm volatile("msr fpcr, %0" : : "r"(fpcr & ~(uint64_t(1) << 24)));
+       #endif
+    }
+
+    class Soak
+    {
+    public:
+        explicit Soak(const Settings_t& soakSettings) : settings(soakSettings), random(soakSettings.seed)
+        {
+            for (int ch = 0; ch < 2; ch++)
+            {
+                in[ch].assign(maxBlockSize, 0.f);
+                clean[ch].assign(maxBlockSize, 0.f);
+                out[ch].assign(maxBlockSize, 0.f);
+                twinOut[ch].assign(maxBlockSize, 0.f);
+            }
+
+            for (int i = 0; i < sd_num_params(); i++)
+                params.push_back(sd_param_default(i));
+        }
+
+        ~Soak()
+        {
+            sd_destroy(engine);
+            sd_destroy(twin);
+        }
+
+        bool run()
+        {
+            const double totalSeconds = settings.hours * 3600.0;
+            const double windowSeconds = settings.windowMinutes * 60.0;
+
+            changeRate();
+            windows.emplace_back();
+
+            std::printf("%8s %10s %10s %10s %10s %8s %8s %8s %8s %8s %8s\n", "hours", "ns/sample", "worst", "silent", "signal",
+                        "age", "inject", "nonfin", "subnorm", "mismatch", "rates");
+
+            while (seconds < totalSeconds)
+            {
+                if (seconds >= nextRateChange) changeRate();
+
+                runBlock();
+
+                if (seconds >= (double) windows.size() * windowSeconds)
+                {
+                    windows.back().age = probeAge();
+                    printWindow(windows.back());
+                    windows.emplace_back();
+                    windows.back().startHours = seconds / 3600.0;
+                }
+            }
+
+            if (windows.back().blocks > 0)
+            {
+                windows.back().age = probeAge();
+                printWindow(windows.back());
+            }
+            else
+            {
+                windows.pop_back();
+            }
+
+            return summarise();
+        }
+
+        void writeJson(const std::string& path) const;
+
+    private:
+        int nextBlockSize()
+        {
+            const int pick = (int) (random() % 100);
+
+            if (pick < 5) return 0;
+            if (pick < 10) return 1;
+            if (pick < 12) return 1 + (int) (random() % maxBlockSize);
+
+            return 2 + (int) (random() % (uint64_t) std::max(1, settings.maxBlock - 1));
+        }
+
+        double uniform() { return (double) (random() >> 11) / 9007199254740992.0; }
+
+        /* a new rate, channel count and set of flags, the way a host prepares again: parameters carry over */
+        void changeRate()
+        {
+            sd_destroy(engine);
+            sd_destroy(twin);
+
+            sampleRate = sampleRates[random() % (sizeof(sampleRates) / sizeof(sampleRates[0]))];
+            numChannels = 1 + (int) (random() % 2);
+            flags = (int) (random() % 4);
+
+            engine = sd_create(sampleRate, flags);
+            twin = settings.twin ? sd_create(sampleRate, flags) : nullptr;
+
+            for (int i = 0; i < (int) params.size(); i++)
+                setParam(i, params[(size_t) i]);
+
+            setTransport(random() % 2 == 0);
+
+            nextRateChange = seconds + settings.windowMinutes * 60.0 * (0.25 + 0.75 * uniform());
+            windows.empty() ? void() : (void) windows.back().rateChanges++;
+        }
+
+        void setParam(const int index, const float value)
+        {
+            sd_set_param(engine, index, value);
+            if (twin != nullptr) sd_set_param(twin, index, value);
+
+            params[(size_t) index] = sd_get_param(engine, index);
+        }
+
+        void setTransport(const bool playing)
+        {
+            const double bpm = 60.0 + uniform() * 140.0;
+            const double ppq = uniform() * 10000.0;
+
+            sd_set_transport(engine, bpm, ppq, playing ? 1 : 0);
+            if (twin != nullptr) sd_set_transport(twin, bpm, ppq, playing ? 1 : 0);
+        }
+
+        void nextSegment()
+        {
+            segment.kind = (Segment_t::Kind) (random() % Segment_t::numKinds);
+            segment.samplesLeft = (int64_t) ((0.05 + uniform() * uniform() * 60.0) * sampleRate);
+            segment.increment = 2.0 * 3.141592653589793 * (30.0 + uniform() * 2000.0) / sampleRate;
+            segment.level = segment.kind == Segment_t::whisper ? std::pow(10.0, -(25.0 + uniform() * 15.0)) : 0.01 + uniform();
+            segment.decay = std::exp(-1.0 / ((0.05 + uniform()) * sampleRate));
+            segment.envelope = 1.0;
+        }
+
+        void fillInput(const int numSamples)
+        {
+            for (int i = 0; i < numSamples; i++)
+            {
+                if (segment.samplesLeft-- <= 0) nextSegment();
+
+                float x = 0.f;
+
+                switch (segment.kind)
+                {
+                    case Segment_t::tone:
+                    case Segment_t::whisper:
+                        x = (float) (segment.level * segment.envelope * std::sin(segment.phase));
+                        segment.phase = std::fmod(segment.phase + segment.increment, 2.0 * 3.141592653589793);
+                        segment.envelope = segment.kind == Segment_t::tone ? segment.envelope * segment.decay : 1.0;
+                        break;
+
+                    case Segment_t::noise:
+                        x = (float) (segment.level * (uniform() * 2.0 - 1.0));
+                        break;
+
+                    default:
+                        break;
+                }
+
+                in[0][(size_t) i] = x;
+                in[1][(size_t) i] = segment.kind == Segment_t::noise ? (float) (segment.level * (uniform() * 2.0 - 1.0)) : x;
+            }
+        }
+
+        /* a few NaNs and infs where a broken plugin upstream would put them, the twin gets zeros there */
+        bool inject(const int numSamples)
+        {
+            for (int ch = 0; ch < 2; ch++)
+                std::copy(in[ch].begin(), in[ch].begin() + numSamples, clean[ch].begin());
+
+            if (numSamples == 0 || random() % 500 != 0) return false;
+
+            static const float bad[] = { std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(),
+                                         -std::numeric_limits<float>::infinity() };
+
+            for (int n = 1 + (int) (random() % 4); n > 0; n--)
+            {
+                const int ch = (int) (random() % (uint64_t) numChannels);
+                const int pos = (int) (random() % (uint64_t) numSamples);
+
+                in[ch][(size_t) pos] = bad[random() % 3];
+                clean[ch][(size_t) pos] = 0.f;
+            }
+
+            return true;
+        }
+
+        void automate()
+        {
+            const int pick = (int) (random() % 1000);
+
+            if (pick < 200)
+            {
+                for (int n = 1 + (int) (random() % 3); n > 0; n--)
+                {
+                    const int index = (int) (random() % params.size());
+                    const float value = (float) (sd_param_min(index) + uniform() * (sd_param_max(index) - sd_param_min(index)));
+
+                    /* now and then a NaN from the host's side too, it has to come out as the default */
+                    setParam(index, random() % 1000 == 0 ? std::numeric_limits<float>::quiet_NaN() : value);
+                }
+            }
+            else if (pick < 201)
+            {
+                setTransport(random() % 2 == 0);
+            }
+            else if (pick == 201 && random() % 5 == 0)
+            {
+                sd_reset(engine);
+                if (twin != nullptr) sd_reset(twin);
+
+                windows.back().resets++;
+            }
+        }
+
+        void runBlock()
+        {
+            Window_t& window = windows.back();
+            const int numSamples = nextBlockSize();
+
+            automate();
+            fillInput(numSamples);
+
+            const bool injected = inject(numSamples);
+
+            bool silent = true;
+
+            for (int i = 0; i < numSamples && silent; i++)
+                silent = clean[0][(size_t) i] == 0.f && clean[1][(size_t) i] == 0.f;
+
+            const float* const inputs[2] = { in[0].data(), in[1].data() };
+            float* const outputs[2] = { out[0].data(), out[1].data() };
+
+            const auto start = std::chrono::steady_clock::now();
+            sd_process(engine, inputs, outputs, numChannels, numSamples);
+            const double nanos = (double) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+            window.blocks++;
+            window.emptyBlocks += numSamples == 0 ? 1 : 0;
+            window.samples += numSamples;
+            window.nanos += nanos;
+            window.injections += injected ? 1 : 0;
+
+            (silent ? window.silentSamples : window.signalSamples) += numSamples;
+            (silent ? window.silentNanos : window.signalNanos) += nanos;
+
+            /* short blocks are all call overhead, they'd only drown the figure out */
+            if (numSamples >= 64) window.worstNanosPerSample = std::max(window.worstNanosPerSample, nanos / numSamples);
+
+            for (int ch = 0; ch < numChannels; ch++)
+            {
+                for (int i = 0; i < numSamples; i++)
+                {
+                    const float y = out[ch][(size_t) i];
+
+                    window.nonFinite += std::isfinite(y) ? 0 : 1;
+                    window.subnormal += std::fpclassify(y) == FP_SUBNORMAL ? 1 : 0;
+                }
+            }
+
+            if (twin != nullptr)
+            {
+                const float* const cleanInputs[2] = { clean[0].data(), clean[1].data() };
+                float* const twinOutputs[2] = { twinOut[0].data(), twinOut[1].data() };
+
+                sd_process(twin, cleanInputs, twinOutputs, numChannels, numSamples);
+
+                for (int ch = 0; ch < numChannels; ch++)
+                    if (std::memcmp(out[ch].data(), twinOut[ch].data(), sizeof(float) * (size_t) numSamples) != 0)
+                        window.mismatches++;
+            }
+
+            seconds += numSamples / sampleRate;
+        }
+
+        /*
+         * the long-running engine against a fresh one with the same rate, flags and parameters, block
+         * for block on the same half second of tone, taking turns going first. the median of the
+         * per-block ratios, so a preempted block doesn't count. the twin goes through it too
+         */
+        double probeAge()
+        {
+            constexpr int blockSize = 256;
+
+            sd_engine* fresh = sd_create(sampleRate, flags);
+            std::vector<double> ratios;
+
+            for (int i = 0; i < (int) params.size(); i++)
+                sd_set_param(fresh, i, params[(size_t) i]);
+
+            const float* const inputs[2] = { clean[0].data(), clean[1].data() };
+            float* const outputs[2] = { out[0].data(), out[1].data() };
+            float* const twinOutputs[2] = { twinOut[0].data(), twinOut[1].data() };
+
+            auto time = [&](sd_engine* e, float* const* dest)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                sd_process(e, inputs, dest, numChannels, blockSize);
+                return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            };
+
+            for (int b = 0; b < (int) (sampleRate * 0.5) / blockSize; b++)
+            {
+                for (int i = 0; i < blockSize; i++)
+                    clean[0][(size_t) i] = clean[1][(size_t) i] = (float) (0.5 * std::sin((b * blockSize + i) * 0.0143));
+
+                if (twin != nullptr) sd_process(twin, inputs, twinOutputs, numChannels, blockSize);
+
+                const bool agedFirst = b % 2 == 0;
+                const double first = time(agedFirst ? engine : fresh, outputs);
+                const double second = time(agedFirst ? fresh : engine, outputs);
+
+                /* the first few are the fresh engine's cold start */
+                if (b >= 4) ratios.push_back(agedFirst ? first / second : second / first);
+            }
+
+            sd_destroy(fresh);
+
+            if (ratios.empty()) return 1.0;
+
+            std::nth_element(ratios.begin(), ratios.begin() + (std::ptrdiff_t) ratios.size() / 2, ratios.end());
+
+            return ratios[ratios.size() / 2];
+        }
+
+        void printWindow(const Window_t& w) const
+        {
+            std::printf("%8.2f %10.2f %10.2f %10.2f %10.2f %8.3f %8lld %8lld %8lld %8lld %8lld\n", w.startHours, w.nanosPerSample(),
+                        w.worstNanosPerSample, w.silentNanosPerSample(), w.signalNanosPerSample(), w.age, (long long) w.injections,
+                        (long long) w.nonFinite, (long long) w.subnormal, (long long) w.mismatches, (long long) w.rateChanges);
+            std::fflush(stdout);
+        }
+
+        bool summarise()
+        {
+            Window_t total;
+
+            for (const Window_t& w : windows)
+            {
+                total.blocks += w.blocks;
+                total.emptyBlocks += w.emptyBlocks;
+                total.samples += w.samples;
+                total.injections += w.injections;
+                total.nonFinite += w.nonFinite;
+                total.subnormal += w.subnormal;
+                total.mismatches += w.mismatches;
+                total.rateChanges += w.rateChanges;
+                total.resets += w.resets;
+            }
+
+            for (const Window_t& w : windows)
+            {
+                drift = std::max(drift, w.age);
+                silenceRatio = std::max(silenceRatio, w.silenceRatio());
+            }
+
+            checks.push_back({ "finite output", total.nonFinite == 0 });
+            checks.push_back({ "no subnormal output", total.subnormal == 0 });
+            checks.push_back({ "recovers from non-finite input within the block", !settings.twin || total.mismatches == 0 });
+            checks.push_back({ "silence costs no more than twice signal", silenceRatio <= 2.0 });
+            checks.push_back({ "no slower than a fresh engine after all that", drift <= settings.maxDrift });
+
+            std::printf("\n%.2f hours of audio, %lld blocks (%lld empty), %lld injections, %lld rate changes, %lld resets\n",
+                        seconds / 3600.0, (long long) total.blocks, (long long) total.emptyBlocks, (long long) total.injections,
+                        (long long) total.rateChanges, (long long) total.resets);
+            std::printf("worst aged against fresh: %.3fx, worst silent against signal: %.3fx\n\n", drift, silenceRatio);
+
+            bool ok = true;
+
+            for (const Check_t& check : checks)
+            {
+                std::printf("%s  %s\n", check.passed ? "ok  " : "FAIL", check.name);
+                ok = ok && check.passed;
+            }
+
+            return ok;
+        }
+
+        typedef struct Check_t
+        {
+        public:
+
+            const char* name;
+            bool passed;
+
+        } Check_t;
+
+        const Settings_t& settings;
+        std::mt19937_64 random;
+
+        sd_engine* engine = nullptr;
+        sd_engine* twin = nullptr;
+
+        double sampleRate = 48000.0;
+        int numChannels = 2, flags = 0;
+        double seconds = 0.0, nextRateChange = 0.0;
+
+        std::vector<float> params;
+        std::vector<float> in[2], clean[2], out[2], twinOut[2];
+        Segment_t segment;
+
+        std::vector<Window_t> windows;
+        std::vector<Check_t> checks;
+        double drift = 1.0, silenceRatio = 0.0;
+    };
+
+    void Soak::writeJson(const std::string& path) const
+    {
+        FILE* file = std::fopen(path.c_str(), "w");
+
+        if (file == nullptr)
+        {
+            std::fprintf(stderr, "can't write %s\n", path.c_str());
+            return;
+        }
+
+        std::fprintf(file, "{\n  \"hours\": %g,\n  \"seed\": %llu,\n  \"twin\": %s,\n  \"drift\": %g,\n  \"silenceRatio\": %g,\n  \"checks\": {",
+                     seconds / 3600.0, (unsigned long long) settings.seed, settings.twin ? "true" : "false", drift, silenceRatio);
+
+        for (size_t i = 0; i < checks.size(); i++)
+            std::fprintf(file, "%s\n    \"%s\": %s", i > 0 ? "," : "", checks[i].name, checks[i].passed ? "true" : "false");
+
+        std::fprintf(file, "\n  },\n  \"windows\": [");
+
+        for (size_t i = 0; i < windows.size(); i++)
+        {
+            const Window_t& w = windows[i];
+
+            std::fprintf(file, "%s\n    { \"startHours\": %g, \"blocks\": %lld, \"emptyBlocks\": %lld, \"samples\": %lld, "
+                               "\"nanosPerSample\": %g, \"worstNanosPerSample\": %g, \"silentNanosPerSample\": %g, \"signalNanosPerSample\": %g, \"age\": %g, "
+                               "\"injections\": %lld, \"nonFinite\": %lld, \"subnormal\": %lld, \"mismatches\": %lld, \"rateChanges\": %lld, \"resets\": %lld }",
+                         i > 0 ? "," : "", w.startHours, (long long) w.blocks, (long long) w.emptyBlocks, (long long) w.samples, w.nanosPerSample(),
+                         w.worstNanosPerSample, w.silentNanosPerSample(), w.signalNanosPerSample(), w.age, (long long) w.injections,
+                         (long long) w.nonFinite, (long long) w.subnormal, (long long) w.mismatches, (long long) w.rateChanges, (long long) w.resets);
+        }
+
+        std::fprintf(file, "\n  ]\n}\n");
+        std::fclose(file);
+    }
+
+    /* "--name=value", nullptr if arg isn't that option */
+    const char* optionValue(const char* arg, const char* name)
+    {
+        const size_t length = std::strlen(name);
+
+        return std::strncmp(arg, name, length) == 0 && arg[length] == '=' ? arg + length + 1 : nullptr;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Settings_t settings;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* value = nullptr;
+
+        if ((value = optionValue(argv[i], "--hours")) != nullptr) settings.hours = std::max(0.001, std::atof(value));
+        else if ((value = optionValue(argv[i], "--window")) != nullptr) settings.windowMinutes = std::max(0.01, std::atof(value));
+        else if ((value = optionValue(argv[i], "--seed")) != nullptr) settings.seed = std::strtoull(value, nullptr, 10);
+        else if ((value = optionValue(argv[i], "--max-block")) != nullptr) settings.maxBlock = std::clamp(std::atoi(value), 2, maxBlockSize);
+        else if ((value = optionValue(argv[i], "--drift")) != nullptr) settings.maxDrift = std::max(1.0, std::atof(value));
+        else if ((value = optionValue(argv[i], "--json")) != nullptr) settings.json = value;
+        else if (std::strcmp(argv[i], "--no-twin") == 0) settings.twin = false;
+        else
+        {
+            std::printf("usage: Soak [--hours=24] [--window=minutes] [--seed=N] [--max-block=N] [--drift=ratio] [--no-twin] [--json=report.json]\n");
+            return std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0 ? 0 : 1;
+        }
+    }
+
+    disableFlushToZero();
+
+    Soak soak(settings);
+    const bool ok = soak.run();
+
+    if (!settings.json.empty()) soak.writeJson(settings.json);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,548 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 19 Oct 2026 11:52:36pm
+    Author:  _astriid_
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../../../Source/PluginProcessor.h"
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+/*
+ * renders one input through every combination of a set of parameter values, for building sample
+ * packs. the input is decoded once and read by every worker, each worker owns one processor for
+ * the whole run and prepares it again between renders, which resets every state and delay line
+ * without building anything: the coefficient tables and program states only depend on the rate
+ *
+ *   Sweep <input> --param="ID=spec" [--param=...] [--random=N] [--seed=N] [--out=folder]
+ *         [--threads=N] [--block=N] [--tail=seconds] [--bits=16|24|32]
+ *
+ * spec is a value, a list ("0,0.25,1"), min:max:steps, or min:max for --random to pick from
+ * anywhere in between. values are plain, as the plugin shows them. a grid renders every
+ * combination, --random=N draws N of them. settings that aren't automatable (lookahead,
+ * decimation, deterministic render) can only be fixed for the whole sweep. one file per render
+ * goes to the out folder, latency compensated, along with manifest.json listing what's in each
+ */
+namespace
+{
+    typedef struct Axis_t
+    {
+    public:
+
+        juce::String id;
+
+        /* into getParameters(), the same for every instance */
+        int paramIndex = -1;
+        bool automatable = true;
+
+        /* the values to pick from, or a range to draw from with --random */
+        std::vector<float> values;
+        bool continuous = false;
+        float min = 0.f, max = 0.f;
+
+    } Axis_t;
+
+    typedef struct Job_t
+    {
+    public:
+
+        /* plain values, one per swept axis, already snapped to what the parameter can hold */
+        std::vector<float> values;
+        juce::File file;
+        bool ok = false;
+
+    } Job_t;
+
+    typedef struct Settings_t
+    {
+    public:
+
+        double sampleRate = 0.0;
+        int numChannels = 0, blockSize = 512, bitDepth = 24;
+        juce::int64 tailSamples = 0;
+
+    } Settings_t;
+
+    void pump(const int ms)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(ms);
+    }
+
+    juce::RangedAudioParameter* getParameter(juce::AudioProcessor& processor, const int index)
+    {
+        return dynamic_cast<juce::RangedAudioParameter*>(processor.getParameters()[index]);
+    }
+
+    float snap(const juce::RangedAudioParameter* param, const float value)
+    {
+        const juce::NormalisableRange<float>& range = param->getNormalisableRange();
+
+        return range.snapToLegalValue(juce::jlimit(range.start, range.end, value));
+    }
+
+    bool parseAxis(const juce::String& text, juce::AudioProcessor& processor, Axis_t& axis, juce::String& error)
+    {
+        axis.id = text.upToFirstOccurrenceOf("=", false, false).trim();
+
+        const juce::String spec = text.fromFirstOccurrenceOf("=", false, false).trim();
+
+        for (int i = 0; i < processor.getParameters().size(); i++)
+        {
+            const juce::RangedAudioParameter* param = getParameter(processor, i);
+
+            if (param != nullptr && param->getParameterID() == axis.id)
+            {
+                axis.paramIndex = i;
+                axis.automatable = param->isAutomatable();
+            }
+        }
+
+        if (axis.paramIndex < 0 || axis.id == "SESSION CAPTURE")
+        {
+            error = "no parameter \"" + axis.id + "\" to sweep";
+            return false;
+        }
+
+        if (spec.isEmpty())
+        {
+            error = axis.id + ": no values";
+            return false;
+        }
+
+        const juce::RangedAudioParameter* param = getParameter(processor, axis.paramIndex);
+
+        if (spec.containsChar(':'))
+        {
+            juce::StringArray tokens = juce::StringArray::fromTokens(spec, ":", "");
+
+            axis.min = tokens[0].getFloatValue();
+            axis.max = tokens[1].getFloatValue();
+
+            if (tokens.size() < 3)
+            {
+                axis.continuous = true;
+            }
+            else
+            {
+                const int steps = juce::jmax(1, tokens[2].getIntValue());
+
+                for (int i = 0; i < steps; i++)
+                    axis.values.push_back(snap(param, steps > 1 ? axis.min + (axis.max - axis.min) * (float) i / (float) (steps - 1)
+                                                                 : axis.min));
+            }
+        }
+        else
+        {
+            for (const juce::String& token : juce::StringArray::fromTokens(spec, ",", ""))
+                axis.values.push_back(snap(param, token.trim().getFloatValue()));
+        }
+
+        /* the rest of the plugin's settings are read when the state is restored, not per block */
+        if (!axis.automatable && (axis.continuous || axis.values.size() != 1))
+        {
+            error = axis.id + " isn't automatable, it can only be fixed for the whole sweep";
+            return false;
+        }
+
+        return true;
+    }
+
+    /* every combination, the first axis changing slowest */
+    bool buildGrid(const std::vector<Axis_t>& axes, std::vector<Job_t>& jobs, juce::String& error)
+    {
+        juce::int64 count = 1;
+
+        for (const Axis_t& axis : axes)
+        {
+            if (axis.continuous)
+            {
+                error = axis.id + ": a grid needs min:max:steps or a list, min:max is only for --random";
+                return false;
+            }
+
+            count *= (juce::int64) axis.values.size();
+
+            if (count > 1000000)
+            {
+                error = "over a million combinations, use --random to draw from them";
+                return false;
+            }
+        }
+
+        jobs.resize((size_t) count);
+
+        for (juce::int64 i = 0; i < count; i++)
+        {
+            juce::int64 rest = i;
+
+            jobs[(size_t) i].values.resize(axes.size());
+
+            for (size_t a = axes.size(); a-- > 0;)
+            {
+                const juce::int64 size = (juce::int64) axes[a].values.size();
+
+                jobs[(size_t) i].values[a] = axes[a].values[(size_t) (rest % size)];
+                rest /= size;
+            }
+        }
+
+        return true;
+    }
+
+    /* drawn up front from one seed, so the same command gives the same set whatever the thread count */
+    void buildRandom(const std::vector<Axis_t>& axes, juce::AudioProcessor& processor, const int count, const juce::int64 seed,
+                     std::vector<Job_t>& jobs)
+    {
+        juce::Random random(seed);
+
+        jobs.resize((size_t) count);
+
+        for (Job_t& job : jobs)
+        {
+            job.values.resize(axes.size());
+
+            for (size_t a = 0; a < axes.size(); a++)
+            {
+                const Axis_t& axis = axes[a];
+
+                job.values[a] = axis.continuous ? snap(getParameter(processor, axis.paramIndex),
+                                                       axis.min + (axis.max - axis.min) * random.nextFloat())
+                                                : axis.values[(size_t) random.nextInt((int) axis.values.size())];
+            }
+        }
+    }
+
+    class SweepWorker : public juce::Thread
+    {
+    public:
+        SweepWorker(const juce::AudioBuffer<float>& sharedInput, const Settings_t& sweepSettings, const std::vector<Axis_t>& sweepAxes,
+                    std::vector<Job_t>& sweepJobs, std::atomic<int>& nextJob, std::atomic<int>& jobsDone)
+            : juce::Thread("Sweep"), input(sharedInput), settings(sweepSettings), axes(sweepAxes), jobs(sweepJobs), next(nextJob),
+              done(jobsDone), plugin(createPluginFilter())
+        {
+            plugin->setPlayConfigDetails(settings.numChannels, settings.numChannels, settings.sampleRate, settings.blockSize);
+        }
+
+        ~SweepWorker() override
+        {
+            stopThread(-1);
+        }
+
+        juce::AudioProcessor& getProcessor() { return *plugin; }
+
+        void run() override
+        {
+            juce::AudioBuffer<float> buffer(settings.numChannels, settings.blockSize);
+            juce::MidiBuffer midi;
+
+            for (int i = next.fetch_add(1); i < (int) jobs.size() && !threadShouldExit(); i = next.fetch_add(1))
+            {
+                jobs[(size_t) i].ok = render(jobs[(size_t) i], buffer, midi);
+                done.fetch_add(1);
+            }
+
+            plugin->releaseResources();
+        }
+
+    private:
+        bool render(const Job_t& job, juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+        {
+            for (size_t a = 0; a < axes.size(); a++)
+            {
+                if (!axes[a].automatable) continue;
+
+                juce::RangedAudioParameter* param = getParameter(*plugin, axes[a].paramIndex);
+
+                param->setValueNotifyingHost(param->convertTo0to1(job.values[a]));
+            }
+
+            /* same rate and block size every time, so this only clears states and delay lines */
+            plugin->prepareToPlay(settings.sampleRate, settings.blockSize);
+
+            const juce::int64 latency = plugin->getLatencySamples();
+            const juce::int64 numInput = input.getNumSamples();
+            const juce::int64 total = numInput + settings.tailSamples + latency;
+
+            job.file.deleteFile();
+
+            std::unique_ptr<juce::OutputStream> out(job.file.createOutputStream());
+            std::unique_ptr<juce::AudioFormatWriter> writer;
+
+            if (out != nullptr)
+                writer.reset(juce::WavAudioFormat().createWriterFor(out.get(), settings.sampleRate, (unsigned int) settings.numChannels,
+                                                                    settings.bitDepth, {}, 0));
+
+            if (writer == nullptr) return false;
+
+            out.release();
+
+            for (juce::int64 pos = 0; pos < total && !threadShouldExit(); pos += settings.blockSize)
+            {
+                const int numSamples = (int) juce::jmin((juce::int64) settings.blockSize, total - pos);
+                const int numFromInput = (int) juce::jlimit((juce::int64) 0, (juce::int64) numSamples, numInput - pos);
+
+                buffer.setSize(settings.numChannels, numSamples, false, false, true);
+                buffer.clear();
+
+                for (int ch = 0; ch < settings.numChannels && numFromInput > 0; ch++)
+                    buffer.copyFrom(ch, 0, input, ch, (int) pos, numFromInput);
+
+                midi.clear();
+                plugin->processBlock(buffer, midi);
+
+                /* the first latency samples are the processor filling up, the file starts where the input does */
+                const int skip = (int) juce::jlimit((juce::int64) 0, (juce::int64) numSamples, latency - pos);
+
+                if (skip < numSamples && !writer->writeFromAudioSampleBuffer(buffer, skip, numSamples - skip)) return false;
+            }
+
+            return !threadShouldExit();
+        }
+
+        const juce::AudioBuffer<float>& input;
+        const Settings_t& settings;
+        const std::vector<Axis_t>& axes;
+        std::vector<Job_t>& jobs;
+        std::atomic<int>& next;
+        std::atomic<int>& done;
+
+        std::unique_ptr<juce::AudioProcessor> plugin;
+
+        JUCE_DECLARE_NON_COPYABLE (SweepWorker)
+    };
+
+    void writeManifest(const juce::File& folder, const juce::File& inputFile, const Settings_t& settings, const std::vector<Axis_t>& axes,
+                       const std::vector<Job_t>& jobs, const int latency, const juce::var& random)
+    {
+        juce::DynamicObject::Ptr manifest = new juce::DynamicObject();
+        juce::DynamicObject::Ptr fixed = new juce::DynamicObject();
+        juce::Array<juce::var> swept, renders;
+
+        manifest->setProperty("input", inputFile.getFullPathName());
+        manifest->setProperty("sampleRate", settings.sampleRate);
+        manifest->setProperty("numChannels", settings.numChannels);
+        manifest->setProperty("bitDepth", settings.bitDepth);
+        manifest->setProperty("blockSize", settings.blockSize);
+        manifest->setProperty("tailSamples", settings.tailSamples);
+        manifest->setProperty("latencyCompensated", latency);
+        manifest->setProperty("random", random);
+
+        /* a single value is the same in every render, it only needs saying once */
+        for (const Axis_t& axis : axes)
+        {
+            if (!axis.continuous && axis.values.size() == 1)
+                fixed->setProperty(axis.id, axis.values[0]);
+            else
+                swept.add(axis.id);
+        }
+
+        manifest->setProperty("fixed", juce::var(fixed.get()));
+        manifest->setProperty("swept", swept);
+
+        for (const Job_t& job : jobs)
+        {
+            juce::DynamicObject::Ptr render = new juce::DynamicObject();
+            juce::DynamicObject::Ptr values = new juce::DynamicObject();
+
+            for (size_t a = 0; a < axes.size(); a++)
+                if (axes[a].continuous || axes[a].values.size() > 1) values->setProperty(axes[a].id, job.values[a]);
+
+            render->setProperty("file", job.file.getFileName());
+            render->setProperty("values", juce::var(values.get()));
+
+            if (!job.ok) render->setProperty("failed", true);
+
+            renders.add(juce::var(render.get()));
+        }
+
+        manifest->setProperty("renders", renders);
+
+        folder.getChildFile("manifest.json").replaceWithText(juce::JSON::toString(juce::var(manifest.get())));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI init;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.size() < 1 || args.containsOption("--help|-h"))
+    {
+        std::cout << "usage: Sweep <input> --param=\"ID=spec\" [--param=...] [--random=N] [--seed=N] [--out=folder]" << std::endl
+                  << "             [--threads=N] [--block=N] [--tail=seconds] [--bits=16|24|32]" << std::endl
+                  << "spec: value | a,b,c | min:max:steps | min:max (--random only)" << std::endl;
+        return args.size() < 1 ? 1 : 0;
+    }
+
+    const juce::File inputFile = args[0].resolveAsFile();
+
+    /* decoded once up front, every worker reads the same buffer and nothing writes to it again */
+    juce::AudioBuffer<float> input;
+    Settings_t settings;
+
+    {
+        juce::AudioFormatManager formats;
+        formats.registerBasicFormats();
+
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(inputFile));
+
+        if (reader == nullptr || reader->lengthInSamples <= 0 || reader->lengthInSamples > std::numeric_limits<int>::max())
+        {
+            std::cerr << inputFile.getFullPathName() << ": can't read it as audio" << std::endl;
+            return 1;
+        }
+
+        settings.sampleRate = reader->sampleRate;
+        settings.numChannels = (int) juce::jlimit(1u, 2u, reader->numChannels);
+
+        input.setSize(settings.numChannels, (int) reader->lengthInSamples);
+        reader->read(&input, 0, (int) reader->lengthInSamples, 0, true, settings.numChannels > 1);
+    }
+
+    settings.blockSize = juce::jlimit(32, 8192, args.containsOption("--block") ? args.getValueForOption("--block").getIntValue() : 512);
+    settings.tailSamples = juce::roundToInt(juce::jmax(0.0, args.containsOption("--tail") ? args.getValueForOption("--tail").getDoubleValue() : 1.0)
+                                            * settings.sampleRate);
+    settings.bitDepth = args.containsOption("--bits") ? args.getValueForOption("--bits").getIntValue() : 24;
+
+    if (settings.bitDepth != 16 && settings.bitDepth != 24 && settings.bitDepth != 32)
+    {
+        std::cerr << "--bits takes 16, 24 or 32" << std::endl;
+        return 1;
+    }
+
+    const int numThreads = juce::jmax(1, args.containsOption("--threads") ? args.getValueForOption("--threads").getIntValue()
+                                                                          : juce::SystemStats::getNumCpus());
+    const int numRandom = args.getValueForOption("--random").getIntValue();
+    const juce::int64 seed = args.containsOption("--seed") ? args.getValueForOption("--seed").getLargeIntValue() : 1;
+
+    const juce::File folder = args.containsOption("--out") ? args.getFileForOption("--out")
+                                                           : inputFile.getSiblingFile(inputFile.getFileNameWithoutExtension() + " sweep");
+
+    if (!folder.createDirectory())
+    {
+        std::cerr << "can't create " << folder.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    std::vector<Job_t> jobs;
+    std::vector<Axis_t> axes;
+    std::atomic<int> next { 0 }, done { 0 };
+
+    /* the workers are made here, processors belong to the message thread until the workers start */
+    std::vector<std::unique_ptr<SweepWorker>> workers;
+
+    for (int i = 0; i < numThreads; i++)
+        workers.push_back(std::make_unique<SweepWorker>(input, settings, axes, jobs, next, done));
+
+    juce::AudioProcessor& first = workers[0]->getProcessor();
+
+    /* getValueForOption() only finds the first one */
+    for (const juce::ArgumentList::Argument& arg : args.arguments)
+    {
+        if (!arg.isLongOption("param")) continue;
+
+        Axis_t axis;
+        juce::String error;
+
+        if (!parseAxis(arg.getLongOptionValue(), first, axis, error))
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+
+        axes.push_back(axis);
+    }
+
+    if (axes.empty())
+    {
+        std::cerr << "nothing to sweep, add a --param=\"ID=spec\"" << std::endl;
+        return 1;
+    }
+
+    if (numRandom > 0)
+    {
+        buildRandom(axes, first, numRandom, seed, jobs);
+    }
+    else
+    {
+        juce::String error;
+
+        if (!buildGrid(axes, jobs, error))
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+    }
+
+    const int digits = juce::String((int) jobs.size()).length();
+
+    for (size_t i = 0; i < jobs.size(); i++)
+        jobs[i].file = folder.getChildFile(inputFile.getFileNameWithoutExtension() + "_" + juce::String((int) i + 1).paddedLeft('0', digits) + ".wav");
+
+    /* the fixed settings the processor only picks up through its state, set once on the message thread */
+    for (const std::unique_ptr<SweepWorker>& worker : workers)
+        for (const Axis_t& axis : axes)
+            if (!axis.automatable)
+                getParameter(worker->getProcessor(), axis.paramIndex)->setValueNotifyingHost(
+                    getParameter(worker->getProcessor(), axis.paramIndex)->convertTo0to1(axis.values[0]));
+
+    pump(200);
+
+    std::cout << jobs.size() << " renders of " << inputFile.getFileName() << " on " << workers.size() << " threads into "
+              << folder.getFullPathName() << std::endl;
+
+    const juce::int64 start = juce::Time::getHighResolutionTicks();
+
+    for (const std::unique_ptr<SweepWorker>& worker : workers)
+        worker->startThread();
+
+    /* the processors still post to the message thread now and then, it keeps running until the last render is in */
+    for (int reported = 0; done.load() < (int) jobs.size();)
+    {
+        pump(100);
+
+        if (done.load() / 50 > reported / 50 || done.load() == (int) jobs.size())
+        {
+            reported = done.load();
+            std::cout << "  " << reported << " / " << jobs.size() << std::endl;
+        }
+    }
+
+    const double seconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    const int latency = first.getLatencySamples();
+
+    workers.clear();
+
+    juce::var random;
+
+    if (numRandom > 0)
+    {
+        juce::DynamicObject::Ptr info = new juce::DynamicObject();
+
+        info->setProperty("count", numRandom);
+        info->setProperty("seed", seed);
+
+        random = juce::var(info.get());
+    }
+
+    writeManifest(folder, inputFile, settings, axes, jobs, latency, random);
+
+    const int failed = (int) std::count_if(jobs.begin(), jobs.end(), [](const Job_t& job) { return !job.ok; });
+    const double audioSeconds = (double) jobs.size() * (double) (input.getNumSamples() + settings.tailSamples) / settings.sampleRate;
+
+    std::cout << juce::String(audioSeconds, 1) << " s of audio in " << juce::String(seconds, 2) << " s ("
+              << juce::String(seconds > 0.0 ? audioSeconds / seconds : 0.0, 1) << "x realtime)" << std::endl;
+
+    if (failed > 0)
+    {
+        std::cerr << failed << " renders couldn't be written, they're marked in manifest.json" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}